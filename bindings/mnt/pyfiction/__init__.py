@@ -56,6 +56,7 @@ from .pyfiction import (  # type: ignore[import-not-found]
     cartesian_layout,
     cartesian_obstruction_layout,
     charge_configuration_to_string,
+    charge_distribution_history,
     charge_distribution_mode,
     charge_distribution_surface,
     charge_distribution_surface_100,
@@ -133,6 +134,7 @@ from .pyfiction import (  # type: ignore[import-not-found]
     displacement_robustness_domain_111,
     displacement_robustness_domain_params,
     displacement_robustness_domain_stats,
+    domain_storage,
     dynamic_truth_table,
     energy_calculation,
     energy_distribution,
@@ -153,6 +155,9 @@ from .pyfiction import (  # type: ignore[import-not-found]
     fanout_substitution,
     fanout_substitution_params,
     # Inout
+    fbl_layout_info,
+    fbl_parsing_error,
+    fbl_write_error,
     fgl_parsing_error,
     ## verfication
     gate_level_drv_params,
@@ -250,10 +255,19 @@ from .pyfiction import (  # type: ignore[import-not-found]
     quicksim,
     quicksim_params,
     random_coordinate,
+    read_cartesian_fbl_layout,
     read_cartesian_fgl_layout,
+    read_fbl_layout_info,
     read_fqca_layout,
+    read_hexagonal_fbl_layout,
     read_hexagonal_fgl_layout,
+    read_inml_fbl_layout,
+    read_qca_fbl_layout,
+    read_shifted_cartesian_fbl_layout,
     read_shifted_cartesian_fgl_layout,
+    read_sidb_100_fbl_layout,
+    read_sidb_111_fbl_layout,
+    read_sidb_fbl_layout,
     read_sqd_layout_100,
     read_sqd_layout_111,
     read_technology_network,
@@ -277,6 +291,7 @@ from .pyfiction import (  # type: ignore[import-not-found]
     sidb_nm_position,
     sidb_simulation_engine,
     sidb_simulation_engine_name,
+    sidb_simulation_domain_stream_params,
     sidb_simulation_parameters,
     sidb_simulation_result_100,
     sidb_simulation_result_111,
@@ -289,6 +304,7 @@ from .pyfiction import (  # type: ignore[import-not-found]
     siqad_volume,
     sqd_parsing_error,
     squared_euclidean_distance,
+    stream_format,
     ## network_transformation
     substitution_strategy,
     sweep_parameter,
@@ -320,6 +336,7 @@ from .pyfiction import (  # type: ignore[import-not-found]
     write_critical_temperature_domain_to_string,
     write_dot_layout,
     write_dot_network,
+    write_fbl_layout,
     write_fgl_layout,
     write_fqca_layout,
     write_fqca_layout_params,
@@ -378,6 +395,7 @@ __all__ = [
     "cartesian_layout",
     "cartesian_obstruction_layout",
     "charge_configuration_to_string",
+    "charge_distribution_history",
     "charge_distribution_mode",
     "charge_distribution_surface",
     "charge_distribution_surface_100",
@@ -455,6 +473,7 @@ __all__ = [
     "displacement_robustness_domain_111",
     "displacement_robustness_domain_params",
     "displacement_robustness_domain_stats",
+    "domain_storage",
     "dynamic_truth_table",
     "energy_calculation",
     "energy_distribution",
@@ -475,6 +494,9 @@ __all__ = [
     "fanout_substitution",
     "fanout_substitution_params",
     # Inout
+    "fbl_layout_info",
+    "fbl_parsing_error",
+    "fbl_write_error",
     "fgl_parsing_error",
     ## verfication
     "gate_level_drv_params",
@@ -572,10 +594,19 @@ __all__ = [
     "quicksim",
     "quicksim_params",
     "random_coordinate",
+    "read_cartesian_fbl_layout",
     "read_cartesian_fgl_layout",
+    "read_fbl_layout_info",
     "read_fqca_layout",
+    "read_hexagonal_fbl_layout",
     "read_hexagonal_fgl_layout",
+    "read_inml_fbl_layout",
+    "read_qca_fbl_layout",
+    "read_shifted_cartesian_fbl_layout",
     "read_shifted_cartesian_fgl_layout",
+    "read_sidb_100_fbl_layout",
+    "read_sidb_111_fbl_layout",
+    "read_sidb_fbl_layout",
     "read_sqd_layout_100",
     "read_sqd_layout_111",
     "read_technology_network",
@@ -599,6 +630,7 @@ __all__ = [
     "sidb_nm_position",
     "sidb_simulation_engine",
     "sidb_simulation_engine_name",
+    "sidb_simulation_domain_stream_params",
     "sidb_simulation_parameters",
     "sidb_simulation_result_100",
     "sidb_simulation_result_111",
@@ -611,6 +643,7 @@ __all__ = [
     "siqad_volume",
     "sqd_parsing_error",
     "squared_euclidean_distance",
+    "stream_format",
     ## network_transformation
     "substitution_strategy",
     "sweep_parameter",
@@ -642,6 +675,7 @@ __all__ = [
     "write_critical_temperature_domain_to_string",
     "write_dot_layout",
     "write_dot_network",
+    "write_fbl_layout",
     "write_fgl_layout",
     "write_fqca_layout",
     "write_fqca_layout_params",
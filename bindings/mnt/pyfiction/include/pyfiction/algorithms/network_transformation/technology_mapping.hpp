@@ -26,7 +26,7 @@ void technology_mapping(pybind11::module& m)
 
     m.def("technology_mapping", &fiction::technology_mapping<Ntk>, py::arg("network"),
           py::arg("params") = fiction::technology_mapping_params{}, py::arg("stats") = nullptr,
-          DOC(fiction_technology_mapping));
+          py::call_guard<py::gil_scoped_release>(), DOC(fiction_technology_mapping));
 }
 
 }  // namespace detail
@@ -37,10 +37,10 @@ void a_star(pybind11::module& m)
                                                                            fiction::unit_cost_functor<Lyt>(), params));
         },
         py::arg("layout"), py::arg("source"), py::arg("target"), py::arg("params") = fiction::a_star_params{},
-        DOC(fiction_a_star));
+        py::call_guard<py::gil_scoped_release>(), DOC(fiction_a_star));
 
     m.def("a_star_distance", &fiction::a_star_distance<Lyt, double>, py::arg("layout"), py::arg("source"),
-          py::arg("target"), DOC(fiction_a_star_distance));
+          py::arg("target"), py::call_guard<py::gil_scoped_release>(), DOC(fiction_a_star_distance));
 }
 
 }  // namespace detail
@@ -47,7 +47,8 @@ void enumerate_all_paths(pybind11::module& m)
             return paths;
         },
         py::arg("layout"), py::arg("source"), py::arg("target"),
-        py::arg("params") = fiction::enumerate_all_paths_params{}, DOC(fiction_enumerate_all_paths));
+        py::arg("params") = fiction::enumerate_all_paths_params{}, py::call_guard<py::gil_scoped_release>(),
+        DOC(fiction_enumerate_all_paths));
 }
 
 }  // namespace detail
@@ -48,7 +48,8 @@ void yen_k_shortest_paths(pybind11::module& m)
             return paths;
         },
         py::arg("layout"), py::arg("source"), py::arg("target"), py::arg("k"),
-        py::arg("params") = fiction::yen_k_shortest_paths_params{}, DOC(fiction_yen_k_shortest_paths));
+        py::arg("params") = fiction::yen_k_shortest_paths_params{}, py::call_guard<py::gil_scoped_release>(),
+        DOC(fiction_yen_k_shortest_paths));
 }
 
 }  // namespace detail
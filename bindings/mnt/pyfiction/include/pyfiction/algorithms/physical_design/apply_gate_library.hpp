@@ -36,7 +36,7 @@ void apply_fcn_gate_library(pybind11::module& m, const std::string& lib_name)
 
     m.def(fmt::format("apply_{}_library", lib_name).c_str(),
           &fiction::apply_gate_library<py_cartesian_technology_cell_layout, GateLibrary, GateLyt>, py::arg("layout"),
-          DOC(fiction_apply_gate_library));
+          py::call_guard<py::gil_scoped_release>(), DOC(fiction_apply_gate_library));
 }
 
 }  // namespace detail
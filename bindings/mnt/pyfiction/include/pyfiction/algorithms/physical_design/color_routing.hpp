@@ -42,7 +42,7 @@ void color_routing(pybind11::module& m)
             return fiction::color_routing(lyt, objs, params);
         },
         py::arg("layout"), py::arg("objectives"), py::arg("params") = fiction::color_routing_params{},
-        DOC(fiction_color_routing));
+        py::call_guard<py::gil_scoped_release>(), DOC(fiction_color_routing));
 }
 
 }  // namespace detail
@@ -71,9 +71,13 @@ inline void color_routing(pybind11::module& m)
                        DOC(fiction_color_routing_params_crossings))
         .def_readwrite("path_limit", &fiction::color_routing_params::path_limit,
                        DOC(fiction_color_routing_params_path_limit))
+        .def_readwrite("num_threads", &fiction::color_routing_params::num_threads,
+                       DOC(fiction_color_routing_params_num_threads))
         .def_readwrite("engine", &fiction::color_routing_params::engine, DOC(fiction_color_routing_params_engine))
         .def_readwrite("partial_sat", &fiction::color_routing_params::partial_sat,
                        DOC(fiction_color_routing_params_partial_sat))
+        .def_readwrite("incremental_sat", &fiction::color_routing_params::incremental_sat,
+                       DOC(fiction_color_routing_params_incremental_sat))
 
         ;
 
@@ -25,7 +25,7 @@ void design_sidb_gates(pybind11::module& m)
 
     m.def("design_sidb_gates", &fiction::design_sidb_gates<Lyt, py_tt>, py::arg("skeleton"), py::arg("spec"),
           py::arg("params") = fiction::design_sidb_gates_params<fiction::cell<Lyt>>{}, py::arg("stats") = nullptr,
-          DOC(fiction_design_sidb_gates));
+          py::call_guard<py::gil_scoped_release>(), DOC(fiction_design_sidb_gates));
 }
 
 }  // namespace detail
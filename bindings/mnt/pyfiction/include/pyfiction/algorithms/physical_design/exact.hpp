@@ -47,6 +47,10 @@ inline void exact(pybind11::module& m)
                        DOC(fiction_exact_physical_design_params_fixed_size))
         .def_readwrite("num_threads", &fiction::exact_physical_design_params::num_threads,
                        DOC(fiction_exact_physical_design_params_num_threads))
+        .def_readwrite("portfolio", &fiction::exact_physical_design_params::portfolio,
+                       DOC(fiction_exact_physical_design_params_portfolio))
+        .def_readwrite("portfolio_seed", &fiction::exact_physical_design_params::portfolio_seed,
+                       DOC(fiction_exact_physical_design_params_portfolio_seed))
         .def_readwrite("crossings", &fiction::exact_physical_design_params::crossings,
                        DOC(fiction_exact_physical_design_params_crossings))
         .def_readwrite("border_io", &fiction::exact_physical_design_params::border_io,
@@ -59,6 +63,9 @@ inline void exact(pybind11::module& m)
                        DOC(fiction_exact_physical_design_params_minimize_wires))
         .def_readwrite("minimize_crossings", &fiction::exact_physical_design_params::minimize_crossings,
                        DOC(fiction_exact_physical_design_params_minimize_crossings))
+        .def_readwrite("break_translation_symmetry",
+                       &fiction::exact_physical_design_params::break_translation_symmetry,
+                       DOC(fiction_exact_physical_design_params_break_translation_symmetry))
         .def_readwrite("timeout", &fiction::exact_physical_design_params::timeout,
                        DOC(fiction_exact_physical_design_params_timeout))
         .def_readwrite("technology_specifics", &fiction::exact_physical_design_params::technology_specifics,
@@ -90,20 +97,25 @@ inline void exact(pybind11::module& m)
                       DOC(fiction_exact_physical_design_stats_num_crossings))
         .def_readonly("num_aspect_ratios", &fiction::exact_physical_design_stats::num_aspect_ratios,
                       DOC(fiction_exact_physical_design_stats_num_aspect_ratios))
+        .def_readonly("num_aspect_ratios_beyond_bounds",
+                      &fiction::exact_physical_design_stats::num_aspect_ratios_beyond_bounds,
+                      DOC(fiction_exact_physical_design_stats_num_aspect_ratios_beyond_bounds))
+        .def_readonly("num_skipped_aspect_ratios", &fiction::exact_physical_design_stats::num_skipped_aspect_ratios,
+                      DOC(fiction_exact_physical_design_stats_num_skipped_aspect_ratios))
 
         ;
 
     m.def("exact_cartesian", &fiction::exact<py_cartesian_gate_layout, py_logic_network>, py::arg("network"),
           py::arg("parameters") = fiction::exact_physical_design_params{}, py::arg("statistics") = nullptr,
-          DOC(fiction_exact));
+          py::call_guard<py::gil_scoped_release>(), DOC(fiction_exact));
 
     m.def("exact_shifted_cartesian", &fiction::exact<py_shifted_cartesian_gate_layout, py_logic_network>,
           py::arg("network"), py::arg("parameters") = fiction::exact_physical_design_params{},
-          py::arg("statistics") = nullptr);
+          py::arg("statistics") = nullptr, py::call_guard<py::gil_scoped_release>());
 
     m.def("exact_hexagonal", &fiction::exact<py_hexagonal_gate_layout, py_logic_network>, py::arg("network"),
           py::arg("parameters") = fiction::exact_physical_design_params{}, py::arg("statistics") = nullptr,
-          DOC(fiction_exact));
+          py::call_guard<py::gil_scoped_release>(), DOC(fiction_exact));
 }
 
 }  // namespace pyfiction
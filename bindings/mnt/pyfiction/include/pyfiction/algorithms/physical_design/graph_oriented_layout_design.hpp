@@ -71,7 +71,10 @@ inline void graph_oriented_layout_design(pybind11::module& m)
         .def_readwrite("planar", &fiction::graph_oriented_layout_design_params::planar,
                        DOC(fiction_graph_oriented_layout_design_params_planar))
         .def_readwrite("enable_multithreading", &fiction::graph_oriented_layout_design_params::enable_multithreading,
-                       DOC(fiction_graph_oriented_layout_design_params_enable_multithreading));
+                       DOC(fiction_graph_oriented_layout_design_params_enable_multithreading))
+        .def_readwrite("num_parallel_expansions",
+                       &fiction::graph_oriented_layout_design_params::num_parallel_expansions,
+                       DOC(fiction_graph_oriented_layout_design_params_num_parallel_expansions));
 
     py::class_<fiction::graph_oriented_layout_design_stats>(m, "graph_oriented_layout_design_stats",
                                                             DOC(fiction_graph_oriented_layout_design_stats))
@@ -99,7 +102,8 @@ inline void graph_oriented_layout_design(pybind11::module& m)
     m.def("graph_oriented_layout_design",
           &fiction::graph_oriented_layout_design<py_cartesian_gate_layout, py_logic_network>, py::arg("network"),
           py::arg("parameters") = fiction::graph_oriented_layout_design_params{}, py::arg("statistics") = nullptr,
-          py::arg("custom_cost_objective") = nullptr, DOC(fiction_graph_oriented_layout_design));
+          py::arg("custom_cost_objective") = nullptr, py::call_guard<py::gil_scoped_release>(),
+          DOC(fiction_graph_oriented_layout_design));
 }
 
 }  // namespace pyfiction
@@ -38,7 +38,14 @@ inline void hexagonalization(pybind11::module& m)
         .def_readwrite("input_pin_extension", &fiction::hexagonalization_params::input_pin_extension,
                        DOC(fiction_hexagonalization_params_input_pin_extension))
         .def_readwrite("output_pin_extension", &fiction::hexagonalization_params::output_pin_extension,
-                       DOC(fiction_hexagonalization_params_output_pin_extension));
+                       DOC(fiction_hexagonalization_params_output_pin_extension))
+        .def_readwrite("negotiated_congestion_routing",
+                       &fiction::hexagonalization_params::negotiated_congestion_routing,
+                       DOC(fiction_hexagonalization_params_negotiated_congestion_routing))
+        .def_readwrite("max_negotiation_iterations", &fiction::hexagonalization_params::max_negotiation_iterations,
+                       DOC(fiction_hexagonalization_params_max_negotiation_iterations))
+        .def_readwrite("num_threads", &fiction::hexagonalization_params::num_threads,
+                       DOC(fiction_hexagonalization_params_num_threads));
 
     py::class_<fiction::hexagonalization_stats>(m, "hexagonalization_stats", DOC(fiction_hexagonalization_stats))
         .def(py::init<>())
@@ -50,11 +57,15 @@ inline void hexagonalization(pybind11::module& m)
                  return stream.str();
              })
         .def_readonly("time_total", &fiction::hexagonalization_stats::time_total,
-                      DOC(fiction_hexagonalization_stats_duration));
+                      DOC(fiction_hexagonalization_stats_duration))
+        .def_readonly("num_negotiation_iterations", &fiction::hexagonalization_stats::num_negotiation_iterations,
+                      DOC(fiction_hexagonalization_stats_num_negotiation_iterations))
+        .def_readonly("negotiation_converged", &fiction::hexagonalization_stats::negotiation_converged,
+                      DOC(fiction_hexagonalization_stats_negotiation_converged));
 
     m.def("hexagonalization", &fiction::hexagonalization<py_hexagonal_gate_layout, py_cartesian_gate_layout>,
           py::arg("layout"), py::arg("parameters") = fiction::hexagonalization_params{},
-          py::arg("statistics") = nullptr, DOC(fiction_hexagonalization));
+          py::arg("statistics") = nullptr, py::call_guard<py::gil_scoped_release>(), DOC(fiction_hexagonalization));
 }
 
 }  // namespace pyfiction
@@ -14,6 +14,7 @@
 #include <pybind11/stl.h>
 
 #include <sstream>
+#include <string_view>
 
 namespace pyfiction
 {
@@ -29,6 +30,8 @@ inline void orthogonal(pybind11::module& m)
     py::class_<fiction::orthogonal_physical_design_params>(m, "orthogonal_params",
                                                            DOC(fiction_orthogonal_physical_design_params))
         .def(py::init<>())
+        .def_readwrite("two_pass", &fiction::orthogonal_physical_design_params::two_pass,
+                       DOC(fiction_orthogonal_physical_design_params_two_pass))
 
         ;
 
@@ -61,7 +64,16 @@ inline void orthogonal(pybind11::module& m)
 
     m.def("orthogonal", &fiction::orthogonal<py_cartesian_gate_layout, py_logic_network>, py::arg("network"),
           py::arg("parameters") = fiction::orthogonal_physical_design_params{}, py::arg("statistics") = nullptr,
-          DOC(fiction_orthogonal));
+          py::call_guard<py::gil_scoped_release>(), DOC(fiction_orthogonal));
+
+    m.def(
+        "write_orthogonal_fgl_layout",
+        [](const py_logic_network& ntk, const std::string_view& filename,
+           const fiction::orthogonal_physical_design_params& ps, fiction::orthogonal_physical_design_stats* pst)
+        { fiction::write_orthogonal_fgl_layout<py_cartesian_gate_layout>(ntk, filename, ps, pst); },
+        py::arg("network"), py::arg("filename"), py::arg("parameters") = fiction::orthogonal_physical_design_params{},
+        py::arg("statistics") = nullptr, py::call_guard<py::gil_scoped_release>(),
+        DOC(fiction_write_orthogonal_fgl_layout_2));
 }
 
 }  // namespace pyfiction
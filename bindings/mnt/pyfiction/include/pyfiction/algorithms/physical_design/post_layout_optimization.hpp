@@ -33,7 +33,13 @@ inline void post_layout_optimization(pybind11::module& m)
         .def_readwrite("planar_optimization", &fiction::post_layout_optimization_params::planar_optimization,
                        DOC(fiction_post_layout_optimization_params_planar_optimization))
         .def_readwrite("timeout", &fiction::post_layout_optimization_params::timeout,
-                       DOC(fiction_post_layout_optimization_params_timeout));
+                       DOC(fiction_post_layout_optimization_params_timeout))
+        .def_readwrite("parallel_relocation", &fiction::post_layout_optimization_params::parallel_relocation,
+                       DOC(fiction_post_layout_optimization_params_parallel_relocation))
+        .def_readwrite("num_threads", &fiction::post_layout_optimization_params::num_threads,
+                       DOC(fiction_post_layout_optimization_params_num_threads))
+        .def_readwrite("gain_driven_relocation", &fiction::post_layout_optimization_params::gain_driven_relocation,
+                       DOC(fiction_post_layout_optimization_params_gain_driven_relocation));
 
     py::class_<fiction::post_layout_optimization_stats>(m, "post_layout_optimization_stats",
                                                         DOC(fiction_post_layout_optimization_stats))
@@ -67,12 +73,14 @@ inline void post_layout_optimization(pybind11::module& m)
                       DOC(fiction_post_layout_optimization_stats_num_crossings_before))
         .def_readonly("num_crossings_after", &fiction::post_layout_optimization_stats::num_crossings_after,
                       DOC(fiction_post_layout_optimization_stats_num_crossings_after))
+        .def_readonly("num_relocation_attempts", &fiction::post_layout_optimization_stats::num_relocation_attempts,
+                      DOC(fiction_post_layout_optimization_stats_num_relocation_attempts))
 
         ;
 
     m.def("post_layout_optimization", &fiction::post_layout_optimization<py_cartesian_gate_layout>, py::arg("layout"),
           py::arg("parameters") = fiction::post_layout_optimization_params{}, py::arg("statistics") = nullptr,
-          DOC(fiction_post_layout_optimization));
+          py::call_guard<py::gil_scoped_release>(), DOC(fiction_post_layout_optimization));
 }
 
 }  // namespace pyfiction
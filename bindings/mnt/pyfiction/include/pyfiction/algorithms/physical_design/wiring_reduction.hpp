@@ -26,7 +26,11 @@ inline void wiring_reduction(pybind11::module& m)
     py::class_<fiction::wiring_reduction_params>(m, "wiring_reduction_params", DOC(fiction_wiring_reduction_params))
         .def(py::init<>())
         .def_readwrite("timeout", &fiction::wiring_reduction_params::timeout,
-                       DOC(fiction_wiring_reduction_params_timeout));
+                       DOC(fiction_wiring_reduction_params_timeout))
+        .def_readwrite("incremental_search", &fiction::wiring_reduction_params::incremental_search,
+                       DOC(fiction_wiring_reduction_params_incremental_search))
+        .def_readwrite("disjoint_paths", &fiction::wiring_reduction_params::disjoint_paths,
+                       DOC(fiction_wiring_reduction_params_disjoint_paths));
 
     py::class_<fiction::wiring_reduction_stats>(m, "wiring_reduction_stats", DOC(fiction_wiring_reduction_stats))
         .def(py::init<>())
@@ -52,6 +56,8 @@ inline void wiring_reduction(pybind11::module& m)
                       DOC(fiction_wiring_reduction_stats_num_wires_before))
         .def_readonly("num_wires_after", &fiction::wiring_reduction_stats::num_wires_after,
                       DOC(fiction_wiring_reduction_stats_num_wires_after))
+        .def_readonly("num_search_passes", &fiction::wiring_reduction_stats::num_search_passes,
+                      DOC(fiction_wiring_reduction_stats_num_search_passes))
         .def_readonly("wiring_improvement", &fiction::wiring_reduction_stats::wiring_improvement,
                       DOC(fiction_wiring_reduction_stats_wiring_improvement))
         .def_readonly("area_improvement", &fiction::wiring_reduction_stats::area_improvement,
@@ -61,7 +67,7 @@ inline void wiring_reduction(pybind11::module& m)
 
     m.def("wiring_reduction", &fiction::wiring_reduction<py_cartesian_gate_layout>, py::arg("layout"),
           py::arg("parameters") = fiction::wiring_reduction_params{}, py::arg("statistics") = nullptr,
-          DOC(fiction_wiring_reduction));
+          py::call_guard<py::gil_scoped_release>(), DOC(fiction_wiring_reduction));
 }
 
 }  // namespace pyfiction
@@ -28,7 +28,8 @@ void clustercomplete(pybind11::module& m)
     namespace py = pybind11;
 
     m.def("clustercomplete", &fiction::clustercomplete<Lyt>, py::arg("lyt"),
-          py::arg("params") = fiction::clustercomplete_params<>{}, DOC(fiction_clustercomplete));
+          py::arg("params") = fiction::clustercomplete_params<>{}, py::call_guard<py::gil_scoped_release>(),
+          DOC(fiction_clustercomplete));
 }
 
 }  // namespace detail
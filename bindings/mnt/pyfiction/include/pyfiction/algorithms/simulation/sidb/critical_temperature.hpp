@@ -28,11 +28,11 @@ void critical_temperature(pybind11::module& m)
 
     m.def("critical_temperature_gate_based", &fiction::critical_temperature_gate_based<Lyt, py_tt>, py::arg("lyt"),
           py::arg("spec"), py::arg("params") = fiction::critical_temperature_params{}, py::arg("stats") = nullptr,
-          DOC(fiction_critical_temperature_gate_based));
+          py::call_guard<py::gil_scoped_release>(), DOC(fiction_critical_temperature_gate_based));
 
     m.def("critical_temperature_non_gate_based", &fiction::critical_temperature_non_gate_based<Lyt>, py::arg("lyt"),
           py::arg("params") = fiction::critical_temperature_params{}, py::arg("stats") = nullptr,
-          DOC(fiction_critical_temperature_non_gate_based));
+          py::call_guard<py::gil_scoped_release>(), DOC(fiction_critical_temperature_non_gate_based));
 }
 
 }  // namespace detail
@@ -34,7 +34,7 @@ void determine_displacement_robustness_domain(pybind11::module& m, const std::st
 
     m.def(fmt::format("determine_displacement_robustness_domain_{}", lattice).c_str(),
           &fiction::determine_displacement_robustness_domain<Lyt, py_tt>, py::arg("layout"), py::arg("spec"),
-          py::arg("params"), py::arg("stats") = nullptr);
+          py::arg("params"), py::arg("stats") = nullptr, py::call_guard<py::gil_scoped_release>());
 }
 
 }  // namespace detail
@@ -27,7 +27,8 @@ void exhaustive_ground_state_simulation(pybind11::module& m)
     namespace py = pybind11;
 
     m.def("exhaustive_ground_state_simulation", &fiction::exhaustive_ground_state_simulation<Lyt>, py::arg("lyt"),
-          py::arg("params") = fiction::sidb_simulation_parameters{}, DOC(fiction_exhaustive_ground_state_simulation));
+          py::arg("params") = fiction::sidb_simulation_parameters{}, py::call_guard<py::gil_scoped_release>(),
+          DOC(fiction_exhaustive_ground_state_simulation));
 }
 
 }  // namespace detail
@@ -6,15 +6,19 @@
 #define PYFICTION_OPERATIONAL_DOMAIN_HPP
 
 #include "pyfiction/documentation.hpp"
+#include "pyfiction/ndarray.hpp"
 #include "pyfiction/types.hpp"
 
 #include <fiction/algorithms/simulation/sidb/operational_domain.hpp>
+#include <fiction/io/sidb_simulation_domain_stream.hpp>
 
 #include <fmt/format.h>
 #include <pybind11/operators.h>
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>
 
+#include <cstddef>
+#include <tuple>
 #include <vector>
 
 namespace pyfiction
@@ -30,19 +34,22 @@ void operational_domain(pybind11::module& m)
 
     m.def("operational_domain_grid_search", &fiction::operational_domain_grid_search<Lyt, py_tt>, py::arg("lyt"),
           py::arg("spec"), py::arg("params") = fiction::operational_domain_params{}, py::arg("stats") = nullptr,
-          DOC(fiction_operational_domain_grid_search));
+          py::call_guard<py::gil_scoped_release>(), DOC(fiction_operational_domain_grid_search));
 
     m.def("operational_domain_random_sampling", &fiction::operational_domain_random_sampling<Lyt, py_tt>,
           py::arg("lyt"), py::arg("spec"), py::arg("samples"), py::arg("params") = fiction::operational_domain_params{},
-          py::arg("stats") = nullptr, DOC(fiction_operational_domain_random_sampling));
+          py::arg("stats") = nullptr, py::call_guard<py::gil_scoped_release>(),
+          DOC(fiction_operational_domain_random_sampling));
 
     m.def("operational_domain_flood_fill", &fiction::operational_domain_flood_fill<Lyt, py_tt>, py::arg("lyt"),
           py::arg("spec"), py::arg("samples"), py::arg("params") = fiction::operational_domain_params{},
-          py::arg("stats") = nullptr, DOC(fiction_operational_domain_flood_fill));
+          py::arg("stats") = nullptr, py::call_guard<py::gil_scoped_release>(),
+          DOC(fiction_operational_domain_flood_fill));
 
     m.def("operational_domain_contour_tracing", &fiction::operational_domain_contour_tracing<Lyt, py_tt>,
           py::arg("lyt"), py::arg("spec"), py::arg("samples"), py::arg("params") = fiction::operational_domain_params{},
-          py::arg("stats") = nullptr, DOC(fiction_operational_domain_contour_tracing));
+          py::arg("stats") = nullptr, py::call_guard<py::gil_scoped_release>(),
+          DOC(fiction_operational_domain_contour_tracing));
 }
 
 template <typename Lyt>
@@ -52,21 +59,23 @@ void critical_temperature_domain(pybind11::module& m)
 
     m.def("critical_temperature_domain_grid_search", &fiction::critical_temperature_domain_grid_search<Lyt, py_tt>,
           py::arg("lyt"), py::arg("spec"), py::arg("params") = fiction::operational_domain_params{},
-          py::arg("stats") = nullptr, DOC(fiction_critical_temperature_domain_grid_search));
+          py::arg("stats") = nullptr, py::call_guard<py::gil_scoped_release>(),
+          DOC(fiction_critical_temperature_domain_grid_search));
 
     m.def("critical_temperature_domain_random_sampling",
           &fiction::critical_temperature_domain_random_sampling<Lyt, py_tt>, py::arg("lyt"), py::arg("spec"),
           py::arg("samples"), py::arg("params") = fiction::operational_domain_params{}, py::arg("stats") = nullptr,
-          DOC(fiction_critical_temperature_domain_random_sampling));
+          py::call_guard<py::gil_scoped_release>(), DOC(fiction_critical_temperature_domain_random_sampling));
 
     m.def("critical_temperature_domain_flood_fill", &fiction::critical_temperature_domain_flood_fill<Lyt, py_tt>,
           py::arg("lyt"), py::arg("spec"), py::arg("samples"), py::arg("params") = fiction::operational_domain_params{},
-          py::arg("stats") = nullptr, DOC(fiction_critical_temperature_domain_flood_fill));
+          py::arg("stats") = nullptr, py::call_guard<py::gil_scoped_release>(),
+          DOC(fiction_critical_temperature_domain_flood_fill));
 
     m.def("critical_temperature_domain_contour_tracing",
           &fiction::critical_temperature_domain_contour_tracing<Lyt, py_tt>, py::arg("lyt"), py::arg("spec"),
           py::arg("samples"), py::arg("params") = fiction::operational_domain_params{}, py::arg("stats") = nullptr,
-          DOC(fiction_critical_temperature_domain_contour_tracing));
+          py::call_guard<py::gil_scoped_release>(), DOC(fiction_critical_temperature_domain_contour_tracing));
 }
 
 }  // namespace detail
@@ -163,6 +172,16 @@ inline void operational_domain(pybind11::module& m)
                  self.for_each([&items](const auto& key, const auto& value) { items.emplace_back(key, value); });
                  return items;
              })
+        .def(
+            "to_numpy",
+            [](const fiction::critical_temperature_domain& self)
+            {
+                return domain_to_numpy(
+                    self,
+                    [](const auto& value) { return std::get<0>(value) == fiction::operational_status::OPERATIONAL; },
+                    [](const auto& value) { return std::get<1>(value); });
+            },
+            DOC(fiction_critical_temperature_domain_to_numpy))
 
         ;
 
@@ -229,6 +248,14 @@ inline void operational_domain(pybind11::module& m)
                                { items.emplace_back(key, std::get<0>(value)); });
                  return items;
              })
+        .def(
+            "to_numpy",
+            [](const fiction::operational_domain& self)
+            {
+                return domain_to_numpy(self, [](const auto& value)
+                                       { return std::get<0>(value) == fiction::operational_status::OPERATIONAL; });
+            },
+            DOC(fiction_operational_domain_to_numpy))
 
         ;
 
@@ -248,13 +275,51 @@ inline void operational_domain(pybind11::module& m)
 
         ;
 
+    py::enum_<fiction::sidb_simulation_domain_stream_params::stream_format>(
+        m, "stream_format", DOC(fiction_sidb_simulation_domain_stream_params_stream_format))
+        .value("CSV", fiction::sidb_simulation_domain_stream_params::stream_format::CSV,
+               DOC(fiction_sidb_simulation_domain_stream_params_stream_format_CSV))
+        .value("BINARY", fiction::sidb_simulation_domain_stream_params::stream_format::BINARY,
+               DOC(fiction_sidb_simulation_domain_stream_params_stream_format_BINARY))
+
+        ;
+
+    py::class_<fiction::sidb_simulation_domain_stream_params>(m, "sidb_simulation_domain_stream_params",
+                                                              DOC(fiction_sidb_simulation_domain_stream_params))
+        .def(py::init<>())
+        .def_readwrite("filename", &fiction::sidb_simulation_domain_stream_params::filename,
+                       DOC(fiction_sidb_simulation_domain_stream_params_filename))
+        .def_readwrite("format", &fiction::sidb_simulation_domain_stream_params::format,
+                       DOC(fiction_sidb_simulation_domain_stream_params_format))
+        .def_readwrite("flush_interval", &fiction::sidb_simulation_domain_stream_params::flush_interval,
+                       DOC(fiction_sidb_simulation_domain_stream_params_flush_interval))
+        .def_readwrite("resume", &fiction::sidb_simulation_domain_stream_params::resume,
+                       DOC(fiction_sidb_simulation_domain_stream_params_resume))
+
+        ;
+
+    py::enum_<fiction::operational_domain_params::domain_storage>(
+        m, "domain_storage", DOC(fiction_operational_domain_params_domain_storage))
+        .value("AUTOMATIC", fiction::operational_domain_params::domain_storage::AUTOMATIC,
+               DOC(fiction_operational_domain_params_domain_storage_AUTOMATIC))
+        .value("HASH_MAP", fiction::operational_domain_params::domain_storage::HASH_MAP,
+               DOC(fiction_operational_domain_params_domain_storage_HASH_MAP))
+        .value("DENSE_GRID", fiction::operational_domain_params::domain_storage::DENSE_GRID,
+               DOC(fiction_operational_domain_params_domain_storage_DENSE_GRID))
+
+        ;
+
     py::class_<fiction::operational_domain_params>(m, "operational_domain_params",
                                                    DOC(fiction_operational_domain_params))
         .def(py::init<>())
         .def_readwrite("operational_params", &fiction::operational_domain_params::operational_params,
                        DOC(fiction_operational_domain_params_operational_params))
         .def_readwrite("sweep_dimensions", &fiction::operational_domain_params::sweep_dimensions,
-                       DOC(fiction_operational_domain_params_sweep_dimensions));
+                       DOC(fiction_operational_domain_params_sweep_dimensions))
+        .def_readwrite("storage", &fiction::operational_domain_params::storage,
+                       DOC(fiction_operational_domain_params_storage))
+        .def_readwrite("stream", &fiction::operational_domain_params::stream,
+                       DOC(fiction_operational_domain_params_stream));
 
     py::class_<fiction::operational_domain_stats>(m, "operational_domain_stats", DOC(fiction_operational_domain_stats))
         .def(py::init<>())
@@ -27,7 +27,7 @@ void compute_operational_ratio(pybind11::module& m)
 
     m.def("operational_domain_ratio", &fiction::operational_domain_ratio<Lyt, py_tt>, py::arg("lyt"), py::arg("spec"),
           py::arg("pp"), py::arg("params") = fiction::operational_domain_ratio_params{},
-          DOC(fiction_operational_domain_ratio));
+          py::call_guard<py::gil_scoped_release>(), DOC(fiction_operational_domain_ratio));
 }
 
 }  // namespace detail
@@ -43,7 +43,7 @@ void physical_population_stability(pybind11::module& m, const std::string& latti
     m.def(fmt::format("physical_population_stability_{}", lattice).c_str(),
           &fiction::physical_population_stability<Lyt>, py::arg("lyt"),
           py::arg("params") = fiction::physical_population_stability_params{},
-          DOC(fiction_physical_population_stability));
+          py::call_guard<py::gil_scoped_release>(), DOC(fiction_physical_population_stability));
 }
 
 }  // namespace detail
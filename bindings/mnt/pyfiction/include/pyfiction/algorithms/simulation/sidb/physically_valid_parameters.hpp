@@ -28,7 +28,8 @@ void physically_valid_parameters(pybind11::module& m)
     namespace py = pybind11;
 
     m.def("physically_valid_parameters", &fiction::physically_valid_parameters<Lyt>, py::arg("cds"),
-          py::arg("params") = fiction::operational_domain_params{}, DOC(fiction_physically_valid_parameters));
+          py::arg("params") = fiction::operational_domain_params{}, py::call_guard<py::gil_scoped_release>(),
+          DOC(fiction_physically_valid_parameters));
 }
 
 }  // namespace detail
@@ -26,7 +26,7 @@ void quickexact(pybind11::module& m)
     namespace py = pybind11;
 
     m.def("quickexact", &fiction::quickexact<Lyt>, py::arg("lyt"), py::arg("params") = fiction::quickexact_params<>{},
-          DOC(fiction_quickexact));
+          py::call_guard<py::gil_scoped_release>(), DOC(fiction_quickexact));
 }
 
 }  // namespace detail
@@ -25,7 +25,7 @@ void quicksim(pybind11::module& m)
     namespace py = pybind11;
 
     m.def("quicksim", &fiction::quicksim<Lyt>, py::arg("lyt"), py::arg("params") = fiction::quicksim_params{},
-          DOC(fiction_quicksim));
+          py::call_guard<py::gil_scoped_release>(), DOC(fiction_quicksim));
 }
 
 }  // namespace detail
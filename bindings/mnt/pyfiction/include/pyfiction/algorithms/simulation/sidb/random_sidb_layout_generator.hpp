@@ -28,11 +28,12 @@ void random_layout_generator(pybind11::module& m)
 
     m.def("generate_random_sidb_layout", &fiction::generate_random_sidb_layout<Lyt>,
           py::arg("params") = fiction::generate_random_sidb_layout_params<fiction::cell<Lyt>>{},
-          py::arg("lyt_skeleton"), DOC(fiction_generate_random_sidb_layout));
+          py::arg("lyt_skeleton"), py::call_guard<py::gil_scoped_release>(), DOC(fiction_generate_random_sidb_layout));
 
     m.def("generate_multiple_random_sidb_layouts", &fiction::generate_multiple_random_sidb_layouts<Lyt>,
           py::arg("params") = fiction::generate_random_sidb_layout_params<fiction::cell<Lyt>>{},
-          py::arg("lyt_skeleton"), DOC(fiction_generate_multiple_random_sidb_layouts));
+          py::arg("lyt_skeleton"), py::call_guard<py::gil_scoped_release>(),
+          DOC(fiction_generate_multiple_random_sidb_layouts));
 }
 
 }  // namespace detail
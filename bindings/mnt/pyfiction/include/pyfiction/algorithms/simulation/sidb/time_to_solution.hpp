@@ -26,7 +26,7 @@ void time_to_solution(pybind11::module& m)
 
     m.def("time_to_solution", &fiction::time_to_solution<Lyt>, py::arg("lyt"), py::arg("quicksim_params"),
           py::arg("tts_params") = fiction::time_to_solution_params{}, py::arg("ps") = nullptr,
-          DOC(fiction_time_to_solution));
+          py::call_guard<py::gil_scoped_release>(), DOC(fiction_time_to_solution));
     m.def("time_to_solution_for_given_simulation_results", &fiction::time_to_solution_for_given_simulation_results<Lyt>,
           py::arg("results_exact"), py::arg("results_heuristic"), py::arg("confidence_level") = 0.997,
           py::arg("ps") = nullptr, DOC(fiction_time_to_solution_for_given_simulation_results));
@@ -39,7 +39,7 @@ void equivalence_checking(pybind11::module& m)
             return stats.eq;
         },
         py::arg("specification"), py::arg("implementation"), py::arg("statistics") = nullptr,
-        DOC(fiction_equivalence_checking));
+        py::call_guard<py::gil_scoped_release>(), DOC(fiction_equivalence_checking));
 }
 
 }  // namespace detail
@@ -92,4 +92,72 @@ empty layout coordinates.
 Returns:
     The minimum  and maximum enclosing coordinate in the associated layout.)doc";
 
+static const char* __doc_fiction_charge_distribution_surface_get_all_sidb_charges_array =
+    R"doc(Returns the charge states of all SiDBs as a NumPy array of type
+``int8``. The charge state at position ``i`` belongs to the SiDB at
+index ``i``, i.e., -1 denotes a negative, 0 a neutral, and 1 a
+positive charge state.
+
+The charge states are copied in a single block. The array does not
+reflect subsequent changes of the charge distribution surface.
+
+Returns:
+    NumPy array of the SiDB charge states.)doc";
+
+static const char* __doc_fiction_charge_distribution_surface_get_all_local_potentials_array =
+    R"doc(Returns the local electrostatic potentials at all SiDB positions as a
+NumPy array of type ``float64`` (unit: V). The potential at position
+``i`` belongs to the SiDB at index ``i``. The array is empty if the
+local potentials have not been computed yet.
+
+The potentials are copied in a single block. The array does not
+reflect subsequent changes of the charge distribution surface.
+
+Returns:
+    NumPy array of the local electrostatic potentials.)doc";
+
+static const char* __doc_fiction_charge_distribution_surface_get_nm_distance_matrix =
+    R"doc(Returns the distances between all pairs of SiDBs as a two-dimensional
+NumPy array of type ``float64`` (unit: nm). The entry at position
+``(i, j)`` is the distance between the SiDBs at indices ``i`` and
+``j``.
+
+Returns:
+    NumPy array of shape ``(n, n)`` where ``n`` is the number of SiDBs.)doc";
+
+static const char* __doc_fiction_charge_distribution_surface_get_chargeless_potential_matrix =
+    R"doc(Returns the chargeless electrostatic potentials between all pairs of
+SiDBs as a two-dimensional NumPy array of type ``float64`` (unit: V).
+The entry at position ``(i, j)`` is the potential at the SiDB at index
+``i`` that is generated by the SiDB at index ``j`` if it was charged.
+
+Returns:
+    NumPy array of shape ``(n, n)`` where ``n`` is the number of SiDBs.)doc";
+
+static const char* __doc_fiction_operational_domain_to_numpy =
+    R"doc(Converts the operational domain to NumPy arrays without creating a
+Python object per parameter point.
+
+Returns:
+    A tuple ``(parameters, operational)``, where ``parameters`` is an
+    array of type ``float64`` and shape ``(n, d)`` that contains the
+    ``n`` parameter points of the ``d``-dimensional domain, and
+    ``operational`` is an array of type ``bool`` and shape ``(n,)``
+    that specifies whether the layout is operational at the
+    respective parameter point.)doc";
+
+static const char* __doc_fiction_critical_temperature_domain_to_numpy =
+    R"doc(Converts the critical temperature domain to NumPy arrays without
+creating a Python object per parameter point.
+
+Returns:
+    A tuple ``(parameters, operational, critical_temperatures)``, where
+    ``parameters`` is an array of type ``float64`` and shape ``(n, d)``
+    that contains the ``n`` parameter points of the ``d``-dimensional
+    domain, ``operational`` is an array of type ``bool`` and shape
+    ``(n,)`` that specifies whether the layout is operational at the
+    respective parameter point, and ``critical_temperatures`` is an
+    array of type ``float64`` and shape ``(n,)`` that contains the
+    respective critical temperatures (unit: K).)doc";
+
 #endif  // FICTION_DOCSTRINGS_HPP
@@ -0,0 +1,73 @@
+//
+// Created by marcel on 19.10.26.
+//
+
+#ifndef PYFICTION_READ_FBL_LAYOUT_HPP
+#define PYFICTION_READ_FBL_LAYOUT_HPP
+
+#include "pyfiction/documentation.hpp"
+#include "pyfiction/types.hpp"
+
+#include <fiction/io/read_fbl_layout.hpp>
+
+#include <pybind11/pybind11.h>
+
+#include <string_view>
+
+namespace pyfiction
+{
+
+namespace detail
+{
+
+template <typename Lyt>
+void read_fbl_layout(pybind11::module& m, const char* function_name)
+{
+    namespace py = pybind11;
+
+    Lyt (*read_fbl_layout_function_pointer)(const std::string_view&, const std::string_view&) =
+        &fiction::read_fbl_layout<Lyt>;
+
+    m.def(function_name, read_fbl_layout_function_pointer, py::arg("filename"), py::arg("layout_name") = "",
+          DOC(fiction_read_fbl_layout_3));
+}
+
+}  // namespace detail
+
+inline void read_fbl_layout(pybind11::module& m)
+{
+    namespace py = pybind11;
+
+    py::register_exception<fiction::fbl_parsing_error>(m, "fbl_parsing_error", PyExc_RuntimeError);
+
+    py::class_<fiction::fbl_layout_info>(m, "fbl_layout_info", DOC(fiction_fbl_layout_info))
+        .def_readonly("version", &fiction::fbl_layout_info::version, DOC(fiction_fbl_layout_info_version))
+        .def_readonly("is_gate_level", &fiction::fbl_layout_info::is_gate_level,
+                      DOC(fiction_fbl_layout_info_is_gate_level))
+        .def_readonly("topology", &fiction::fbl_layout_info::topology, DOC(fiction_fbl_layout_info_topology))
+        .def_readonly("technology", &fiction::fbl_layout_info::technology, DOC(fiction_fbl_layout_info_technology))
+        .def_readonly("lattice_orientation", &fiction::fbl_layout_info::lattice_orientation,
+                      DOC(fiction_fbl_layout_info_lattice_orientation))
+        .def_readonly("name", &fiction::fbl_layout_info::name, DOC(fiction_fbl_layout_info_name))
+
+        ;
+
+    fiction::fbl_layout_info (*read_fbl_layout_info_function_pointer)(const std::string_view&) =
+        &fiction::read_fbl_layout_info;
+
+    m.def("read_fbl_layout_info", read_fbl_layout_info_function_pointer, py::arg("filename"),
+          DOC(fiction_read_fbl_layout_info_2));
+
+    detail::read_fbl_layout<py_cartesian_gate_layout>(m, "read_cartesian_fbl_layout");
+    detail::read_fbl_layout<py_shifted_cartesian_gate_layout>(m, "read_shifted_cartesian_fbl_layout");
+    detail::read_fbl_layout<py_hexagonal_gate_layout>(m, "read_hexagonal_fbl_layout");
+    detail::read_fbl_layout<py_qca_layout>(m, "read_qca_fbl_layout");
+    detail::read_fbl_layout<py_inml_layout>(m, "read_inml_fbl_layout");
+    detail::read_fbl_layout<py_sidb_layout>(m, "read_sidb_fbl_layout");
+    detail::read_fbl_layout<py_sidb_100_lattice>(m, "read_sidb_100_fbl_layout");
+    detail::read_fbl_layout<py_sidb_111_lattice>(m, "read_sidb_111_fbl_layout");
+}
+
+}  // namespace pyfiction
+
+#endif  // PYFICTION_READ_FBL_LAYOUT_HPP
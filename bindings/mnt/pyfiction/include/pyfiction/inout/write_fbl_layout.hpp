@@ -0,0 +1,54 @@
+//
+// Created by marcel on 19.10.26.
+//
+
+#ifndef PYFICTION_WRITE_FBL_LAYOUT_HPP
+#define PYFICTION_WRITE_FBL_LAYOUT_HPP
+
+#include "pyfiction/documentation.hpp"
+#include "pyfiction/types.hpp"
+
+#include <fiction/io/write_fbl_layout.hpp>
+
+#include <pybind11/pybind11.h>
+
+#include <string_view>
+
+namespace pyfiction
+{
+
+namespace detail
+{
+
+template <typename Lyt>
+void write_fbl_layout(pybind11::module& m)
+{
+    namespace py = pybind11;
+
+    void (*write_fbl_layout_function_pointer)(const Lyt&, const std::string_view&) = &fiction::write_fbl_layout<Lyt>;
+
+    m.def("write_fbl_layout", write_fbl_layout_function_pointer, py::arg("layout"), py::arg("filename"),
+          DOC(fiction_write_fbl_layout_2));
+}
+
+}  // namespace detail
+
+inline void write_fbl_layout(pybind11::module& m)
+{
+    namespace py = pybind11;
+
+    py::register_exception<fiction::fbl_write_error>(m, "fbl_write_error", PyExc_ValueError);
+
+    detail::write_fbl_layout<py_cartesian_gate_layout>(m);
+    detail::write_fbl_layout<py_shifted_cartesian_gate_layout>(m);
+    detail::write_fbl_layout<py_hexagonal_gate_layout>(m);
+    detail::write_fbl_layout<py_qca_layout>(m);
+    detail::write_fbl_layout<py_inml_layout>(m);
+    detail::write_fbl_layout<py_sidb_111_lattice>(m);
+    detail::write_fbl_layout<py_sidb_100_lattice>(m);
+    detail::write_fbl_layout<py_sidb_layout>(m);
+}
+
+}  // namespace pyfiction
+
+#endif  // PYFICTION_WRITE_FBL_LAYOUT_HPP
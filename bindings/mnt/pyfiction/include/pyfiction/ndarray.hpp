@@ -0,0 +1,158 @@
+//
+// Created by marcel on 19.10.26.
+//
+
+#ifndef PYFICTION_NDARRAY_HPP
+#define PYFICTION_NDARRAY_HPP
+
+#include <pybind11/numpy.h>
+#include <pybind11/pybind11.h>
+
+#include <cstddef>
+#include <cstring>
+#include <limits>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace pyfiction
+{
+
+/**
+ * Creates a one-dimensional NumPy array that holds a copy of the given vector. The elements are copied in a single
+ * block instead of being converted element by element into a Python list. Since the array owns its memory, it stays
+ * valid regardless of what happens to the vector afterward.
+ *
+ * @tparam ArrayType Element type of the NumPy array. Must have the same size as `T`, e.g., the underlying type of an
+ * enumeration.
+ * @tparam T Element type of the vector.
+ * @param data Vector to copy.
+ * @return A one-dimensional NumPy array that contains the elements of `data`.
+ */
+template <typename ArrayType, typename T>
+pybind11::array_t<ArrayType> to_ndarray(const std::vector<T>& data)
+{
+    namespace py = pybind11;
+
+    static_assert(std::is_arithmetic_v<ArrayType>, "ArrayType must be an arithmetic type");
+    static_assert(std::is_trivially_copyable_v<T>, "T must be trivially copyable");
+    static_assert(sizeof(ArrayType) == sizeof(T) && alignof(ArrayType) == alignof(T),
+                  "ArrayType must have the same representation as T");
+
+    py::array_t<ArrayType> array(static_cast<py::ssize_t>(data.size()));
+
+    if (!data.empty())
+    {
+        std::memcpy(array.mutable_data(), data.data(), data.size() * sizeof(T));
+    }
+
+    return array;
+}
+
+/**
+ * Creates a two-dimensional NumPy array of shape `(rows, cols)` and fills it in a single pass without creating any
+ * intermediate Python objects.
+ *
+ * @tparam Fn Functor type that maps a row and a column index to a `double`.
+ * @param rows Number of rows.
+ * @param cols Number of columns.
+ * @param fn Functor that returns the value at the given row and column.
+ * @return A two-dimensional NumPy array of type `float64`.
+ */
+template <typename Fn>
+pybind11::array_t<double> to_matrix(const std::size_t rows, const std::size_t cols, Fn&& fn)
+{
+    namespace py = pybind11;
+
+    py::array_t<double> matrix({static_cast<py::ssize_t>(rows), static_cast<py::ssize_t>(cols)});
+
+    auto values = matrix.mutable_unchecked<2>();
+
+    for (std::size_t i = 0; i < rows; ++i)
+    {
+        for (std::size_t j = 0; j < cols; ++j)
+        {
+            values(static_cast<py::ssize_t>(i), static_cast<py::ssize_t>(j)) = fn(i, j);
+        }
+    }
+
+    return matrix;
+}
+
+namespace detail
+{
+
+/**
+ * Element type of the NumPy array that `domain_to_numpy` creates for the given functor.
+ */
+template <typename Domain, typename Fn>
+using domain_column_t = std::invoke_result_t<const Fn&, const typename Domain::mapped_type&>;
+
+/**
+ * Writes the columns extracted from the given domain value into the given row of the respective arrays.
+ */
+template <typename Columns, typename Fns, typename Value, std::size_t... Is>
+void fill_domain_columns(Columns& columns, const Fns& fns, const pybind11::ssize_t row, const Value& value,
+                         std::index_sequence<Is...> /*unused*/)
+{
+    ((std::get<Is>(columns)(row) = std::get<Is>(fns)(value)), ...);
+}
+
+}  // namespace detail
+
+/**
+ * Converts a simulation domain, e.g., an operational or a critical temperature domain, to NumPy arrays in a single pass
+ * without creating a Python object per parameter point.
+ *
+ * @tparam Domain Simulation domain type whose keys are parameter points.
+ * @tparam Fns Functor types that map a value of the domain to an arithmetic type.
+ * @param domain Simulation domain to convert.
+ * @param fns Functors that each extract one column from the values of the domain.
+ * @return A tuple whose first element is an array of type `float64` and shape `(n, d)` that contains the `n` parameter
+ * points of the `d`-dimensional domain, followed by one array of shape `(n,)` per functor in `fns`. Missing dimensions
+ * of a parameter point are reported as NaN.
+ */
+template <typename Domain, typename... Fns>
+pybind11::tuple domain_to_numpy(const Domain& domain, const Fns&... fns)
+{
+    namespace py = pybind11;
+
+    const auto size = static_cast<py::ssize_t>(domain.size());
+
+    py::array_t<double> parameters({size, static_cast<py::ssize_t>(domain.get_number_of_dimensions())});
+    std::tuple<py::array_t<detail::domain_column_t<Domain, Fns>>...> arrays{
+        py::array_t<detail::domain_column_t<Domain, Fns>>(size)...};
+
+    auto p       = parameters.mutable_unchecked<2>();
+    auto columns = std::apply([](auto&... a) { return std::make_tuple(a.template mutable_unchecked<1>()...); }, arrays);
+
+    const auto extractors = std::forward_as_tuple(fns...);
+
+    py::ssize_t i = 0;
+    domain.for_each(
+        [&p, &columns, &extractors, &i, size](const auto& key, const auto& value)
+        {
+            // guard against values that were added concurrently
+            if (i >= size)
+            {
+                return;
+            }
+
+            const auto& values = key.get_parameters();
+            for (py::ssize_t d = 0; d < p.shape(1); ++d)
+            {
+                const auto dim = static_cast<std::size_t>(d);
+                p(i, d)        = dim < values.size() ? values[dim] : std::numeric_limits<double>::quiet_NaN();
+            }
+
+            detail::fill_domain_columns(columns, extractors, i, value, std::index_sequence_for<Fns...>{});
+            ++i;
+        });
+
+    return std::apply([&parameters](const auto&... a) { return py::make_tuple(parameters, a...); }, arrays);
+}
+
+}  // namespace pyfiction
+
+#endif  // PYFICTION_NDARRAY_HPP
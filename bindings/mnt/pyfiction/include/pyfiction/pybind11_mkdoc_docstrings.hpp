@@ -223,6 +223,18 @@ supported standard functions.
 Returns:
     Technology mapping parameters.)doc";
 
+static const char *__doc_fiction_allocation_counters =
+R"doc(Process-wide allocation counters. They are only updated by
+`tracking_allocator` and, if enabled via
+`FICTION_TRACK_GLOBAL_ALLOCATIONS`, by the global `operator new` and
+`operator delete`.)doc";
+
+static const char *__doc_fiction_allocation_counters_bytes_allocated = R"doc(Total number of allocated bytes.)doc";
+
+static const char *__doc_fiction_allocation_counters_num_allocations = R"doc(Number of allocations.)doc";
+
+static const char *__doc_fiction_allocation_counters_num_deallocations = R"doc(Number of deallocations.)doc";
+
 static const char *__doc_fiction_and_or_not =
 R"doc(Auxiliary function to create technology mapping parameters for AND,
 OR, and NOT gates.
@@ -2418,6 +2430,14 @@ R"doc(Returns the number of primary output cells in the layout.
 Returns:
     Number of primary output cells.)doc";
 
+static const char *__doc_fiction_cell_level_layout_reserve_cells =
+R"doc(Reserves storage for at least `n` cells such that assigning cell types
+to up to `n` cells does not trigger any rehashing. This is useful when
+large layouts are read from files.
+
+Parameter ``n``:
+    Number of cells to reserve storage for.)doc";
+
 static const char *__doc_fiction_cell_level_layout_set_layout_name =
 R"doc(Assigns or overrides the layout name.
 
@@ -3072,6 +3092,16 @@ static const char *__doc_fiction_color_routing_params_crossings = R"doc(Enable c
 
 static const char *__doc_fiction_color_routing_params_engine = R"doc(The engine to use.)doc";
 
+static const char *__doc_fiction_color_routing_params_incremental_sat =
+R"doc(Keep a single SAT solver alive across all color numbers when the SAT
+engine is used instead of encoding the edge intersection graph anew
+for each of them. The encoding is limited by an upper bound determined
+via DSATUR.)doc";
+
+static const char *__doc_fiction_color_routing_params_num_threads =
+R"doc(Number of threads used to enumerate the paths of the routing
+objectives. If set to 0, the number of hardware threads is used.)doc";
+
 static const char *__doc_fiction_color_routing_params_partial_sat = R"doc(Allow partial solutions when the SAT engine is used.)doc";
 
 static const char *__doc_fiction_color_routing_params_path_limit =
@@ -3730,7 +3760,11 @@ Returns:
     The critical temperature domain of the layout.
 
 Throws:
-    std::invalid_argument if the given sweep parameters are invalid.)doc";
+    std::invalid_argument if the given sweep parameters are invalid or
+    do not match the stream file to resume from.
+
+Throws:
+    std::ofstream::failure if the stream file could not be opened.)doc";
 
 static const char *__doc_fiction_critical_temperature_domain_critical_temperature_domain = R"doc(Default constructor.)doc";
 
@@ -3795,7 +3829,11 @@ Returns:
     The critical temperature domain of the layout.
 
 Throws:
-    std::invalid_argument if the given sweep parameters are invalid.)doc";
+    std::invalid_argument if the given sweep parameters are invalid or
+    do not match the stream file to resume from.
+
+Throws:
+    std::ofstream::failure if the stream file could not be opened.)doc";
 
 static const char *__doc_fiction_critical_temperature_domain_get_dimension =
 R"doc(Returns a specific dimension by index.
@@ -3856,7 +3894,11 @@ Returns:
     The critical temperature domain of the layout.
 
 Throws:
-    std::invalid_argument if the given sweep parameters are invalid.)doc";
+    std::invalid_argument if the given sweep parameters are invalid or
+    do not match the stream file to resume from.
+
+Throws:
+    std::ofstream::failure if the stream file could not be opened.)doc";
 
 static const char *__doc_fiction_critical_temperature_domain_maximum_ct =
 R"doc(Finds the maximum critical temperature in the domain.
@@ -3912,7 +3954,11 @@ Returns:
     The critical temperature domain of the layout.
 
 Throws:
-    std::invalid_argument if the given sweep parameters are invalid.)doc";
+    std::invalid_argument if the given sweep parameters are invalid or
+    do not match the stream file to resume from.
+
+Throws:
+    std::ofstream::failure if the stream file could not be opened.)doc";
 
 static const char *__doc_fiction_critical_temperature_gate_based =
 R"doc(This algorithm performs temperature-aware SiDB simulation as proposed
@@ -4331,7 +4377,14 @@ Parameter ``stats``:
     Statistics.
 
 Returns:
-    The defect influence domain of the layout.)doc";
+    The defect influence domain of the layout.
+
+Throws:
+    std::invalid_argument if the stream file to resume from does not
+    store a defect influence domain.
+
+Throws:
+    std::ofstream::failure if the stream file could not be opened.)doc";
 
 static const char *__doc_fiction_defect_influence_grid_search_2 =
 R"doc(This algorithm uses a grid search to determine the defect influence
@@ -4355,7 +4408,14 @@ Parameter ``stats``:
     Statistics.
 
 Returns:
-    The defect influence domain of the layout.)doc";
+    The defect influence domain of the layout.
+
+Throws:
+    std::invalid_argument if the stream file to resume from does not
+    store a defect influence domain.
+
+Throws:
+    std::ofstream::failure if the stream file could not be opened.)doc";
 
 static const char *__doc_fiction_defect_influence_params =
 R"doc(Parameters to determine the defect influence.
@@ -4383,6 +4443,11 @@ status of the layout.)doc";
 
 static const char *__doc_fiction_defect_influence_params_operational_params = R"doc(Parameters for the `is_operational` algorithm.)doc";
 
+static const char *__doc_fiction_defect_influence_params_stream =
+R"doc(Parameters for streaming each evaluated defect position to a file as
+soon as its influence is known. This allows for resuming long-running
+computations. By default, no file is written.)doc";
+
 static const char *__doc_fiction_defect_influence_quicktrace =
 R"doc(Applies contour tracing to identify the boundary (contour) between
 influencing and non-influencing defect positions for a given SiDB
@@ -4440,7 +4505,14 @@ Parameter ``stats``:
     Defect influence computation statistics.
 
 Returns:
-    The (partial) defect influence domain of the layout.)doc";
+    The (partial) defect influence domain of the layout.
+
+Throws:
+    std::invalid_argument if the stream file to resume from does not
+    store a defect influence domain.
+
+Throws:
+    std::ofstream::failure if the stream file could not be opened.)doc";
 
 static const char *__doc_fiction_defect_influence_quicktrace_2 =
 R"doc(Applies contour tracing to identify the boundary (contour) between
@@ -4484,7 +4556,14 @@ Parameter ``stats``:
     Defect influence computation statistics.
 
 Returns:
-    The (partial) defect influence domain of the layout.)doc";
+    The (partial) defect influence domain of the layout.
+
+Throws:
+    std::invalid_argument if the stream file to resume from does not
+    store a defect influence domain.
+
+Throws:
+    std::ofstream::failure if the stream file could not be opened.)doc";
 
 static const char *__doc_fiction_defect_influence_random_sampling =
 R"doc(This algorithm uses random sampling to find a part of the defect
@@ -4515,7 +4594,14 @@ Parameter ``stats``:
     Statistics.
 
 Returns:
-    The (partial) defect influence domain of the layout.)doc";
+    The (partial) defect influence domain of the layout.
+
+Throws:
+    std::invalid_argument if the stream file to resume from does not
+    store a defect influence domain.
+
+Throws:
+    std::ofstream::failure if the stream file could not be opened.)doc";
 
 static const char *__doc_fiction_defect_influence_random_sampling_2 =
 R"doc(This algorithm uses random sampling to find a part of the defect
@@ -4539,7 +4625,14 @@ Parameter ``stats``:
     Statistics.
 
 Returns:
-    The (partial) defect influence domain of the layout.)doc";
+    The (partial) defect influence domain of the layout.
+
+Throws:
+    std::invalid_argument if the stream file to resume from does not
+    store a defect influence domain.
+
+Throws:
+    std::ofstream::failure if the stream file could not be opened.)doc";
 
 static const char *__doc_fiction_defect_influence_stats = R"doc(Statistics.)doc";
 
@@ -4591,6 +4684,127 @@ Parameter ``ntk``:
 Returns:
     The resulting network after virtual primary inputs are deleted.)doc";
 
+static const char *__doc_fiction_dense_tile_storage =
+R"doc(Storage policy for `gate_level_layout` that maps tiles to nodes via a
+dense array that is indexed by the tiles' :math:`(x, y,
+z)`-coordinates and nodes to tiles via a dense array that is indexed
+by the nodes. Lookups do not need to compute any hashes, which
+considerably speeds up algorithms that query tiles extensively, e.g.,
+routing. Memory consumption is proportional to the layout area.
+Therefore, this policy is suitable for bounded layouts that are
+densely populated. The tile array is sized on `resize` and
+additionally grows geometrically whenever a node gets assigned to a
+tile outside its current bounds.
+
+This policy requires the tiles to be represented by
+`offset::ucoord_t`.)doc";
+
+static const char *__doc_fiction_dense_tile_storage_map =
+R"doc(Bidirectional tile <-> node map.
+
+Template parameter ``Node``:
+    Node type.
+
+Template parameter ``Signal``:
+    Signal type, i.e., the 64-bit representation of a tile.)doc";
+
+static const char *__doc_fiction_dense_tile_storage_map_const0 =
+R"doc(Signal representations of the constant tiles.)doc";
+
+static const char *__doc_fiction_dense_tile_storage_map_const1 =
+R"doc(Signal representations of the constant tiles.)doc";
+
+static const char *__doc_fiction_dense_tile_storage_map_depth = R"doc(Dimensions of the tile array.)doc";
+
+static const char *__doc_fiction_dense_tile_storage_map_erase =
+R"doc(Removes the assignment of node `n` to tile `s`.
+
+Parameter ``s``:
+    Tile in its signal representation.
+
+Parameter ``n``:
+    Node.)doc";
+
+static const char *__doc_fiction_dense_tile_storage_map_find_node =
+R"doc(Fetches the node that is assigned to the given tile.
+
+Parameter ``s``:
+    Tile in its signal representation.
+
+Returns:
+    The node assigned to `s` or `std::nullopt` if there is none.)doc";
+
+static const char *__doc_fiction_dense_tile_storage_map_find_tile =
+R"doc(Fetches the tile that the given node is assigned to.
+
+Parameter ``n``:
+    Node.
+
+Returns:
+    The tile `n` is assigned to in its signal representation or
+    `std::nullopt` if there is none.)doc";
+
+static const char *__doc_fiction_dense_tile_storage_map_grow =
+R"doc(Re-allocates the tile array with at least the given dimensions and
+transfers all stored assignments.)doc";
+
+static const char *__doc_fiction_dense_tile_storage_map_height = R"doc(Dimensions of the tile array.)doc";
+
+static const char *__doc_fiction_dense_tile_storage_map_index = R"doc()doc";
+
+static const char *__doc_fiction_dense_tile_storage_map_insert =
+R"doc(Assigns node `n` to tile `s`. Grows the tile array if `s` lies outside
+its current bounds.
+
+Parameter ``s``:
+    Tile in its signal representation. Must not be dead.
+
+Parameter ``n``:
+    Node.)doc";
+
+static const char *__doc_fiction_dense_tile_storage_map_is_within_bounds = R"doc()doc";
+
+static const char *__doc_fiction_dense_tile_storage_map_map =
+R"doc(Standard constructor. Registers the two constant nodes.
+
+Parameter ``c0``:
+    Signal representation of the tile reserved for the `const0` node.
+
+Parameter ``c1``:
+    Signal representation of the tile reserved for the `const1` node.)doc";
+
+static const char *__doc_fiction_dense_tile_storage_map_no_tile =
+R"doc(Marks nodes that are not assigned to any tile.)doc";
+
+static const char *__doc_fiction_dense_tile_storage_map_node_tiles =
+R"doc(Node array holding the tile that each node is assigned to or `no_tile`
+if it is not assigned.)doc";
+
+static const char *__doc_fiction_dense_tile_storage_map_reserve =
+R"doc(Grows the tile array such that it covers the given aspect ratio. Never
+shrinks the array because nodes might still be assigned to tiles
+outside the given aspect ratio.
+
+Template parameter ``AspectRatio``:
+    Aspect ratio type.
+
+Parameter ``ar``:
+    Highest possible position in the layout.)doc";
+
+static const char *__doc_fiction_dense_tile_storage_map_reserve_nodes =
+R"doc(Pre-allocates the node array for the given number of nodes such that
+it does not need to grow while being filled.
+
+Parameter ``num_nodes``:
+    Expected number of nodes.)doc";
+
+static const char *__doc_fiction_dense_tile_storage_map_tile_nodes =
+R"doc(Tile array indexed by :math:`(z \cdot height + y) \cdot width + x`
+holding the node that is assigned to each tile or 0 if the tile is
+empty.)doc";
+
+static const char *__doc_fiction_dense_tile_storage_map_width = R"doc(Dimensions of the tile array.)doc";
+
 static const char *__doc_fiction_dependent_cell_mode = R"doc(An enumeration of modes for the dependent cell.)doc";
 
 static const char *__doc_fiction_dependent_cell_mode_FIXED =
@@ -4713,6 +4927,10 @@ static const char *__doc_fiction_design_sidb_gates_stats_number_of_layouts_after
 R"doc(The number of layouts that remain after third pruning (discarding
 layouts with unstable I/O signals).)doc";
 
+static const char *__doc_fiction_design_sidb_gates_stats_profile =
+R"doc(Time spent in pruning and simulation, the number of evaluated gate
+candidates, and the memory usage of the entire process.)doc";
+
 static const char *__doc_fiction_design_sidb_gates_stats_report =
 R"doc(This function outputs the total time taken for the SiDB gate design
 process to the provided output stream. If no output stream is
@@ -4975,6 +5193,19 @@ Parameter ``value``:
 Returns:
     The string representation of the value.)doc";
 
+static const char *__doc_fiction_detail_append_little_endian =
+R"doc(Appends the little-endian encoding of the given unsigned integer to the
+given buffer.
+
+Template parameter ``T``:
+    Unsigned integer type.
+
+Parameter ``buffer``:
+    Buffer to append to.
+
+Parameter ``value``:
+    Value to encode.)doc";
+
 static const char *__doc_fiction_detail_apply_gate_library_impl = R"doc()doc";
 
 static const char *__doc_fiction_detail_apply_gate_library_impl_apply_gate_library_impl = R"doc()doc";
@@ -5872,6 +6103,16 @@ static const char *__doc_fiction_detail_critical_temperature_impl_stats = R"doc(
 
 static const char *__doc_fiction_detail_defect_influence_impl = R"doc()doc";
 
+static const char *__doc_fiction_detail_defect_influence_impl_add_to_domain =
+R"doc(Adds a value to the defect influence domain and appends it to the
+stream file, if any.
+
+Parameter ``defect_cell``:
+    The defect position to associate with the value.
+
+Parameter ``value``:
+    The value to add.)doc";
+
 static const char *__doc_fiction_detail_defect_influence_impl_current_defect_position = R"doc(The current defect position.)doc";
 
 static const char *__doc_fiction_detail_defect_influence_impl_defect_influence_impl = R"doc()doc";
@@ -5939,6 +6180,10 @@ Returns:
 
 static const char *__doc_fiction_detail_defect_influence_impl_influence_domain = R"doc(The defect influence domain of the layout.)doc";
 
+static const char *__doc_fiction_detail_defect_influence_impl_influence_stream =
+R"doc(The stream that each evaluated defect position is appended to or
+`nullptr` if no stream file is given.)doc";
+
 static const char *__doc_fiction_detail_defect_influence_impl_is_defect_influential =
 R"doc(This function evaluates if the defect at position `c` influences the
 layout.
@@ -6768,6 +7013,17 @@ static const char *__doc_fiction_detail_exact_impl_smt_handler_establish_transit
 R"doc(Adds constraints to the solver to expand the formerly created sub-
 paths transitively.)doc";
 
+static const char *__doc_fiction_detail_exact_impl_smt_handler_exceeds_upper_bounds =
+R"doc(Checks whether a given aspect ratio extends beyond the upper bounds
+specified in the parameters.
+
+Parameter ``ar``:
+    Aspect ratio to evaluate.
+
+Returns:
+    `true` iff `ar` exceeds the upper bound on the area or on one of
+    the dimensions.)doc";
+
 static const char *__doc_fiction_detail_exact_impl_smt_handler_fetch_solver =
 R"doc(Accesses the solver tree and looks for a solver state that is
 associated with an aspect ratio smaller by 1 row or column than given
@@ -7145,7 +7401,8 @@ whether it can be skipped, i.e., does not need to be explored by the
 SMT solver. The better this function is at predicting unsatisfying
 inputs, the more UNSAT instances can be skipped without losing the
 optimality guarantee. This function should never be overly
-restrictive!
+restrictive! Aspect ratios beyond the upper bounds are not considered
+here but by `exceeds_upper_bounds`.
 
 Parameter ``ar``:
     Aspect ratio to evaluate.
@@ -7332,6 +7589,40 @@ static const char *__doc_fiction_detail_fanout_substitution_impl_ps = R"doc()doc
 
 static const char *__doc_fiction_detail_fanout_substitution_impl_run = R"doc()doc";
 
+static const char *__doc_fiction_detail_fbl_byte_reader =
+R"doc(Sequential little-endian decoder for the contents of an FBL file that
+checks all accesses against the file size.)doc";
+
+static const char *__doc_fiction_detail_fbl_byte_reader_get_array =
+R"doc(Returns a view of the next `count` elements of `element_size` bytes
+each.)doc";
+
+static const char *__doc_fiction_detail_fbl_header =
+R"doc(Header of an FBL file with its enumerators not yet validated against a
+layout type.)doc";
+
+static const char *__doc_fiction_detail_fbl_num_truth_table_words =
+R"doc(Returns the number of 64-bit words that make up a truth table over the
+given number of variables.
+
+Parameter ``num_vars``:
+    Number of variables.
+
+Returns:
+    Number of 64-bit words.)doc";
+
+static const char *__doc_fiction_detail_fgl_gate_type =
+R"doc(Determines the FGL type of a gate that computes the given function.
+Buffers, inverters, the named 2-input gates, and majority gates are
+identified by their names. All other functions are stored as their
+hexadecimal truth tables.
+
+Parameter ``tt``:
+    Function of the gate.
+
+Returns:
+    FGL type of the gate.)doc";
+
 static const char *__doc_fiction_detail_gate_level_drvs_impl = R"doc()doc";
 
 static const char *__doc_fiction_detail_gate_level_drvs_impl_border_io_check =
@@ -7456,103 +7747,88 @@ Returns:
 
 static const char *__doc_fiction_detail_generate_edge_intersection_graph_impl = R"doc()doc";
 
-static const char *__doc_fiction_detail_generate_edge_intersection_graph_impl_all_paths =
-R"doc(Stores a collection of all annotated paths
-(labeled_layout_coordinate_lookup_path objects) computed thus far to
-find intersections with new ones. The edge intersection graph stores
-plain paths without the extra set and label. Therefore, after the
-generate_edge_intersection_graph function terminates, the extra memory
-overhead is being released again.)doc";
-
 static const char *__doc_fiction_detail_generate_edge_intersection_graph_impl_connect_clique =
-R"doc(Given a collection of paths belonging to the same objective, this
-function creates edges in the edge intersection graph between each
-pair of corresponding nodes, thus, forming a clique (complete sub-
-graph).
+R"doc(Given the consecutive labels of paths belonging to the same objective,
+this function creates edges in the edge intersection graph between
+each pair of corresponding nodes, thus, forming a clique (complete
+sub-graph).
 
-Parameter ``objective_paths``:
-    Collection of paths belonging to the same objective.)doc";
+Parameter ``first_label``:
+    Label of the first path of the objective.
+
+Parameter ``num_paths``:
+    Number of paths of the objective.)doc";
 
 static const char *__doc_fiction_detail_generate_edge_intersection_graph_impl_create_intersection_edges =
 R"doc(Given a collection of paths belonging to the same objective, this
 function creates edges in the edge intersection graph between each
 corresponding node and all of the already existing nodes that
 represent paths that intersect with it, i.e., that share at least one
-coordinate.
+coordinate or, if crossings are enabled, at least one segment of size
+2.
+
+Only paths that are found via the inverted indices are considered. To
+keep the resulting graph identical to a pairwise comparison of all
+paths, the edges of each path are inserted in ascending label order.
 
 Parameter ``objective_paths``:
-    Collection of paths belonging to the same objective.)doc";
+    Collection of paths belonging to the same objective.
+
+Parameter ``first_label``:
+    Label of the first path in `objective_paths`.)doc";
+
+static const char *__doc_fiction_detail_generate_edge_intersection_graph_impl_determine_num_threads =
+R"doc(Determines the number of threads to use for the path enumeration.
+
+Returns:
+    Number of threads.)doc";
 
 static const char *__doc_fiction_detail_generate_edge_intersection_graph_impl_edge_id = R"doc()doc";
 
+static const char *__doc_fiction_detail_generate_edge_intersection_graph_impl_enumerate_objective_paths =
+R"doc(Enumerates the paths of all objectives. If more than one thread is
+requested, the objectives are distributed dynamically among them. Each
+thread owns a search context whose buffers are reused across its
+objectives.
+
+Returns:
+    A collection of paths for each objective in the order of
+    `objectives`.)doc";
+
 static const char *__doc_fiction_detail_generate_edge_intersection_graph_impl_generate_edge_intersection_graph_impl = R"doc()doc";
 
 static const char *__doc_fiction_detail_generate_edge_intersection_graph_impl_graph = R"doc(The edge intersection graph to be created.)doc";
 
+static const char *__doc_fiction_detail_generate_edge_intersection_graph_impl_index_paths =
+R"doc(Adds a collection of paths belonging to the same objective to the
+inverted indices such that paths of subsequent objectives can find
+them.
+
+Parameter ``objective_paths``:
+    Collection of paths belonging to the same objective.
+
+Parameter ``first_label``:
+    Label of the first path in `objective_paths`.)doc";
+
 static const char *__doc_fiction_detail_generate_edge_intersection_graph_impl_initiate_objective_nodes =
 R"doc(Given a collection of paths belonging to the same objective, this
-function assigns them unique labels and generates corresponding nodes
-in the edge intersection graph.
+function assigns them consecutive labels and generates corresponding
+nodes in the edge intersection graph.
 
 Since each path of the same objective objective belongs to a clique in
 the final graph, this function additionally stores their node IDs in
 the statistics.
 
 Parameter ``objective_paths``:
-    Collection of paths belonging to the same objective.)doc";
-
-static const char *__doc_fiction_detail_generate_edge_intersection_graph_impl_labeled_layout_coordinate_lookup_path =
-R"doc(Extends the layout_coordinate_path to additionally to the vector
-representation of the path also hold a set that allows fast lookup
-needed to find intersections (O(log n)). Additionally, a label is
-assigned to each path to identify it in the edge intersection graph.)doc";
-
-static const char *__doc_fiction_detail_generate_edge_intersection_graph_impl_labeled_layout_coordinate_lookup_path_append =
-R"doc(Overwrites the append function to additionally store the given
-coordinate in a set.
-
-Parameter ``c``:
-    Coordinate to append to the path.)doc";
-
-static const char *__doc_fiction_detail_generate_edge_intersection_graph_impl_labeled_layout_coordinate_lookup_path_has_intersection_with =
-R"doc(Given another path, this function checks if they are not disjoint,
-i.e., it looks for at least one coordinate that both paths share.
-
-If, at some point, the set approach is not to be used anymore,
-std::find_first_of offers the same functionality on any kind of range.
-
-Template parameter ``Path``:
-    Type of other path.
-
-Parameter ``other``:
-    The other path.
-
-Returns:
-    `true` iff this path and the given one are not disjoint, i.e.,
-    share at least one coordinate.)doc";
-
-static const char *__doc_fiction_detail_generate_edge_intersection_graph_impl_labeled_layout_coordinate_lookup_path_has_overlap_with =
-R"doc(Like has_intersection_with but allows paths to share crossings, i.e.,
-single-tile intersections.
-
-Similar to has_intersection_with, this function also returns `true` if
-source and target are matching in both paths.
-
-Template parameter ``Path``:
-    Type of other path.
-
-Parameter ``other``:
-    The other path.
+    Collection of paths belonging to the same objective.
 
 Returns:
-    `true` iff this path and the given one are overlapping, i.e.,
-    share at least one coordinate segment of size 2.)doc";
-
-static const char *__doc_fiction_detail_generate_edge_intersection_graph_impl_labeled_layout_coordinate_lookup_path_label = R"doc(Label to identify the path in the edge intersection graph.)doc";
+    Label of the first path in `objective_paths`.)doc";
 
-static const char *__doc_fiction_detail_generate_edge_intersection_graph_impl_labeled_layout_coordinate_lookup_path_path_elements =
-R"doc(Uniquely identify path elements in a set to make them searchable in
-O(1).)doc";
+static const char *__doc_fiction_detail_generate_edge_intersection_graph_impl_last_candidate_of =
+R"doc(Stores for each label the label of the path for which it has last been
+found as a candidate. This is used to avoid inserting duplicate edges
+when a pair of paths shares more than one tile.)doc";
 
 static const char *__doc_fiction_detail_generate_edge_intersection_graph_impl_layout = R"doc(Reference to the layout.)doc";
 
@@ -7566,6 +7842,21 @@ static const char *__doc_fiction_detail_generate_edge_intersection_graph_impl_ps
 
 static const char *__doc_fiction_detail_generate_edge_intersection_graph_impl_run = R"doc()doc";
 
+static const char *__doc_fiction_detail_generate_edge_intersection_graph_impl_terminal_index =
+R"doc(Maps each source coordinate to the targets and labels of all indexed
+paths starting there. Paths that share both source and target are
+always considered intersecting.)doc";
+
+static const char *__doc_fiction_detail_generate_edge_intersection_graph_impl_tile_index =
+R"doc(Inverted index that maps each coordinate to all paths that contain it.
+Without crossings, only the inner coordinates of each path are
+indexed, because a path's source and target are allowed to be shared.
+With crossings, each segment of size 2 is indexed by its first
+coordinate instead and its second coordinate is stored alongside the
+label. Thereby, only paths that actually share a tile have to be
+considered when looking for intersections instead of all paths
+enumerated thus far.)doc";
+
 static const char *__doc_fiction_detail_get_offset =
 R"doc(Utility function to calculate the offset that has to be subtracted
 from any x-coordinate on the hexagonal layout.
@@ -7702,6 +7993,17 @@ as better solutions are found.)doc";
 
 static const char *__doc_fiction_detail_graph_oriented_layout_design_impl_best_optimized_solution = R"doc(Current best solution w.r.t. area after relocating POs.)doc";
 
+static const char *__doc_fiction_detail_graph_oriented_layout_design_impl_best_solution =
+R"doc(Returns the cost of the best solution found so far w.r.t. the given
+cost objective.
+
+Parameter ``cost_objective``:
+    The cost objective.
+
+Returns:
+    Reference to the cost of the best solution, which is the maximum
+    possible value as long as no solution has been found.)doc";
+
 static const char *__doc_fiction_detail_graph_oriented_layout_design_impl_best_wire_solution =
 R"doc(The current best solution with respect to the number of wire segments,
 initialized to the maximum possible value. This value will be updated
@@ -7749,6 +8051,20 @@ Returns:
 
 static const char *__doc_fiction_detail_graph_oriented_layout_design_impl_custom_cost_objective = R"doc(Custom cost objective.)doc";
 
+static const char *__doc_fiction_detail_graph_oriented_layout_design_impl_fetch_min =
+R"doc(Atomically replaces the given value by the candidate if the candidate
+is smaller. Search space graphs that are processed concurrently may
+publish their solutions at the same time.
+
+Parameter ``value``:
+    The value to update.
+
+Parameter ``candidate``:
+    The candidate value.
+
+Returns:
+    `true` iff `value` was replaced.)doc";
+
 static const char *__doc_fiction_detail_graph_oriented_layout_design_impl_get_possible_positions =
 R"doc(Retrieves the possible positions for a given node in the layout based
 on its type and preceding nodes. It determines the type of the node
@@ -7875,34 +8191,6 @@ Parameter ``p``:
 Parameter ``st``:
     The statistics object to record execution details.)doc";
 
-static const char *__doc_fiction_detail_graph_oriented_layout_design_impl_improve_acp_solution =
-R"doc(Flag indicating that an initial solution has been found with the area-
-crossings product as cost objective. When set to `true`, subsequent
-search space graphs with the area-crossing product as cost objective
-can be pruned.)doc";
-
-static const char *__doc_fiction_detail_graph_oriented_layout_design_impl_improve_area_solution =
-R"doc(Flag indicating that an initial solution has been found with the
-layout area as cost objective. When set to `true`, subsequent search
-space graphs with the layout area as cost objective can be pruned.)doc";
-
-static const char *__doc_fiction_detail_graph_oriented_layout_design_impl_improve_crossing_solution =
-R"doc(Flag indicating that an initial solution has been found with the
-number of crossings as cost objective. When set to `true`, subsequent
-search space graphs with the number of crossings as cost objective can
-be pruned.)doc";
-
-static const char *__doc_fiction_detail_graph_oriented_layout_design_impl_improve_custom_solution =
-R"doc(Flag indicating that an initial solution has been found with a custom
-cost objective. When set to `true`, subsequent search space graphs
-with a custom cost objective can be pruned.)doc";
-
-static const char *__doc_fiction_detail_graph_oriented_layout_design_impl_improve_wire_solution =
-R"doc(Flag indicating that an initial solution has been found with the
-number of wire segments as cost objective. When set to `true`,
-subsequent search space graphs with the number of wire segments as
-cost objective can be pruned.)doc";
-
 static const char *__doc_fiction_detail_graph_oriented_layout_design_impl_initialize_layout =
 R"doc(Initializes the layout with minimum width
 
@@ -8017,6 +8305,12 @@ best found layout.
 Returns:
     The best layout found by the algorithm.)doc";
 
+static const char *__doc_fiction_detail_graph_oriented_layout_design_impl_solution_found =
+R"doc(Checks if a solution has been found w.r.t. any cost objective.
+
+Returns:
+    `true` iff a solution has been found.)doc";
+
 static const char *__doc_fiction_detail_graph_oriented_layout_design_impl_ssg_vec = R"doc(Vector of search space graphs.)doc";
 
 static const char *__doc_fiction_detail_graph_oriented_layout_design_impl_start = R"doc(Start time.)doc";
@@ -8025,6 +8319,16 @@ static const char *__doc_fiction_detail_graph_oriented_layout_design_impl_timeou
 
 static const char *__doc_fiction_detail_graph_oriented_layout_design_impl_timeout_limit_reached = R"doc(Timeout limit reached.)doc";
 
+static const char *__doc_fiction_detail_graph_oriented_layout_design_impl_to_layout =
+R"doc(Converts a layout of the type used during the search into the
+requested layout type.
+
+Parameter ``lyt``:
+    Layout found during the search.
+
+Returns:
+    `lyt` as a layout of type `Lyt`.)doc";
+
 static const char *__doc_fiction_detail_graph_oriented_layout_design_impl_update_stats =
 R"doc(This function updates statistical metrics.
 
@@ -8331,6 +8635,11 @@ static const char *__doc_fiction_detail_ground_state_space_impl_potential_bound_
 R"doc(Switch used to analyse multiset charge configurations without
 composition information.)doc";
 
+static const char *__doc_fiction_detail_ground_state_space_impl_profile =
+R"doc(Profile of the construction. It is declared first such that the
+construction of the cluster hierarchy in the constructor can be
+profiled as well.)doc";
+
 static const char *__doc_fiction_detail_ground_state_space_impl_projector_state_count =
 R"doc(Count the total number of projector states that are stored in the
 constructed hierarchy.)doc";
@@ -8990,6 +9299,18 @@ the canvas SiDBs satisfies the criteria for physical validity.)doc";
 
 static const char *__doc_fiction_detail_layout_invalidity_reason_POTENTIAL_POSITIVE_CHARGES = R"doc(Positive SiDBs can potentially occur.)doc";
 
+static const char *__doc_fiction_detail_load_little_endian =
+R"doc(Decodes an unsigned integer from its little-endian encoding.
+
+Template parameter ``T``:
+    Unsigned integer type.
+
+Parameter ``bytes``:
+    Pointer to the first of `sizeof(T)` bytes.
+
+Returns:
+    The decoded value.)doc";
+
 static const char *__doc_fiction_detail_nested_vector_hash =
 R"doc(This struct defines a hash function for a nested vector of layout
 tiles. It calculates a combined hash value for a vector of tiles based
@@ -9044,6 +9365,16 @@ static const char *__doc_fiction_detail_non_operationality_reason_POTENTIAL_POSI
 
 static const char *__doc_fiction_detail_operational_domain_impl = R"doc()doc";
 
+static const char *__doc_fiction_detail_operational_domain_impl_add_to_domain =
+R"doc(Adds a value to the operational domain and appends it to the stream
+file, if any.
+
+Parameter ``param_point``:
+    The parameter point to associate with the value.
+
+Parameter ``value``:
+    The value to add.)doc";
+
 static const char *__doc_fiction_detail_operational_domain_impl_canvas_lyt = R"doc(This layout consists of the canvas cells of the layout.)doc";
 
 static const char *__doc_fiction_detail_operational_domain_impl_contour_tracing =
@@ -9064,6 +9395,10 @@ Parameter ``samples``:
 Returns:
     The (partial) operational domain of the layout.)doc";
 
+static const char *__doc_fiction_detail_operational_domain_impl_domain_stream =
+R"doc(The stream that each evaluated parameter point is appended to or
+`nullptr` if no stream file is given.)doc";
+
 static const char *__doc_fiction_detail_operational_domain_impl_find_operational_contour_step_point =
 R"doc(Finds a boundary starting point for the contour tracing algorithm.
 This function starts at the given starting point and moves towards the
@@ -9129,6 +9464,12 @@ Returns:
     A vector of unique random `step_point`s in the stored parameter
     range of size at most equal to `samples`.)doc";
 
+static const char *__doc_fiction_detail_operational_domain_impl_grid_axes =
+R"doc(Returns the axes of the dense grid that contains all step points.
+
+Returns:
+    One axis per dimension.)doc";
+
 static const char *__doc_fiction_detail_operational_domain_impl_grid_search =
 R"doc(Performs a grid search over the specified parameter ranges with the
 specified step sizes. The grid search always has quadratic complexity.
@@ -9206,7 +9547,7 @@ where :math:`i` is the number of inputs of the layout. This function
 is used by all operational domain computation techniques.
 
 Any investigated point is added to the stored `op_domain`, regardless
-of its operational status.
+of its operational status, and appended to the stream file, if any.
 
 Parameter ``sp``:
     Step point to be investigated.
@@ -9284,11 +9625,17 @@ static const char *__doc_fiction_detail_operational_domain_impl_number_of_thread
 
 static const char *__doc_fiction_detail_operational_domain_impl_op_domain = R"doc(The operational domain of the layout.)doc";
 
+static const char *__doc_fiction_detail_operational_domain_impl_open_stream =
+R"doc(Opens the stream file given in the parameters, if any. If resuming is
+enabled, the parameter points stored in an existing file are loaded
+into the operational domain such that they are not evaluated again.)doc";
+
 static const char *__doc_fiction_detail_operational_domain_impl_operational_domain_impl =
 R"doc(Standard constructor. Initializes the lyt, the truth table, the
 parameters and the statistics. Also detects the output BDL pair, which
 is necessary for the operational domain computation. The lyt must have
-exactly one output BDL pair.
+exactly one output BDL pair. If a stream file is given in `ps`, it is
+opened as well.
 
 Parameter ``lyt``:
     SiDB cell-level lyt to be evaluated.
@@ -9301,7 +9648,14 @@ Parameter ``ps``:
     Parameters for the operational domain computation.
 
 Parameter ``st``:
-    Statistics of the process.)doc";
+    Statistics of the process.
+
+Throws:
+    std::invalid_argument if the stream file should be resumed but
+    does not match the sweep dimensions.
+
+Throws:
+    std::ofstream::failure if the stream file could not be opened.)doc";
 
 static const char *__doc_fiction_detail_operational_domain_impl_operational_domain_impl_2 =
 R"doc(Additional Constructor. Initializes the layout, the parameters and the
@@ -9322,6 +9676,17 @@ static const char *__doc_fiction_detail_operational_domain_impl_output_bdl_wires
 
 static const char *__doc_fiction_detail_operational_domain_impl_params = R"doc(The parameters for the operational domain computation.)doc";
 
+static const char *__doc_fiction_detail_operational_domain_impl_prepare_storage =
+R"doc(Switches the operational domain to a dense grid storage if requested
+by the parameters.
+
+Parameter ``exhaustive``:
+    Whether the entire parameter space is going to be evaluated. This
+    determines the storage if `params.storage` is `AUTOMATIC`.
+
+Returns:
+    `true` iff the operational domain uses a dense grid storage.)doc";
+
 static const char *__doc_fiction_detail_operational_domain_impl_random_sampling =
 R"doc(Performs a random sampling of the specified number of samples within
 the specified parameter range. The operational status is computed for
@@ -9853,6 +10218,16 @@ queue.
 Returns:
     The element with the highest priority.)doc";
 
+static const char *__doc_fiction_detail_priority_queue_peek =
+R"doc(Returns the elements with the highest priorities in the order in which
+they would be retrieved without removing them from the queue.
+
+Parameter ``n``:
+    Maximum number of elements to return.
+
+Returns:
+    Up to `n` elements with the highest priorities.)doc";
+
 static const char *__doc_fiction_detail_priority_queue_put =
 R"doc(Adds an element to the priority queue with a given priority.
 
@@ -9970,6 +10345,10 @@ Template parameter ``ChargeLyt``:
 Parameter ``charge_layout``:
     Initialized charge layout.)doc";
 
+static const char *__doc_fiction_detail_read_fbl_layout_impl_lyt = R"doc(The layout which will be altered based on the parsed information.)doc";
+
+static const char *__doc_fiction_detail_read_fbl_layout_impl_reader = R"doc(Decoder for the contents of the FBL file.)doc";
+
 static const char *__doc_fiction_detail_read_fgl_layout_impl = R"doc()doc";
 
 static const char *__doc_fiction_detail_read_fgl_layout_impl_gate_storage =
@@ -10052,8 +10431,31 @@ static const char *__doc_fiction_detail_read_sidb_surface_defects_impl_lyt = R"d
 
 static const char *__doc_fiction_detail_read_sidb_surface_defects_impl_max_cell_pos = R"doc()doc";
 
+static const char *__doc_fiction_detail_read_sidb_surface_defects_impl_parse_row =
+R"doc(Assigns the defects of a single row. Entries of index 0, i.e., `NONE`,
+are skipped without touching the surface.
+
+Parameter ``begin``:
+    Start of the row contents after the opening bracket.
+
+Parameter ``end``:
+    End of the row contents at the closing bracket.
+
+Parameter ``num_entries``:
+    Number of entries in the row.
+
+Parameter ``y``:
+    Index of the row.)doc";
+
 static const char *__doc_fiction_detail_read_sidb_surface_defects_impl_read_sidb_surface_defects_impl = R"doc()doc";
 
+static const char *__doc_fiction_detail_read_sidb_surface_defects_impl_reserve_defects =
+R"doc(Reserves storage for the defects on the surface. Since every index of
+a defect other than `NONE` contains at least one non-zero digit, the
+number of non-zero digits is an upper bound for the number of defects.
+Counting them is a single branch-free pass over the data that
+compilers vectorize.)doc";
+
 static const char *__doc_fiction_detail_read_sidb_surface_defects_impl_run = R"doc()doc";
 
 static const char *__doc_fiction_detail_read_sqd_layout_impl = R"doc()doc";
@@ -10074,75 +10476,125 @@ Parameter ``l``:
 Returns:
     The cell position converted from the dimer position.)doc";
 
+static const char *__doc_fiction_detail_read_sqd_layout_impl_element_text = R"doc(Text content of the element that was read last by `read_text`.)doc";
+
+static const char *__doc_fiction_detail_read_sqd_layout_impl_incl_cells = R"doc(Cells covered by the defect that is currently being parsed.)doc";
+
 static const char *__doc_fiction_detail_read_sqd_layout_impl_is = R"doc(The input stream from which the SQD file is read.)doc";
 
 static const char *__doc_fiction_detail_read_sqd_layout_impl_lyt = R"doc(The layout to which the parsed cells are added.)doc";
 
 static const char *__doc_fiction_detail_read_sqd_layout_impl_max_cell_pos = R"doc(The maximum position of a cell in the layout.)doc";
 
+static const char *__doc_fiction_detail_read_sqd_layout_impl_next_child =
+R"doc(Advances to the next child element of the current element.
+
+Returns:
+    `true` if a child element was found and `false` if the current
+    element was closed instead.)doc";
+
 static const char *__doc_fiction_detail_read_sqd_layout_impl_parse_db_dot =
 R"doc(Parses a <dbdot> element from the SQD file and adds the respective dot
-to the layout.
+to the layout. If the element has no <type> child, the dot is assumed
+to be normal.)doc";
 
-Parameter ``db_dot``:
-    The <dbdot> element.)doc";
+static const char *__doc_fiction_detail_read_sqd_layout_impl_parse_db_layer =
+R"doc(Parses a <layer> element of type DB and adds all of its dots to the
+layout.)doc";
 
 static const char *__doc_fiction_detail_read_sqd_layout_impl_parse_defect =
 R"doc(Parses a <defect> element from the SQD file and adds the respective
-defect to the layout if it implements the has_assign_sidb_defect
-function..
-
-Parameter ``label``:
-    The <defect> element.)doc";
+defect to the layout.)doc";
 
 static const char *__doc_fiction_detail_read_sqd_layout_impl_parse_defect_label =
-R"doc(Parses a <val> attribute of a <type_label> element of a <property_map>
-element from the SQD file and converts it to the respective SiDB
-defect type.
+R"doc(Converts the text of a <val> element of a <type_label> element of a
+<property_map> element from the SQD file to the respective SiDB defect
+type.
 
 Parameter ``label``:
-    The <type_label> element's <val> attribute.
+    The text of the <val> element.
 
 Returns:
     The SiDB defect type corresponding to the given label.)doc";
 
+static const char *__doc_fiction_detail_read_sqd_layout_impl_parse_defects_layer =
+R"doc(Parses a <layer> element of type Defects and adds all of its defects
+to the layout if it implements the `assign_sidb_defect` function.
+Otherwise, the layer is skipped.)doc";
+
+static const char *__doc_fiction_detail_read_sqd_layout_impl_parse_design = R"doc(Parses the <design> element and all of its <layer> elements.)doc";
+
 static const char *__doc_fiction_detail_read_sqd_layout_impl_parse_dot_type =
-R"doc(Parses the <type> attribute of a <dbdot> element from the SQD file and
-returns the corresponding cell type.
+R"doc(Converts the text of a <type> element of a <dbdot> element from the
+SQD file to the corresponding cell type.
 
-Parameter ``db_dot``:
-    The <dbdot> element.
+Parameter ``type``:
+    The text of the <type> element.
 
 Returns:
-    The cell type specified by the <dbdot> element. If non is
-    specified, the cell type is assumed to be normal.)doc";
+    The cell type specified by the <type> element.)doc";
 
 static const char *__doc_fiction_detail_read_sqd_layout_impl_parse_lat_type =
-R"doc(Parses a <latcoord> element from the SQD file and returns its
-specified cell position.
+R"doc(Checks whether the given lattice orientation name matches the lattice
+orientation of `Lyt`.
+
+Parameter ``name``:
+    The name of the lattice orientation as specified in the SQD file.)doc";
+
+static const char *__doc_fiction_detail_read_sqd_layout_impl_parse_lat_vec =
+R"doc(Parses a <lat_vec> element and checks the lattice orientation
+specified in its <name> element.)doc";
 
-Parameter ``latcoord``:
-    The <latcoord> element.
+static const char *__doc_fiction_detail_read_sqd_layout_impl_parse_latcoord =
+R"doc(Parses the attributes of the current <latcoord> element and returns
+its specified cell position.
 
 Returns:
     The cell position specified by the <latcoord> element.)doc";
 
-static const char *__doc_fiction_detail_read_sqd_layout_impl_parse_latcoord =
-R"doc(Parses a <latcoord> element from the SQD file and returns its
-specified cell position.
+static const char *__doc_fiction_detail_read_sqd_layout_impl_parse_layer_prop =
+R"doc(Parses a <layer_prop> element and checks the lattice orientation
+specified in its <lat_vec> element.)doc";
 
-Parameter ``latcoord``:
-    The <latcoord> element.
+static const char *__doc_fiction_detail_read_sqd_layout_impl_parse_layers =
+R"doc(Parses the <layers> element and checks the lattice orientation
+specified in its first <layer_prop> element.)doc";
+
+static const char *__doc_fiction_detail_read_sqd_layout_impl_parse_property_map =
+R"doc(Parses a <property_map> element of a <defect> element and returns the
+defect type given by its first <type_label> element.
 
 Returns:
-    The cell position specified by the <latcoord> element.)doc";
+    The SiDB defect type specified by the <property_map> element.)doc";
+
+static const char *__doc_fiction_detail_read_sqd_layout_impl_parse_siqad = R"doc(Parses the <siqad> root element.)doc";
 
 static const char *__doc_fiction_detail_read_sqd_layout_impl_read_sqd_layout_impl = R"doc()doc";
 
 static const char *__doc_fiction_detail_read_sqd_layout_impl_read_sqd_layout_impl_2 = R"doc()doc";
 
+static const char *__doc_fiction_detail_read_sqd_layout_impl_read_text =
+R"doc(Reads the text content of the current element up to its closing tag.
+Child elements are skipped.
+
+Returns:
+    The text content of the current element. Empty if it does not
+    contain any non-whitespace text.)doc";
+
+static const char *__doc_fiction_detail_read_sqd_layout_impl_reserve_storage =
+R"doc(Reserves storage in the layout for all <dbdot> and <defect> elements
+in the input such that the layout's hash maps do not have to rehash
+while the file is parsed. To this end, the elements are counted in a
+fast pass over the raw input before the stream is rewound. Streams
+that cannot be rewound, e.g., pipes, are parsed without reserving
+storage.)doc";
+
 static const char *__doc_fiction_detail_read_sqd_layout_impl_run = R"doc()doc";
 
+static const char *__doc_fiction_detail_read_sqd_layout_impl_skip_element =
+R"doc(Skips the remainder of the current element including all of its
+children.)doc";
+
 static const char *__doc_fiction_detail_read_sqd_layout_impl_update_bounding_box =
 R"doc(Updates the bounding box given by the maximum position of a cell in
 the layout
@@ -10151,6 +10603,8 @@ Parameter ``cell``:
     The cell to challenge the stored maximum position of a cell in the
     layout against.)doc";
 
+static const char *__doc_fiction_detail_read_sqd_layout_impl_xml = R"doc(The parser that reads the SQD file element by element.)doc";
+
 static const char *__doc_fiction_detail_recursively_paint_edges = R"doc()doc";
 
 static const char *__doc_fiction_detail_routing_objective_with_fanin_update_information =
@@ -10367,21 +10821,193 @@ left.)doc";
 
 static const char *__doc_fiction_detail_search_space_graph_planar = R"doc(Create planar layouts.)doc";
 
-static const char *__doc_fiction_detail_sweep_parameter_to_string =
-R"doc(Converts a sweep parameter to a string representation. This is used to
-write the parameter name to the CSV file.
+static const char *__doc_fiction_detail_search_space_graph_speculative_expansions =
+R"doc(Speculative expansions of the vertices that follow the current one in
+the frontier, keyed by the Zobrist hash of their placement sequences.)doc";
 
-Parameter ``param``:
-    The sweep parameter to be converted.
+static const char *__doc_fiction_detail_sidb_defects_is_digit =
+R"doc(Checks whether the given character is a decimal digit.
+
+Parameter ``c``:
+    Character to check.
 
 Returns:
-    The string representation of the sweep parameter.)doc";
+    `true` iff `c` is in `[0-9]`.)doc";
 
-static const char *__doc_fiction_detail_technology_mapping_impl = R"doc()doc";
+static const char *__doc_fiction_detail_sidb_defects_is_space =
+R"doc(Checks whether the given character is a whitespace character, i.e.,
+one of `[ \t\n\v\f\r]`.
 
-static const char *__doc_fiction_detail_technology_mapping_impl_ntk = R"doc(Input network to be mapped.)doc";
+Parameter ``c``:
+    Character to check.
 
-static const char *__doc_fiction_detail_technology_mapping_impl_params = R"doc(Technology mapping parameters.)doc";
+Returns:
+    `true` iff `c` is a whitespace character.)doc";
+
+static const char *__doc_fiction_detail_sqd_xml_pull_parser =
+R"doc(A minimal XML pull parser that reads its input incrementally from a
+stream buffer. In contrast to a DOM parser, it only ever holds the
+currently parsed tag in memory such that documents with millions of
+elements can be processed with constant memory overhead.
+
+It supports the subset of XML that is used by SiQAD, i.e., elements,
+attributes, text, entity and character references, and CDATA sections.
+Comments, processing instructions, and document type declarations are
+skipped.)doc";
+
+static const char *__doc_fiction_detail_sqd_xml_pull_parser_append_utf8 =
+R"doc(Appends the UTF-8 encoding of the given code point to the given
+string.
+
+Parameter ``str``:
+    String to append to.
+
+Parameter ``code_point``:
+    Unicode code point.)doc";
+
+static const char *__doc_fiction_detail_sqd_xml_pull_parser_attribute =
+R"doc(Returns the value of the given attribute of the element of the last
+`START_ELEMENT` event. The returned pointer is invalidated by the next
+call to `next`.
+
+Parameter ``key``:
+    Attribute name.
+
+Returns:
+    Pointer to the attribute value or `nullptr` if the element does
+    not have the attribute.)doc";
+
+static const char *__doc_fiction_detail_sqd_xml_pull_parser_attributes =
+R"doc(Attributes of the current element. Entries beyond `num_attributes` are
+kept to reuse their storage.)doc";
+
+static const char *__doc_fiction_detail_sqd_xml_pull_parser_consume =
+R"doc(Consumes the given string if the input continues with it. Characters
+are only consumed if they match.
+
+Parameter ``str``:
+    String to consume.
+
+Returns:
+    `true` iff the entire string was consumed.)doc";
+
+static const char *__doc_fiction_detail_sqd_xml_pull_parser_depth = R"doc(Number of currently open elements.)doc";
+
+static const char *__doc_fiction_detail_sqd_xml_pull_parser_element_name = R"doc(Name of the current element.)doc";
+
+static const char *__doc_fiction_detail_sqd_xml_pull_parser_event = R"doc(Events reported by the parser.)doc";
+
+static const char *__doc_fiction_detail_sqd_xml_pull_parser_event_END_ELEMENT = R"doc(A closing tag was read or a self-closing tag was completed.)doc";
+
+static const char *__doc_fiction_detail_sqd_xml_pull_parser_event_END_OF_DOCUMENT = R"doc(The end of the document was reached.)doc";
+
+static const char *__doc_fiction_detail_sqd_xml_pull_parser_event_START_ELEMENT = R"doc(An opening tag or a self-closing tag was read.)doc";
+
+static const char *__doc_fiction_detail_sqd_xml_pull_parser_event_TEXT = R"doc(Text content that does not consist of whitespace only was read.)doc";
+
+static const char *__doc_fiction_detail_sqd_xml_pull_parser_get_char =
+R"doc(Reads the next character and throws if the end of the file was
+reached.)doc";
+
+static const char *__doc_fiction_detail_sqd_xml_pull_parser_name =
+R"doc(Returns the name of the element of the last `START_ELEMENT` or
+`END_ELEMENT` event.
+
+Returns:
+    Element name.)doc";
+
+static const char *__doc_fiction_detail_sqd_xml_pull_parser_next =
+R"doc(Advances to the next event in the document.
+
+Returns:
+    The next event.
+
+Throws:
+    sqd_parsing_error if the document is not well-formed.)doc";
+
+static const char *__doc_fiction_detail_sqd_xml_pull_parser_num_attributes = R"doc(Number of attributes of the current element.)doc";
+
+static const char *__doc_fiction_detail_sqd_xml_pull_parser_open_elements =
+R"doc(Names of all currently open elements. Entries beyond `depth` are kept
+to reuse their storage.)doc";
+
+static const char *__doc_fiction_detail_sqd_xml_pull_parser_pending_end_element =
+R"doc(Flag to indicate that the last start tag was self-closing such that
+its end event is still to be reported.)doc";
+
+static const char *__doc_fiction_detail_sqd_xml_pull_parser_read_attribute = R"doc(Reads an attribute of the current start tag.)doc";
+
+static const char *__doc_fiction_detail_sqd_xml_pull_parser_read_cdata =
+R"doc(Reads the contents of a CDATA section whose opening sequence was
+already consumed.)doc";
+
+static const char *__doc_fiction_detail_sqd_xml_pull_parser_read_end_tag = R"doc(Reads an end tag whose leading "</" was already consumed.)doc";
+
+static const char *__doc_fiction_detail_sqd_xml_pull_parser_read_name =
+R"doc(Reads an element or attribute name.
+
+Parameter ``name``:
+    String to store the name in.)doc";
+
+static const char *__doc_fiction_detail_sqd_xml_pull_parser_read_reference =
+R"doc(Resolves an entity or character reference whose leading '&' was
+already consumed and appends the result to the given string. Unknown
+references are kept verbatim.
+
+Parameter ``str``:
+    String to append to.)doc";
+
+static const char *__doc_fiction_detail_sqd_xml_pull_parser_read_start_tag = R"doc(Reads a start tag whose leading '<' was already consumed.)doc";
+
+static const char *__doc_fiction_detail_sqd_xml_pull_parser_read_text =
+R"doc(Reads text up to the next tag.
+
+Returns:
+    `true` iff the text contains at least one non-whitespace
+    character.)doc";
+
+static const char *__doc_fiction_detail_sqd_xml_pull_parser_sb = R"doc(The stream buffer to read from.)doc";
+
+static const char *__doc_fiction_detail_sqd_xml_pull_parser_skip_declaration =
+R"doc(Skips a document type declaration including a potential internal
+subset.)doc";
+
+static const char *__doc_fiction_detail_sqd_xml_pull_parser_skip_until =
+R"doc(Skips all characters up to and including the given terminator.
+
+Parameter ``terminator``:
+    Terminating character sequence.)doc";
+
+static const char *__doc_fiction_detail_sqd_xml_pull_parser_sqd_xml_pull_parser =
+R"doc(Standard constructor.
+
+Parameter ``is``:
+    The input stream to read from.)doc";
+
+static const char *__doc_fiction_detail_sqd_xml_pull_parser_text =
+R"doc(Returns the text of the last `TEXT` event with all entity and
+character references resolved.
+
+Returns:
+    Text content.)doc";
+
+static const char *__doc_fiction_detail_sqd_xml_pull_parser_text_content = R"doc(Current text content.)doc";
+
+static const char *__doc_fiction_detail_sweep_parameter_to_string =
+R"doc(Converts a sweep parameter to a string representation. This is used to
+write the parameter name to the CSV file.
+
+Parameter ``param``:
+    The sweep parameter to be converted.
+
+Returns:
+    The string representation of the sweep parameter.)doc";
+
+static const char *__doc_fiction_detail_technology_mapping_impl = R"doc()doc";
+
+static const char *__doc_fiction_detail_technology_mapping_impl_ntk = R"doc(Input network to be mapped.)doc";
+
+static const char *__doc_fiction_detail_technology_mapping_impl_params = R"doc(Technology mapping parameters.)doc";
 
 static const char *__doc_fiction_detail_technology_mapping_impl_perform_mapping =
 R"doc(Perform technology mapping with the given number of inputs.
@@ -10483,6 +11109,26 @@ Constructs topological view on another network.)doc";
 
 static const char *__doc_fiction_detail_topo_view_co_to_ci_update_topo = R"doc()doc";
 
+static const char *__doc_fiction_detail_tracked_free =
+R"doc(Frees memory for the global `operator delete` and records the
+deallocation.
+
+Parameter ``ptr``:
+    Pointer to the memory to free.)doc";
+
+static const char *__doc_fiction_detail_tracked_malloc =
+R"doc(Allocates memory for the global `operator new` and records the
+allocation.
+
+Parameter ``size``:
+    Number of bytes to allocate.
+
+Returns:
+    Pointer to the allocated memory.
+
+Throws:
+    std::bad_alloc if the allocation fails.)doc";
+
 static const char *__doc_fiction_detail_update_to_delete_list =
 R"doc(Update the to-delete list based on a possible path in a
 wiring_reduction_layout.
@@ -10522,6 +11168,32 @@ Parameter ``params``:
 Throws:
     std::invalid_argument if the sweep parameters are invalid.)doc";
 
+static const char *__doc_fiction_detail_vertex_expansion =
+R"doc(The result of expanding a vertex of a search space graph.
+
+Template parameter ``Lyt``:
+    Cartesian gate-level layout type.)doc";
+
+static const char *__doc_fiction_detail_vertex_expansion_bound =
+R"doc(Cost of the best solution that was known for the cost objective of the
+search space graph when the vertex was expanded. Partial layouts whose
+costs reach it are pruned.)doc";
+
+static const char *__doc_fiction_detail_vertex_expansion_cost =
+R"doc(Cost of `solution` w.r.t. the cost objective of the search space graph
+before relocating its POs.)doc";
+
+static const char *__doc_fiction_detail_vertex_expansion_optimized_cost =
+R"doc(Cost of `solution` w.r.t. the desired cost objective after relocating
+its POs.)doc";
+
+static const char *__doc_fiction_detail_vertex_expansion_solution =
+R"doc(The layout after relocating its POs if the vertex completes the
+placement and does not exceed `bound`.)doc";
+
+static const char *__doc_fiction_detail_vertex_expansion_successors =
+R"doc(The successor vertices with their priorities.)doc";
+
 static const char *__doc_fiction_detail_wire_east = R"doc()doc";
 
 static const char *__doc_fiction_detail_wire_south = R"doc()doc";
@@ -10704,6 +11376,67 @@ Parameter ``direction``:
     The search direction to be used. Defaults to HORIZONTAL if not
     provided.)doc";
 
+static const char *__doc_fiction_detail_write_fbl_layout_impl_FLUSH_THRESHOLD = R"doc(Size in bytes from which on the buffer is written to the stream.)doc";
+
+static const char *__doc_fiction_detail_write_fbl_layout_impl_buffer =
+R"doc(Buffer that collects encoded data before it is written to the stream
+in large chunks.)doc";
+
+static const char *__doc_fiction_detail_write_fbl_layout_impl_lyt = R"doc(The layout to be written.)doc";
+
+static const char *__doc_fiction_detail_write_fbl_layout_impl_os = R"doc(The output stream to which the layout is written.)doc";
+
+static const char *__doc_fiction_detail_write_fgl_element =
+R"doc(Writes a single gate or wire element, including its incoming signals
+if there are any.
+
+Template parameter ``Coordinate``:
+    Coordinate type.
+
+Template parameter ``Signals``:
+    Container type of the incoming signals' coordinates.
+
+Parameter ``os``:
+    Output stream to write into.
+
+Parameter ``id``:
+    ID of the element.
+
+Parameter ``type``:
+    FGL type of the element, e.g., as determined by `fgl_gate_type`.
+
+Parameter ``name``:
+    Name of the element, which is empty for all elements except for
+    primary inputs and outputs.
+
+Parameter ``t``:
+    Location of the element.
+
+Parameter ``incoming``:
+    Coordinates of the incoming signals.)doc";
+
+static const char *__doc_fiction_detail_write_fgl_element_2 =
+R"doc(Writes a single gate or wire element without incoming signals, e.g., a
+primary input.
+
+Template parameter ``Coordinate``:
+    Coordinate type.
+
+Parameter ``os``:
+    Output stream to write into.
+
+Parameter ``id``:
+    ID of the element.
+
+Parameter ``type``:
+    FGL type of the element.
+
+Parameter ``name``:
+    Name of the element.
+
+Parameter ``t``:
+    Location of the element.)doc";
+
 static const char *__doc_fiction_detail_write_fgl_layout_impl = R"doc()doc";
 
 static const char *__doc_fiction_detail_write_fgl_layout_impl_lyt = R"doc(The layout to be written.)doc";
@@ -10714,6 +11447,14 @@ static const char *__doc_fiction_detail_write_fgl_layout_impl_run = R"doc()doc";
 
 static const char *__doc_fiction_detail_write_fgl_layout_impl_write_fgl_layout_impl = R"doc()doc";
 
+static const char *__doc_fiction_detail_write_fgl_preamble =
+R"doc(Writes the XML declaration, opens the FGL root element, and writes the
+metadata of the fiction version that created the file, including the
+current date.
+
+Parameter ``os``:
+    Output stream to write into.)doc";
+
 static const char *__doc_fiction_detail_write_fqca_layout_impl = R"doc()doc";
 
 static const char *__doc_fiction_detail_write_fqca_layout_impl_alphabet_iterator = R"doc()doc";
@@ -11337,6 +12078,17 @@ R"doc(If cliques in the passed graph are known, they can be used for
 symmetry breaking in the SAT engine which significantly speeds up
 runtime. The bigger the cliques, the better.)doc";
 
+static const char *__doc_fiction_determine_vertex_coloring_sat_params_incremental =
+R"doc(Keep a single SAT solver alive across all checked values of :math:`k`
+instead of encoding each of them from scratch. To this end, the
+instance is encoded once for an upper bound determined via DSATUR and
+the colors that exceed the currently checked :math:`k` are disabled
+via an activation literal that is passed as an assumption. Thereby,
+all clauses, including the ones that the solver learned, are reused
+between the checks. Since the upper bound is known, `BINARY_SEARCH`
+skips its exponential phase and behaves like
+`UPPER_BOUND_BINARY_SEARCH`.)doc";
+
 static const char *__doc_fiction_determine_vertex_coloring_sat_params_sat_engine = R"doc(The SAT solver to use.)doc";
 
 static const char *__doc_fiction_determine_vertex_coloring_sat_params_sat_search_tactic = R"doc(The search tactic to apply.)doc";
@@ -11967,6 +12719,17 @@ static const char *__doc_fiction_exact_physical_design_params = R"doc(Parameters
 
 static const char *__doc_fiction_exact_physical_design_params_border_io = R"doc(Flag to indicate that I/Os should be placed at the layout's border.)doc";
 
+static const char *__doc_fiction_exact_physical_design_params_break_translation_symmetry =
+R"doc(Flag to indicate that symmetry breaking constraints should be added
+that exclude layouts which could be translated towards the origin,
+i.e., layouts whose first row or first column is empty. Such layouts
+would fit into a smaller aspect ratio that has already been examined.
+Only applies to Cartesian layouts clocked by 2DDWave, Columnar, or Row,
+whose clock zones are invariant under translation up to a relabeling of
+the clock numbers, and only if global synchronization is not enforced
+via path length constraints, no synchronization elements and no black
+list are used, and `fixed_size` is not set.)doc";
+
 static const char *__doc_fiction_exact_physical_design_params_crossings = R"doc(Flag to indicate that crossings may be used.)doc";
 
 static const char *__doc_fiction_exact_physical_design_params_desynchronize =
@@ -11997,6 +12760,20 @@ R"doc(Number of threads to use for exploring the possible aspect ratios.
 
 @note This is an unstable beta feature.)doc";
 
+static const char *__doc_fiction_exact_physical_design_params_portfolio =
+R"doc(Flag to indicate that the threads launched via `num_threads` should
+act as a solver portfolio. Each thread configures its Z3 solvers with a
+different random seed, aspect ratios proven UNSAT by one thread prune
+all aspect ratios they dominate for every other thread, and all workers
+are cancelled as soon as a minimal-area layout has been proven. Only
+has an effect if `num_threads > 1`.
+
+@note This is an unstable beta feature.)doc";
+
+static const char *__doc_fiction_exact_physical_design_params_portfolio_seed =
+R"doc(Base random seed for the solver portfolio. The solvers of thread
+:math:`i` use seed `portfolio_seed + i`.)doc";
+
 static const char *__doc_fiction_exact_physical_design_params_scheme = R"doc(Clocking scheme to be used.)doc";
 
 static const char *__doc_fiction_exact_physical_design_params_straight_inverters =
@@ -12034,12 +12811,26 @@ static const char *__doc_fiction_exact_physical_design_stats_duration = R"doc()d
 
 static const char *__doc_fiction_exact_physical_design_stats_num_aspect_ratios = R"doc()doc";
 
+static const char *__doc_fiction_exact_physical_design_stats_num_aspect_ratios_beyond_bounds =
+R"doc(Number of aspect ratios that were discarded because they exceed the
+upper bounds specified in the parameters.)doc";
+
 static const char *__doc_fiction_exact_physical_design_stats_num_crossings = R"doc()doc";
 
 static const char *__doc_fiction_exact_physical_design_stats_num_gates = R"doc()doc";
 
+static const char *__doc_fiction_exact_physical_design_stats_num_skipped_aspect_ratios =
+R"doc(Number of aspect ratios within the upper bounds that were discarded as
+infeasible before any SMT instance was generated, e.g., because they
+cannot host all I/O pins or do not provide enough tiles with
+sufficient degrees.)doc";
+
 static const char *__doc_fiction_exact_physical_design_stats_num_wires = R"doc()doc";
 
+static const char *__doc_fiction_exact_physical_design_stats_profile =
+R"doc(Time spent in fanout substitution and SMT solving as well as the
+memory usage of the entire process.)doc";
+
 static const char *__doc_fiction_exact_physical_design_stats_report = R"doc()doc";
 
 static const char *__doc_fiction_exact_physical_design_stats_x_size = R"doc()doc";
@@ -12267,6 +13058,52 @@ static const char *__doc_fiction_fanout_substitution_params_threshold =
 R"doc(Maximum number of outputs any gate is allowed to have before
 substitution applies.)doc";
 
+static const char *__doc_fiction_fbl_layout_info =
+R"doc(Information stored in the header of an FBL file. It can be used to
+determine the layout type that a file has to be read into before the
+file is parsed completely.)doc";
+
+static const char *__doc_fiction_fbl_layout_info_is_gate_level =
+R"doc(`true` iff the file contains a gate-level layout. Otherwise, it
+contains a cell-level layout.)doc";
+
+static const char *__doc_fiction_fbl_layout_info_lattice_orientation =
+R"doc(Lattice orientation of an SiDB layout, i.e., `100` or `111`. Empty if
+the layout has no lattice orientation.)doc";
+
+static const char *__doc_fiction_fbl_layout_info_name = R"doc(Name of the layout.)doc";
+
+static const char *__doc_fiction_fbl_layout_info_technology =
+R"doc(Technology of a cell-level layout, i.e., `QCA`, `iNML`, or `SiDB`.
+Empty for gate-level layouts.)doc";
+
+static const char *__doc_fiction_fbl_layout_info_topology =
+R"doc(Topology of the layout, i.e., `cartesian` or of the form
+`<odd|even>_<row|column>_<cartesian|hex>`.)doc";
+
+static const char *__doc_fiction_fbl_layout_info_version = R"doc(Version of the FBL format the file was written in.)doc";
+
+static const char *__doc_fiction_fbl_parsing_error =
+R"doc(Exception thrown when an error occurs during parsing of an .fbl file
+containing a gate-level or cell-level layout.)doc";
+
+static const char *__doc_fiction_fbl_parsing_error_fbl_parsing_error =
+R"doc(Constructs a `fbl_parsing_error` object with the given error message.
+
+Parameter ``msg``:
+    The error message describing the parsing error.)doc";
+
+static const char *__doc_fiction_fbl_write_error =
+R"doc(Exception thrown by `write_fbl_layout` if the given layout cannot be
+stored in an .fbl file, e.g., because the file could not be parsed
+again.)doc";
+
+static const char *__doc_fiction_fbl_write_error_fbl_write_error =
+R"doc(Constructs a `fbl_write_error` object with the given error message.
+
+Parameter ``msg``:
+    The error message describing why the layout cannot be stored.)doc";
+
 static const char *__doc_fiction_fcn_gate_library =
 R"doc(Base class for various FCN libraries used to map gate-level layouts to
 cell-level ones. Any new gate library can extend `fcn_gate_library` if
@@ -13056,6 +13893,18 @@ R"doc(Copy constructor from another `ClockedLayout`.
 Parameter ``lyt``:
     Clocked layout.)doc";
 
+static const char *__doc_fiction_gate_level_layout_gate_level_layout_6 =
+R"doc(Converting constructor from a gate-level layout that realizes its tile
+<-> node mapping via a different storage policy. Creates a deep copy
+of `other` whose nodes keep their indices, functions, children, names,
+and tiles. Events are not copied.
+
+Template parameter ``OtherTileStorage``:
+    Tile storage policy of `other`.
+
+Parameter ``other``:
+    Gate-level layout to convert.)doc";
+
 static const char *__doc_fiction_gate_level_layout_gate_level_layout_storage_data = R"doc()doc";
 
 static const char *__doc_fiction_gate_level_layout_gate_level_layout_storage_data_const0 = R"doc()doc";
@@ -13068,8 +13917,6 @@ static const char *__doc_fiction_gate_level_layout_gate_level_layout_storage_dat
 
 static const char *__doc_fiction_gate_level_layout_gate_level_layout_storage_data_node_names = R"doc()doc";
 
-static const char *__doc_fiction_gate_level_layout_gate_level_layout_storage_data_node_tile_map = R"doc()doc";
-
 static const char *__doc_fiction_gate_level_layout_gate_level_layout_storage_data_num_crossings = R"doc()doc";
 
 static const char *__doc_fiction_gate_level_layout_gate_level_layout_storage_data_num_gates = R"doc()doc";
@@ -13729,6 +14576,25 @@ static const char *__doc_fiction_gate_level_layout_pi_at = R"doc()doc";
 
 static const char *__doc_fiction_gate_level_layout_po_at = R"doc()doc";
 
+static const char *__doc_fiction_gate_level_layout_reserve_nodes =
+R"doc(Reserves storage for the given number of nodes including the two
+constants. As long as the layout does not exceed this number of nodes,
+creating new ones neither re-allocates the node storage nor rehashes
+the tile storage. This avoids peaks in memory consumption when large
+layouts are constructed whose number of nodes is known in advance.
+
+Parameter ``num_nodes``:
+    Expected number of nodes.)doc";
+
+static const char *__doc_fiction_gate_level_layout_resize =
+R"doc(Updates the layout's dimensions. To this end, it calls
+`ClockedLayout`'s resize function. Additionally, the tile storage is
+informed about the new dimensions such that a dense storage policy can
+pre-allocate its arrays.
+
+Parameter ``ar``:
+    New highest possible position in the layout.)doc";
+
 static const char *__doc_fiction_gate_level_layout_revive_node = R"doc()doc";
 
 static const char *__doc_fiction_gate_level_layout_set_input_name = R"doc()doc";
@@ -13797,6 +14663,13 @@ static const char *__doc_fiction_generate_edge_intersection_graph_params_crossin
 R"doc(Allow crossings by not creating edges between paths that only share
 single-coordinate sub-paths.)doc";
 
+static const char *__doc_fiction_generate_edge_intersection_graph_params_num_threads =
+R"doc(Number of threads used to enumerate the paths of the routing
+objectives. Since the objectives are independent, each thread
+enumerates the paths of entire objectives. The resulting graph does
+not depend on the number of threads. If set to 0, the number of
+hardware threads is used.)doc";
+
 static const char *__doc_fiction_generate_edge_intersection_graph_params_path_limit =
 R"doc(If a value is given, for each objective, only up to the `path_limit`
 shortest paths will be enumerated (using Yen's algorithm) instead of
@@ -13989,6 +14862,12 @@ static const char *__doc_fiction_get_unique_cluster_id_2 =
 R"doc(Forward declaration. Required for compilation due to the mutually
 recursive structure in this file.)doc";
 
+static const char *__doc_fiction_global_allocation_counters =
+R"doc(Returns the process-wide allocation counters.
+
+Returns:
+    Reference to the allocation counters.)doc";
+
 static const char *__doc_fiction_graph_coloring_engine =
 R"doc(An enumeration of coloring engines to use for the graph coloring. All
 but SAT are using the graph-coloring library by Brian Crites.)doc";
@@ -14043,6 +14922,13 @@ static const char *__doc_fiction_graph_coloring_sat_search_tactic_LINEARLY_DESCE
 R"doc(Descend linearly by checking for :math:`k = |G|, |G| - 1, |G| - 2,
 \dots` until UNSAT.)doc";
 
+static const char *__doc_fiction_graph_coloring_sat_search_tactic_UPPER_BOUND_BINARY_SEARCH =
+R"doc(First determine an upper bound :math:`u` via DSATUR, then perform
+binary search in the window :math:`[|C|, u]`, where :math:`|C|` is the
+largest clique size or 1 if no cliques are passed. If no coloring with
+less than :math:`u` colors exists, the DSATUR coloring is returned as
+it is optimal.)doc";
+
 static const char *__doc_fiction_graph_oriented_layout_design =
 R"doc(A scalable and efficient placement & routing approach based on
 spanning a search space graph of partial layouts and finding a path to
@@ -14178,6 +15064,23 @@ Default value: `false`)doc";
 
 static const char *__doc_fiction_graph_oriented_layout_design_params_mode = R"doc(The effort mode used. Defaults to HIGH_EFFORT.)doc";
 
+static const char *__doc_fiction_graph_oriented_layout_design_params_num_parallel_expansions =
+R"doc(Number of vertices of each search space graph that are expanded
+concurrently per step. Whereas `enable_multithreading` only
+distributes different search space graphs across threads, this option
+parallelizes the search within each graph and thereby also benefits
+the `HIGH_EFFICIENCY` mode.
+
+Besides the vertex to be expanded next, the vertices that follow it in
+the frontier are expanded speculatively. Such an expansion is only
+used once its vertex is taken from the frontier and if no solution
+that changes the pruning has been found in the meantime. Otherwise,
+the vertex is expanded again. Unless `enable_multithreading` is set as
+well, the search therefore explores the same vertices and returns the
+same layout as with one expansion per step.
+
+Default value: `1`, i.e., vertices are expanded one at a time.)doc";
+
 static const char *__doc_fiction_graph_oriented_layout_design_params_num_vertex_expansions =
 R"doc(Number of expansions for each vertex that should be explored. For each
 partial layout, `num_vertex_expansions` positions will be checked for
@@ -14212,6 +15115,10 @@ static const char *__doc_fiction_graph_oriented_layout_design_stats_num_gates =
 
 static const char *__doc_fiction_graph_oriented_layout_design_stats_num_wires = R"doc(Number of wires.)doc";
 
+static const char *__doc_fiction_graph_oriented_layout_design_stats_profile =
+R"doc(Time spent in the initialization and the expansion of the search space
+graphs as well as the memory usage of the entire process.)doc";
+
 static const char *__doc_fiction_graph_oriented_layout_design_stats_report =
 R"doc(Reports the statistics to the given output stream.
 
@@ -14573,6 +15480,11 @@ number of combinations of :math:`N` stars and :math:`b - 1` bars.
 Hence this is computed with the following combinatorial formula:
 :math:`\binom{N + b - 1}{b - 1}`.)doc";
 
+static const char *__doc_fiction_ground_state_space_results_profile =
+R"doc(Time spent in the construction of the cluster hierarchy, the charge
+space updates, and the merges as well as the memory usage of the
+entire process.)doc";
+
 static const char *__doc_fiction_ground_state_space_results_projector_state_count =
 R"doc(The total number of distinct projector states is counted. At each
 merge, the projector states in charge space compositions in the charge
@@ -14758,6 +15670,8 @@ static const char *__doc_fiction_has_ordinal_operations = R"doc()doc";
 
 static const char *__doc_fiction_has_post_layout_optimization = R"doc()doc";
 
+static const char *__doc_fiction_has_reserve_cells = R"doc()doc";
+
 static const char *__doc_fiction_has_set_layout_name = R"doc()doc";
 
 static const char *__doc_fiction_has_south = R"doc()doc";
@@ -15585,12 +16499,38 @@ rerouting (i.e., without crossings).)doc";
 
 static const char *__doc_fiction_hexagonalization_params_io_pin_extension_mode_NONE = R"doc(Do not extend primary inputs/outputs to the top/bottom row (default).)doc";
 
+static const char *__doc_fiction_hexagonalization_params_max_negotiation_iterations = R"doc(Maximum number of rip-up and reroute iterations of the negotiated-congestion router.)doc";
+
+static const char *__doc_fiction_hexagonalization_params_negotiated_congestion_routing =
+R"doc(Route all objectives that arise from extending primary inputs/outputs
+together with a negotiated-congestion router (PathFinder) instead of
+one after another. Paths may initially share coordinates, which are
+penalized increasingly over several rip-up and reroute iterations
+until all paths are disjoint. If the negotiation does not converge,
+the objectives are routed one after another.)doc";
+
+static const char *__doc_fiction_hexagonalization_params_num_threads =
+R"doc(Number of threads used to compute the coordinate transformation of
+the Cartesian tiles. Each thread maps entire diagonals, while the
+resulting gates are placed in diagonal order afterward. Thus, the
+result does not depend on the number of threads. If set to 0, the
+number of hardware threads is used.)doc";
+
 static const char *__doc_fiction_hexagonalization_params_output_pin_extension = R"doc(Output extension mode. Defaults to none)doc";
 
 static const char *__doc_fiction_hexagonalization_stats = R"doc(This struct stores statistics about the hexagonalization process.)doc";
 
 static const char *__doc_fiction_hexagonalization_stats_duration = R"doc(Runtime of the hexagonalization process.)doc";
 
+static const char *__doc_fiction_hexagonalization_stats_negotiation_converged =
+R"doc(Flag indicating that negotiated-congestion routing was enabled and all
+of its negotiations converged, i.e., no objectives had to be routed
+one after another instead.)doc";
+
+static const char *__doc_fiction_hexagonalization_stats_num_negotiation_iterations =
+R"doc(Total number of rip-up and reroute iterations of the negotiated-
+congestion router for the primary inputs and outputs.)doc";
+
 static const char *__doc_fiction_hexagonalization_stats_report =
 R"doc(Reports the statistics to the given output stream.
 
@@ -16453,6 +17393,46 @@ Template parameter ``Dist``:
 
 static const char *__doc_fiction_manhattan_distance_functor_manhattan_distance_functor = R"doc()doc";
 
+static const char *__doc_fiction_memory_mapped_file =
+R"doc(A read-only view of the contents of a file. On POSIX systems, regular
+files are memory-mapped such that their contents do not have to be
+copied into a buffer before they are parsed. This avoids reading files
+of several gigabytes into memory at once. On other platforms and for
+non-regular files, e.g., pipes, the contents are read into an internal
+buffer instead.)doc";
+
+static const char *__doc_fiction_memory_mapped_file_buffer = R"doc(File contents if the file could not be mapped.)doc";
+
+static const char *__doc_fiction_memory_mapped_file_mapping =
+R"doc(Start of the memory-mapped file contents or `nullptr` if the file is
+not mapped.)doc";
+
+static const char *__doc_fiction_memory_mapped_file_mapping_size = R"doc(Size of the memory-mapped region in bytes.)doc";
+
+static const char *__doc_fiction_memory_mapped_file_memory_mapped_file =
+R"doc(Opens the given file and maps its contents into memory.
+
+Parameter ``filename``:
+    The name of the file to open.
+
+Throws:
+    std::ifstream::failure if the file could not be opened or mapped.)doc";
+
+static const char *__doc_fiction_memory_mapped_file_memory_mapped_file_2 = R"doc()doc";
+
+static const char *__doc_fiction_memory_mapped_file_memory_mapped_file_3 = R"doc()doc";
+
+static const char *__doc_fiction_memory_mapped_file_operator_assign = R"doc()doc";
+
+static const char *__doc_fiction_memory_mapped_file_operator_assign_2 = R"doc()doc";
+
+static const char *__doc_fiction_memory_mapped_file_view =
+R"doc(Returns a view of the contents of the file. The view is valid as long
+as this object exists.
+
+Returns:
+    A view of the contents of the file.)doc";
+
 static const char *__doc_fiction_minimum_energy =
 R"doc(Computes the minimum energy of a range of
 `charge_distribution_surface` objects. If the range is empty, infinity
@@ -17131,7 +18111,11 @@ Returns:
     The operational domain of the layout.
 
 Throws:
-    std::invalid_argument if the given sweep parameters are invalid.)doc";
+    std::invalid_argument if the given sweep parameters are invalid or
+    do not match the stream file to resume from.
+
+Throws:
+    std::ofstream::failure if the stream file could not be opened.)doc";
 
 static const char *__doc_fiction_operational_domain_dimensions =
 R"doc(The dimensions to sweep over. The first dimension is the x dimension,
@@ -17195,7 +18179,11 @@ Returns:
     The operational domain of the layout.
 
 Throws:
-    std::invalid_argument if the given sweep parameters are invalid.)doc";
+    std::invalid_argument if the given sweep parameters are invalid or
+    do not match the stream file to resume from.
+
+Throws:
+    std::ofstream::failure if the stream file could not be opened.)doc";
 
 static const char *__doc_fiction_operational_domain_get_dimension =
 R"doc(Returns a specific dimension by index.
@@ -17258,7 +18246,11 @@ Returns:
     The operational domain of the layout.
 
 Throws:
-    std::invalid_argument if the given sweep parameters are invalid.)doc";
+    std::invalid_argument if the given sweep parameters are invalid or
+    do not match the stream file to resume from.
+
+Throws:
+    std::ofstream::failure if the stream file could not be opened.)doc";
 
 static const char *__doc_fiction_operational_domain_operational_domain = R"doc(Default constructor.)doc";
 
@@ -17272,10 +18264,34 @@ static const char *__doc_fiction_operational_domain_params =
 R"doc(Parameters for the operational domain computation. The parameters are
 used across the different operational domain computation algorithms.)doc";
 
+static const char *__doc_fiction_operational_domain_params_domain_storage = R"doc(Storage for the computed parameter points.)doc";
+
+static const char *__doc_fiction_operational_domain_params_domain_storage_AUTOMATIC =
+R"doc(Use `DENSE_GRID` for grid search and `HASH_MAP` for all other
+techniques.)doc";
+
+static const char *__doc_fiction_operational_domain_params_domain_storage_DENSE_GRID =
+R"doc(Store the parameter points in a dense array that is addressed by their
+step indices. The memory consumption is proportional to the total
+number of parameter points, but no lock is required to add points and
+no copy is created when iterating them.)doc";
+
+static const char *__doc_fiction_operational_domain_params_domain_storage_HASH_MAP =
+R"doc(Store the parameter points in a hash map. The memory consumption is
+proportional to the number of evaluated parameter points, which is
+preferable if only a small part of the parameter space is sampled.)doc";
+
 static const char *__doc_fiction_operational_domain_params_operational_params =
 R"doc(The parameters used to determine if a layout is operational or non-
 operational.)doc";
 
+static const char *__doc_fiction_operational_domain_params_storage = R"doc(Storage for the computed parameter points.)doc";
+
+static const char *__doc_fiction_operational_domain_params_stream =
+R"doc(Parameters for streaming each evaluated parameter point to a file as
+soon as its operational status is known. This allows for resuming
+long-running computations. By default, no file is written.)doc";
+
 static const char *__doc_fiction_operational_domain_params_sweep_dimensions =
 R"doc(The dimensions to sweep over together with their value ranges, ordered
 by priority. The first dimension is the x dimension, the second
@@ -17325,7 +18341,11 @@ Returns:
     The operational domain of the layout.
 
 Throws:
-    std::invalid_argument if the given sweep parameters are invalid.)doc";
+    std::invalid_argument if the given sweep parameters are invalid or
+    do not match the stream file to resume from.
+
+Throws:
+    std::ofstream::failure if the stream file could not be opened.)doc";
 
 static const char *__doc_fiction_operational_domain_ratio =
 R"doc(Calculates the ratio of operational parameter points surrounding a
@@ -17389,6 +18409,11 @@ static const char *__doc_fiction_operational_domain_stats_num_simulator_invocati
 
 static const char *__doc_fiction_operational_domain_stats_num_total_parameter_points = R"doc(Total number of parameter points in the parameter space.)doc";
 
+static const char *__doc_fiction_operational_domain_stats_profile =
+R"doc(Time spent in the different stages of the computation, e.g., random
+sampling, flood fill, or contour tracing, as well as the memory usage
+of the entire process.)doc";
+
 static const char *__doc_fiction_operational_domain_value_range =
 R"doc(A range of values for a dimension sweep. The range is defined by a
 minimum value, a maximum value and a step size.)doc";
@@ -17521,6 +18546,13 @@ static const char *__doc_fiction_orthogonal_physical_design_params = R"doc(Param
 
 static const char *__doc_fiction_orthogonal_physical_design_params_number_of_clock_phases = R"doc(Number of clock phases to use. 3 and 4 are supported.)doc";
 
+static const char *__doc_fiction_orthogonal_physical_design_params_two_pass =
+R"doc(Run the algorithm twice on Cartesian layouts. The first pass only
+determines the number of elements to place without constructing the
+layout, which is then used to pre-allocate the layout's storage in the
+second pass. This avoids rehashing and reallocations when laying out
+very large networks. The result is identical either way.)doc";
+
 static const char *__doc_fiction_orthogonal_physical_design_stats = R"doc()doc";
 
 static const char *__doc_fiction_orthogonal_physical_design_stats_duration = R"doc()doc";
@@ -17531,6 +18563,10 @@ static const char *__doc_fiction_orthogonal_physical_design_stats_num_gates = R"
 
 static const char *__doc_fiction_orthogonal_physical_design_stats_num_wires = R"doc()doc";
 
+static const char *__doc_fiction_orthogonal_physical_design_stats_profile =
+R"doc(Time spent in fanout substitution, edge coloring, and arrangement as
+well as the memory usage of the entire process.)doc";
+
 static const char *__doc_fiction_orthogonal_physical_design_stats_report = R"doc()doc";
 
 static const char *__doc_fiction_orthogonal_physical_design_stats_x_size = R"doc()doc";
@@ -17694,56 +18730,308 @@ static const char *__doc_fiction_path_set_add = R"doc()doc";
 
 static const char *__doc_fiction_path_set_contains = R"doc()doc";
 
-static const char *__doc_fiction_physical_population_stability =
-R"doc(This function simulates the population stability of each physically
-valid charge distributions of a given SiDB layout. It determines the
-minimum absolute electrostatic potential required to induce a charge
-distribution transition. The function also identifies the SiDB for
-which this is the case (critical SiDB) and the corresponding charge
-state transition (i.e., the change from one charge state to another).
+static const char *__doc_fiction_peak_resident_set_size =
+R"doc(Returns the peak resident set size of the current process, i.e., the
+maximum amount of physical memory it has occupied so far.
 
-Template parameter ``Lyt``:
-    SiDB cell-level layout type.
+Returns:
+    Peak resident set size in bytes, or `std::nullopt` if it cannot be
+    determined on this platform.)doc";
 
-Parameter ``lyt``:
-    The layout for which the population stability is simulated.
+static const char *__doc_fiction_performance_profile =
+R"doc(A lightweight profile of an algorithm's execution that can be attached
+to its statistics. It records the time spent in named phases, named
+event counters, and the memory usage of the process.
 
-Parameter ``params``:
-    Parameters used to simulate the population stability.
+All member functions are thread-safe such that worker threads of
+parallel algorithms can report to the same profile. Since the profile
+is locked on every update, phase timers and counters are meant to be
+used at the granularity of algorithm phases and not inside of tight
+loops.
 
-Returns:
-    A vector of population stability information for all physically
-    valid charge distributions of the given SiDB layout.)doc";
+Phases and counters are reported in lexicographical order of their
+names.)doc";
 
-static const char *__doc_fiction_physical_population_stability_params =
-R"doc(This struct stores the parameters required to simulate the population
-stability.)doc";
+static const char *__doc_fiction_performance_profile_add_phase_time =
+R"doc(Adds the given time to a phase.
 
-static const char *__doc_fiction_physical_population_stability_params_precision_for_distance_corresponding_to_potential =
-R"doc(The precision level for the conversion from the minimum potential
-difference to the corresponding distance.)doc";
+Parameter ``name``:
+    Name of the phase.
 
-static const char *__doc_fiction_physical_population_stability_params_simulation_parameters = R"doc(Parameters for the electrostatic potential.)doc";
+Parameter ``time``:
+    Time to add.
 
-static const char *__doc_fiction_physically_valid_parameters =
-R"doc(This function computes the physical parameters necessary for ensuring
-the physical validity of a given charge distribution and determines
-the corresponding excited state number. The ground state is denoted by
-zero, with each subsequent excited state incrementally numbered.
+Parameter ``num_calls``:
+    Number of executions of the phase that took `time` in total.)doc";
 
-This function is designed to derive the physical parameters from
-charge distribution measurements of SiDB layouts, often acquired
-through Atomic Force Microscopy (AFM). Given a specific charge
-distribution, the function typically yields several physically valid
-parameters.
+static const char *__doc_fiction_performance_profile_call_with_phase_timer =
+R"doc(Calls the given function and adds the time it takes to a phase,
+similar to `mockturtle::call_with_stopwatch`.
 
-As more SiDB layouts with corresponding charge distributions are
-recorded, the number of physically valid parameters for all layouts
-decreases. Consequently, this enables a more precise determination of
-the physical parameters present on the surface.
+Template parameter ``Fn``:
+    Functor type.
 
-Template parameter ``Lyt``:
-    The charge distribution surface type.
+Parameter ``name``:
+    Name of the phase.
+
+Parameter ``fn``:
+    Function to call.
+
+Returns:
+    The return value of `fn`.)doc";
+
+static const char *__doc_fiction_performance_profile_counters = R"doc(Counters by name.)doc";
+
+static const char *__doc_fiction_performance_profile_empty =
+R"doc(Checks whether anything was recorded.
+
+Returns:
+    `true` iff no phase, counter, or memory usage was recorded.)doc";
+
+static const char *__doc_fiction_performance_profile_find_or_insert =
+R"doc(Returns the value with the given key and inserts a default-constructed
+one if it does not exist yet. Avoids constructing a `std::string` for
+keys that already exist.
+
+Template parameter ``Map``:
+    Map type with a transparent comparator.
+
+Parameter ``map``:
+    Map to search.
+
+Parameter ``key``:
+    Key to look up.
+
+Returns:
+    Reference to the value.)doc";
+
+static const char *__doc_fiction_performance_profile_get_counter =
+R"doc(Returns the value of a counter.
+
+Parameter ``name``:
+    Name of the counter.
+
+Returns:
+    Value of the counter, which is `0` if it was never incremented.)doc";
+
+static const char *__doc_fiction_performance_profile_get_memory_usage =
+R"doc(Returns the recorded memory usage.
+
+Returns:
+    The memory usage, or `std::nullopt` if it was not tracked.)doc";
+
+static const char *__doc_fiction_performance_profile_get_phase =
+R"doc(Returns the accumulated time and number of executions of a phase.
+
+Parameter ``name``:
+    Name of the phase.
+
+Returns:
+    The phase, or `std::nullopt` if it was never executed.)doc";
+
+static const char *__doc_fiction_performance_profile_increment =
+R"doc(Increments a counter.
+
+Parameter ``name``:
+    Name of the counter.
+
+Parameter ``value``:
+    Value to add.)doc";
+
+static const char *__doc_fiction_performance_profile_memory = R"doc(Memory usage.)doc";
+
+static const char *__doc_fiction_performance_profile_memory_tracker =
+R"doc(Records the memory usage between its construction and its destruction
+in a profile.)doc";
+
+static const char *__doc_fiction_performance_profile_memory_tracker_bytes_allocated = R"doc()doc";
+
+static const char *__doc_fiction_performance_profile_memory_tracker_memory_tracker =
+R"doc(Takes a snapshot of the allocation counters.
+
+Parameter ``p``:
+    Profile to report to.)doc";
+
+static const char *__doc_fiction_performance_profile_memory_tracker_memory_tracker_2 = R"doc()doc";
+
+static const char *__doc_fiction_performance_profile_memory_tracker_memory_tracker_3 = R"doc()doc";
+
+static const char *__doc_fiction_performance_profile_memory_tracker_num_allocations =
+R"doc(Allocation counters at construction.)doc";
+
+static const char *__doc_fiction_performance_profile_memory_tracker_num_deallocations = R"doc()doc";
+
+static const char *__doc_fiction_performance_profile_memory_tracker_operator_assign = R"doc()doc";
+
+static const char *__doc_fiction_performance_profile_memory_tracker_operator_assign_2 = R"doc()doc";
+
+static const char *__doc_fiction_performance_profile_memory_tracker_profile = R"doc(Profile to report to.)doc";
+
+static const char *__doc_fiction_performance_profile_memory_usage = R"doc(Memory usage during a tracked scope.)doc";
+
+static const char *__doc_fiction_performance_profile_memory_usage_bytes_allocated =
+R"doc(Number of bytes allocated during the scope. Only counted if allocation
+tracking is enabled.)doc";
+
+static const char *__doc_fiction_performance_profile_memory_usage_num_allocations =
+R"doc(Number of allocations during the scope. Only counted if allocation
+tracking is enabled.)doc";
+
+static const char *__doc_fiction_performance_profile_memory_usage_num_deallocations =
+R"doc(Number of deallocations during the scope. Only counted if allocation
+tracking is enabled.)doc";
+
+static const char *__doc_fiction_performance_profile_memory_usage_peak_resident_set_size =
+R"doc(Peak resident set size of the process in bytes at the end of the
+scope. Since the operating system only reports the peak of the whole
+process, this includes everything that happened before the scope.)doc";
+
+static const char *__doc_fiction_performance_profile_merge =
+R"doc(Adds all phases and counters of another profile to this one. If the
+other profile recorded a memory usage, it replaces the one of this
+profile. This is useful to combine the profiles of independent runs or
+threads.
+
+Parameter ``other``:
+    Profile to merge into this one.)doc";
+
+static const char *__doc_fiction_performance_profile_mutex = R"doc(Mutex that protects all members.)doc";
+
+static const char *__doc_fiction_performance_profile_operator_assign =
+R"doc(Copy assignment operator.
+
+Parameter ``other``:
+    Profile to copy.
+
+Returns:
+    Reference to this profile.)doc";
+
+static const char *__doc_fiction_performance_profile_performance_profile =
+R"doc(Standard constructor. Creates an empty profile.)doc";
+
+static const char *__doc_fiction_performance_profile_performance_profile_2 =
+R"doc(Copy constructor.
+
+Parameter ``other``:
+    Profile to copy.)doc";
+
+static const char *__doc_fiction_performance_profile_phase =
+R"doc(Accumulated time and number of executions of a phase.)doc";
+
+static const char *__doc_fiction_performance_profile_phase_num_calls =
+R"doc(Number of times the phase was executed.)doc";
+
+static const char *__doc_fiction_performance_profile_phase_time = R"doc(Total time spent in the phase.)doc";
+
+static const char *__doc_fiction_performance_profile_phase_timer =
+R"doc(Measures the time between its construction and its destruction and
+adds it to a phase of a profile.)doc";
+
+static const char *__doc_fiction_performance_profile_phase_timer_name = R"doc(Name of the phase.)doc";
+
+static const char *__doc_fiction_performance_profile_phase_timer_operator_assign = R"doc()doc";
+
+static const char *__doc_fiction_performance_profile_phase_timer_operator_assign_2 = R"doc()doc";
+
+static const char *__doc_fiction_performance_profile_phase_timer_phase_timer =
+R"doc(Starts measuring the given phase.
+
+Parameter ``p``:
+    Profile to report to.
+
+Parameter ``n``:
+    Name of the phase.)doc";
+
+static const char *__doc_fiction_performance_profile_phase_timer_phase_timer_2 = R"doc()doc";
+
+static const char *__doc_fiction_performance_profile_phase_timer_phase_timer_3 = R"doc()doc";
+
+static const char *__doc_fiction_performance_profile_phase_timer_profile = R"doc(Profile to report to.)doc";
+
+static const char *__doc_fiction_performance_profile_phase_timer_start =
+R"doc(Point in time at which the measurement started.)doc";
+
+static const char *__doc_fiction_performance_profile_phases = R"doc(Phases by name.)doc";
+
+static const char *__doc_fiction_performance_profile_report =
+R"doc(Prints the profile.
+
+Parameter ``out``:
+    Output stream to write to.)doc";
+
+static const char *__doc_fiction_performance_profile_set_memory_usage =
+R"doc(Stores the given memory usage.
+
+Parameter ``usage``:
+    Memory usage to store.)doc";
+
+static const char *__doc_fiction_performance_profile_time_phase =
+R"doc(Starts measuring the given phase. The measurement ends when the
+returned timer is destroyed.
+
+Parameter ``name``:
+    Name of the phase.
+
+Returns:
+    Timer that measures the phase.)doc";
+
+static const char *__doc_fiction_performance_profile_track_memory =
+R"doc(Starts tracking the memory usage. The tracking ends when the returned
+tracker is destroyed.
+
+Returns:
+    Tracker that records the memory usage.)doc";
+
+static const char *__doc_fiction_physical_population_stability =
+R"doc(This function simulates the population stability of each physically
+valid charge distributions of a given SiDB layout. It determines the
+minimum absolute electrostatic potential required to induce a charge
+distribution transition. The function also identifies the SiDB for
+which this is the case (critical SiDB) and the corresponding charge
+state transition (i.e., the change from one charge state to another).
+
+Template parameter ``Lyt``:
+    SiDB cell-level layout type.
+
+Parameter ``lyt``:
+    The layout for which the population stability is simulated.
+
+Parameter ``params``:
+    Parameters used to simulate the population stability.
+
+Returns:
+    A vector of population stability information for all physically
+    valid charge distributions of the given SiDB layout.)doc";
+
+static const char *__doc_fiction_physical_population_stability_params =
+R"doc(This struct stores the parameters required to simulate the population
+stability.)doc";
+
+static const char *__doc_fiction_physical_population_stability_params_precision_for_distance_corresponding_to_potential =
+R"doc(The precision level for the conversion from the minimum potential
+difference to the corresponding distance.)doc";
+
+static const char *__doc_fiction_physical_population_stability_params_simulation_parameters = R"doc(Parameters for the electrostatic potential.)doc";
+
+static const char *__doc_fiction_physically_valid_parameters =
+R"doc(This function computes the physical parameters necessary for ensuring
+the physical validity of a given charge distribution and determines
+the corresponding excited state number. The ground state is denoted by
+zero, with each subsequent excited state incrementally numbered.
+
+This function is designed to derive the physical parameters from
+charge distribution measurements of SiDB layouts, often acquired
+through Atomic Force Microscopy (AFM). Given a specific charge
+distribution, the function typically yields several physically valid
+parameters.
+
+As more SiDB layouts with corresponding charge distributions are
+recorded, the number of physically valid parameters for all layouts
+decreases. Consequently, this enables a more precise determination of
+the physical parameters present on the surface.
+
+Template parameter ``Lyt``:
+    The charge distribution surface type.
 
 Parameter ``cds``:
     The charge distribution surface for which physical parameters are
@@ -18156,12 +19444,35 @@ Parameter ``pst``:
 
 static const char *__doc_fiction_post_layout_optimization_params = R"doc(Parameters for the post-layout optimization algorithm.)doc";
 
+static const char *__doc_fiction_post_layout_optimization_params_gain_driven_relocation =
+R"doc(Visit gates in the order of their estimated gain instead of
+diagonally. The gain of a gate estimates how far it could move towards
+the origin, i.e., the difference between the diagonal of its position
+and the diagonal of the bottom-right corner of its fan-ins' bounding
+box. Gates without gain are not visited at all. After a gate has been
+moved, only its fan-ins and fan-outs are re-scored and visited again.
+Thereby, most of the area reduction is usually achieved with a
+fraction of the relocation attempts. This option is ignored if
+`parallel_relocation` is enabled. Defaults to false.)doc";
+
 static const char *__doc_fiction_post_layout_optimization_params_max_gate_relocations =
 R"doc(Maximum number of relocations to try for each gate. Defaults to the
 number of tiles in the given layout if not specified.)doc";
 
+static const char *__doc_fiction_post_layout_optimization_params_num_threads =
+R"doc(Number of threads to use if `parallel_relocation` is enabled. If set
+to 0, the number of hardware threads is used.)doc";
+
 static const char *__doc_fiction_post_layout_optimization_params_optimize_pos_only = R"doc(Only optimize PO positions.)doc";
 
+static const char *__doc_fiction_post_layout_optimization_params_parallel_relocation =
+R"doc(Relocate gates in batches of consecutive gates whose footprints, i.e.,
+the regions that their relocations can affect, are disjoint. The gates
+of a batch are relocated concurrently on separate copies of the
+layout. In this mode, rerouting is restricted to the footprint of the
+respective gate, which makes the result independent of the batch
+composition and thus of `num_threads`. Defaults to false.)doc";
+
 static const char *__doc_fiction_post_layout_optimization_params_planar_optimization =
 R"doc(Disable the creation of crossings during optimization. If set to true,
 gates will only be relocated if a crossing-free wiring is found.
@@ -18187,10 +19498,16 @@ static const char *__doc_fiction_post_layout_optimization_stats_num_crossings_af
 
 static const char *__doc_fiction_post_layout_optimization_stats_num_crossings_before = R"doc(Number of crossings before the post-layout optimization process.)doc";
 
+static const char *__doc_fiction_post_layout_optimization_stats_num_relocation_attempts = R"doc(Number of gate relocation attempts.)doc";
+
 static const char *__doc_fiction_post_layout_optimization_stats_num_wires_after = R"doc(Number of wire segments after the post-layout optimization process.)doc";
 
 static const char *__doc_fiction_post_layout_optimization_stats_num_wires_before = R"doc(Number of wire segments before the post-layout optimization process.)doc";
 
+static const char *__doc_fiction_post_layout_optimization_stats_profile =
+R"doc(Time spent in wiring reduction, gate relocation, and output
+optimization as well as the memory usage of the entire process.)doc";
+
 static const char *__doc_fiction_post_layout_optimization_stats_report =
 R"doc(Reports the statistics to the given output stream.
 
@@ -18963,6 +20280,110 @@ R"doc(Standard constructor with forward reference.
 Parameter ``range``:
     Begin and end iterator pair.)doc";
 
+static const char *__doc_fiction_read_fbl_layout =
+R"doc(Reads a gate-level or cell-level layout from an FBL file provided as
+an input stream. The file has to contain a layout of the same kind,
+topology, and technology as `Lyt`.
+
+May throw an `fbl_parsing_error` if the FBL file is malformed or does
+not match `Lyt`.
+
+Template parameter ``Lyt``:
+    The layout type to be created from an input.
+
+Parameter ``is``:
+    The input stream to read from. It should have been opened in
+    binary mode.
+
+Parameter ``name``:
+    The name to give to the generated layout.)doc";
+
+static const char *__doc_fiction_read_fbl_layout_2 =
+R"doc(Reads a gate-level or cell-level layout from an FBL file provided as
+an input stream. The file has to contain a layout of the same kind,
+topology, and technology as `Lyt`.
+
+May throw an `fbl_parsing_error` if the FBL file is malformed or does
+not match `Lyt`.
+
+This is an in-place version of `read_fbl_layout` that utilizes the
+given layout as a target to write to.
+
+Template parameter ``Lyt``:
+    The layout type to be used as input.
+
+Parameter ``lyt``:
+    The layout to write to.
+
+Parameter ``is``:
+    The input stream to read from. It should have been opened in
+    binary mode.)doc";
+
+static const char *__doc_fiction_read_fbl_layout_3 =
+R"doc(Reads a gate-level or cell-level layout from an FBL file provided as a
+file name. The file is memory-mapped such that its contents are
+decoded without being copied into a buffer first. The file has to
+contain a layout of the same kind, topology, and technology as `Lyt`.
+
+May throw an `fbl_parsing_error` if the FBL file is malformed or does
+not match `Lyt`.
+
+Template parameter ``Lyt``:
+    The layout type to be created from an input.
+
+Parameter ``filename``:
+    The file name to open and read from.
+
+Parameter ``name``:
+    The name to give to the generated layout.)doc";
+
+static const char *__doc_fiction_read_fbl_layout_4 =
+R"doc(Reads a gate-level or cell-level layout from an FBL file provided as a
+file name. The file is memory-mapped such that its contents are
+decoded without being copied into a buffer first. The file has to
+contain a layout of the same kind, topology, and technology as `Lyt`.
+
+May throw an `fbl_parsing_error` if the FBL file is malformed or does
+not match `Lyt`.
+
+This is an in-place version of `read_fbl_layout` that utilizes the
+given layout as a target to write to.
+
+Template parameter ``Lyt``:
+    The layout type to be used as input.
+
+Parameter ``lyt``:
+    The layout to write to.
+
+Parameter ``filename``:
+    The file name to open and read from.)doc";
+
+static const char *__doc_fiction_read_fbl_layout_info =
+R"doc(Reads the header of an FBL file provided as an input stream. The
+returned information can be used to determine the layout type the file
+has to be read into.
+
+May throw an `fbl_parsing_error` if the header is malformed.
+
+Parameter ``is``:
+    The input stream to read from.
+
+Returns:
+    Information stored in the header of the FBL file.)doc";
+
+static const char *__doc_fiction_read_fbl_layout_info_2 =
+R"doc(Reads the header of an FBL file provided as a file name. The returned
+information can be used to determine the layout type the file has to
+be read into.
+
+May throw an `fbl_parsing_error` if the header is malformed.
+
+Parameter ``filename``:
+    The file name to open and read from.
+
+Returns:
+    Information stored in the header of the FBL file.)doc";
+
 static const char *__doc_fiction_read_fgl_layout =
 R"doc(Reads a gate-level layout from an FGL file provided as an input
 stream.
@@ -19099,6 +20520,10 @@ May throw a `missing_sidb_position_exception` or an
 surfaces is provided in the `experiments/defect_aware_physical_design`
 directory.
 
+The file is memory-mapped and parsed in place such that even full-
+wafer scans of tens of millions of entries are not copied into memory
+before parsing.
+
 Template parameter ``Lyt``:
     The layout type underlying the SiDB surface. Must be a cell-level
     SiDB layout.
@@ -19194,6 +20619,16 @@ Parameter ``lyt``:
 Parameter ``filename``:
     The file name to open and read from.)doc";
 
+static const char *__doc_fiction_record_allocation =
+R"doc(Records an allocation of the given size in the process-wide allocation
+counters.
+
+Parameter ``size``:
+    Number of allocated bytes.)doc";
+
+static const char *__doc_fiction_record_deallocation =
+R"doc(Records a deallocation in the process-wide allocation counters.)doc";
+
 static const char *__doc_fiction_relative_to_absolute_cell_position =
 R"doc(Converts a relative cell position within a tile to an absolute cell
 position within a layout. To compute the absolute position, the layout
@@ -20427,6 +21862,15 @@ tuples. It uses a `locked_parallel_flat_hash_map` to ensure thread-
 safe access to the stored data. All methods of this class are thread-
 safe.
 
+If the keys represent points of a regular sweep, i.e., `Key` can be
+constructed from and converted to a `std::vector<double>` via
+`get_parameters()`, the domain can additionally be switched to a dense
+grid storage via `use_grid_storage`. Values of keys that lie on the
+grid are then stored in a flat array addressed by their step indices,
+which neither requires a global lock for writing nor a copy for
+iterating. Keys that do not lie on the grid are still stored in the
+hash map.
+
 Template parameter ``Key``:
     The type of the key used to identify entries in the domain.
 
@@ -20443,6 +21887,17 @@ Parameter ``key``:
 Parameter ``value``:
     The value to add, which must be a tuple.)doc";
 
+static const char *__doc_fiction_sidb_simulation_domain_axis =
+R"doc(Describes one dimension of a regularly sampled simulation domain,
+i.e., the values :math:`\text{min} + i \cdot \text{step}` for :math:`i
+= 0, \dots, \text{num_values} - 1`.)doc";
+
+static const char *__doc_fiction_sidb_simulation_domain_axis_min = R"doc(The first value of the dimension.)doc";
+
+static const char *__doc_fiction_sidb_simulation_domain_axis_num_values = R"doc(The number of values of the dimension.)doc";
+
+static const char *__doc_fiction_sidb_simulation_domain_axis_step = R"doc(The distance between two consecutive values of the dimension.)doc";
+
 static const char *__doc_fiction_sidb_simulation_domain_contains =
 R"doc(Checks whether a specified key exists in the given map and retrieves
 its associated value if present. This function utilizes the
@@ -20455,18 +21910,40 @@ Returns:
     The value associated with the key if it exists, `std::nullopt`
     otherwise.)doc";
 
-static const char *__doc_fiction_sidb_simulation_domain_domain_values = R"doc(The domain values stored in a thread-safe map.)doc";
+static const char *__doc_fiction_sidb_simulation_domain_dense_grid =
+R"doc(A dense grid that stores one value per grid point in a flat array.
+Each slot is guarded by an atomic state that is set once a value has
+been written completely. Thereby, values of different grid points can
+be written concurrently without any lock, and reading a slot never
+observes a partially written value.)doc";
 
-static const char *__doc_fiction_sidb_simulation_domain_empty =
-R"doc(Checks whether the operational domain is empty.
+static const char *__doc_fiction_sidb_simulation_domain_dense_grid_at =
+R"doc(Returns the value of the given slot.
+
+Parameter ``index``:
+    The slot index.
 
 Returns:
-    `true` if the operational domain is empty, `false` otherwise.)doc";
+    The value of the slot or `std::nullopt` if no value has been
+    written to it (yet).)doc";
 
-static const char *__doc_fiction_sidb_simulation_domain_for_each =
-R"doc(Applies a callable to all key-value pairs in the container. For
-thread-safety, this function operates on a copy of the underlying map
-created at the time of the function call.
+static const char *__doc_fiction_sidb_simulation_domain_dense_grid_axes = R"doc(The axes of the grid.)doc";
+
+static const char *__doc_fiction_sidb_simulation_domain_dense_grid_dense_grid =
+R"doc(Standard constructor. Allocates one slot per grid point.
+
+Parameter ``grid_axes``:
+    The axes of the grid.)doc";
+
+static const char *__doc_fiction_sidb_simulation_domain_dense_grid_dense_grid_2 =
+R"doc(Copy constructor.
+
+Parameter ``other``:
+    The grid to copy.)doc";
+
+static const char *__doc_fiction_sidb_simulation_domain_dense_grid_for_each =
+R"doc(Applies a callable to all assigned slots in the order of their
+indices.
 
 Template parameter ``Fn``:
     Functor type.
@@ -20474,27 +21951,412 @@ Template parameter ``Fn``:
 Parameter ``fn``:
     Functor to apply to each key-value pair.)doc";
 
-static const char *__doc_fiction_sidb_simulation_domain_sidb_simulation_domain = R"doc(Constructs a new `sidb_simulation_domain` instance.)doc";
+static const char *__doc_fiction_sidb_simulation_domain_dense_grid_index_of =
+R"doc(Returns the slot index of the given key.
 
-static const char *__doc_fiction_sidb_simulation_domain_size =
-R"doc(Counts the number of key-value pairs in the operational domain.
+Keys whose parameters are not finite or lie outside of
+:math:`[\text{min}, \text{max}]` of an axis, up to
+`constants::ERROR_MARGIN`, are never mapped to a slot and, thus, end up
+in the hash map.
+
+Parameter ``key``:
+    The key to determine the slot index for.
 
 Returns:
-    The size of the operational domain.)doc";
+    The slot index of `key` or `std::nullopt` if `key` does not lie on
+    the grid.)doc";
 
-static const char *__doc_fiction_sidb_simulation_engine = R"doc(Selector for the available SiDB simulation engines.)doc";
+static const char *__doc_fiction_sidb_simulation_domain_dense_grid_num_assigned = R"doc(The number of assigned slots.)doc";
 
-static const char *__doc_fiction_sidb_simulation_engine_CLUSTERCOMPLETE =
-R"doc(*ClusterComplete* is a novel exact simulation engine that requires
-exponential runtime, though, depending on the simulation problem, it
-effectively reduces the base number by a real number, thus allowing
-problem sizes that were previously considered astronomical in size.
-Inherent to the simulation methodology that does not depend on the
-simulation base, it simulates very effectively for either base number
-(2 or 3).)doc";
+static const char *__doc_fiction_sidb_simulation_domain_dense_grid_num_points = R"doc(The total number of grid points.)doc";
 
-static const char *__doc_fiction_sidb_simulation_engine_EXGS =
-R"doc(*Exhaustive Ground State Search (EXGS)* is an exact simulation engine
+static const char *__doc_fiction_sidb_simulation_domain_dense_grid_size =
+R"doc(Returns the number of slots that have been assigned a value.
+
+Returns:
+    Number of assigned slots.)doc";
+
+static const char *__doc_fiction_sidb_simulation_domain_dense_grid_slot_state = R"doc(Possible states of a slot.)doc";
+
+static const char *__doc_fiction_sidb_simulation_domain_dense_grid_slot_state_ASSIGNED = R"doc(The slot holds a value.)doc";
+
+static const char *__doc_fiction_sidb_simulation_domain_dense_grid_slot_state_EMPTY = R"doc(No value has been written to the slot.)doc";
+
+static const char *__doc_fiction_sidb_simulation_domain_dense_grid_slot_state_WRITING = R"doc(A value is currently being written to the slot.)doc";
+
+static const char *__doc_fiction_sidb_simulation_domain_dense_grid_states = R"doc(The states of all slots.)doc";
+
+static const char *__doc_fiction_sidb_simulation_domain_dense_grid_try_emplace =
+R"doc(Writes the given value to the given slot unless the slot has already
+been claimed by another write.
+
+Parameter ``index``:
+    The slot index.
+
+Parameter ``value``:
+    The value to write.)doc";
+
+static const char *__doc_fiction_sidb_simulation_domain_dense_grid_values = R"doc(The values of all slots.)doc";
+
+static const char *__doc_fiction_sidb_simulation_domain_domain_values = R"doc(The domain values stored in a thread-safe map.)doc";
+
+static const char *__doc_fiction_sidb_simulation_domain_empty =
+R"doc(Checks whether the operational domain is empty.
+
+Returns:
+    `true` if the operational domain is empty, `false` otherwise.)doc";
+
+static const char *__doc_fiction_sidb_simulation_domain_for_each =
+R"doc(Applies a callable to all key-value pairs in the container. For
+thread-safety, this function operates on a copy of the underlying map
+created at the time of the function call. Values in the grid storage
+are visited in the order of their step indices without copying them.
+The callable may safely add values to this domain or query it.
+
+Template parameter ``Fn``:
+    Functor type.
+
+Parameter ``fn``:
+    Functor to apply to each key-value pair.)doc";
+
+static const char *__doc_fiction_sidb_simulation_domain_grid = R"doc(The dense grid storage or `nullptr` if only the hash map is used.)doc";
+
+static const char *__doc_fiction_sidb_simulation_domain_has_grid_storage =
+R"doc(Checks whether this domain uses a dense grid storage.
+
+Returns:
+    `true` iff `use_grid_storage` has been called on this domain.)doc";
+
+static const char *__doc_fiction_sidb_simulation_domain_is_grid_key_v =
+R"doc(Whether `Key` represents a point of a regular sweep and, thus, can be
+stored in a dense grid.)doc";
+
+static const char *__doc_fiction_sidb_simulation_domain_move_to_grid_or_map =
+R"doc(Adds the given key-value pair to the given grid if the key lies on it
+and to the hash map otherwise.
+
+Parameter ``target_grid``:
+    The grid to add the key-value pair to.
+
+Parameter ``key``:
+    The key.
+
+Parameter ``value``:
+    The value.)doc";
+
+static const char *__doc_fiction_sidb_simulation_domain_operator_assign =
+R"doc(Copy assignment operator. The grid storage, if any, is copied as well.
+
+Parameter ``other``:
+    The domain to copy.
+
+Returns:
+    Reference to this domain.)doc";
+
+static const char *__doc_fiction_sidb_simulation_domain_operator_assign_2 =
+R"doc(Move assignment operator.
+
+Returns:
+    Reference to this domain.)doc";
+
+static const char *__doc_fiction_sidb_simulation_domain_sidb_simulation_domain = R"doc(Constructs a new `sidb_simulation_domain` instance.)doc";
+
+static const char *__doc_fiction_sidb_simulation_domain_sidb_simulation_domain_2 =
+R"doc(Copy constructor. The grid storage, if any, is copied as well.
+
+Parameter ``other``:
+    The domain to copy.)doc";
+
+static const char *__doc_fiction_sidb_simulation_domain_sidb_simulation_domain_3 = R"doc(Move constructor.)doc";
+
+static const char *__doc_fiction_sidb_simulation_domain_size =
+R"doc(Counts the number of key-value pairs in the operational domain.
+
+Returns:
+    The size of the operational domain.)doc";
+
+static const char *__doc_fiction_sidb_simulation_domain_stream =
+R"doc(Appends key-value pairs of a simulation domain to a file as soon as
+they have been computed. The keys are either parameter points, i.e.,
+`Key` can be constructed from a `std::vector<double>` and provides
+`get_parameters()`, or cells whose `x`, `y`, and `z` coordinates are
+written. The mapped values may be enumerations with an 8-bit
+underlying type or `double`s. All member functions are thread-safe.
+
+Template parameter ``Domain``:
+    Simulation domain type, e.g., `operational_domain`.)doc";
+
+static const char *__doc_fiction_sidb_simulation_domain_stream_BINARY_MAGIC = R"doc(Identifies files in the binary format.)doc";
+
+static const char *__doc_fiction_sidb_simulation_domain_stream_BINARY_VERSION = R"doc(Version of the binary format.)doc";
+
+static const char *__doc_fiction_sidb_simulation_domain_stream_DELIMITER = R"doc(The delimiter of the CSV format.)doc";
+
+static const char *__doc_fiction_sidb_simulation_domain_stream_append =
+R"doc(Buffers the given key-value pair and writes the buffer to the file
+once it holds `flush_interval` points.
+
+Parameter ``key``:
+    The key.
+
+Parameter ``value``:
+    The value associated with `key`.)doc";
+
+static const char *__doc_fiction_sidb_simulation_domain_stream_append_binary =
+R"doc(Appends the little-endian binary representation of the given value to
+the given buffer.
+
+Template parameter ``T``:
+    Value type, i.e., an enumeration with an 8-bit underlying type or
+    `double`.
+
+Parameter ``buffer``:
+    Buffer to append to.
+
+Parameter ``value``:
+    Value to encode.)doc";
+
+static const char *__doc_fiction_sidb_simulation_domain_stream_binary_point_size =
+R"doc(Returns the size in bytes of the binary representation of one point.
+
+Returns:
+    Size of one point in bytes.)doc";
+
+static const char *__doc_fiction_sidb_simulation_domain_stream_binary_size =
+R"doc(Returns the size in bytes of the binary representation of a value of
+type `T`.
+
+Template parameter ``T``:
+    Value type.
+
+Returns:
+    Size of a value of type `T` in bytes.)doc";
+
+static const char *__doc_fiction_sidb_simulation_domain_stream_buffer = R"doc(Points that have not been written to the file yet.)doc";
+
+static const char *__doc_fiction_sidb_simulation_domain_stream_file = R"doc(The file the points are written to.)doc";
+
+static const char *__doc_fiction_sidb_simulation_domain_stream_flush = R"doc(Writes all buffered points to the file and flushes it.)doc";
+
+static const char *__doc_fiction_sidb_simulation_domain_stream_for_each_value_column =
+R"doc(Applies a callable to the index of each value column, given as an
+`std::integral_constant`.
+
+Template parameter ``Fn``:
+    Functor type.
+
+Template parameter ``Is``:
+    Value column indices.
+
+Parameter ``fn``:
+    Functor to apply to each value column index.)doc";
+
+static const char *__doc_fiction_sidb_simulation_domain_stream_for_each_value_column_2 =
+R"doc(Applies a callable to the index of each value column, given as an
+`std::integral_constant`.
+
+Template parameter ``Fn``:
+    Functor type.
+
+Parameter ``fn``:
+    Functor to apply to each value column index.)doc";
+
+static const char *__doc_fiction_sidb_simulation_domain_stream_has_parameter_key_v = R"doc(Whether the keys are parameter points rather than cells.)doc";
+
+static const char *__doc_fiction_sidb_simulation_domain_stream_header =
+R"doc(Returns the header that is written at the beginning of a new file.
+
+Returns:
+    Header in the selected format.)doc";
+
+static const char *__doc_fiction_sidb_simulation_domain_stream_key_columns = R"doc(Names of the key columns.)doc";
+
+static const char *__doc_fiction_sidb_simulation_domain_stream_load_binary =
+R"doc(Decodes a value from its little-endian binary representation.
+
+Template parameter ``T``:
+    Value type, i.e., an enumeration with an 8-bit underlying type or
+    `double`.
+
+Parameter ``bytes``:
+    Pointer to the first of `binary_size<T>()` bytes.
+
+Returns:
+    The decoded value.)doc";
+
+static const char *__doc_fiction_sidb_simulation_domain_stream_mutex = R"doc(Mutex that guards `buffer` and `file`.)doc";
+
+static const char *__doc_fiction_sidb_simulation_domain_stream_num_value_columns = R"doc(Number of value columns.)doc";
+
+static const char *__doc_fiction_sidb_simulation_domain_stream_operator_assign = R"doc(Copy assignment operator is deleted.)doc";
+
+static const char *__doc_fiction_sidb_simulation_domain_stream_operator_assign_2 = R"doc(Move assignment operator is deleted.)doc";
+
+static const char *__doc_fiction_sidb_simulation_domain_stream_params = R"doc(Stream parameters.)doc";
+
+static const char *__doc_fiction_sidb_simulation_domain_stream_params_filename =
+R"doc(Path of the file to stream the domain points to. If empty, no points
+are streamed.)doc";
+
+static const char *__doc_fiction_sidb_simulation_domain_stream_params_flush_interval =
+R"doc(Number of points that are buffered before they are written to the file
+and the file is flushed.)doc";
+
+static const char *__doc_fiction_sidb_simulation_domain_stream_params_format = R"doc(File format of the stream.)doc";
+
+static const char *__doc_fiction_sidb_simulation_domain_stream_params_resume =
+R"doc(If `true` and the file already exists, the points stored in it are
+loaded into the domain before the computation starts such that they
+are not evaluated again, and new points are appended to the file. An
+incomplete trailing line or block, e.g., caused by a crash while
+writing, is discarded. Complete CSV lines that cannot be parsed are
+skipped but kept in the file. If `false`, an existing file is
+overwritten.)doc";
+
+static const char *__doc_fiction_sidb_simulation_domain_stream_params_stream_format = R"doc(File format of the stream.)doc";
+
+static const char *__doc_fiction_sidb_simulation_domain_stream_params_stream_format_BINARY =
+R"doc(Compact binary format in little-endian byte order. After a header that
+describes the columns, the points are written in blocks of up to
+`flush_interval` points. Within each block, the values are stored
+column by column.)doc";
+
+static const char *__doc_fiction_sidb_simulation_domain_stream_params_stream_format_CSV =
+R"doc(One point per line in CSV format. The first line holds the column
+names. Enumerators are written by their underlying integer value.)doc";
+
+static const char *__doc_fiction_sidb_simulation_domain_stream_parse_csv_value =
+R"doc(Parses the value columns of a CSV line.
+
+Parameter ``fields``:
+    The fields of the line that belong to the value columns.
+
+Returns:
+    The parsed value or `std::nullopt` if a field is malformed.)doc";
+
+static const char *__doc_fiction_sidb_simulation_domain_stream_resume_binary =
+R"doc(Loads all complete blocks of an existing binary file into the given
+domain.
+
+Parameter ``domain``:
+    The domain to add the points to.
+
+Returns:
+    The size of the file without an incomplete trailing block or
+    `std::nullopt` if the file does not even contain a complete
+    header.
+
+Throws:
+    std::invalid_argument if the header of the file does not match the
+    columns of this stream.)doc";
+
+static const char *__doc_fiction_sidb_simulation_domain_stream_resume_csv =
+R"doc(Loads all complete lines of an existing CSV file into the given
+domain. Lines that cannot be parsed, e.g., because they have been
+edited by hand, are skipped.
+
+Parameter ``domain``:
+    The domain to add the points to.
+
+Returns:
+    The size of the file without an incomplete trailing line or
+    `std::nullopt` if the file does not even contain a complete
+    header.
+
+Throws:
+    std::invalid_argument if the header of the file does not match the
+    columns of this stream.)doc";
+
+static const char *__doc_fiction_sidb_simulation_domain_stream_sidb_simulation_domain_stream =
+R"doc(Standard constructor. Opens the file given in `ps` and writes the
+column header. If `ps.resume` is set and the file exists, its points
+are added to `domain` instead and further points are appended to it.
+
+Parameter ``ps``:
+    Stream parameters.
+
+Parameter ``key_column_names``:
+    Names of the key columns, i.e., one per dimension for parameter
+    points and `x`, `y`, and `z` for cells.
+
+Parameter ``value_column_names``:
+    Names of the value columns, i.e., one per element of
+    `mapped_type`.
+
+Parameter ``domain``:
+    Domain to load the points of an existing file into if `ps.resume`
+    is set.
+
+Throws:
+    std::invalid_argument if an existing file to resume from does not
+    match the given columns.
+
+Throws:
+    std::ofstream::failure if the file could not be opened.)doc";
+
+static const char *__doc_fiction_sidb_simulation_domain_stream_sidb_simulation_domain_stream_2 = R"doc(Copy constructor is deleted.)doc";
+
+static const char *__doc_fiction_sidb_simulation_domain_stream_sidb_simulation_domain_stream_3 = R"doc(Move constructor is deleted.)doc";
+
+static const char *__doc_fiction_sidb_simulation_domain_stream_to_columns =
+R"doc(Converts a key to its column values.
+
+Parameter ``key``:
+    The key.
+
+Returns:
+    One value per key column.)doc";
+
+static const char *__doc_fiction_sidb_simulation_domain_stream_to_key =
+R"doc(Converts column values to a key.
+
+Parameter ``columns``:
+    One value per key column.
+
+Returns:
+    The key.)doc";
+
+static const char *__doc_fiction_sidb_simulation_domain_stream_value_columns = R"doc(Names of the value columns.)doc";
+
+static const char *__doc_fiction_sidb_simulation_domain_stream_write_buffer =
+R"doc(Writes all buffered points to the file and clears the buffer. The
+mutex has to be held by the caller.)doc";
+
+static const char *__doc_fiction_sidb_simulation_domain_use_grid_storage =
+R"doc(Switches this domain to a dense grid storage spanned by the given
+axes. One slot is allocated for each point of the grid such that the
+memory consumption is proportional to the number of grid points,
+regardless of how many of them are actually assigned a value.
+Therefore, this storage is best suited for exhaustive sweeps. Values
+that have been added before and whose keys lie on the grid are moved
+to the grid storage.
+
+This function is only available if `Key` can be constructed from a
+`std::vector<double>` and provides its parameter values via
+`get_parameters()`. It must not be called concurrently with any other
+member function.
+
+Parameter ``axes``:
+    The axes of the grid. The first axis is the most significant one
+    when ordering the grid points.
+
+Throws:
+    std::invalid_argument if an axis has a non-finite minimum or a step
+    size that is not positive and finite.)doc";
+
+static const char *__doc_fiction_sidb_simulation_engine = R"doc(Selector for the available SiDB simulation engines.)doc";
+
+static const char *__doc_fiction_sidb_simulation_engine_CLUSTERCOMPLETE =
+R"doc(*ClusterComplete* is a novel exact simulation engine that requires
+exponential runtime, though, depending on the simulation problem, it
+effectively reduces the base number by a real number, thus allowing
+problem sizes that were previously considered astronomical in size.
+Inherent to the simulation methodology that does not depend on the
+simulation base, it simulates very effectively for either base number
+(2 or 3).)doc";
+
+static const char *__doc_fiction_sidb_simulation_engine_EXGS =
+R"doc(*Exhaustive Ground State Search (EXGS)* is an exact simulation engine
 that always has exponential runtime.)doc";
 
 static const char *__doc_fiction_sidb_simulation_engine_QUICKEXACT =
@@ -21059,6 +22921,82 @@ R"doc(Construct the distance functor from a sparse distance map.
 Parameter ``sdm``:
     Sparse distance map.)doc";
 
+static const char *__doc_fiction_sparse_tile_storage =
+R"doc(Storage policy for `gate_level_layout` that maps tiles to nodes and
+vice versa via hash maps. Memory consumption is proportional to the
+number of placed nodes, which makes this policy suitable for sparse or
+unbounded layouts. This is the default policy.)doc";
+
+static const char *__doc_fiction_sparse_tile_storage_map =
+R"doc(Bidirectional tile <-> node map.
+
+Template parameter ``Node``:
+    Node type.
+
+Template parameter ``Signal``:
+    Signal type, i.e., the 64-bit representation of a tile.)doc";
+
+static const char *__doc_fiction_sparse_tile_storage_map_erase =
+R"doc(Removes the assignment of node `n` to tile `s`.
+
+Parameter ``s``:
+    Tile in its signal representation.
+
+Parameter ``n``:
+    Node.)doc";
+
+static const char *__doc_fiction_sparse_tile_storage_map_find_node =
+R"doc(Fetches the node that is assigned to the given tile.
+
+Parameter ``s``:
+    Tile in its signal representation.
+
+Returns:
+    The node assigned to `s` or `std::nullopt` if there is none.)doc";
+
+static const char *__doc_fiction_sparse_tile_storage_map_find_tile =
+R"doc(Fetches the tile that the given node is assigned to.
+
+Parameter ``n``:
+    Node.
+
+Returns:
+    The tile `n` is assigned to in its signal representation or
+    `std::nullopt` if there is none.)doc";
+
+static const char *__doc_fiction_sparse_tile_storage_map_insert =
+R"doc(Assigns node `n` to tile `s`.
+
+Parameter ``s``:
+    Tile in its signal representation.
+
+Parameter ``n``:
+    Node.)doc";
+
+static const char *__doc_fiction_sparse_tile_storage_map_map =
+R"doc(Standard constructor. Registers the two constant nodes.
+
+Parameter ``const0``:
+    Signal representation of the tile reserved for the `const0` node.
+
+Parameter ``const1``:
+    Signal representation of the tile reserved for the `const1` node.)doc";
+
+static const char *__doc_fiction_sparse_tile_storage_map_node_tile_map = R"doc()doc";
+
+static const char *__doc_fiction_sparse_tile_storage_map_reserve =
+R"doc(Hash maps do not depend on the layout dimensions. Therefore, this
+function does nothing.)doc";
+
+static const char *__doc_fiction_sparse_tile_storage_map_reserve_nodes =
+R"doc(Reserves buckets for the given number of nodes in both maps such that
+they do not need to rehash while being filled.
+
+Parameter ``num_nodes``:
+    Expected number of nodes.)doc";
+
+static const char *__doc_fiction_sparse_tile_storage_map_tile_node_map = R"doc()doc";
+
 static const char *__doc_fiction_sqd_parsing_error = R"doc(Exception thrown when an error occurs during parsing of an SQD file.)doc";
 
 static const char *__doc_fiction_sqd_parsing_error_sqd_parsing_error = R"doc()doc";
@@ -21810,6 +23748,90 @@ algorithm.)doc";
 
 static const char *__doc_fiction_time_to_solution_stats_time_to_solution = R"doc(Time-to-solution in seconds.)doc";
 
+static const char *__doc_fiction_to_json =
+R"doc(Converts SiDB gate design statistics into JSON.
+
+Parameter ``j``:
+    JSON value to write to.
+
+Parameter ``stats``:
+    Statistics to convert.)doc";
+
+static const char *__doc_fiction_to_json_2 =
+R"doc(Converts exact physical design statistics into JSON.
+
+Parameter ``j``:
+    JSON value to write to.
+
+Parameter ``stats``:
+    Statistics to convert.)doc";
+
+static const char *__doc_fiction_to_json_3 =
+R"doc(Converts graph-oriented layout design statistics into JSON.
+
+Parameter ``j``:
+    JSON value to write to.
+
+Parameter ``stats``:
+    Statistics to convert.)doc";
+
+static const char *__doc_fiction_to_json_4 =
+R"doc(Converts orthogonal physical design statistics into JSON.
+
+Parameter ``j``:
+    JSON value to write to.
+
+Parameter ``stats``:
+    Statistics to convert.)doc";
+
+static const char *__doc_fiction_to_json_5 =
+R"doc(Converts post-layout optimization statistics into JSON.
+
+Parameter ``j``:
+    JSON value to write to.
+
+Parameter ``stats``:
+    Statistics to convert.)doc";
+
+static const char *__doc_fiction_to_json_6 =
+R"doc(Converts wiring reduction statistics into JSON.
+
+Parameter ``j``:
+    JSON value to write to.
+
+Parameter ``stats``:
+    Statistics to convert.)doc";
+
+static const char *__doc_fiction_to_json_7 =
+R"doc(Converts *Ground State Space* results into JSON. The cluster hierarchy
+itself is not included.
+
+Parameter ``j``:
+    JSON value to write to.
+
+Parameter ``results``:
+    Results to convert.)doc";
+
+static const char *__doc_fiction_to_json_8 =
+R"doc(Converts operational domain statistics into JSON.
+
+Parameter ``j``:
+    JSON value to write to.
+
+Parameter ``stats``:
+    Statistics to convert.)doc";
+
+static const char *__doc_fiction_to_json_9 =
+R"doc(Converts a profile into JSON. Phases are mapped to objects containing
+their time in seconds and their number of calls, counters to integers,
+and the memory usage to an object. Empty sections are omitted.
+
+Parameter ``j``:
+    JSON value to write to.
+
+Parameter ``profile``:
+    Profile to convert.)doc";
+
 static const char *__doc_fiction_to_sidb_cluster =
 R"doc(This function initiates the recursive procedure of converting a binary
 cluster hierarchy to our bespoke version.
@@ -21840,6 +23862,41 @@ Returns:
     A uniquely identified node in a decorated cluster hierarchy that
     follows the "general tree" structure.)doc";
 
+static const char *__doc_fiction_tracking_allocator =
+R"doc(An allocator that forwards to `std::allocator` and records all
+allocations in the process-wide allocation counters. It can be used to
+track the allocations of individual containers without replacing the
+global `operator new`.
+
+Template parameter ``T``:
+    Type of the allocated objects.)doc";
+
+static const char *__doc_fiction_tracking_allocator_allocate =
+R"doc(Allocates storage for `n` objects of type `T`.
+
+Parameter ``n``:
+    Number of objects.
+
+Returns:
+    Pointer to the allocated storage.)doc";
+
+static const char *__doc_fiction_tracking_allocator_deallocate =
+R"doc(Deallocates storage that was obtained from `allocate`.
+
+Parameter ``ptr``:
+    Pointer to the storage.
+
+Parameter ``n``:
+    Number of objects that was passed to `allocate`.)doc";
+
+static const char *__doc_fiction_tracking_allocator_operator_eq = R"doc()doc";
+
+static const char *__doc_fiction_tracking_allocator_operator_ne = R"doc()doc";
+
+static const char *__doc_fiction_tracking_allocator_tracking_allocator = R"doc()doc";
+
+static const char *__doc_fiction_tracking_allocator_tracking_allocator_2 = R"doc()doc";
+
 static const char *__doc_fiction_transition_type =
 R"doc(Possible types of charge transitions that can occur in an SiDB layout.
 These transitions represent changes in the charge state of SiDBs,
@@ -22428,6 +24485,17 @@ Parameter ``pst``:
 
 static const char *__doc_fiction_wiring_reduction_params = R"doc(Parameters for the wiring reduction algorithm.)doc";
 
+static const char *__doc_fiction_wiring_reduction_params_disjoint_paths =
+R"doc(Find several non-overlapping paths for wire deletion per search pass
+on a breadth-first level graph (cf. Dinic's maximum flow algorithm)
+instead of running one A* search per path.)doc";
+
+static const char *__doc_fiction_wiring_reduction_params_incremental_search =
+R"doc(Maintain one search layout per search direction across all iterations
+and update it in place after each deletion instead of recreating it.
+Only the obstructions of the rows or columns affected by a deletion
+are recomputed.)doc";
+
 static const char *__doc_fiction_wiring_reduction_params_timeout =
 R"doc(Timeout limit (in ms). Specifies the maximum allowed time in
 milliseconds for the optimization process. For large layouts, the
@@ -22442,10 +24510,19 @@ static const char *__doc_fiction_wiring_reduction_stats_area_improvement = R"doc
 
 static const char *__doc_fiction_wiring_reduction_stats_duration = R"doc(Runtime of the wiring reduction process.)doc";
 
+static const char *__doc_fiction_wiring_reduction_stats_num_search_passes =
+R"doc(Number of search passes, i.e., A* searches or level graph
+constructions, for paths of excess wiring.)doc";
+
 static const char *__doc_fiction_wiring_reduction_stats_num_wires_after = R"doc(Number of wire segments after the wiring reduction process.)doc";
 
 static const char *__doc_fiction_wiring_reduction_stats_num_wires_before = R"doc(Number of wire segments before the wiring reduction process.)doc";
 
+static const char *__doc_fiction_wiring_reduction_stats_profile =
+R"doc(Time spent in the construction of the wiring reduction layouts, in the
+path search, and in the wire deletion as well as the memory usage of
+the entire process.)doc";
+
 static const char *__doc_fiction_wiring_reduction_stats_report =
 R"doc(Reports the statistics to the given output stream.
 
@@ -22462,6 +24539,22 @@ static const char *__doc_fiction_wiring_reduction_stats_y_size_after = R"doc(Lay
 
 static const char *__doc_fiction_wiring_reduction_stats_y_size_before = R"doc(Layout height before the wiring reduction process.)doc";
 
+static const char *__doc_fiction_with_tile_storage =
+R"doc(Determines the `gate_level_layout` type that is equal to `Lyt` except
+for its tile storage policy, which is replaced by `TileStorage`. If
+`Lyt` is not a `gate_level_layout` or its tiles do not support
+`TileStorage`, i.e., `TileStorage` is `dense_tile_storage` but the
+tiles are not of type `offset::ucoord_t`, `Lyt` is kept as is.
+
+Layouts of the original and the resulting type can be converted into
+each other via `gate_level_layout`'s converting constructor.
+
+Template parameter ``Lyt``:
+    Gate-level layout type.
+
+Template parameter ``TileStorage``:
+    Desired tile storage policy.)doc";
+
 static const char *__doc_fiction_write_defect_influence_domain =
 R"doc(Writes a CSV representation of an defect influence domain to the
 specified output stream. The data are written as rows, each
@@ -22542,6 +24635,52 @@ Parameter ``lyt``:
 Parameter ``filename``:
     Filename)doc";
 
+static const char *__doc_fiction_write_fbl_layout =
+R"doc(Writes a gate-level or cell-level layout to a file in the fiction
+binary layout (FBL) format. In contrast to the XML-based formats, FBL
+stores all tiles, gates, and cells in packed arrays and can therefore
+be written and read significantly faster for large layouts. The
+layout's coordinates must be of type `offset::ucoord_t`.
+
+This overload uses an output stream to write into. The stream should
+have been opened in binary mode.
+
+May throw an `fbl_write_error` if the layout cannot be stored, e.g.,
+because it contains gates without incoming signals that could not be
+parsed again.
+
+Template parameter ``Lyt``:
+    Gate-level or cell-level layout type.
+
+Parameter ``lyt``:
+    The layout to be written.
+
+Parameter ``os``:
+    The output stream to write into.)doc";
+
+static const char *__doc_fiction_write_fbl_layout_2 =
+R"doc(Writes a gate-level or cell-level layout to a file in the fiction
+binary layout (FBL) format. In contrast to the XML-based formats, FBL
+stores all tiles, gates, and cells in packed arrays and can therefore
+be written and read significantly faster for large layouts. The
+layout's coordinates must be of type `offset::ucoord_t`.
+
+This overload uses a file name to create and write into.
+
+May throw an `fbl_write_error` if the layout cannot be stored, e.g.,
+because it contains gates without incoming signals that could not be
+parsed again.
+
+Template parameter ``Lyt``:
+    Gate-level or cell-level layout type.
+
+Parameter ``lyt``:
+    The layout to be written.
+
+Parameter ``filename``:
+    The file name to create and write into. Should preferably use the
+    .fbl extension.)doc";
+
 static const char *__doc_fiction_write_fgl_layout =
 R"doc(Writes an FGL layout to a file.
 
@@ -22753,6 +24892,63 @@ yields a significantly smaller CSV file. It is recommended to set this
 option for 3D plots because the non-operational samples would shadow
 the operational samples anyway.)doc";
 
+static const char *__doc_fiction_write_orthogonal_fgl_layout =
+R"doc(Runs the orthogonal physical design algorithm on the given network and
+writes the resulting Cartesian layout directly to the given output
+stream in the FGL format instead of constructing it in memory. Only the
+occupied extent of each row and column is stored during placement such
+that memory consumption no longer depends on the number of wire
+segments. This enables the processing of networks whose layouts would
+otherwise not fit into main memory. The written layout is equal to the
+one returned by `orthogonal` and can be read via `read_fgl_layout`.
+
+May throw a high_degree_fanin_exception if `ntk` contains any node with
+a fan-in larger than 2.
+
+Template parameter ``Lyt``:
+    Cartesian gate-level layout type that is emulated.
+
+Template parameter ``Ntk``:
+    Network type that acts as specification.
+
+Parameter ``ntk``:
+    The network that is to place and route.
+
+Parameter ``os``:
+    The output stream to write into.
+
+Parameter ``ps``:
+    Parameters.
+
+Parameter ``pst``:
+    Statistics.)doc";
+
+static const char *__doc_fiction_write_orthogonal_fgl_layout_2 =
+R"doc(Runs the orthogonal physical design algorithm on the given network and
+writes the resulting Cartesian layout directly to a file in the FGL
+format.
+
+This overload uses a file name to create and write into.
+
+Template parameter ``Lyt``:
+    Cartesian gate-level layout type that is emulated.
+
+Template parameter ``Ntk``:
+    Network type that acts as specification.
+
+Parameter ``ntk``:
+    The network that is to place and route.
+
+Parameter ``filename``:
+    The file name to create and write into. Should preferably use the
+    .fgl extension.
+
+Parameter ``ps``:
+    Parameters.
+
+Parameter ``pst``:
+    Statistics.)doc";
+
 static const char *__doc_fiction_write_qca_layout =
 R"doc(Writes a cell-level QCA layout to a qca file that is used by
 QCADesigner (https://waluslab.ece.ubc.ca/qcadesigner/), a physical
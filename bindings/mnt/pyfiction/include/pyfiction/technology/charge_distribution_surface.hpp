@@ -6,6 +6,7 @@
 #define PYFICTION_CHARGE_DISTRIBUTION_SURFACE_HPP
 
 #include "pyfiction/documentation.hpp"
+#include "pyfiction/ndarray.hpp"
 #include "pyfiction/types.hpp"
 
 #include <fiction/algorithms/simulation/sidb/sidb_simulation_engine.hpp>
@@ -18,6 +19,7 @@
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>
 
+#include <cstddef>
 #include <cstdint>
 #include <string>
 #include <vector>
@@ -100,6 +102,10 @@ void charge_distribution_surface_layout(pybind11::module& m, const std::string&
             "get_charge_state_by_index",
             [](py_cds& cds, uint64_t index) { return cds.get_charge_state_by_index(index); }, py::arg("index"))
         .def("get_all_sidb_charges", [](py_cds& cds) { return cds.get_all_sidb_charges(); })
+        .def(
+            "get_all_sidb_charges_array",
+            [](const py_cds& cds) { return to_ndarray<int8_t>(cds.get_all_sidb_charges()); },
+            DOC(fiction_charge_distribution_surface_get_all_sidb_charges_array))
 
         .def("negative_sidb_detection", [](py_cds& cds) { return cds.negative_sidb_detection(); })
         .def(
@@ -123,6 +129,22 @@ void charge_distribution_surface_layout(pybind11::module& m, const std::string&
         .def(
             "get_chargless_potential_by_indices", [](py_cds& cds, uint64_t index1, uint64_t index2)
             { return cds.get_chargeless_potential_by_indices(index1, index2); }, py::arg("index1"), py::arg("index2"))
+        .def(
+            "get_nm_distance_matrix",
+            [](const py_cds& cds)
+            {
+                return to_matrix(cds.num_cells(), cds.num_cells(), [&cds](const std::size_t i, const std::size_t j)
+                                 { return cds.get_nm_distance_by_indices(i, j); });
+            },
+            DOC(fiction_charge_distribution_surface_get_nm_distance_matrix))
+        .def(
+            "get_chargeless_potential_matrix",
+            [](const py_cds& cds)
+            {
+                return to_matrix(cds.num_cells(), cds.num_cells(), [&cds](const std::size_t i, const std::size_t j)
+                                 { return cds.get_chargeless_potential_by_indices(i, j); });
+            },
+            DOC(fiction_charge_distribution_surface_get_chargeless_potential_matrix))
         .def(
             "get_potential_between_sidbs", [](py_cds& cds, fiction::cell<py_cds> c1, fiction::cell<py_cds> c2)
             { return cds.get_potential_between_sidbs(c1, c2); }, py::arg("c1"), py::arg("c2"))
@@ -135,6 +157,10 @@ void charge_distribution_surface_layout(pybind11::module& m, const std::string&
         .def(
             "get_local_potential_by_index",
             [](py_cds& cds, uint64_t index) { return cds.get_local_potential_by_index(index); }, py::arg("index"))
+        .def(
+            "get_all_local_potentials_array",
+            [](const py_cds& cds) { return to_ndarray<double>(cds.get_all_local_potentials()); },
+            DOC(fiction_charge_distribution_surface_get_all_local_potentials_array))
         .def("assign_system_energy_to_zero", [](py_cds& cds) { return cds.assign_system_energy_to_zero(); })
         .def("recompute_system_energy", [](py_cds& cds) { return cds.recompute_system_energy(); })
         .def("get_electrostatic_potential_energy", [](py_cds& cds) { return cds.get_electrostatic_potential_energy(); })
@@ -55,10 +55,12 @@
 #include "pyfiction/algorithms/simulation/sidb/time_to_solution.hpp"
 #include "pyfiction/algorithms/verification/design_rule_violations.hpp"
 #include "pyfiction/algorithms/verification/equivalence_checking.hpp"
+#include "pyfiction/inout/read_fbl_layout.hpp"
 #include "pyfiction/inout/read_fgl_layout.hpp"
 #include "pyfiction/inout/read_fqca_layout.hpp"
 #include "pyfiction/inout/read_sqd_layout.hpp"
 #include "pyfiction/inout/write_dot_layout.hpp"
+#include "pyfiction/inout/write_fbl_layout.hpp"
 #include "pyfiction/inout/write_fgl_layout.hpp"
 #include "pyfiction/inout/write_fqca_layout.hpp"
 #include "pyfiction/inout/write_svg_layout.hpp"
@@ -206,6 +208,7 @@ PYBIND11_MODULE(pyfiction, m, pybind11::mod_gil_not_used())
      */
     pyfiction::write_dot_layout(m);
     pyfiction::write_fgl_layout(m);
+    pyfiction::write_fbl_layout(m);
     pyfiction::write_qca_layout(m);
     pyfiction::write_svg_layout(m);
     pyfiction::write_sqd_layout(m);
@@ -216,6 +219,7 @@ PYBIND11_MODULE(pyfiction, m, pybind11::mod_gil_not_used())
     // pyfiction::write_location_and_ground_state(m);
     pyfiction::write_operational_domain(m);
     pyfiction::read_fgl_layout(m);
+    pyfiction::read_fbl_layout(m);
     pyfiction::read_fqca_layout(m);
     pyfiction::read_sqd_layout(m);
     /**
@@ -47,6 +47,41 @@ class TestColorRouting(unittest.TestCase):
 
         self.assertTrue(success)
 
+    def test_incremental_sat(self):
+        lyt = cartesian_gate_layout((4, 4), "2DDWave", "Layout")
+
+        x1 = lyt.create_pi("x1", offset_coordinate(0, 0))
+        x2 = lyt.create_pi("x2", offset_coordinate(0, 1))
+
+        a = lyt.create_and(x1, x2, offset_coordinate(2, 2))
+
+        lyt.create_po(a, "f1", offset_coordinate(4, 4))
+
+        params = color_routing_params()
+        params.incremental_sat = True
+
+        success = color_routing(lyt, [((0, 0), (2, 2)), ((0, 1), (2, 2)), ((2, 2), (4, 4))], params=params)
+
+        self.assertTrue(success)
+
+
+    def test_parallel_path_enumeration(self):
+        lyt = cartesian_gate_layout((4, 4), "2DDWave", "Layout")
+
+        x1 = lyt.create_pi("x1", offset_coordinate(0, 0))
+        x2 = lyt.create_pi("x2", offset_coordinate(0, 1))
+
+        a = lyt.create_and(x1, x2, offset_coordinate(2, 2))
+
+        lyt.create_po(a, "f1", offset_coordinate(4, 4))
+
+        params = color_routing_params()
+        params.num_threads = 0
+
+        success = color_routing(lyt, [((0, 0), (2, 2)), ((0, 1), (2, 2)), ((2, 2), (4, 4))], params=params)
+
+        self.assertTrue(success)
+
 
 if __name__ == "__main__":
     unittest.main()
@@ -113,6 +113,32 @@ class TestHexagonalization(unittest.TestCase):
         for po in hex_layout.pos():
             self.assertEqual(po.y, hex_layout.y())
 
+    def test_hexagonalization_with_parallel_mapping_and_negotiated_routing(self):
+        network = read_technology_network(dir_path + "/../../resources/mux21.v")
+        cart_layout = orthogonal(network)
+
+        params = hexagonalization_params()
+        params.num_threads = 4
+        params.negotiated_congestion_routing = True
+        params.max_negotiation_iterations = 16
+
+        for mode in [
+            hexagonalization_io_pin_extension_mode.EXTEND,
+            hexagonalization_io_pin_extension_mode.EXTEND_PLANAR,
+        ]:
+            params.input_pin_extension = mode
+            params.output_pin_extension = mode
+            stats = hexagonalization_stats()
+            hex_layout = hexagonalization(cart_layout, params, stats)
+            self.assertGreaterEqual(stats.num_negotiation_iterations, 2)
+            self.assertLessEqual(stats.num_negotiation_iterations, 2 * params.max_negotiation_iterations)
+            self.assertEqual(equivalence_checking(network, hex_layout), eq_type.STRONG)
+            self.assertEqual(equivalence_checking(cart_layout, hex_layout), eq_type.STRONG)
+            for pi in hex_layout.pis():
+                self.assertEqual(pi.y, 0)
+            for po in hex_layout.pos():
+                self.assertEqual(po.y, hex_layout.y())
+
 
 if __name__ == "__main__":
     unittest.main()
@@ -7,7 +7,9 @@ from mnt.pyfiction import (
     orthogonal,
     orthogonal_params,
     orthogonal_stats,
+    read_cartesian_fgl_layout,
     read_technology_network,
+    write_orthogonal_fgl_layout,
 )
 
 dir_path = os.path.dirname(os.path.realpath(__file__))
@@ -37,6 +39,42 @@ class TestOrthogonalPhysicalDesign(unittest.TestCase):
 
         self.assertEqual(equivalence_checking(network, layout), eq_type.STRONG)
 
+    def test_orthogonal_two_pass(self):
+        network = read_technology_network(dir_path + "/../../resources/mux21.v")
+
+        params = orthogonal_params()
+        params.two_pass = True
+
+        stats = orthogonal_stats()
+        two_pass_stats = orthogonal_stats()
+
+        layout = orthogonal(network, statistics=stats)
+        two_pass_layout = orthogonal(network, params, two_pass_stats)
+
+        self.assertEqual(equivalence_checking(network, two_pass_layout), eq_type.STRONG)
+        self.assertEqual(two_pass_layout.x(), layout.x())
+        self.assertEqual(two_pass_layout.y(), layout.y())
+        self.assertEqual(two_pass_stats.num_wires, stats.num_wires)
+
+    def test_write_orthogonal_fgl_layout(self):
+        network = read_technology_network(dir_path + "/../../resources/mux21.v")
+
+        stats = orthogonal_stats()
+
+        layout = orthogonal(network)
+        write_orthogonal_fgl_layout(network, "mux21_orthogonal.fgl", statistics=stats)
+        read_layout = read_cartesian_fgl_layout("mux21_orthogonal.fgl")
+
+        self.assertEqual(equivalence_checking(network, read_layout), eq_type.STRONG)
+        self.assertEqual(read_layout.x(), layout.x())
+        self.assertEqual(read_layout.y(), layout.y())
+        self.assertEqual(read_layout.num_wires(), stats.num_wires)
+
+        try:
+            os.remove("mux21_orthogonal.fgl")
+        except OSError as e:
+            print(f"Error: {e.filename} - {e.strerror}.")
+
 
 if __name__ == "__main__":
     unittest.main()
@@ -78,6 +78,44 @@ class TestPostLayoutOptimiztaion(unittest.TestCase):
         self.assertEqual(stats.y_size_after, 4)
         self.assertEqual(stats.area_improvement, 50.0)
 
+    def test_post_layout_optimization_with_parallel_relocation(self):
+        network = read_technology_network(dir_path + "/../../resources/mux21.v")
+
+        sizes = []
+
+        for num_threads in [1, 2, 4]:
+            layout = orthogonal(network)
+
+            params = post_layout_optimization_params()
+            params.parallel_relocation = True
+            params.num_threads = num_threads
+
+            stats = post_layout_optimization_stats()
+            post_layout_optimization(layout, params, statistics=stats)
+
+            self.assertEqual(equivalence_checking(network, layout), eq_type.STRONG)
+
+            sizes.append((stats.x_size_after, stats.y_size_after, stats.num_wires_after))
+
+        # the result does not depend on the number of threads
+        self.assertEqual(sizes[0], sizes[1])
+        self.assertEqual(sizes[0], sizes[2])
+
+    def test_post_layout_optimization_with_gain_driven_relocation(self):
+        network = read_technology_network(dir_path + "/../../resources/mux21.v")
+
+        layout = orthogonal(network)
+
+        params = post_layout_optimization_params()
+        params.gain_driven_relocation = True
+
+        stats = post_layout_optimization_stats()
+        post_layout_optimization(layout, params, statistics=stats)
+
+        self.assertEqual(equivalence_checking(network, layout), eq_type.STRONG)
+        self.assertGreater(stats.num_relocation_attempts, 0)
+        self.assertLess(stats.x_size_after * stats.y_size_after, stats.x_size_before * stats.y_size_before)
+
 
 if __name__ == "__main__":
     unittest.main()
@@ -1,5 +1,9 @@
 import os
+import tempfile
 import unittest
+from concurrent.futures import ThreadPoolExecutor
+
+import numpy as np
 
 from mnt.pyfiction import (
     create_and_tt,
@@ -10,6 +14,7 @@ from mnt.pyfiction import (
     critical_temperature_domain_flood_fill,
     critical_temperature_domain_grid_search,
     critical_temperature_domain_random_sampling,
+    domain_storage,
     input_bdl_configuration,
     operational_domain,
     operational_domain_contour_tracing,
@@ -24,8 +29,10 @@ from mnt.pyfiction import (
     read_sqd_layout_100,
     read_sqd_layout_111,
     sidb_100_lattice,
+    sidb_simulation_domain_stream_params,
     sidb_simulation_engine,
     sidb_technology,
+    stream_format,
     sweep_parameter,
 )
 
@@ -61,6 +68,78 @@ class TestOperationalDomain(unittest.TestCase):
         operational_domain_contour_tracing(lyt, [create_xor_tt()], 100, params, stats_contour_tracing)
         self.assertGreater(stats_contour_tracing.num_operational_parameter_combinations, 0)
 
+    def test_operational_domain_storage(self):
+        lyt = read_sqd_layout_100(dir_path + "/../../../resources/hex_21_inputsdbp_xor_v1.sqd")
+
+        params = operational_domain_params()
+        params.operational_params.sim_engine = sidb_simulation_engine.QUICKEXACT
+        params.operational_params.simulation_parameters.base = 2
+
+        params.sweep_dimensions = [
+            operational_domain_value_range(sweep_parameter.EPSILON_R, 5.55, 5.65, 0.01),
+            operational_domain_value_range(sweep_parameter.LAMBDA_TF, 4.95, 5.05, 0.01),
+        ]
+
+        self.assertEqual(params.storage, domain_storage.AUTOMATIC)
+
+        params.storage = domain_storage.HASH_MAP
+        op_domain_hash_map = operational_domain_grid_search(lyt, [create_xor_tt()], params)
+
+        params.storage = domain_storage.DENSE_GRID
+        op_domain_dense_grid = operational_domain_grid_search(lyt, [create_xor_tt()], params)
+
+        self.assertGreater(len(op_domain_hash_map), 0)
+        self.assertEqual(len(op_domain_dense_grid), len(op_domain_hash_map))
+
+        for key, value in op_domain_hash_map.items():
+            self.assertIn(key, op_domain_dense_grid)
+            self.assertEqual(op_domain_dense_grid[key], value)
+
+        # parameter points off the grid are still supported
+        off_grid_key = parameter_point([5.555, 5.0])
+        op_domain_dense_grid[off_grid_key] = operational_status.OPERATIONAL
+        self.assertIn(off_grid_key, op_domain_dense_grid)
+        self.assertEqual(len(op_domain_dense_grid), len(op_domain_hash_map) + 1)
+
+    def test_operational_domain_stream(self):
+        lyt = read_sqd_layout_100(dir_path + "/../../../resources/hex_21_inputsdbp_xor_v1.sqd")
+
+        params = operational_domain_params()
+        params.operational_params.sim_engine = sidb_simulation_engine.QUICKEXACT
+        params.operational_params.simulation_parameters.base = 2
+
+        params.sweep_dimensions = [
+            operational_domain_value_range(sweep_parameter.EPSILON_R, 5.55, 5.65, 0.01),
+            operational_domain_value_range(sweep_parameter.LAMBDA_TF, 4.95, 5.05, 0.01),
+        ]
+
+        self.assertEqual(params.stream.filename, "")
+        self.assertEqual(params.stream.format, stream_format.CSV)
+        self.assertFalse(params.stream.resume)
+
+        with tempfile.TemporaryDirectory() as tmp_dir:
+            for fmt in [stream_format.CSV, stream_format.BINARY]:
+                stream_params = sidb_simulation_domain_stream_params()
+                stream_params.filename = os.path.join(tmp_dir, "op_domain")
+                stream_params.format = fmt
+                stream_params.flush_interval = 10
+                params.stream = stream_params
+
+                op_domain = operational_domain_grid_search(lyt, [create_xor_tt()], params)
+                self.assertTrue(os.path.exists(stream_params.filename))
+
+                stream_params.resume = True
+                params.stream = stream_params
+
+                stats = operational_domain_stats()
+                op_domain_resumed = operational_domain_grid_search(lyt, [create_xor_tt()], params, stats)
+
+                self.assertEqual(stats.num_simulator_invocations, 0)
+                self.assertEqual(len(op_domain_resumed), len(op_domain))
+
+                for key, value in op_domain.items():
+                    self.assertEqual(op_domain_resumed[key], value)
+
     def test_critical_temperature_domain_XOR_gate_100_lattice(self):
         lyt = read_sqd_layout_100(dir_path + "/../../../resources/hex_21_inputsdbp_xor_v1.sqd")
 
@@ -260,6 +339,58 @@ class TestOperationalDomain(unittest.TestCase):
         self.assertIn((new_key, new_value), items_method)
         self.assertEqual(len(items_method), 2)
 
+    def test_domain_to_numpy(self):
+        op_domain = operational_domain([sweep_parameter.EPSILON_R, sweep_parameter.LAMBDA_TF])
+        op_domain[parameter_point([5.5, 5.0])] = operational_status.OPERATIONAL
+        op_domain[parameter_point([5.6, 5.1])] = operational_status.NON_OPERATIONAL
+
+        parameters, operational = op_domain.to_numpy()
+        self.assertEqual(parameters.shape, (2, 2))
+        self.assertEqual(parameters.dtype, np.float64)
+        self.assertEqual(operational.shape, (2,))
+        self.assertEqual(operational.dtype, np.bool_)
+
+        for point, is_operational in zip(parameters, operational):
+            self.assertEqual(
+                op_domain[parameter_point(list(point))] == operational_status.OPERATIONAL, bool(is_operational)
+            )
+
+        ct_domain = critical_temperature_domain([sweep_parameter.EPSILON_R, sweep_parameter.LAMBDA_TF])
+        ct_domain[parameter_point([5.5, 5.0])] = (operational_status.OPERATIONAL, 35.0)
+
+        parameters, operational, critical_temperatures = ct_domain.to_numpy()
+        self.assertEqual(parameters.shape, (1, 2))
+        self.assertTrue(operational[0])
+        self.assertEqual(critical_temperatures.dtype, np.float64)
+        self.assertAlmostEqual(critical_temperatures[0], 35.0)
+
+    def test_operational_domain_concurrent_threads(self):
+        lyt = read_sqd_layout_100(dir_path + "/../../../resources/hex_21_inputsdbp_xor_v1.sqd")
+
+        params = operational_domain_params()
+        params.operational_params.sim_engine = sidb_simulation_engine.QUICKEXACT
+        params.operational_params.simulation_parameters.base = 2
+
+        params.sweep_dimensions = [
+            operational_domain_value_range(sweep_parameter.EPSILON_R, 5.55, 5.65, 0.01),
+            operational_domain_value_range(sweep_parameter.LAMBDA_TF, 4.95, 5.05, 0.01),
+        ]
+
+        reference = operational_domain_grid_search(lyt, [create_xor_tt()], params)
+
+        # the GIL is released during the search, so several sweeps can run in parallel
+        with ThreadPoolExecutor(max_workers=4) as executor:
+            futures = [
+                executor.submit(operational_domain_grid_search, lyt, [create_xor_tt()], params) for _ in range(4)
+            ]
+            results = [future.result() for future in futures]
+
+        for op_domain in results:
+            self.assertEqual(len(op_domain), len(reference))
+
+            for key, value in reference.items():
+                self.assertEqual(op_domain[key], value)
+
     def test_operational_domain_two_bdl_pair_wire(self):
         bdl_wire = sidb_100_lattice()
 
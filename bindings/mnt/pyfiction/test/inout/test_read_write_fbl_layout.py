@@ -0,0 +1,80 @@
+import os
+import unittest
+
+from mnt.pyfiction import (
+    eq_type,
+    equivalence_checking,
+    fbl_parsing_error,
+    hexagonalization,
+    orthogonal,
+    read_cartesian_fbl_layout,
+    read_fbl_layout_info,
+    read_hexagonal_fbl_layout,
+    read_qca_fbl_layout,
+    read_sidb_100_fbl_layout,
+    read_sidb_111_fbl_layout,
+    read_technology_network,
+    sidb_100_lattice,
+    sidb_technology,
+    write_fbl_layout,
+)
+
+dir_path = os.path.dirname(os.path.realpath(__file__))
+
+
+class TestReadWriteFblLayout(unittest.TestCase):
+    def test_read_write_gate_level_layout(self):
+        network = read_technology_network(dir_path + "/../resources/mux21.v")
+        cart_layout = orthogonal(network)
+        write_fbl_layout(cart_layout, "mux21_cartesian.fbl")
+
+        info = read_fbl_layout_info("mux21_cartesian.fbl")
+        self.assertTrue(info.is_gate_level)
+        self.assertEqual(info.topology, "cartesian")
+
+        read_cart_layout = read_cartesian_fbl_layout("mux21_cartesian.fbl")
+        self.assertEqual(equivalence_checking(read_cart_layout, cart_layout), eq_type.STRONG)
+
+        hex_layout = hexagonalization(cart_layout)
+        write_fbl_layout(hex_layout, "mux21_hexagonal.fbl")
+        read_hexagonal_layout = read_hexagonal_fbl_layout("mux21_hexagonal.fbl")
+        self.assertEqual(equivalence_checking(read_hexagonal_layout, hex_layout), eq_type.STRONG)
+
+        with self.assertRaises(fbl_parsing_error):
+            read_hexagonal_fbl_layout("mux21_cartesian.fbl")
+
+        os.remove("mux21_cartesian.fbl")
+        os.remove("mux21_hexagonal.fbl")
+
+    def test_read_write_cell_level_layout(self):
+        layout = sidb_100_lattice((4, 4), "AND")
+
+        layout.assign_cell_type((0, 2), sidb_technology.cell_type.INPUT)
+        layout.assign_cell_type((2, 2), sidb_technology.cell_type.NORMAL)
+        layout.assign_cell_type((4, 2), sidb_technology.cell_type.OUTPUT)
+        layout.assign_cell_name((0, 2), "a")
+
+        write_fbl_layout(layout, "and.fbl")
+
+        info = read_fbl_layout_info("and.fbl")
+        self.assertFalse(info.is_gate_level)
+        self.assertEqual(info.technology, "SiDB")
+        self.assertEqual(info.lattice_orientation, "100")
+        self.assertEqual(info.name, "AND")
+
+        read_layout = read_sidb_100_fbl_layout("and.fbl")
+        self.assertEqual(read_layout.get_layout_name(), "AND")
+        self.assertEqual(read_layout.num_cells(), 3)
+        self.assertEqual(read_layout.get_cell_type((2, 2)), sidb_technology.cell_type.NORMAL)
+        self.assertEqual(read_layout.get_cell_name((0, 2)), "a")
+
+        with self.assertRaises(fbl_parsing_error):
+            read_sidb_111_fbl_layout("and.fbl")
+        with self.assertRaises(fbl_parsing_error):
+            read_qca_fbl_layout("and.fbl")
+
+        os.remove("and.fbl")
+
+
+if __name__ == "__main__":
+    unittest.main()
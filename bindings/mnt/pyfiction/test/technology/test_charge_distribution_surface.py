@@ -1,6 +1,9 @@
 import unittest
 
+import numpy as np
+
 from mnt.pyfiction import (
+    charge_distribution_history,
     charge_distribution_surface,
     charge_distribution_surface_111,
     charge_index_mode,
@@ -93,6 +96,48 @@ class TestChargeDistributionSurface(unittest.TestCase):
         charge_lyt.assign_charge_state((2, 1), sidb_charge_state.POSITIVE)
         self.assertEqual(charge_lyt.num_positive_sidbs(), 1)
 
+    def test_numpy_arrays(self):
+        layout = sidb_layout((10, 10))
+        layout.assign_cell_type((0, 1), sidb_technology.cell_type.NORMAL)
+        layout.assign_cell_type((4, 1), sidb_technology.cell_type.NORMAL)
+        layout.assign_cell_type((6, 1), sidb_technology.cell_type.NORMAL)
+
+        charge_lyt = charge_distribution_surface(layout)
+
+        charges = charge_lyt.get_all_sidb_charges_array()
+        self.assertEqual(charges.dtype, np.int8)
+        self.assertEqual(charges.shape, (3,))
+        self.assertTrue(np.all(charges == -1))
+
+        charge_lyt.assign_charge_state((4, 1), sidb_charge_state.NEUTRAL)
+        self.assertEqual(charge_lyt.get_all_sidb_charges_array()[charge_lyt.cell_to_index((4, 1))], 0)
+
+        charge_lyt.update_local_potential(charge_distribution_history.NEGLECT)
+        potentials = charge_lyt.get_all_local_potentials_array()
+        self.assertEqual(potentials.dtype, np.float64)
+        self.assertEqual(potentials.shape, (3,))
+        for i in range(3):
+            self.assertAlmostEqual(potentials[i], charge_lyt.get_local_potential_by_index(i))
+
+        distances = charge_lyt.get_nm_distance_matrix()
+        self.assertEqual(distances.shape, (3, 3))
+        self.assertTrue(np.allclose(distances, distances.T))
+        self.assertTrue(np.allclose(np.diag(distances), 0.0))
+        self.assertAlmostEqual(distances[0, 1], charge_lyt.get_nm_distance_by_indices(0, 1))
+
+        potential_matrix = charge_lyt.get_chargeless_potential_matrix()
+        self.assertEqual(potential_matrix.shape, (3, 3))
+        self.assertAlmostEqual(potential_matrix[0, 2], charge_lyt.get_chargless_potential_by_indices(0, 2))
+
+        # the arrays own their memory and stay valid when SiDBs are added or the surface is destroyed
+        charge_lyt.add_sidb((8, 1), sidb_charge_state.NEGATIVE)
+        self.assertEqual(charge_lyt.get_all_sidb_charges_array().shape, (4,))
+
+        del charge_lyt
+        self.assertEqual(charges.shape, (3,))
+        self.assertTrue(np.all(charges == -1))
+        self.assertEqual(potentials.shape, (3,))
+
 
 if __name__ == "__main__":
     unittest.main()
@@ -0,0 +1,411 @@
+//
+// Created by marcel on 19.10.26.
+//
+
+#ifndef FICTION_CMD_BATCH_HPP
+#define FICTION_CMD_BATCH_HPP
+
+#include <fiction/utils/name_utils.hpp>
+
+#include <alice/alice.hpp>
+#include <fmt/format.h>
+#include <mockturtle/utils/stopwatch.hpp>
+#include <nlohmann/json.hpp>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <fstream>
+#include <limits>
+#include <optional>
+#include <ostream>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <variant>
+#include <vector>
+
+namespace alice
+{
+/**
+ * Outcome of running a command on a single store entry in batch mode.
+ */
+enum class batch_status : uint8_t
+{
+    /**
+     * The command produced a result.
+     */
+    SUCCESS,
+    /**
+     * The command terminated regularly but did not produce a result, e.g., because no layout exists within the given
+     * parameters or because design rule violations were found.
+     */
+    FAILURE,
+    /**
+     * The command did not produce a result before its timeout, which was restricted to the per-entry time limit.
+     */
+    TIMEOUT,
+    /**
+     * The command threw an exception.
+     */
+    EXCEPTION
+};
+/**
+ * Returns the name of the given batch status as it appears in the batch summary.
+ *
+ * @param status Batch status.
+ * @return Lower-case name of `status`.
+ */
+[[nodiscard]] inline std::string batch_status_name(const batch_status status) noexcept
+{
+    switch (status)
+    {
+        case batch_status::SUCCESS:
+        {
+            return "success";
+        }
+        case batch_status::FAILURE:
+        {
+            return "failure";
+        }
+        case batch_status::TIMEOUT:
+        {
+            return "timeout";
+        }
+        case batch_status::EXCEPTION:
+        {
+            return "exception";
+        }
+    }
+
+    return "unknown";
+}
+/**
+ * Result of a job that processes a single store entry in batch mode.
+ *
+ * @tparam Output Type of the store entry that is produced by the job, or `std::monostate` if the job does not produce
+ * any store entries.
+ */
+template <typename Output>
+struct batch_job_result
+{
+    /**
+     * Type of the produced store entry.
+     */
+    using output_type = Output;
+    /**
+     * Outcome of the job.
+     */
+    batch_status status{batch_status::SUCCESS};
+    /**
+     * Optional message that explains the outcome.
+     */
+    std::string message{};
+    /**
+     * Result metrics of the job. These use the same keys as the command's log.
+     */
+    nlohmann::json metrics = nlohmann::json::object();
+    /**
+     * Produced store entry, if any.
+     */
+    std::optional<Output> output{};
+};
+/**
+ * Base class for commands that can either be executed on the current store entry or, in batch mode, on all entries of
+ * a store concurrently.
+ *
+ * In batch mode, each entry is processed by an independent job. Jobs must neither access the command's members nor
+ * `env`, but operate on copies of the parameters and on the store entry they are given. Once all jobs have finished,
+ * the produced entries are added to their store in the order of the processed entries, and a summary with one JSON
+ * object per entry (JSON lines) is written to the standard output or to the file given via `--summary`. The summary is
+ * also returned by `log()`.
+ */
+class batch_command : public command
+{
+  public:
+    /**
+     * Standard constructor. Adds the batch mode options.
+     *
+     * @param e alice::environment that specifies stores etc.
+     * @param caption Description of the command.
+     * @param all_flag Name of the flag that enables batch mode. Commands whose short flag `-a` is already taken can
+     * pass `"--all"` here.
+     */
+    batch_command(const environment::ptr& e, const std::string& caption, const std::string& all_flag = "--all,-a") :
+            command(e, caption)
+    {
+        add_flag(all_flag, "Run the command on all entries of the store concurrently instead of only on the current "
+                           "one, and print a summary in the JSON lines format");
+        add_option("--jobs,-j", num_jobs,
+                   "Number of store entries to process concurrently in batch mode (0 to use all hardware threads)",
+                   true);
+        add_option("--summary", summary_filename, "File to write the batch mode summary to instead of the standard "
+                                                  "output");
+    }
+
+  protected:
+    /**
+     * Executes the command and resets the batch mode options afterward, which is necessary since alice does not reset
+     * them between calls.
+     */
+    void execute() final
+    {
+        batch_summary.reset();
+
+        execute_command();
+
+        num_jobs         = 0;
+        time_limit       = 0.0;
+        summary_filename = "";
+    }
+    /**
+     * Returns the batch mode summary if the command was executed in batch mode, and the command's log otherwise.
+     *
+     * @return JSON object containing information about the execution.
+     */
+    [[nodiscard]] nlohmann::json log() const final
+    {
+        if (batch_summary.has_value())
+        {
+            return *batch_summary;
+        }
+
+        return log_command();
+    }
+    /**
+     * Executes the command on the current store entry or, in batch mode, on all store entries. Batch mode is handled
+     * by `run_on_all_entries`.
+     */
+    virtual void execute_command() = 0;
+    /**
+     * Logs the resulting information of a command execution on the current store entry.
+     *
+     * @return JSON object containing information about the execution.
+     */
+    [[nodiscard]] virtual nlohmann::json log_command() const
+    {
+        return command::log();
+    }
+    /**
+     * Checks whether the command is executed in batch mode.
+     *
+     * @return `true` iff the command is to be executed on all store entries.
+     */
+    [[nodiscard]] bool is_batch_mode()
+    {
+        return is_set("all");
+    }
+    /**
+     * Adds the `--time_limit` option. Only commands whose algorithms support timeouts call this function and pass the
+     * limit to them via `apply_time_limit`. Thereby, the option is rejected by all commands that cannot interrupt
+     * their algorithms.
+     */
+    void add_time_limit_option()
+    {
+        add_option("--time_limit", time_limit,
+                   "Time limit per store entry in seconds in batch mode (0 for no limit), which restricts the "
+                   "algorithm's timeout",
+                   true);
+    }
+    /**
+     * Restricts the given algorithm timeout to the per-entry time limit if one was set. The algorithm is trusted to
+     * enforce the limit itself, i.e., results of entries that slightly exceed it are kept.
+     *
+     * @tparam Timeout Integral type of the timeout.
+     * @param timeout Timeout in milliseconds to restrict.
+     */
+    template <typename Timeout>
+    void apply_time_limit(Timeout& timeout) noexcept
+    {
+        if (time_limit <= 0.0)
+        {
+            return;
+        }
+
+        const auto limit_ms = time_limit * 1000.0;
+
+        // larger limits cannot restrict the timeout any further
+        if (limit_ms < static_cast<double>(std::numeric_limits<Timeout>::max()))
+        {
+            timeout = std::min(timeout, static_cast<Timeout>(limit_ms));
+        }
+    }
+    /**
+     * Runs the given job on all entries of the store of type `Input` using up to `--jobs` threads.
+     *
+     * @tparam Input Store type whose entries are to be processed.
+     * @tparam Job Functor type that maps a `const Input&` and the entry's index in the store to a `batch_job_result`.
+     * @param command_name Name of the command as it appears in the summary.
+     * @param job Job to run on each store entry. It is invoked concurrently and must therefore be thread-safe.
+     */
+    template <typename Input, typename Job>
+    void run_on_all_entries(const std::string& command_name, Job&& job)
+    {
+        using result_t = std::invoke_result_t<Job&, const Input&, std::size_t>;
+        using output_t = typename result_t::output_type;
+
+        auto& s = store<Input>();
+
+        // copy the entries so that jobs do not access the store concurrently
+        std::vector<Input>       entries{};
+        std::vector<std::string> names{};
+        entries.reserve(s.size());
+        names.reserve(s.size());
+
+        for (std::size_t i = 0; i < s.size(); ++i)
+        {
+            entries.push_back(s[i]);
+            names.push_back(std::visit([](auto&& ptr) { return fiction::get_name(*ptr); }, s[i]));
+        }
+
+        std::vector<result_t> results(entries.size());
+        std::vector<double>   runtimes(entries.size(), 0.0);
+
+        std::atomic<std::size_t> next_entry{0};
+
+        const auto worker = [&entries, &results, &runtimes, &next_entry, &job, this]
+        {
+            for (auto i = next_entry.fetch_add(1); i < entries.size(); i = next_entry.fetch_add(1))
+            {
+                mockturtle::stopwatch<>::duration time{0};
+
+                try
+                {
+                    const mockturtle::stopwatch stop{time};
+
+                    results[i] = job(entries[i], i);
+                }
+                catch (const std::exception& e)
+                {
+                    results[i]         = {};
+                    results[i].status  = batch_status::EXCEPTION;
+                    results[i].message = e.what();
+                }
+                catch (...)
+                {
+                    results[i]         = {};
+                    results[i].status  = batch_status::EXCEPTION;
+                    results[i].message = "an unknown error occurred";
+                }
+
+                runtimes[i] = mockturtle::to_seconds(time);
+
+                // algorithms that ran out of time do not produce a result
+                if (time_limit > 0.0 && runtimes[i] >= time_limit && results[i].status == batch_status::FAILURE)
+                {
+                    results[i].status = batch_status::TIMEOUT;
+                }
+            }
+        };
+
+        const auto num_threads = std::clamp(
+            num_jobs == 0 ? static_cast<std::size_t>(std::thread::hardware_concurrency()) : num_jobs, std::size_t{1},
+            std::max(entries.size(), std::size_t{1}));
+
+        mockturtle::stopwatch<>::duration total_time{0};
+        {
+            const mockturtle::stopwatch stop{total_time};
+
+            std::vector<std::thread> threads{};
+            threads.reserve(num_threads - 1);
+
+            for (std::size_t t = 0; t < num_threads - 1; ++t)
+            {
+                threads.emplace_back(worker);
+            }
+
+            worker();
+
+            for (auto& thread : threads)
+            {
+                thread.join();
+            }
+        }
+
+        std::ofstream summary_file{};
+        if (!summary_filename.empty())
+        {
+            summary_file.open(summary_filename);
+
+            if (!summary_file.is_open())
+            {
+                env->out() << fmt::format("[e] could not open '{}'; writing the summary to the standard output\n",
+                                          summary_filename);
+            }
+        }
+        auto& summary_stream = summary_file.is_open() ? static_cast<std::ostream&>(summary_file) : env->out();
+
+        std::array<std::size_t, 4> status_counts{};
+        batch_summary = nlohmann::json::array();
+
+        for (std::size_t i = 0; i < entries.size(); ++i)
+        {
+            auto& result = results[i];
+
+            ++status_counts[static_cast<std::size_t>(result.status)];
+
+            if constexpr (!std::is_same_v<output_t, std::monostate>)
+            {
+                if (result.output.has_value())
+                {
+                    store<output_t>().extend() = std::move(*result.output);
+                }
+            }
+
+            nlohmann::json line{{"command", command_name},
+                                {"index", i},
+                                {"name", names[i]},
+                                {"status", batch_status_name(result.status)},
+                                {"runtime in seconds", runtimes[i]},
+                                {"metrics", std::move(result.metrics)}};
+
+            if (!result.message.empty())
+            {
+                line["message"] = std::move(result.message);
+            }
+
+            summary_stream << line.dump() << '\n';
+
+            batch_summary->push_back(std::move(line));
+        }
+
+        summary_stream.flush();
+
+        if (summary_file.is_open())
+        {
+            env->out() << fmt::format("[i] processed {} entries with {} jobs in {:.2f} s: {} succeeded, {} failed, {} "
+                                      "timed out, {} threw an exception\n",
+                                      entries.size(), num_threads, mockturtle::to_seconds(total_time),
+                                      status_counts[static_cast<std::size_t>(batch_status::SUCCESS)],
+                                      status_counts[static_cast<std::size_t>(batch_status::FAILURE)],
+                                      status_counts[static_cast<std::size_t>(batch_status::TIMEOUT)],
+                                      status_counts[static_cast<std::size_t>(batch_status::EXCEPTION)]);
+        }
+    }
+
+  private:
+    /**
+     * Number of store entries to process concurrently (0 to use all hardware threads).
+     */
+    std::size_t num_jobs{0};
+    /**
+     * Time limit per store entry in seconds (0 for no limit).
+     */
+    double time_limit{0.0};
+    /**
+     * File to write the summary to.
+     */
+    std::string summary_filename{};
+    /**
+     * Summary of the last batch mode execution.
+     */
+    std::optional<nlohmann::json> batch_summary{};
+};
+
+}  // namespace alice
+
+#endif  // FICTION_CMD_BATCH_HPP
@@ -0,0 +1,146 @@
+//
+// Created by marcel on 19.10.26.
+//
+
+#ifndef FICTION_CMD_FBL_HPP
+#define FICTION_CMD_FBL_HPP
+
+#include <fiction/io/write_fbl_layout.hpp>
+#include <fiction/traits.hpp>
+#include <fiction/types.hpp>
+#include <fiction/utils/name_utils.hpp>
+
+#include <alice/alice.hpp>
+#include <fmt/format.h>
+
+#include <filesystem>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <variant>
+
+namespace alice
+{
+/**
+ * Generates a compact binary FBL file for the current gate-level or cell-level layout in store and writes it to the
+ * given path.
+ */
+class fbl_command : public command
+{
+  public:
+    /**
+     * Standard constructor. Adds descriptive information, options, and flags.
+     *
+     * @param e alice::environment that specifies stores etc.
+     */
+    explicit fbl_command(const environment::ptr& e) :
+            command(e, "Generates a compact binary FBL file for the current gate-level layout in store. "
+                       "Large layouts are written and read back considerably faster than with FGL or SQD.")
+    {
+        add_option("filename", filename, "FBL file name");
+        add_flag("--cell_layout,-c", "Write the current cell-level layout instead");
+    }
+
+  protected:
+    /**
+     * Function to perform the output call. Generates an FBL file.
+     */
+    void execute() override
+    {
+        if (is_set("cell_layout"))
+        {
+            write_current<fiction::cell_layout_t>("cell-level");
+        }
+        else
+        {
+            write_current<fiction::gate_layout_t>("gate-level");
+        }
+
+        filename.clear();
+    }
+
+  private:
+    /**
+     * File name to write the FBL file into.
+     */
+    std::string filename;
+    /**
+     * Writes the current layout of the store associated with the given layout variant.
+     *
+     * @tparam LytVariant Layout variant type that identifies the store.
+     * @param store_name Name of the store to use in messages.
+     */
+    template <typename LytVariant>
+    void write_current(const std::string& store_name)
+    {
+        auto& s = store<LytVariant>();
+
+        // error case: empty layout store
+        if (s.empty())
+        {
+            env->out() << fmt::format("[w] no {} layout in store", store_name) << std::endl;
+            return;
+        }
+
+        const auto get_name = [](auto&& lyt_ptr) -> std::string { return fiction::get_name(*lyt_ptr); };
+
+        const auto write_fbl = [this, &get_name](auto&& lyt_ptr)
+        {
+            using Lyt = typename std::decay_t<decltype(lyt_ptr)>::element_type;
+
+            if constexpr (std::is_same_v<fiction::coordinate<Lyt>, fiction::offset::ucoord_t>)
+            {
+                fiction::write_fbl_layout(*lyt_ptr, filename);
+            }
+            else
+            {
+                env->out() << fmt::format("[e] {} does not use offset coordinates and cannot be stored as FBL",
+                                          get_name(lyt_ptr))
+                           << std::endl;
+            }
+        };
+
+        const auto& lyt = s.current();
+
+        // error case: do not override directories
+        if (std::filesystem::is_directory(filename))
+        {
+            env->out() << "[e] cannot override a directory" << std::endl;
+            return;
+        }
+        // if filename was not given, use stored layout name
+        if (filename.empty())
+        {
+            filename = std::visit(get_name, lyt);
+        }
+        // add .fbl file extension if necessary
+        if (std::filesystem::path(filename).extension() != ".fbl")
+        {
+            filename += ".fbl";
+        }
+
+        try
+        {
+            std::visit(write_fbl, lyt);
+        }
+        catch (const std::ofstream::failure& e)
+        {
+            env->out() << fmt::format("[e] {}", e.what()) << std::endl;
+        }
+        catch (const fiction::fbl_write_error& e)
+        {
+            env->out() << fmt::format("[e] {}", e.what()) << std::endl;
+        }
+        catch (...)
+        {
+            env->out() << "[e] an error occurred while the file was being written; it could be corrupted" << std::endl;
+        }
+    }
+};
+
+ALICE_ADD_COMMAND(fbl, "I/O")
+
+}  // namespace alice
+
+#endif  // FICTION_CMD_FBL_HPP
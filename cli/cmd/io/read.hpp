@@ -6,6 +6,7 @@
 #define FICTION_CMD_READ_HPP
 
 #include <fiction/io/network_reader.hpp>
+#include <fiction/io/read_fbl_layout.hpp>
 #include <fiction/io/read_fgl_layout.hpp>
 #include <fiction/io/read_fqca_layout.hpp>
 #include <fiction/io/read_sqd_layout.hpp>
@@ -18,6 +19,7 @@
 #include <filesystem>
 #include <memory>
 #include <string>
+#include <type_traits>
 
 namespace alice
 {
@@ -28,7 +30,7 @@ namespace alice
  *
  * For more information see: https://github.com/hriener/lorina
  *
- * Parses FGL, SQD, and FQCA via custom reader functions.
+ * Parses FGL, FBL, SQD, and FQCA via custom reader functions.
  */
 class read_command : public command
 {
@@ -42,8 +44,8 @@ class read_command : public command
             command(e, "Reads a file or a directory of files and creates logic network or FCN layout objects "
                        "which will be put into the respective store. Current supported file types are:\n"
                        "Logic networks: Verilog, AIGER, BLIF.\n"
-                       "Gate-level layouts: FGL.\n"
-                       "Cell-level layouts: SQD, FQCA.\n"
+                       "Gate-level layouts: FGL, FBL.\n"
+                       "Cell-level layouts: SQD, FQCA, FBL.\n"
                        "In a directory, only files with extension '.v', '.aig', '.blif' are considered.")
     {
         add_option("filename", filename, "Filename or directory")->required();
@@ -58,6 +60,7 @@ class read_command : public command
         add_flag("--fgl,-f", "Parse FGL file as fiction gate-level layout");
         add_flag("--sqd,-s", "Parse SQD file as SiDB cell-level layout");
         add_flag("--fqca,-q", "Parse FQCA file as QCA cell-level layout");
+        add_flag("--fbl,-b", "Parse FBL file as fiction gate-level or cell-level layout");
         add_flag("--sort", sort, "Sort networks in given directory by node count prior to storing them");
     }
 
@@ -68,7 +71,7 @@ class read_command : public command
     void execute() override
     {
         if (!is_set("aig") && !is_set("xag") && !is_set("mig") && !is_set("tec") && !is_set("fgl") && !is_set("sqd") &&
-            !is_set("fqca"))
+            !is_set("fqca") && !is_set("fbl"))
         {
             env->out() << "[e] at least one network or layout type must be specified" << std::endl;
         }
@@ -85,6 +88,12 @@ class read_command : public command
         {
             env->out() << "[e] cannot parse files as both gate-level and cell-level layouts" << std::endl;
         }
+        else if (is_set("fbl") &&
+                 (is_set("aig") || is_set("xag") || is_set("mig") || is_set("tec") || is_set("fgl") ||
+                  is_set("sqd") || is_set("fqca")))
+        {
+            env->out() << "[e] FBL files cannot be parsed as any other file type" << std::endl;
+        }
         else
         {
             const auto store_ntks = [&](auto&& reader)
@@ -121,13 +130,24 @@ class read_command : public command
 
                     store_ntks(reader);
                 }
-                if (is_set("fgl") || is_set("sqd") || is_set("fqca"))
+                if (is_set("fgl") || is_set("sqd") || is_set("fqca") || is_set("fbl"))
                 {
                     if (std::filesystem::exists(filename))
                     {
                         if (std::filesystem::is_regular_file(filename))
                         {
-                            if (is_set("fgl"))
+                            if (is_set("fbl"))
+                            {
+                                try
+                                {
+                                    read_fbl();
+                                }
+                                catch (const fiction::fbl_parsing_error& e)
+                                {
+                                    env->out() << e.what() << std::endl;
+                                }
+                            }
+                            else if (is_set("fgl"))
                             {
                                 if (!topology.empty())
                                 {
@@ -292,6 +312,94 @@ class read_command : public command
     }
 
   private:
+    /**
+     * Reads an FBL file. The layout type is determined by the file header such that neither the topology nor the
+     * lattice orientation have to be specified.
+     */
+    void read_fbl()
+    {
+        const auto info = fiction::read_fbl_layout_info(filename);
+
+        const auto store_gate_layout = [this](auto&& type_tag)
+        {
+            using Lyt = typename std::decay_t<decltype(type_tag)>::element_type;
+
+            store<fiction::gate_layout_t>().extend() = std::make_shared<Lyt>(fiction::read_fbl_layout<Lyt>(filename));
+        };
+
+        const auto store_cell_layout = [this](auto&& type_tag)
+        {
+            using Lyt = typename std::decay_t<decltype(type_tag)>::element_type;
+
+            store<fiction::cell_layout_t>().extend() = std::make_shared<Lyt>(fiction::read_fbl_layout<Lyt>(filename));
+        };
+
+        if (info.is_gate_level)
+        {
+            if (info.topology == "cartesian")
+            {
+                store_gate_layout(std::shared_ptr<fiction::cart_gate_clk_lyt>{});
+            }
+            else if (info.topology == "odd_row_cartesian")
+            {
+                store_gate_layout(std::shared_ptr<fiction::cart_odd_row_gate_clk_lyt>{});
+            }
+            else if (info.topology == "even_row_cartesian")
+            {
+                store_gate_layout(std::shared_ptr<fiction::cart_even_row_gate_clk_lyt>{});
+            }
+            else if (info.topology == "odd_column_cartesian")
+            {
+                store_gate_layout(std::shared_ptr<fiction::cart_odd_col_gate_clk_lyt>{});
+            }
+            else if (info.topology == "even_column_cartesian")
+            {
+                store_gate_layout(std::shared_ptr<fiction::cart_even_col_gate_clk_lyt>{});
+            }
+            else if (info.topology == "odd_row_hex")
+            {
+                store_gate_layout(std::shared_ptr<fiction::hex_odd_row_gate_clk_lyt>{});
+            }
+            else if (info.topology == "even_row_hex")
+            {
+                store_gate_layout(std::shared_ptr<fiction::hex_even_row_gate_clk_lyt>{});
+            }
+            else if (info.topology == "odd_column_hex")
+            {
+                store_gate_layout(std::shared_ptr<fiction::hex_odd_col_gate_clk_lyt>{});
+            }
+            else if (info.topology == "even_column_hex")
+            {
+                store_gate_layout(std::shared_ptr<fiction::hex_even_col_gate_clk_lyt>{});
+            }
+        }
+        else if (info.topology != "cartesian")
+        {
+            env->out() << fmt::format("[e] cell-level layouts with topology {} are not supported", info.topology)
+                       << std::endl;
+        }
+        else if (info.technology == "QCA")
+        {
+            store_cell_layout(std::shared_ptr<fiction::qca_cell_clk_lyt>{});
+        }
+        else if (info.technology == "iNML")
+        {
+            store_cell_layout(std::shared_ptr<fiction::inml_cell_clk_lyt>{});
+        }
+        else if (info.technology == "SiDB" && info.lattice_orientation == "111")
+        {
+            store_cell_layout(std::shared_ptr<fiction::sidb_111_cell_clk_lyt>{});
+        }
+        else if (info.technology == "SiDB")
+        {
+            store_cell_layout(std::shared_ptr<fiction::sidb_100_cell_clk_lyt>{});
+        }
+        else
+        {
+            env->out() << fmt::format("[e] cell-level layouts of technology '{}' are not supported", info.technology)
+                       << std::endl;
+        }
+    }
     /**
      * Verilog filename.
      */
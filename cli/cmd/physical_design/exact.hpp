@@ -11,10 +11,13 @@
 #include <fiction/layouts/clocking_scheme.hpp>
 #include <fiction/types.hpp>
 
+#include "../batch.hpp"
+
 #include <alice/alice.hpp>
 #include <nlohmann/json.hpp>
 
 #include <memory>
+#include <string>
 #include <thread>
 #include <variant>
 
@@ -24,7 +27,7 @@ namespace alice
  * Executes an exact physical design approach utilizing the SMT solver Z3.
  * See algo/exact.h for more details.
  */
-class exact_command : public command
+class exact_command : public batch_command
 {
   public:
     /**
@@ -33,8 +36,10 @@ class exact_command : public command
      * @param e alice::environment that specifies stores etc.
      */
     explicit exact_command(const environment::ptr& e) :
-            command(e, "Performs exact placement and routing of the current logic network in store. "
-                       "A minimum FCN layout will be found that meets all given constraints.")
+            batch_command(e,
+                          "Performs exact placement and routing of the current logic network in store. "
+                          "A minimum FCN layout will be found that meets all given constraints.",
+                          "--all")
     {
         add_option("--clk_scheme,-s", ps.scheme,
                    "Clocking scheme to use {OPEN[3|4], COLUMNAR[3|4], ROW[3|4] 2DDWAVE[3|4], 2DDWAVEHEX[3|4], USE, "
@@ -50,6 +55,9 @@ class exact_command : public command
 
         add_flag("--async_max,",
                  "Examine as many layout dimensions in parallel as threads are available (beta feature)");
+        add_flag("--portfolio,-p", ps.portfolio,
+                 "Run the parallel threads as a solver portfolio that shares bounds across threads (beta feature)");
+        add_option("--seed", ps.portfolio_seed, "Base random seed for the solver portfolio");
         add_option("--hex", hexagonal_tile_shift,
                    "Use hexagonal tiles and specify tile shift. Possible values are 'odd_row', 'even_row', "
                    "'odd_column', or 'even_column'");
@@ -66,9 +74,13 @@ class exact_command : public command
                  "Minimize the number of crossing tiles to be used (slightly runtime expensive)");
         add_flag("--sync_elems,-e", ps.synchronization_elements,
                  "Allow synchronization elements to satisfy global synchronization (runtime expensive!)");
+        add_flag("--break_symmetry", ps.break_translation_symmetry,
+                 "Exclude layouts that could be translated towards the origin (2DDWave, Columnar, and Row clocking "
+                 "with de-synchronization or border I/Os only)");
 
         add_flag("--topolinano", "Indicate the use of technology-specific constraints for iNML as used by ToPoliNano "
                                  "(to be used with COLUMNAR clocking)");
+        add_time_limit_option();
     }
 
   protected:
@@ -76,7 +88,7 @@ class exact_command : public command
      * Function to perform the physical design call.
      * Given arguments are parsed and a placed and routed FCN gate layout is generated if possible.
      */
-    void execute() override
+    void execute_command() override
     {
         auto& s = store<fiction::logic_network_t>();
 
@@ -153,14 +165,9 @@ class exact_command : public command
      *
      * @return JSON object containing information about the solving process.
      */
-    nlohmann::json log() const override
+    nlohmann::json log_command() const override
     {
-        return nlohmann::json{
-            {"runtime in seconds", mockturtle::to_seconds(st.time_total)},
-            {"number of gates", st.num_gates},
-            {"number of wires", st.num_wires},
-            {"number of crossings", st.num_crossings},
-            {"layout", {{"x-size", st.x_size}, {"y-size", st.y_size}, {"area", st.x_size * st.y_size}}}};
+        return nlohmann::json(st);
     }
 
   private:
@@ -201,6 +208,53 @@ class exact_command : public command
     template <typename Lyt>
     void exact_physical_design()
     {
+        if (is_batch_mode())
+        {
+            auto params = ps;
+            apply_time_limit(params.timeout);
+
+            run_on_all_entries<fiction::logic_network_t>(
+                "exact",
+                [params](const fiction::logic_network_t& ntk, const std::size_t /* index */)
+                {
+                    batch_job_result<fiction::gate_layout_t> result{};
+                    fiction::exact_physical_design_stats     stats{};
+
+                    const auto perform_physical_design = [&params, &stats](auto&& ntk_ptr)
+                    { return fiction::exact<Lyt>(*ntk_ptr, params, &stats); };
+
+                    try
+                    {
+                        if (const auto lyt = std::visit(perform_physical_design, ntk); lyt.has_value())
+                        {
+                            result.output = std::make_shared<Lyt>(*lyt);
+                        }
+                        else
+                        {
+                            result.status  = batch_status::FAILURE;
+                            result.message = "impossible to place and route within the given parameters";
+                        }
+                    }
+                    catch (const fiction::unsupported_clocking_scheme_exception&)
+                    {
+                        result.status  = batch_status::FAILURE;
+                        result.message =
+                            fmt::format("\"{}\" does not refer to a supported clocking scheme", params.scheme);
+                    }
+                    catch (const fiction::high_degree_fanin_exception& e)
+                    {
+                        result.status  = batch_status::FAILURE;
+                        result.message = fmt::format("{} of the given clocking scheme", e.what());
+                    }
+
+                    result.metrics = nlohmann::json(stats);
+
+                    return result;
+                });
+
+            return;
+        }
+
         const auto get_name = [](auto&& ntk_ptr) -> std::string { return ntk_ptr->get_network_name(); };
 
         const auto perform_physical_design = [this](auto&& ntk_ptr) { return fiction::exact<Lyt>(*ntk_ptr, ps, &st); };
@@ -9,11 +9,14 @@
 #include <fiction/traits.hpp>
 #include <fiction/types.hpp>
 
+#include "../batch.hpp"
+
 #include <alice/alice.hpp>
 #include <nlohmann/json.hpp>
 
 #include <iostream>
 #include <memory>
+#include <string>
 #include <variant>
 
 namespace alice
@@ -22,7 +25,7 @@ namespace alice
  * Executes a physical design approach utilizing A* path finding in a search space graph.
  * See algorithms/physical_design/graph_oriented_layout_search.hpp for more details.
  */
-class gold_command : public command
+class gold_command : public batch_command
 {
   public:
     /**
@@ -31,11 +34,11 @@ class gold_command : public command
      * @param e alice::environment that specifies stores etc.
      */
     explicit gold_command(const environment::ptr& e) :
-            command(e, "Performs scalable placement and routing of the current logic network in store using the "
-                       "Graph-Oriented Layout Design (GOLD) algorithm. GOLD generates close-to-optimal 2DDWave-clocked "
-                       "FCN gate-level layouts in reasonable runtime. Its result quality is better than 'ortho' and "
-                       "its runtime behavior superior to 'exact' and 'onepass'. Additionally, different cost "
-                       "objectives can be specified.")
+            batch_command(e, "Performs scalable placement and routing of the current logic network in store using the "
+                             "Graph-Oriented Layout Design (GOLD) algorithm. GOLD generates close-to-optimal "
+                             "2DDWave-clocked FCN gate-level layouts in reasonable runtime. Its result quality is "
+                             "better than 'ortho' and its runtime behavior superior to 'exact' and 'onepass'. "
+                             "Additionally, different cost objectives can be specified.")
     {
         add_option("--timeout,-t", ps.timeout, "Timeout in seconds");
         add_option("--num_vertex_expansions,-n", ps.num_vertex_expansions, "Number of vertex expansions during search",
@@ -64,14 +67,17 @@ class gold_command : public command
                  "Terminate on the first found layout; reduces runtime but might sacrifice result quality");
         add_flag("--planar,-p", ps.planar, "Enable planar layout generation");
         add_flag("--multithreading,-m", ps.enable_multithreading, "Enable multithreading (beta feature)");
+        add_option("--parallel_expansions,-x", ps.num_parallel_expansions,
+                   "Number of vertices per search space graph that are expanded concurrently", true);
         add_flag("--verbose,-v", ps.verbose, "Be verbose");
+        add_time_limit_option();
     }
 
   protected:
     /**
      * Function to perform the physical design call. Generates a placed and routed FCN gate layout.
      */
-    void execute() override
+    void execute_command() override
     {
         // error case: empty logic network store
         if (store<fiction::logic_network_t>().empty())
@@ -88,6 +94,13 @@ class gold_command : public command
             return;
         }
 
+        if (ps.num_parallel_expansions == 0)
+        {
+            env->out() << "[w] the number of parallel expansions has to be at least 1" << std::endl;
+            ps = {};
+            return;
+        }
+
         if (is_set("timeout"))
         {
             // convert timeout entered in seconds to milliseconds
@@ -104,14 +117,9 @@ class gold_command : public command
      *
      * @return JSON object containing information about the physical design process.
      */
-    nlohmann::json log() const override
+    nlohmann::json log_command() const override
     {
-        return nlohmann::json{
-            {"runtime in seconds", mockturtle::to_seconds(st.time_total)},
-            {"number of gates", st.num_gates},
-            {"number of wires", st.num_wires},
-            {"number of crossings", st.num_crossings},
-            {"layout", {{"x-size", st.x_size}, {"y-size", st.y_size}, {"area", st.x_size * st.y_size}}}};
+        return nlohmann::json(st);
     }
 
   private:
@@ -127,6 +135,49 @@ class gold_command : public command
     template <typename Lyt>
     void graph_oriented_layout_design()
     {
+        if (is_batch_mode())
+        {
+            auto params = ps;
+            apply_time_limit(params.timeout);
+            // concurrent jobs would interleave their reports
+            params.verbose = false;
+
+            run_on_all_entries<fiction::logic_network_t>(
+                "gold",
+                [params](const fiction::logic_network_t& ntk, const std::size_t /* index */)
+                {
+                    batch_job_result<fiction::gate_layout_t> result{};
+                    fiction::graph_oriented_layout_design_stats stats{};
+
+                    const auto perform_physical_design = [&params, &stats](auto&& ntk_ptr)
+                    { return fiction::graph_oriented_layout_design<Lyt>(*ntk_ptr, params, &stats); };
+
+                    try
+                    {
+                        if (const auto lyt = std::visit(perform_physical_design, ntk); lyt.has_value())
+                        {
+                            result.output = std::make_shared<Lyt>(*lyt);
+                        }
+                        else
+                        {
+                            result.status  = batch_status::FAILURE;
+                            result.message = "impossible to place and route within the given parameters";
+                        }
+                    }
+                    catch (const fiction::high_degree_fanin_exception& e)
+                    {
+                        result.status  = batch_status::FAILURE;
+                        result.message = e.what();
+                    }
+
+                    result.metrics = nlohmann::json(stats);
+
+                    return result;
+                });
+
+            return;
+        }
+
         const auto get_name = [](auto&& ntk_ptr) -> std::string { return ntk_ptr->get_network_name(); };
 
         const auto perform_physical_design = [this](auto&& ntk_ptr)
@@ -34,6 +34,12 @@ class hex_command : public command
         add_flag("--output_pin_extension,-o", "Extend primary output pins to the resulting layout's bottom row");
         add_flag("--planar,-p", "Extend primary input and/or output pins with planar rerouting (i.e., without "
                                 "crossings) in the resulting layout");
+        add_flag("--negotiated,-n", ps.negotiated_congestion_routing,
+                 "Reroute extended primary input and/or output pins together via negotiated congestion instead of one "
+                 "after another");
+        add_option("--threads", ps.num_threads,
+                   "Compute the coordinate transformation using the given number of threads (0 to use all hardware "
+                   "threads). The result does not depend on the number of threads.");
         add_flag("--verbose,-v", "Be verbose");
     }
 
@@ -13,11 +13,17 @@
 #include <fiction/types.hpp>
 #include <fiction/utils/name_utils.hpp>
 
+#include "../batch.hpp"
+
 #include <alice/alice.hpp>
+#include <mockturtle/utils/stopwatch.hpp>
+#include <nlohmann/json.hpp>
 
 #include <cstdint>
 #include <iostream>
+#include <memory>
 #include <optional>
+#include <type_traits>
 #include <variant>
 
 namespace alice
@@ -25,7 +31,7 @@ namespace alice
 /**
  * Optimizes a 2DDWave-clocked Cartesian layout.
  */
-class optimize_command : public command
+class optimize_command : public batch_command
 {
   public:
     /**
@@ -34,9 +40,10 @@ class optimize_command : public command
      * @param e alice::environment that specifies stores etc.
      */
     explicit optimize_command(const environment::ptr& e) :
-            command(e, "Optimizes a 2DDWave-clocked Cartesian layout with respect to area. It achieves this objective "
-                       "by strategically repositioning gates within the layout, removing excess wiring, and "
-                       "effectively relocating outputs to more favorable positions.")
+            batch_command(e,
+                          "Optimizes a 2DDWave-clocked Cartesian layout with respect to area. It achieves this "
+                          "objective by strategically repositioning gates within the layout, removing excess wiring, "
+                          "and effectively relocating outputs to more favorable positions.")
     {
         add_flag("--wiring_reduction_only,-w",
                  "Do not attempt gate repositioning, but apply wiring reduction "
@@ -48,8 +55,21 @@ class optimize_command : public command
                  "During optimization, only relocate gates if the new wiring contains no crossings. For planar "
                  "layouts, the resulting layout will also be planar. If the layout already contains crossings, the "
                  "optimized layout will have the same number of crossings or less.");
+        add_flag("--gain_driven,-g", ps.gain_driven_relocation,
+                 "Visit gates in the order of their estimated gain instead of diagonally. This usually achieves most "
+                 "of the area reduction with a fraction of the relocation attempts.");
+        add_flag("--incremental,-i", psw.incremental_search,
+                 "During wiring reduction, update the search layouts in place after each deletion instead of "
+                 "recreating them (only applies in combination with --wiring_reduction_only).");
+        add_flag("--disjoint_paths,-d", psw.disjoint_paths,
+                 "During wiring reduction, find several non-overlapping paths of excess wiring per search pass (only "
+                 "applies in combination with --wiring_reduction_only).");
         add_flag("--verbose,-v", "Be verbose");
         add_option("--timeout,-t", ps.timeout, "Timeout in seconds");
+        add_option("--threads", ps.num_threads,
+                   "Relocate gates in conflict-free batches using the given number of threads (0 to use all hardware "
+                   "threads). The result does not depend on the number of threads.");
+        add_time_limit_option();
     }
 
   protected:
@@ -71,7 +91,7 @@ class optimize_command : public command
     /**
      * Optimizes a 2DDWave-clocked Cartesian layout.
      */
-    void execute() override
+    void execute_command() override
     {
         auto& gls = store<fiction::gate_layout_t>();
 
@@ -83,6 +103,30 @@ class optimize_command : public command
             return;
         }
 
+        if (is_set("timeout"))
+        {
+            // convert timeout entered in seconds to milliseconds
+            ps.timeout *= 1000;
+            psw.timeout = ps.timeout;
+        }
+
+        if (is_set("max_gate_relocations"))
+        {
+            ps.max_gate_relocations = max_gate_relocations;
+        }
+        if (is_set("threads"))
+        {
+            ps.parallel_relocation = true;
+        }
+
+        if (is_batch_mode())
+        {
+            optimize_all_layouts();
+            ps  = {};
+            psw = {};
+            return;
+        }
+
         const auto& lyt = gls.current();
 
         const auto is_twoddwave_clocked = [](auto&& lyt_ptr) -> bool
@@ -92,17 +136,11 @@ class optimize_command : public command
         if (!std::visit(is_twoddwave_clocked, lyt))
         {
             env->out() << "[e] layout has to be 2DDWave-clocked\n";
-            ps = {};
+            ps  = {};
+            psw = {};
             return;
         }
 
-        if (is_set("timeout"))
-        {
-            // convert timeout entered in seconds to milliseconds
-            ps.timeout *= 1000;
-            psw.timeout = ps.timeout;
-        }
-
         const auto apply_optimization = [&](auto&& lyt_ptr)
         {
             using Lyt = typename std::decay_t<decltype(lyt_ptr)>::element_type;
@@ -138,12 +176,72 @@ class optimize_command : public command
             }
         };
 
-        if (is_set("max_gate_relocations"))
-        {
-            ps.max_gate_relocations = max_gate_relocations;
-        }
         std::visit(apply_optimization, lyt);
-        ps = {};
+        ps  = {};
+        psw = {};
+    }
+
+  private:
+    /**
+     * Optimizes all layouts in store concurrently.
+     */
+    void optimize_all_layouts()
+    {
+        auto params        = ps;
+        auto params_wiring = psw;
+        apply_time_limit(params.timeout);
+        apply_time_limit(params_wiring.timeout);
+
+        run_on_all_entries<fiction::gate_layout_t>(
+            "optimize",
+            [params, params_wiring, wiring_reduction_only = is_set("wiring_reduction_only")](
+                const fiction::gate_layout_t& lyt, const std::size_t /* index */)
+            {
+                batch_job_result<fiction::gate_layout_t> result{};
+
+                const auto apply_optimization = [&](auto&& lyt_ptr)
+                {
+                    using Lyt = typename std::decay_t<decltype(lyt_ptr)>::element_type;
+
+                    if (!lyt_ptr->is_clocking_scheme(fiction::clock_name::TWODDWAVE))
+                    {
+                        result.status  = batch_status::FAILURE;
+                        result.message = "layout has to be 2DDWave-clocked";
+                        return;
+                    }
+
+                    if constexpr (fiction::is_cartesian_layout_v<Lyt>)
+                    {
+                        auto lyt_copy = lyt_ptr->clone();
+
+                        if (wiring_reduction_only)
+                        {
+                            fiction::wiring_reduction_stats stats{};
+                            fiction::wiring_reduction(lyt_copy, params_wiring, &stats);
+                            result.metrics = nlohmann::json(stats);
+                        }
+                        else
+                        {
+                            fiction::post_layout_optimization_stats stats{};
+                            fiction::post_layout_optimization(lyt_copy, params, &stats);
+                            result.metrics = nlohmann::json(stats);
+                        }
+
+                        fiction::restore_names(*lyt_ptr, lyt_copy);
+
+                        result.output = std::make_shared<Lyt>(lyt_copy);
+                    }
+                    else
+                    {
+                        result.status  = batch_status::FAILURE;
+                        result.message = "layout has to be Cartesian";
+                    }
+                };
+
+                std::visit(apply_optimization, lyt);
+
+                return result;
+            });
     }
 };
 
@@ -10,13 +10,18 @@
 #include <fiction/types.hpp>
 #include <fiction/utils/network_utils.hpp>
 
+#include "../batch.hpp"
+
 #include <alice/alice.hpp>
 #include <mockturtle/utils/stopwatch.hpp>
 #include <mockturtle/views/names_view.hpp>
 #include <nlohmann/json.hpp>
 
 #include <cstdint>
+#include <fstream>
 #include <memory>
+#include <string>
+#include <variant>
 
 namespace alice
 {
@@ -24,7 +29,7 @@ namespace alice
  * Executes a heuristic physical approach based on "Improved Orthogonal Drawing of 3-graphs" by Therese Biedl, 1996.
  * See algo/orthogonal.hpp for more details.
  */
-class ortho_command : public command
+class ortho_command : public batch_command
 {
   public:
     /**
@@ -33,13 +38,17 @@ class ortho_command : public command
      * @param e alice::environment that specifies stores etc.
      */
     explicit ortho_command(const environment::ptr& e) :
-            command(e, "Performs scalable placement and routing of the current logic network in store. "
-                       "An FCN layout that is not minimal will be found in reasonable runtime.")
+            batch_command(e, "Performs scalable placement and routing of the current logic network in store. "
+                             "An FCN layout that is not minimal will be found in reasonable runtime.")
     {
         add_option("--clock_numbers,-n", num_clock_phases, "Number of clock phases to be used {3 or 4}");
         add_option("--hex", hexagonal_tile_shift,
                    "Use hexagonal tiles and specify tile shift. Possible values are 'odd_row', 'even_row', "
                    "'odd_column', or 'even_column'");
+        add_flag("--two_pass,-t", "Pre-compute the number of layout elements to pre-allocate the layout's storage");
+        add_option("--fgl,-f", fgl_filename,
+                   "Write the Cartesian layout directly to the given FGL file instead of storing it (saves memory "
+                   "on very large networks)");
         add_flag("--verbose,-v", "Be verbose");
     }
 
@@ -47,7 +56,7 @@ class ortho_command : public command
     /**
      * Function to perform the physical design call. Generates a placed and routed FCN gate layout.
      */
-    void execute() override
+    void execute_command() override
     {
         // error case: empty logic network store
         if (store<fiction::logic_network_t>().empty())
@@ -67,8 +76,24 @@ class ortho_command : public command
         }
 
         ps.number_of_clock_phases = num_clock_phases == 3 ? fiction::num_clks::THREE : fiction::num_clks::FOUR;
+        ps.two_pass               = is_set("two_pass");
 
-        if (is_set("hex"))
+        if (is_set("fgl"))
+        {
+            if (is_batch_mode())
+            {
+                env->out() << "[e] writing FGL files directly is not supported in batch mode" << std::endl;
+            }
+            else if (is_set("hex"))
+            {
+                env->out() << "[e] writing FGL files directly is only supported for Cartesian layouts" << std::endl;
+            }
+            else
+            {
+                write_orthogonal_fgl_layout<fiction::cart_gate_clk_lyt>();
+            }
+        }
+        else if (is_set("hex"))
         {
             if (hexagonal_tile_shift == "odd_row")
             {
@@ -100,6 +125,7 @@ class ortho_command : public command
 
         ps                   = {};
         hexagonal_tile_shift = "";
+        fgl_filename         = "";
     }
 
     /**
@@ -107,14 +133,9 @@ class ortho_command : public command
      *
      * @return JSON object containing information about the physical design process.
      */
-    nlohmann::json log() const override
+    nlohmann::json log_command() const override
     {
-        return nlohmann::json{
-            {"runtime in seconds", mockturtle::to_seconds(st.time_total)},
-            {"number of gates", st.num_gates},
-            {"number of wires", st.num_wires},
-            {"number of crossings", st.num_crossings},
-            {"layout", {{"x-size", st.x_size}, {"y-size", st.y_size}, {"area", st.x_size * st.y_size}}}};
+        return nlohmann::json(st);
     }
 
   private:
@@ -122,6 +143,10 @@ class ortho_command : public command
      * Tile shift for hexagonal layouts.
      */
     std::string hexagonal_tile_shift{};
+    /**
+     * File to write the layout into without storing it.
+     */
+    std::string fgl_filename{};
     /**
      * Number of clock phases.
      */
@@ -138,6 +163,36 @@ class ortho_command : public command
     template <typename Lyt>
     void orthogonal_physical_design()
     {
+        if (is_batch_mode())
+        {
+            run_on_all_entries<fiction::logic_network_t>(
+                "ortho",
+                [params = ps](const fiction::logic_network_t& ntk, const std::size_t /* index */)
+                {
+                    batch_job_result<fiction::gate_layout_t> result{};
+                    fiction::orthogonal_physical_design_stats stats{};
+
+                    const auto perform_physical_design = [&params, &stats](auto&& ntk_ptr) -> fiction::gate_layout_t
+                    { return std::make_shared<Lyt>(fiction::orthogonal<Lyt>(*ntk_ptr, params, &stats)); };
+
+                    try
+                    {
+                        result.output = std::visit(perform_physical_design, ntk);
+                    }
+                    catch (const fiction::high_degree_fanin_exception& e)
+                    {
+                        result.status  = batch_status::FAILURE;
+                        result.message = e.what();
+                    }
+
+                    result.metrics = nlohmann::json(stats);
+
+                    return result;
+                });
+
+            return;
+        }
+
         const auto perform_physical_design = [this](auto&& ntk_ptr)
         { return fiction::orthogonal<Lyt>(*ntk_ptr, ps, &st); };
 
@@ -159,6 +214,33 @@ class ortho_command : public command
             env->out() << fmt::format("[e] {}", e.what()) << std::endl;
         }
     }
+
+    template <typename Lyt>
+    void write_orthogonal_fgl_layout()
+    {
+        const auto perform_physical_design = [this](auto&& ntk_ptr)
+        { fiction::write_orthogonal_fgl_layout<Lyt>(*ntk_ptr, fgl_filename, ps, &st); };
+
+        const auto& ntk_ptr = store<fiction::logic_network_t>().current();
+
+        try
+        {
+            std::visit(perform_physical_design, ntk_ptr);
+
+            if (is_set("verbose"))
+            {
+                st.report(env->out());
+            }
+        }
+        catch (const fiction::high_degree_fanin_exception& e)
+        {
+            env->out() << fmt::format("[e] {}", e.what()) << std::endl;
+        }
+        catch (const std::ofstream::failure& e)
+        {
+            env->out() << fmt::format("[e] {}", e.what()) << std::endl;
+        }
+    }
 };
 
 ALICE_ADD_COMMAND(ortho, "Physical Design")
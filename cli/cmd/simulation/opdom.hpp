@@ -12,6 +12,8 @@
 #include <fiction/types.hpp>
 #include <fiction/utils/name_utils.hpp>
 
+#include "../batch.hpp"
+
 #include <alice/alice.hpp>
 #include <mockturtle/utils/stopwatch.hpp>
 #include <nlohmann/json.hpp>
@@ -19,8 +21,10 @@
 #include <algorithm>
 #include <array>
 #include <cctype>
+#include <cstddef>
 #include <cstdlib>
 #include <exception>
+#include <filesystem>
 #include <iostream>
 #include <optional>
 #include <stdexcept>
@@ -53,7 +57,7 @@ namespace alice
  * problem: data is not read from the CLI properly after the manual reset. This causes error messages to be displayed
  * only once even if the same misconfigured command is executed twice in a row.
  */
-class opdom_command : public command
+class opdom_command : public batch_command
 {
   public:
     /**
@@ -62,7 +66,7 @@ class opdom_command : public command
      * @param e alice::environment that specifies stores etc.
      */
     explicit opdom_command(const environment::ptr& e) :
-            command(
+            batch_command(
                 e,
                 "Computes the operational domain for the current SiDB cell-level layout in store. An operational "
                 "domain is a set of simulation parameter values for which a given SiDB layout is logically operational."
@@ -76,7 +80,10 @@ class opdom_command : public command
         add_option("--contour_tracing,-c", num_random_samples,
                    "Use contour tracing instead of grid search with this many random samples");
 
-        add_option("filename", filename, "CSV filename to write the operational domain to")->required();
+        add_option("filename", filename,
+                   "CSV filename to write the operational domain to; in batch mode, the index of each store entry is "
+                   "appended to the file's stem")
+            ->required();
         add_flag(
             "--omit_non_op_samples,-o", omit_non_operational_samples,
             "Omit non-operational samples in the CSV file to reduce file size and increase visibility in 3D plots");
@@ -115,7 +122,7 @@ class opdom_command : public command
     /**
      * Function to perform the operational domain call.
      */
-    void execute() override
+    void execute_command() override
     {
         // reset operational domain and stats
         op_domain = {};
@@ -268,6 +275,13 @@ class opdom_command : public command
             sweep_dimensions.pop_back();
         }
 
+        if (is_batch_mode())
+        {
+            compute_all_operational_domains();
+            reset_params();
+            return;
+        }
+
         const auto get_name = [](auto&& lyt_ptr) -> std::string { return fiction::get_name(*lyt_ptr); };
 
         const auto opdom = [this, &ts, &get_name](auto&& lyt_ptr)
@@ -412,18 +426,9 @@ class opdom_command : public command
             return;
         }
 
-        // set up parameters
-        fiction::write_operational_domain_params write_opdom_params{};
-        write_opdom_params.non_operational_tag = "0";
-        write_opdom_params.operational_tag     = "1";
-        write_opdom_params.writing_mode =
-            omit_non_operational_samples ?
-                fiction::write_operational_domain_params::sample_writing_mode::OPERATIONAL_ONLY :
-                fiction::write_operational_domain_params::sample_writing_mode::ALL_SAMPLES;
-
         try
         {
-            write_operational_domain(op_domain, filename, write_opdom_params);
+            write_operational_domain(op_domain, filename, write_params());
         }
         catch (const std::exception& e)
         {
@@ -441,15 +446,143 @@ class opdom_command : public command
      *
      * @return JSON object containing details about the operational domain.
      */
-    [[nodiscard]] nlohmann::json log() const override
+    [[nodiscard]] nlohmann::json log_command() const override
+    {
+        return stats_to_json(params.operational_params.sim_engine, stats);
+    }
+    /**
+     * Converts the given statistics into a JSON object.
+     *
+     * @param engine Simulation engine that was used.
+     * @param op_stats Statistics of the operational domain computation.
+     * @return JSON object containing details about the operational domain.
+     */
+    [[nodiscard]] static nlohmann::json stats_to_json(const fiction::sidb_simulation_engine     engine,
+                                                      const fiction::operational_domain_stats& op_stats)
     {
         return nlohmann::json{
-            {"Algorithm name", sidb_simulation_engine_name(params.operational_params.sim_engine)},
-            {"Runtime in seconds", mockturtle::to_seconds(stats.time_total)},
-            {"Number of simulator invocations", stats.num_simulator_invocations},
-            {"Number of evaluated parameter combinations", stats.num_evaluated_parameter_combinations},
-            {"Number of operational parameter combinations", stats.num_operational_parameter_combinations},
-            {"Number of non-operational parameter combinations", stats.num_non_operational_parameter_combinations}};
+            {"Algorithm name", sidb_simulation_engine_name(engine)},
+            {"Runtime in seconds", mockturtle::to_seconds(op_stats.time_total)},
+            {"Number of simulator invocations", op_stats.num_simulator_invocations},
+            {"Number of evaluated parameter combinations", op_stats.num_evaluated_parameter_combinations},
+            {"Number of operational parameter combinations", op_stats.num_operational_parameter_combinations},
+            {"Number of non-operational parameter combinations", op_stats.num_non_operational_parameter_combinations},
+            {"Profile", op_stats.profile}};
+    }
+    /**
+     * Returns the parameters for writing the operational domain to a CSV file.
+     *
+     * @return Parameters for `write_operational_domain`.
+     */
+    [[nodiscard]] fiction::write_operational_domain_params write_params() const noexcept
+    {
+        fiction::write_operational_domain_params write_opdom_params{};
+        write_opdom_params.non_operational_tag = "0";
+        write_opdom_params.operational_tag     = "1";
+        write_opdom_params.writing_mode =
+            omit_non_operational_samples ?
+                fiction::write_operational_domain_params::sample_writing_mode::OPERATIONAL_ONLY :
+                fiction::write_operational_domain_params::sample_writing_mode::ALL_SAMPLES;
+
+        return write_opdom_params;
+    }
+    /**
+     * Computes the operational domains of all SiDB layouts in store concurrently with respect to the current truth
+     * table in store. Each operational domain is written to its own CSV file.
+     */
+    void compute_all_operational_domains()
+    {
+        const auto engine = fiction::get_sidb_simulation_engine(sim_engine_str);
+
+        if (!engine.has_value())
+        {
+            env->out() << fmt::format("[e] {} is not a supported SiDB simulation engine\n", sim_engine_str);
+            return;
+        }
+
+        auto job_params                                     = params;
+        job_params.operational_params.simulation_parameters = simulation_params;
+        job_params.sweep_dimensions                         = sweep_dimensions;
+        job_params.operational_params.sim_engine            = engine.value();
+
+        run_on_all_entries<fiction::cell_layout_t>(
+            "opdom",
+            [job_params, spec = std::vector{*store<fiction::truth_table_t>().current()}, samples = num_random_samples,
+             random_sampling = is_set("random_sampling"), flood_fill = is_set("flood_fill"),
+             contour_tracing = is_set("contour_tracing"), write_opdom_params = write_params(),
+             base_path = std::filesystem::path{filename}](const fiction::cell_layout_t& lyt, const std::size_t index)
+            {
+                batch_job_result<std::monostate> result{};
+
+                // append the index to the file's stem, e.g., 'opdom.csv' becomes 'opdom_3.csv'
+                auto output_path = base_path;
+                output_path.replace_filename(
+                    fmt::format("{}_{}{}", base_path.stem().string(), index, base_path.extension().string()));
+
+                fiction::operational_domain_stats op_stats{};
+
+                const auto opdom = [&](auto&& lyt_ptr)
+                {
+                    using Lyt = typename std::decay_t<decltype(lyt_ptr)>::element_type;
+
+                    if constexpr (!fiction::has_sidb_technology_v<Lyt>)
+                    {
+                        result.status  = batch_status::FAILURE;
+                        result.message = "not an SiDB layout";
+                    }
+                    else
+                    {
+                        if (lyt_ptr->num_pis() == 0 || lyt_ptr->num_pos() == 0)
+                        {
+                            result.status  = batch_status::FAILURE;
+                            result.message = "requires primary input and output cells to simulate its Boolean function";
+                            return;
+                        }
+
+                        fiction::operational_domain op_domain{};
+
+                        if (random_sampling)
+                        {
+                            op_domain = fiction::operational_domain_random_sampling(*lyt_ptr, spec, samples,
+                                                                                    job_params, &op_stats);
+                        }
+                        else if (flood_fill)
+                        {
+                            op_domain = fiction::operational_domain_flood_fill(*lyt_ptr, spec, samples, job_params,
+                                                                               &op_stats);
+                        }
+                        else if (contour_tracing)
+                        {
+                            op_domain = fiction::operational_domain_contour_tracing(*lyt_ptr, spec, samples,
+                                                                                    job_params, &op_stats);
+                        }
+                        else
+                        {
+                            op_domain = fiction::operational_domain_grid_search(*lyt_ptr, spec, job_params, &op_stats);
+                        }
+
+                        if (op_domain.empty())
+                        {
+                            result.status  = batch_status::FAILURE;
+                            result.message = "no parameter combinations were evaluated";
+                            return;
+                        }
+
+                        write_operational_domain(op_domain, output_path.string(), write_opdom_params);
+                    }
+                };
+
+                std::visit(opdom, lyt);
+
+                result.metrics = stats_to_json(job_params.operational_params.sim_engine, op_stats);
+
+                if (result.status == batch_status::SUCCESS)
+                {
+                    result.metrics["File"] = output_path.string();
+                }
+
+                return result;
+            });
     }
     /**
      * Resets the parameters to their default values.
@@ -12,6 +12,8 @@
 #include <fiction/types.hpp>
 #include <fiction/utils/name_utils.hpp>
 
+#include "../batch.hpp"
+
 #include <alice/alice.hpp>
 #include <nlohmann/json.hpp>
 
@@ -29,7 +31,7 @@ namespace alice
 /**
  * Executes *QuickExact* exact simulation for the current SiDB cell-level layout in store.
  */
-class quickexact_command : public command
+class quickexact_command : public batch_command
 {
   public:
     /**
@@ -38,9 +40,9 @@ class quickexact_command : public command
      * @param e alice::environment that specifies stores etc.
      */
     explicit quickexact_command(const environment::ptr& e) :
-            command(e, "QuickExact is a quick and exact electrostatic ground state simulation algorithm designed "
-                       "specifically for SiDB layouts. It provides a significant performance advantage of more than "
-                       "three orders of magnitude over ExGS from SiQAD.")
+            batch_command(e, "QuickExact is a quick and exact electrostatic ground state simulation algorithm designed "
+                             "specifically for SiDB layouts. It provides a significant performance advantage of more "
+                             "than three orders of magnitude over ExGS from SiQAD.")
     {
         add_option("--epsilon_r,-e", physical_params.epsilon_r, "Electric permittivity of the substrate (unit-less)",
                    true);
@@ -54,7 +56,7 @@ class quickexact_command : public command
     /**
      * Function to perform the simulation call.
      */
-    void execute() override
+    void execute_command() override
     {
         // reset sim result
         sim_result = {};
@@ -83,6 +85,13 @@ class quickexact_command : public command
             return;
         }
 
+        if (is_batch_mode())
+        {
+            simulate_all_layouts();
+            reset_params();
+            return;
+        }
+
         const auto get_name = [](auto&& lyt_ptr) -> std::string { return fiction::get_name(*lyt_ptr); };
 
         const auto quickexact = [this, &get_name](auto&& lyt_ptr)
@@ -187,41 +196,105 @@ class quickexact_command : public command
      *
      * @return JSON object containing details about the simulation.
      */
-    [[nodiscard]] nlohmann::json log() const override
+    [[nodiscard]] nlohmann::json log_command() const override
     {
         try
         {
             if (std::holds_alternative<sim_result_100>(sim_result))
             {
-                const auto& sim_res = std::get<sim_result_100>(sim_result);
-
-                return nlohmann::json{{"Algorithm name", sim_res.algorithm_name},
-                                      {"Simulation runtime", sim_res.simulation_runtime.count()},
-                                      {"Physical parameters",
-                                       {{"epsilon_r", sim_res.simulation_parameters.epsilon_r},
-                                        {"lambda_tf", sim_res.simulation_parameters.lambda_tf},
-                                        {"mu_minus", sim_res.simulation_parameters.mu_minus}}},
-                                      {"Lowest state energy (eV)", min_energy},
-                                      {"Number of stable states", sim_res.charge_distributions.size()}};
+                return sim_result_to_json(std::get<sim_result_100>(sim_result), min_energy);
             }
 
-            const auto& sim_res = std::get<sim_result_111>(sim_result);
-
-            return nlohmann::json{{"Algorithm name", sim_res.algorithm_name},
-                                  {"Simulation runtime", sim_res.simulation_runtime.count()},
-                                  {"Physical parameters",
-                                   {{"epsilon_r", sim_res.simulation_parameters.epsilon_r},
-                                    {"lambda_tf", sim_res.simulation_parameters.lambda_tf},
-                                    {"mu_minus", sim_res.simulation_parameters.mu_minus}}},
-                                  {"Lowest state energy (eV)", min_energy},
-                                  {"Number of stable states", sim_res.charge_distributions.size()}};
+            return sim_result_to_json(std::get<sim_result_111>(sim_result), min_energy);
         }
         catch (...)
         {
             return nlohmann::json{};
         }
     }
+    /**
+     * Converts the given simulation result into a JSON object.
+     *
+     * @tparam SimResult Simulation result type.
+     * @param sim_res Simulation result.
+     * @param lowest_energy Energy of the ground state.
+     * @return JSON object containing details about the simulation.
+     */
+    template <typename SimResult>
+    [[nodiscard]] static nlohmann::json sim_result_to_json(const SimResult& sim_res, const double lowest_energy)
+    {
+        return nlohmann::json{{"Algorithm name", sim_res.algorithm_name},
+                              {"Simulation runtime", sim_res.simulation_runtime.count()},
+                              {"Physical parameters",
+                               {{"epsilon_r", sim_res.simulation_parameters.epsilon_r},
+                                {"lambda_tf", sim_res.simulation_parameters.lambda_tf},
+                                {"mu_minus", sim_res.simulation_parameters.mu_minus}}},
+                              {"Lowest state energy (eV)", lowest_energy},
+                              {"Number of stable states", sim_res.charge_distributions.size()}};
+    }
+    /**
+     * Simulates all SiDB layouts in store concurrently and stores their ground states.
+     */
+    void simulate_all_layouts()
+    {
+        auto params                  = qe_params;
+        params.simulation_parameters = physical_params;
 
+        run_on_all_entries<fiction::cell_layout_t>(
+            "quickexact",
+            [params](const fiction::cell_layout_t& lyt, const std::size_t /* index */)
+            {
+                batch_job_result<fiction::cell_layout_t> result{};
+
+                const auto quickexact = [&params, &result](auto&& lyt_ptr)
+                {
+                    using Lyt = typename std::decay_t<decltype(lyt_ptr)>::element_type;
+
+                    if constexpr (!fiction::has_sidb_technology_v<Lyt> ||
+                                  fiction::is_charge_distribution_surface_v<Lyt>)
+                    {
+                        result.status  = batch_status::FAILURE;
+                        result.message = "not an SiDB layout without charge distribution";
+                    }
+                    else
+                    {
+                        const auto sim_res = fiction::quickexact(*lyt_ptr, params);
+
+                        if (sim_res.charge_distributions.empty())
+                        {
+                            result.status  = batch_status::FAILURE;
+                            result.message = "ground state could not be determined";
+                            result.metrics = sim_result_to_json(sim_res, std::numeric_limits<double>::infinity());
+                            return;
+                        }
+
+                        const auto min_energy_distr = fiction::minimum_energy_distribution(
+                            sim_res.charge_distributions.cbegin(), sim_res.charge_distributions.cend());
+
+                        result.metrics =
+                            sim_result_to_json(sim_res, min_energy_distr->get_electrostatic_potential_energy());
+
+                        if constexpr (fiction::is_sidb_lattice_100_v<Lyt>)
+                        {
+                            result.output = std::make_shared<fiction::cds_sidb_100_cell_clk_lyt>(*min_energy_distr);
+                        }
+                        else if constexpr (fiction::is_sidb_lattice_111_v<Lyt>)
+                        {
+                            result.output = std::make_shared<fiction::cds_sidb_111_cell_clk_lyt>(*min_energy_distr);
+                        }
+                        else
+                        {
+                            result.status  = batch_status::FAILURE;
+                            result.message = "no valid lattice orientation";
+                        }
+                    }
+                };
+
+                std::visit(quickexact, lyt);
+
+                return result;
+            });
+    }
     /**
      * Resets the parameters to their default values.
      */
@@ -8,9 +8,13 @@
 #include <fiction/algorithms/verification/design_rule_violations.hpp>
 #include <fiction/types.hpp>
 
+#include "../batch.hpp"
+
 #include <alice/alice.hpp>
 #include <nlohmann/json.hpp>
 
+#include <cstddef>
+#include <sstream>
 #include <variant>
 
 namespace alice
@@ -21,7 +25,7 @@ namespace alice
  *
  * See fiction/algorithms/design_rule_violations.hpp for more details.
  */
-class check_command : public command
+class check_command : public batch_command
 {
   public:
     /**
@@ -30,15 +34,15 @@ class check_command : public command
      * @param e alice::environment that specifies stores etc.
      */
     explicit check_command(const environment::ptr& e) :
-            command(e, "Performs various design rule checks on the current gate-level layout in store. "
-                       "A full report can be logged and a summary is printed to standard output.")
+            batch_command(e, "Performs various design rule checks on the current gate-level layout in store. "
+                             "A full report can be logged and a summary is printed to standard output.")
     {}
 
   protected:
     /**
      * Function to perform the design rule check call. Generates a report and prints a summary.
      */
-    void execute() override
+    void execute_command() override
     {
         auto& s = store<fiction::gate_layout_t>();
 
@@ -49,6 +53,12 @@ class check_command : public command
             return;
         }
 
+        if (is_batch_mode())
+        {
+            check_all_layouts();
+            return;
+        }
+
         ps.out = &env->out();
         pst    = {};
 
@@ -62,7 +72,7 @@ class check_command : public command
      *
      * @return JSON object containing information about the process.
      */
-    nlohmann::json log() const override
+    nlohmann::json log_command() const override
     {
         return pst.report;
     }
@@ -70,6 +80,41 @@ class check_command : public command
   private:
     fiction::gate_level_drv_params ps{};
     fiction::gate_level_drv_stats  pst{};
+
+    /**
+     * Performs design rule checks on all gate-level layouts in store concurrently. A layout fails if it has at least
+     * one design rule violation.
+     */
+    void check_all_layouts()
+    {
+        run_on_all_entries<fiction::gate_layout_t>(
+            "check",
+            [params = ps](const fiction::gate_layout_t& lyt, const std::size_t /* index */)
+            {
+                batch_job_result<std::monostate> result{};
+                fiction::gate_level_drv_stats    stats{};
+
+                // the summary replaces the printed report
+                std::ostringstream report{};
+                auto               job_params = params;
+                job_params.out                = &report;
+
+                const auto design_rule_check = [&job_params, &stats](auto&& lyt_ptr)
+                { fiction::gate_level_drvs(*lyt_ptr, job_params, &stats); };
+
+                std::visit(design_rule_check, lyt);
+
+                if (stats.drvs > 0)
+                {
+                    result.status  = batch_status::FAILURE;
+                    result.message = "design rule violations found";
+                }
+
+                result.metrics = nlohmann::json{{"DRVs", stats.drvs}, {"warnings", stats.warnings}};
+
+                return result;
+            });
+    }
 };
 
 ALICE_ADD_COMMAND(check, "Verification")
@@ -11,6 +11,7 @@
 
 // input/output commands
 #include "cmd/io/blif.hpp"
+#include "cmd/io/fbl.hpp"
 #include "cmd/io/fgl.hpp"
 #include "cmd/io/fqca.hpp"
 #include "cmd/io/qca.hpp"
@@ -5,22 +5,25 @@
 #ifndef FICTION_GENERATE_EDGE_INTERSECTION_GRAPH_HPP
 #define FICTION_GENERATE_EDGE_INTERSECTION_GRAPH_HPP
 
+#include "fiction/algorithms/path_finding/a_star.hpp"
 #include "fiction/algorithms/path_finding/enumerate_all_paths.hpp"
 #include "fiction/algorithms/path_finding/k_shortest_paths.hpp"
 #include "fiction/layouts/obstruction_layout.hpp"
 #include "fiction/traits.hpp"
 #include "fiction/utils/routing_utils.hpp"
-#include "fiction/utils/stl_utils.hpp"
 
 #include <mockturtle/utils/stopwatch.hpp>
 #include <phmap.h>
 
 #include <algorithm>
+#include <atomic>
 #include <cstdint>
+#include <limits>
 #include <optional>
+#include <thread>
+#include <utility>
 #include <vector>
 
-#include <combinations.h>
 #include <undirected_graph.h>
 #include <undirected_pair.h>
 
@@ -50,6 +53,12 @@ struct generate_edge_intersection_graph_params
      * Yen's algorithm) instead of all paths.
      */
     std::optional<uint32_t> path_limit = std::nullopt;
+    /**
+     * Number of threads used to enumerate the paths of the routing objectives. Since the objectives are independent,
+     * each thread enumerates the paths of entire objectives. The resulting graph does not depend on the number of
+     * threads. If set to 0, the number of hardware threads is used.
+     */
+    uint64_t num_threads = 1ull;
 };
 
 struct generate_edge_intersection_graph_stats
@@ -95,26 +104,15 @@ class generate_edge_intersection_graph_impl
         // measure runtime
         mockturtle::stopwatch stop{pst.time_total};
 
-        std::for_each(objectives.cbegin(), objectives.cend(),
-                      [this](const auto& obj)
-                      {
-                          path_collection<clk_path> obj_paths{};
-
-                          if (!ps.path_limit.has_value())
-                          {
-                              // enumerate all paths for the current objective
-                              obj_paths = enumerate_all_paths<clk_path>(obstruction_layout{layout},
-                                                                        {obj.source, obj.target}, {ps.crossings});
-                          }
-                          else
-                          {
-                              // enumerate k paths for the current objective
-                              obj_paths = yen_k_shortest_paths<clk_path>(
-                                  obstruction_layout{layout}, {obj.source, obj.target}, *ps.path_limit, {ps.crossings});
-                          }
+        // the path enumeration is independent for each objective and, thus, happens up front
+        const auto objective_paths = enumerate_objective_paths();
 
+        // the graph, however, is built sequentially in objective order to assign deterministic labels
+        std::for_each(objective_paths.cbegin(), objective_paths.cend(),
+                      [this](const auto& obj_paths)
+                      {
                           // assign a unique label to each path and create a corresponding node in the graph
-                          initiate_objective_nodes(obj_paths);
+                          const auto first_label = initiate_objective_nodes(obj_paths);
 
                           // if there are no paths, the objective could not be fulfilled
                           if (obj_paths.empty())
@@ -125,13 +123,13 @@ class generate_edge_intersection_graph_impl
                           {
                               // since all paths of the same objective have intersections by definition, create
                               // edges between all of them by iterating over all possible combinations of size 2
-                              connect_clique(obj_paths);
+                              connect_clique(first_label, obj_paths.size());
                           }
-                          // for each previously stored path, create an edge if there is an intersection
-                          create_intersection_edges(obj_paths);
+                          // for each previously indexed path, create an edge if there is an intersection
+                          create_intersection_edges(obj_paths, first_label);
 
-                          // add the collection to all paths gathered thus far
-                          all_paths.insert(all_paths.end(), obj_paths.cbegin(), obj_paths.cend());
+                          // make the paths of this objective searchable for the ones of all subsequent objectives
+                          index_paths(obj_paths, first_label);
                       });
 
         // store size of the generated graph
@@ -167,164 +165,264 @@ class generate_edge_intersection_graph_impl
      */
     std::size_t node_id{0}, edge_id{0};
     /**
-     * Extends the layout_coordinate_path to additionally to the vector representation of the path also hold a set that
-     * allows fast lookup needed to find intersections (O(log n)). Additionally, a label is assigned to each path to
-     * identify it in the edge intersection graph.
+     * Alias for the path type.
      */
-    class labeled_layout_coordinate_lookup_path : public layout_coordinate_path<Lyt>
+    using path = layout_coordinate_path<Lyt>;
+    /**
+     * Maps a coordinate to the labels of all indexed paths that are associated with it, each of which is annotated
+     * with a successive coordinate where needed.
+     */
+    using coordinate_index =
+        phmap::flat_hash_map<coordinate<Lyt>, std::vector<std::pair<coordinate<Lyt>, std::size_t>>>;
+    /**
+     * Inverted index that maps each coordinate to all paths that contain it. Without crossings, only the inner
+     * coordinates of each path are indexed, because a path's source and target are allowed to be shared. With
+     * crossings, each segment of size 2 is indexed by its first coordinate instead and its second coordinate is stored
+     * alongside the label. Thereby, only paths that actually share a tile have to be considered when looking for
+     * intersections instead of all paths enumerated thus far.
+     */
+    coordinate_index tile_index{};
+    /**
+     * Maps each source coordinate to the targets and labels of all indexed paths starting there. Paths that share both
+     * source and target are always considered intersecting.
+     */
+    coordinate_index terminal_index{};
+    /**
+     * Stores for each label the label of the path for which it has last been found as a candidate. This is used to
+     * avoid inserting duplicate edges when a pair of paths shares more than one tile.
+     */
+    std::vector<std::size_t> last_candidate_of{};
+    /**
+     * Enumerates the paths of all objectives. If more than one thread is requested, the objectives are distributed
+     * dynamically among them. Each thread owns a search context whose buffers are reused across its objectives.
+     *
+     * @return A collection of paths for each objective in the order of `objectives`.
+     */
+    [[nodiscard]] std::vector<path_collection<path>> enumerate_objective_paths() const
     {
-      public:
-        /**
-         * Overwrites the append function to additionally store the given coordinate in a set.
-         *
-         * @param c Coordinate to append to the path.
-         */
-        void append(const coordinate<Lyt>& c) noexcept
-        {
-            path_elements.insert(c);
-            layout_coordinate_path<Lyt>::append(c);
-        }
-        /**
-         * Given another path, this function checks if they are not disjoint, i.e., it looks for at least one coordinate
-         * that both paths share.
-         *
-         * If, at some point, the set approach is not to be used anymore, std::find_first_of offers the same
-         * functionality on any kind of range.
-         *
-         * @tparam Path Type of other path.
-         * @param other The other path.
-         * @return `true` iff this path and the given one are not disjoint, i.e., share at least one coordinate.
-         */
-        template <typename Path>
-        bool has_intersection_with(const Path& other) const noexcept
+        std::vector<path_collection<path>> objective_paths(objectives.size());
+
+        const auto enumerate = [this](const auto& obj, a_star_context<Lyt>& context)
         {
-            // if source and target are identical, an intersection was found
-            if (this->source() == other.source() && this->target() == other.target())
+            if (!ps.path_limit.has_value())
             {
-                return true;
+                // enumerate all paths for the current objective
+                return enumerate_all_paths<path>(obstruction_layout{layout}, {obj.source, obj.target}, context,
+                                                 {ps.crossings});
             }
 
-            // else, check if any of the remaining coordinates occur in the stored path
-            return std::any_of(std::cbegin(other) + 1, std::cend(other) - 1,
-                               [this](const auto& c) { return path_elements.count(c) > 0; });
-        }
-        /**
-         * Like has_intersection_with but allows paths to share crossings, i.e., single-tile intersections.
-         *
-         * Similar to has_intersection_with, this function also returns `true` if source and target are matching in both
-         * paths.
-         *
-         * @tparam Path Type of other path.
-         * @param other The other path.
-         * @return `true` iff this path and the given one are overlapping, i.e., share at least one coordinate segment
-         * of size 2.
-         */
-        template <typename Path>
-        bool has_overlap_with(const Path& other) const noexcept
+            // enumerate k paths for the current objective
+            return yen_k_shortest_paths<path>(obstruction_layout{layout}, {obj.source, obj.target}, *ps.path_limit,
+                                              context, {ps.crossings});
+        };
+
+        const auto num_workers = std::min(static_cast<uint64_t>(objectives.size()), determine_num_threads());
+
+        if (num_workers <= 1)
         {
-            // if source and target are identical, an intersection was found
-            if (this->source() == other.source() && this->target() == other.target())
+            a_star_context<Lyt> context{};
+
+            for (std::size_t i = 0; i < objectives.size(); ++i)
             {
-                return true;
+                objective_paths[i] = enumerate(objectives[i], context);
             }
 
-            // else, check if any of the coordinates (including I/Os) form a shared segment in the stored path
-            return find_first_two_of(std::cbegin(other), std::cend(other), std::cbegin(*this), std::cend(*this)) !=
-                   std::cend(other);
+            return objective_paths;
         }
-        /**
-         * Label to identify the path in the edge intersection graph.
-         */
-        std::size_t label{};
-
-      protected:
-        using base = layout_coordinate_path<Lyt>;
-
-      public:
-        // make all inherited constructors available
-        using base::base;
-
-      private:
-        /**
-         * Uniquely identify path elements in a set to make them searchable in O(1).
-         */
-        phmap::flat_hash_set<coordinate<Lyt>> path_elements{};
-    };
-    /**
-     * Alias for the path type.
-     */
-    using clk_path = labeled_layout_coordinate_lookup_path;
+
+        std::atomic<std::size_t> next_objective{0};
+
+        std::vector<std::thread> workers{};
+        workers.reserve(num_workers);
+
+        for (uint64_t i = 0; i < num_workers; ++i)
+        {
+            workers.emplace_back(
+                [this, &objective_paths, &next_objective, &enumerate]
+                {
+                    a_star_context<Lyt> context{};
+
+                    for (auto k = next_objective++; k < objectives.size(); k = next_objective++)
+                    {
+                        objective_paths[k] = enumerate(objectives[k], context);
+                    }
+                });
+        }
+
+        for (auto& worker : workers)
+        {
+            worker.join();
+        }
+
+        return objective_paths;
+    }
     /**
-     * Stores a collection of all annotated paths (labeled_layout_coordinate_lookup_path objects) computed thus far to
-     * find intersections with new ones. The edge intersection graph stores plain paths without the extra set and label.
-     * Therefore, after the generate_edge_intersection_graph function terminates, the extra memory overhead is being
-     * released again.
+     * Determines the number of threads to use for the path enumeration.
+     *
+     * @return Number of threads.
      */
-    path_collection<clk_path> all_paths{};
+    [[nodiscard]] uint64_t determine_num_threads() const noexcept
+    {
+        if (ps.num_threads != 0)
+        {
+            return ps.num_threads;
+        }
+
+        return std::max(uint64_t{1}, static_cast<uint64_t>(std::thread::hardware_concurrency()));
+    }
     /**
-     * Given a collection of paths belonging to the same objective, this function assigns them unique labels and
+     * Given a collection of paths belonging to the same objective, this function assigns them consecutive labels and
      * generates corresponding nodes in the edge intersection graph.
      *
      * Since each path of the same objective objective belongs to a clique in the final graph, this function
      * additionally stores their node IDs in the statistics.
      *
      * @param objective_paths Collection of paths belonging to the same objective.
+     * @return Label of the first path in `objective_paths`.
      */
-    void initiate_objective_nodes(path_collection<clk_path>& objective_paths) noexcept
+    std::size_t initiate_objective_nodes(const path_collection<path>& objective_paths) noexcept
     {
+        const auto first_label = node_id;
+
         std::vector<std::size_t> clique{};
+        clique.reserve(objective_paths.size());
 
-        std::for_each(objective_paths.begin(), objective_paths.end(),
-                      [this, &clique](auto& p)
+        std::for_each(objective_paths.cbegin(), objective_paths.cend(),
+                      [this, &clique](const auto& p)
                       {
-                          p.label = node_id++;
-                          graph.insert_vertex(p.label, p);
-                          clique.push_back(p.label);
+                          graph.insert_vertex(node_id, p);
+                          clique.push_back(node_id++);
                       });
 
         if (!clique.empty())
         {
             pst.cliques.push_back(clique);
         }
+
+        last_candidate_of.resize(node_id, std::numeric_limits<std::size_t>::max());
+
+        return first_label;
+    }
+    /**
+     * Given the consecutive labels of paths belonging to the same objective, this function creates edges in the edge
+     * intersection graph between each pair of corresponding nodes, thus, forming a clique (complete sub-graph).
+     *
+     * @param first_label Label of the first path of the objective.
+     * @param num_paths Number of paths of the objective.
+     */
+    void connect_clique(const std::size_t first_label, const std::size_t num_paths) noexcept
+    {
+        for (auto i = first_label; i < first_label + num_paths; ++i)
+        {
+            for (auto j = i + 1; j < first_label + num_paths; ++j)
+            {
+                graph.insert_edge(i, j, edge_id++);
+            }
+        }
     }
     /**
      * Given a collection of paths belonging to the same objective, this function creates edges in the edge intersection
-     * graph between each pair of corresponding nodes, thus, forming a clique (complete sub-graph).
+     * graph between each corresponding node and all of the already existing nodes that represent paths that intersect
+     * with it, i.e., that share at least one coordinate or, if crossings are enabled, at least one segment of size 2.
+     *
+     * Only paths that are found via the inverted indices are considered. To keep the resulting graph identical to a
+     * pairwise comparison of all paths, the edges of each path are inserted in ascending label order.
      *
      * @param objective_paths Collection of paths belonging to the same objective.
+     * @param first_label Label of the first path in `objective_paths`.
      */
-    void connect_clique(path_collection<clk_path>& objective_paths) noexcept
+    void create_intersection_edges(const path_collection<path>& objective_paths, const std::size_t first_label) noexcept
     {
-        combinations::for_each_combination(objective_paths.begin(), objective_paths.begin() + 2, objective_paths.end(),
-                                           [this](const auto begin, [[maybe_unused]] const auto end)
-                                           {
-                                               graph.insert_edge(begin->label, (begin + 1)->label, edge_id++);
+        std::vector<std::size_t> candidates{};
 
-                                               return false;  // keep looping
-                                           });
+        for (std::size_t i = 0; i < objective_paths.size(); ++i)
+        {
+            const auto& obj_p = objective_paths[i];
+            const auto  label = first_label + i;
+
+            candidates.clear();
+
+            const auto add_candidate = [this, &candidates, label](const std::size_t stored_label) noexcept
+            {
+                if (last_candidate_of[stored_label] != label)
+                {
+                    last_candidate_of[stored_label] = label;
+                    candidates.push_back(stored_label);
+                }
+            };
+
+            // paths with identical source and target always intersect
+            if (const auto it = terminal_index.find(obj_p.source()); it != terminal_index.cend())
+            {
+                for (const auto& [target, stored_label] : it->second)
+                {
+                    if (target == obj_p.target())
+                    {
+                        add_candidate(stored_label);
+                    }
+                }
+            }
+
+            for (std::size_t j = 0; j < obj_p.size(); ++j)
+            {
+                const auto it = tile_index.find(obj_p[j]);
+
+                if (it == tile_index.cend())
+                {
+                    continue;
+                }
+
+                for (const auto& [successor, stored_label] : it->second)
+                {
+                    // with crossings, the indexed segment has to be shared as well
+                    if (!ps.crossings || (j + 1 < obj_p.size() && successor == obj_p[j + 1]))
+                    {
+                        add_candidate(stored_label);
+                    }
+                }
+            }
+
+            std::sort(candidates.begin(), candidates.end());
+
+            for (const auto stored_label : candidates)
+            {
+                graph.insert_edge(label, stored_label, edge_id++);
+            }
+        }
     }
     /**
-     * Given a collection of paths belonging to the same objective, this function creates edges in the edge intersection
-     * graph between each corresponding node and all of the already existing nodes that represent paths that intersect
-     * with it, i.e., that share at least one coordinate.
+     * Adds a collection of paths belonging to the same objective to the inverted indices such that paths of subsequent
+     * objectives can find them.
      *
      * @param objective_paths Collection of paths belonging to the same objective.
+     * @param first_label Label of the first path in `objective_paths`.
      */
-    void create_intersection_edges(path_collection<clk_path>& objective_paths) noexcept
+    void index_paths(const path_collection<path>& objective_paths, const std::size_t first_label)
     {
-        std::for_each(objective_paths.cbegin(), objective_paths.cend(),
-                      [this](const auto& obj_p)
-                      {
-                          std::for_each(all_paths.cbegin(), all_paths.cend(),
-                                        [this, &obj_p](const auto& stored_p)
-                                        {
-                                            if (ps.crossings ? obj_p.has_overlap_with(stored_p) :
-                                                               obj_p.has_intersection_with(stored_p))
-                                            {
-                                                graph.insert_edge(obj_p.label, stored_p.label, edge_id++);
-                                            }
-                                        });
-                      });
+        for (std::size_t i = 0; i < objective_paths.size(); ++i)
+        {
+            const auto& p     = objective_paths[i];
+            const auto  label = first_label + i;
+
+            terminal_index[p.source()].emplace_back(p.target(), label);
+
+            if (ps.crossings)
+            {
+                // index each segment of size 2 by its first coordinate
+                for (std::size_t j = 0; j + 1 < p.size(); ++j)
+                {
+                    tile_index[p[j]].emplace_back(p[j + 1], label);
+                }
+            }
+            else
+            {
+                // index all inner coordinates; the successor is not needed
+                for (std::size_t j = 1; j + 1 < p.size(); ++j)
+                {
+                    tile_index[p[j]].emplace_back(p[j], label);
+                }
+            }
+        }
     }
 };
 
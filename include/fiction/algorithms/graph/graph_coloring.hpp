@@ -98,7 +98,13 @@ enum class graph_coloring_sat_search_tactic
      * passed, \f$k\f$ starts at the largest clique size \f$|C|\f$ instead with \f$k = 2^0 \cdot |C|, 2^1 \cdot
      * |C|, 2^2 \cdot |C|, \dots\f$
      */
-    BINARY_SEARCH
+    BINARY_SEARCH,
+    /**
+     * First determine an upper bound \f$u\f$ via DSATUR, then perform binary search in the window \f$[|C|, u]\f$,
+     * where \f$|C|\f$ is the largest clique size or 1 if no cliques are passed. If no coloring with less than \f$u\f$
+     * colors exists, the DSATUR coloring is returned as it is optimal.
+     */
+    UPPER_BOUND_BINARY_SEARCH
 };
 
 /**
@@ -126,6 +132,14 @@ struct determine_vertex_coloring_sat_params
      * Tries to establish the color frequency of color 0 such that it equals the largest clique size.
      */
     bool clique_size_color_frequency = false;
+    /**
+     * Keep a single SAT solver alive across all checked values of \f$k\f$ instead of encoding each of them from
+     * scratch. To this end, the instance is encoded once for an upper bound determined via DSATUR and the colors that
+     * exceed the currently checked \f$k\f$ are disabled via an activation literal that is passed as an assumption.
+     * Thereby, all clauses, including the ones that the solver learned, are reused between the checks. Since the upper
+     * bound is known, `BINARY_SEARCH` skips its exponential phase and behaves like `UPPER_BOUND_BINARY_SEARCH`.
+     */
+    bool incremental = false;
 };
 /**
  * Parameters for heuristic graph coloring.
@@ -199,23 +213,76 @@ class sat_coloring_handler
     struct solver_instance;
     using solver_instance_ptr = std::shared_ptr<solver_instance>;
     using result_instance     = std::pair<bill::result::states, solver_instance_ptr>;
-    using k_instance          = std::pair<std::size_t, solver_instance_ptr>;
+    /**
+     * A satisfiable number of colors together with the model that the solver found for it. The model is stored
+     * alongside because an incremental solver instance overwrites it on subsequent checks.
+     */
+    struct k_instance
+    {
+        std::size_t              k{0};
+        solver_instance_ptr      instance{};
+        bill::result::model_type model{};
+    };
 
   public:
-    explicit sat_coloring_handler(const Graph& g, const determine_vertex_coloring_sat_params<Graph>& p,
-                                  determine_vertex_coloring_stats<Color>& st) :
+    /**
+     * Standard constructor.
+     *
+     * @param g The graph to color.
+     * @param p Parameters.
+     * @param st Statistics.
+     * @param heuristic_coloring A coloring determined by a heuristic together with its number of colors that acts as
+     * an upper bound. Required for `UPPER_BOUND_BINARY_SEARCH` and incremental solving.
+     */
+    explicit sat_coloring_handler(
+        const Graph& g, const determine_vertex_coloring_sat_params<Graph>& p,
+        determine_vertex_coloring_stats<Color>& st,
+        std::optional<std::pair<std::size_t, vertex_coloring<Graph, Color>>> heuristic_coloring = std::nullopt) :
             graph{g},
             ps{p},
             pst{st},
             largest_clique{std::max_element(ps.cliques.cbegin(), ps.cliques.cend(),
                                             [](const auto& c1, const auto& c2) { return c1.size() < c2.size(); })},
-            q{largest_clique == ps.cliques.cend() ? 1 : (largest_clique->size() ? largest_clique->size() : 1)}
+            q{largest_clique == ps.cliques.cend() ? 1 : (largest_clique->size() ? largest_clique->size() : 1)},
+            upper_bound{std::move(heuristic_coloring)}
     {}
 
     result_instance check_k_coloring(const std::size_t k) const noexcept
     {
+        if (incremental_instance != nullptr)
+        {
+            return check_k_coloring_incrementally(k);
+        }
+
         const auto k_color_instance = std::make_shared<solver_instance>(graph, k);
 
+        encode(k_color_instance);
+
+        return {check_sat(k_color_instance), k_color_instance};
+    }
+    /**
+     * Checks for a coloring with \f$k\f$ colors on the incremental solver instance by disabling all colors that exceed
+     * \f$k\f$ via an assumption.
+     *
+     * @param k Number of colors to check for. Must not exceed the number of colors the instance was encoded with.
+     * @return Result of the check and the incremental solver instance.
+     */
+    result_instance check_k_coloring_incrementally(const std::size_t k) const noexcept
+    {
+        assert(k <= incremental_instance->k);
+
+        std::vector<bill::lit_type> assumptions{};
+
+        if (k < incremental_instance->k)
+        {
+            assumptions.emplace_back(incremental_instance->color_enabled[k], bill::negative_polarity);
+        }
+
+        return {incremental_instance->solver.solve(assumptions), incremental_instance};
+    }
+
+    void encode(const solver_instance_ptr& k_color_instance) const
+    {
         at_least_one_color_per_vertex(k_color_instance);
         at_most_one_color_per_vertex(k_color_instance);
         exclude_identical_adjacent_colors(k_color_instance);
@@ -231,8 +298,6 @@ class sat_coloring_handler
         {
             color_frequency_equal_to_largest_clique_size(k_color_instance);
         }
-
-        return {check_sat(k_color_instance), k_color_instance};
     }
 
     std::optional<k_instance> determine_min_coloring_with_linearly_ascending_search() const noexcept
@@ -241,7 +306,7 @@ class sat_coloring_handler
         {
             if (const auto [sat, instance] = check_k_coloring(k); sat == bill::result::states::satisfiable)
             {
-                return k_instance{k, instance};
+                return make_k_instance(k, instance);
             }
         }
 
@@ -250,7 +315,7 @@ class sat_coloring_handler
 
     std::optional<k_instance> determine_min_coloring_with_linearly_descending_search() const noexcept
     {
-        k_instance most_recent_sat_instance{};
+        std::optional<k_instance> most_recent_sat_instance{};
 
         for (std::size_t k = graph.size_vertices(); k >= q - 1; --k)
         {
@@ -261,7 +326,7 @@ class sat_coloring_handler
                 return most_recent_sat_instance;
             }
 
-            most_recent_sat_instance = {k, instance};
+            most_recent_sat_instance = make_k_instance(k, instance);
         }
 
         return std::nullopt;
@@ -278,7 +343,7 @@ class sat_coloring_handler
         {
             if (const auto [sat, instance] = check_k_coloring(h); sat == bill::result::states::satisfiable)
             {
-                most_recent_sat_instance = {h, instance};
+                most_recent_sat_instance = make_k_instance(h, instance);
 
                 // optimization to immediately return the found instance if h is equal to the clique size because the
                 // clique size represents a lower bound. Thus, no binary search needs to be conducted
@@ -303,7 +368,7 @@ class sat_coloring_handler
             {
                 if (const auto [sat, instance] = check_k_coloring(k1); sat == bill::result::states::satisfiable)
                 {
-                    most_recent_sat_instance = {k1, instance};
+                    most_recent_sat_instance = make_k_instance(k1, instance);
 
                     return false;
                 }
@@ -313,9 +378,141 @@ class sat_coloring_handler
 
         return most_recent_sat_instance;
     }
+    /**
+     * Determines the window of color numbers to search in. It starts at the largest clique size and ends below the
+     * upper bound because the heuristic coloring already is valid for it. If the color frequency constraint is enabled,
+     * the upper bound itself and one additional color have to be checked as well. The latter is sufficient if any
+     * coloring exists at all: color 0 is reserved for the vertices that satisfy the constraint while the remaining ones
+     * can be colored like in the heuristic coloring.
+     *
+     * @return Window of color numbers to search in where the upper end is exclusive.
+     */
+    [[nodiscard]] std::pair<std::size_t, std::size_t> upper_bound_window() const noexcept
+    {
+        assert(upper_bound.has_value());
+
+        return {q, ps.clique_size_color_frequency ? upper_bound->first + 2 : upper_bound->first};
+    }
+
+    std::optional<k_instance> determine_min_coloring_with_upper_bound_linearly_ascending_search() const noexcept
+    {
+        const auto [lower, upper] = upper_bound_window();
+
+        for (std::size_t k = lower; k < upper; ++k)
+        {
+            if (const auto [sat, instance] = check_k_coloring(k); sat == bill::result::states::satisfiable)
+            {
+                return make_k_instance(k, instance);
+            }
+        }
+
+        return std::nullopt;
+    }
+
+    std::optional<k_instance> determine_min_coloring_with_upper_bound_linearly_descending_search() const noexcept
+    {
+        const auto [lower, upper] = upper_bound_window();
+
+        std::optional<k_instance> most_recent_sat_instance{};
+
+        // the clique size is a lower bound; thus, it does not need to be undercut
+        for (std::size_t k = upper; k > lower; --k)
+        {
+            const auto [sat, instance] = check_k_coloring(k - 1);
+
+            if (sat == bill::result::states::unsatisfiable)
+            {
+                break;
+            }
+
+            most_recent_sat_instance = make_k_instance(k - 1, instance);
+        }
+
+        return most_recent_sat_instance;
+    }
+
+    std::optional<k_instance> determine_min_coloring_with_upper_bound_binary_search() const noexcept
+    {
+        auto [lower, upper] = upper_bound_window();
+
+        std::optional<k_instance> most_recent_sat_instance{};
+
+        // invariant: all k < lower are unsatisfiable and upper is either satisfiable or out of reach
+        while (lower < upper)
+        {
+            const auto k = lower + (upper - lower) / 2;
+
+            if (const auto [sat, instance] = check_k_coloring(k); sat == bill::result::states::satisfiable)
+            {
+                most_recent_sat_instance = make_k_instance(k, instance);
+                upper                    = k;
+            }
+            else
+            {
+                lower = k + 1;
+            }
+        }
+
+        return most_recent_sat_instance;
+    }
+
+    std::optional<vertex_coloring<Graph, Color>> color_within_upper_bound() noexcept
+    {
+        if (const auto [lower, upper] = upper_bound_window(); ps.incremental && lower < upper)
+        {
+            // encode the instance once for the largest number of colors that is to be checked
+            incremental_instance = std::make_shared<solver_instance>(graph, upper - 1);
+
+            encode(incremental_instance);
+            guard_colors_by_activation_literals(incremental_instance);
+        }
+
+        std::optional<k_instance> min_coloring = std::nullopt;
+
+        switch (ps.sat_search_tactic)
+        {
+            case graph_coloring_sat_search_tactic::LINEARLY_ASCENDING:
+            {
+                min_coloring = determine_min_coloring_with_upper_bound_linearly_ascending_search();
+                break;
+            }
+            case graph_coloring_sat_search_tactic::LINEARLY_DESCENDING:
+            {
+                min_coloring = determine_min_coloring_with_upper_bound_linearly_descending_search();
+                break;
+            }
+            case graph_coloring_sat_search_tactic::BINARY_SEARCH:
+            case graph_coloring_sat_search_tactic::UPPER_BOUND_BINARY_SEARCH:
+            {
+                min_coloring = determine_min_coloring_with_upper_bound_binary_search();
+                break;
+            }
+        }
+
+        if (min_coloring.has_value())
+        {
+            pst.chromatic_number = min_coloring->k;
+            return extract_vertex_coloring(min_coloring->instance, min_coloring->model);
+        }
+
+        // no coloring with fewer colors exists, i.e., the heuristic one is optimal; its color frequency has already
+        // been recorded by the caller
+        if (!ps.clique_size_color_frequency)
+        {
+            pst.chromatic_number = upper_bound->first;
+            return upper_bound->second;
+        }
+
+        return std::nullopt;
+    }
 
     std::optional<vertex_coloring<Graph, Color>> color() noexcept
     {
+        if (upper_bound.has_value())
+        {
+            return color_within_upper_bound();
+        }
+
         std::optional<k_instance> min_coloring = std::nullopt;
 
         switch (ps.sat_search_tactic)
@@ -335,14 +532,17 @@ class sat_coloring_handler
                 min_coloring = determine_min_coloring_with_binary_search();
                 break;
             }
+            case graph_coloring_sat_search_tactic::UPPER_BOUND_BINARY_SEARCH:
+            {
+                assert(false && "UPPER_BOUND_BINARY_SEARCH requires a heuristic coloring");
+                break;
+            }
         }
 
         if (min_coloring.has_value())
         {
-            const auto [k, instance] = *min_coloring;
-
-            pst.chromatic_number = k;
-            return extract_vertex_coloring(instance, get_model(instance));
+            pst.chromatic_number = min_coloring->k;
+            return extract_vertex_coloring(min_coloring->instance, min_coloring->model);
         }
 
         return std::nullopt;
@@ -369,6 +569,14 @@ class sat_coloring_handler
      * Largest clique size.
      */
     const std::size_t q;
+    /**
+     * Heuristic coloring and its number of colors that acts as an upper bound.
+     */
+    const std::optional<std::pair<std::size_t, vertex_coloring<Graph, Color>>> upper_bound;
+    /**
+     * Solver instance that is reused across all checks if incremental solving is enabled.
+     */
+    solver_instance_ptr incremental_instance{nullptr};
     /**
      * Alias for a vertex-color pair.
      */
@@ -410,7 +618,47 @@ class sat_coloring_handler
          * Stores all variables.
          */
         std::unordered_map<vertex_color, bill::var_type> variables{};
+        /**
+         * Activation literals of all colors if the instance is solved incrementally. Color c can only be assigned if
+         * `color_enabled[c]` holds.
+         */
+        std::vector<bill::var_type> color_enabled{};
     };
+    /**
+     * Guards each color by an activation literal such that all colors from \f$k\f$ onwards can be disabled by a single
+     * assumption. To this end, disabling a color also disables all subsequent ones.
+     *
+     * @param instance Pointer to the solver instance.
+     */
+    void guard_colors_by_activation_literals(const solver_instance_ptr& instance) const
+    {
+        instance->color_enabled.reserve(instance->k);
+
+        for (std::size_t c = 0; c < instance->k; ++c)
+        {
+            const auto enabled = instance->solver.add_variable();
+            instance->color_enabled.push_back(enabled);
+
+            // for each vertex
+            std::for_each(graph.begin_vertices(), graph.end_vertices(),
+                          [&instance, &c, &enabled](const auto& vp)
+                          {
+                              const auto& v = vp.first;
+                              // not vertex has color c OR color c is enabled
+                              instance->solver.add_clause(
+                                  {{bill::lit_type{instance->variables[{v, c}], bill::negative_polarity},
+                                    bill::lit_type{enabled, bill::positive_polarity}}});
+                          });
+
+            if (c > 0)
+            {
+                const auto previous_enabled = instance->color_enabled[c - 1];
+                // not color c is enabled OR color c - 1 is enabled
+                instance->solver.add_clause({{bill::lit_type{enabled, bill::negative_polarity},
+                                              bill::lit_type{previous_enabled, bill::positive_polarity}}});
+            }
+        }
+    }
 
     void at_least_one_color_per_vertex(const solver_instance_ptr& instance) const
     {
@@ -639,6 +887,26 @@ class sat_coloring_handler
     {
         return instance->solver.get_model().model();
     }
+    /**
+     * Stores the model of a satisfiable check for \f$k\f$ colors. On the incremental instance, all colors from
+     * \f$k\f$ onwards are permanently disabled afterward because all search tactics only check for fewer colors once
+     * a coloring has been found.
+     *
+     * @param k Number of colors that was found to be satisfiable.
+     * @param instance Pointer to the solver instance.
+     * @return The satisfiable number of colors together with the model.
+     */
+    k_instance make_k_instance(const std::size_t k, const solver_instance_ptr& instance) const
+    {
+        k_instance sat_instance{k, instance, get_model(instance)};
+
+        if (instance == incremental_instance && k < instance->k)
+        {
+            instance->solver.add_clause(bill::lit_type{instance->color_enabled[k], bill::negative_polarity});
+        }
+
+        return sat_instance;
+    }
 
     vertex_coloring<Graph, Color> extract_vertex_coloring(const solver_instance_ptr&      instance,
                                                           const bill::result::model_type& model) const noexcept
@@ -698,17 +966,29 @@ class graph_coloring_impl
 
         if (ps.engine == graph_coloring_engine::SAT)
         {
+            std::optional<std::pair<std::size_t, vertex_coloring<Graph, Color>>> heuristic_coloring = std::nullopt;
+
+            // determine an upper bound for the SAT engine
+            if (ps.sat_params.incremental ||
+                ps.sat_params.sat_search_tactic == graph_coloring_sat_search_tactic::UPPER_BOUND_BINARY_SEARCH)
+            {
+                auto dsatur_coloring = run_brian_crites_engine(graph_coloring_engine::DSATUR);
+                heuristic_coloring   = {pst.chromatic_number, std::move(dsatur_coloring)};
+            }
+
             switch (ps.sat_params.sat_engine)
             {
                 case bill::solvers::ghack:
                 {
-                    coloring =
-                        sat_coloring_handler<Graph, Color, bill::solvers::ghack>{graph, ps.sat_params, pst}.color();
+                    coloring = sat_coloring_handler<Graph, Color, bill::solvers::ghack>{graph, ps.sat_params, pst,
+                                                                                    heuristic_coloring}
+                                   .color();
                     break;
                 }
                 case bill::solvers::glucose_41:
                 {
-                    coloring = sat_coloring_handler<Graph, Color, bill::solvers::glucose_41>{graph, ps.sat_params, pst}
+                    coloring = sat_coloring_handler<Graph, Color, bill::solvers::glucose_41>{graph, ps.sat_params,
+                                                                                         pst, heuristic_coloring}
                                    .color();
                     break;
                 }
@@ -718,27 +998,31 @@ class graph_coloring_impl
                                     "properly. It is, therefore, not recommended using it. If in the future an update "
                                     "to bill and/or bsat2 has been published, feel free to remove this assertion.");
 
-                    coloring =
-                        sat_coloring_handler<Graph, Color, bill::solvers::bsat2>{graph, ps.sat_params, pst}.color();
+                    coloring = sat_coloring_handler<Graph, Color, bill::solvers::bsat2>{graph, ps.sat_params, pst,
+                                                                                    heuristic_coloring}
+                                   .color();
                     break;
                 }
 #if !defined(BILL_WINDOWS_PLATFORM)
                 case bill::solvers::maple:
                 {
-                    coloring =
-                        sat_coloring_handler<Graph, Color, bill::solvers::maple>{graph, ps.sat_params, pst}.color();
+                    coloring = sat_coloring_handler<Graph, Color, bill::solvers::maple>{graph, ps.sat_params, pst,
+                                                                                    heuristic_coloring}
+                                   .color();
                     break;
                 }
                 case bill::solvers::bmcg:
                 {
-                    coloring =
-                        sat_coloring_handler<Graph, Color, bill::solvers::bmcg>{graph, ps.sat_params, pst}.color();
+                    coloring = sat_coloring_handler<Graph, Color, bill::solvers::bmcg>{graph, ps.sat_params, pst,
+                                                                                    heuristic_coloring}
+                                   .color();
                     break;
                 }
 #endif
                 default:
                 {
-                    coloring = sat_coloring_handler<Graph, Color>{graph, ps.sat_params, pst}.color();
+                    coloring =
+                        sat_coloring_handler<Graph, Color>{graph, ps.sat_params, pst, heuristic_coloring}.color();
                     break;
                 }
             }
@@ -752,7 +1036,7 @@ class graph_coloring_impl
 
         if (is_brian_crites_engine(ps.engine))
         {
-            coloring = run_brian_crites_engine();
+            coloring = run_brian_crites_engine(ps.engine);
         }
 
         assert(coloring.has_value() && "No coloring could be determined.");
@@ -905,14 +1189,15 @@ class graph_coloring_impl
         return v_coloring;
     }
 
-    [[nodiscard]] vertex_coloring<Graph, Color> run_brian_crites_engine() const noexcept
+    [[nodiscard]] vertex_coloring<Graph, Color>
+    run_brian_crites_engine(const graph_coloring_engine engine) const noexcept
     {
         const auto translated_graph = translate_to_brian_crites_graph(graph);
 
         std::unique_ptr<GraphColoring::GraphColor> coloring_engine_ptr;
 
         // select engine
-        switch (ps.engine)
+        switch (engine)
         {
             case graph_coloring_engine::MCS:
             {
@@ -7,6 +7,7 @@
 
 #include "fiction/algorithms/path_finding/cost.hpp"
 #include "fiction/algorithms/path_finding/distance.hpp"
+#include "fiction/layouts/coordinates.hpp"
 #include "fiction/traits.hpp"
 #include "fiction/utils/routing_utils.hpp"
 #include "fiction/utils/stl_utils.hpp"
@@ -15,6 +16,7 @@
 
 #include <algorithm>
 #include <cassert>
+#include <cstddef>
 #include <cstdint>
 #include <iterator>
 #include <limits>
@@ -35,22 +37,238 @@ struct a_star_params
     bool crossings = false;
 };
 
+/**
+ * A reusable search context for A* and related path finding algorithms (see `jump_point_search`,
+ * `enumerate_all_paths`, and `yen_k_shortest_paths`). It stores the open list and a search record (g-value, origin,
+ * and closed flag) for each coordinate. Searches that are invoked with a context reuse its buffers instead of
+ * allocating new ones, which pays off when many searches are performed on the same layout, e.g., during
+ * post-layout optimization.
+ *
+ * Resetting a context for the next search does not touch the stored records. Instead, a generation counter is
+ * incremented, which invalidates all records at once. Each record is lazily re-initialized upon its first access in
+ * the new generation. Thereby, the reset costs are proportional to the number of coordinates that remained in the
+ * open list, not to the size of the layout.
+ *
+ * Layouts with `offset::ucoord_t` coordinates are bounded by their aspect ratio. Hence, their coordinates are mapped
+ * to record indices arithmetically by default. This requires records for the entire layout area, which only pays off if
+ * the context is reused. All other coordinate types, or contexts for which `DenseIndex` is `false`, assign indices on
+ * the fly via a hash map that is kept alive between searches as well. Their memory consumption is proportional to the
+ * number of explored coordinates.
+ *
+ * A context must not be used by multiple searches concurrently.
+ *
+ * @tparam Lyt Coordinate layout type. The context can be used with any layout of the same coordinate type, e.g., with
+ * both `Lyt` and `obstruction_layout<Lyt>`.
+ * @tparam Value Type of the stored g- and f-values.
+ * @tparam DenseIndex Flag to map coordinates to record indices arithmetically. Requires `offset::ucoord_t` coordinates.
+ */
+template <typename Lyt, typename Value = uint64_t,
+          bool DenseIndex = std::is_same_v<coordinate<Lyt>, offset::ucoord_t>>
+class a_star_context
+{
+    static_assert(!DenseIndex || std::is_same_v<coordinate<Lyt>, offset::ucoord_t>,
+                  "A dense coordinate index requires offset::ucoord_t coordinates");
+
+  public:
+    /**
+     * Each coordinate that is encountered during a search is identified by an integral handle.
+     */
+    using handle = std::size_t;
+    /**
+     * Search information that is stored for each coordinate.
+     */
+    struct coordinate_record
+    {
+        /**
+         * The g-cost, i.e., the length of the shortest path from the source to this coordinate found so far.
+         */
+        Value g{0};
+        /**
+         * Handle of the coordinate's origin to recreate the path.
+         */
+        handle came_from{0};
+        /**
+         * Flag that indicates whether the coordinate has been visited already.
+         */
+        bool closed{false};
+        /**
+         * The search generation in which this record was last initialized.
+         */
+        uint32_t generation{0};
+    };
+    /**
+     * Prepares the context for a new search on the given layout. All records from previous searches are invalidated and
+     * the open list is cleared.
+     *
+     * @tparam SearchLyt Type of the layout that is about to be searched.
+     * @param layout The layout that is about to be searched.
+     */
+    template <typename SearchLyt>
+    void reset(const SearchLyt& layout)
+    {
+        static_assert(std::is_same_v<coordinate<SearchLyt>, coordinate<Lyt>>,
+                      "SearchLyt and Lyt must use the same coordinate type");
+
+        open.clear();
+
+        // on overflow, invalidate all records explicitly once
+        if (++generation == 0)
+        {
+            for (auto& r : records)
+            {
+                r.generation = 0;
+            }
+
+            generation = 1;
+        }
+
+        if constexpr (has_dense_coordinate_index)
+        {
+            width  = static_cast<handle>(layout.x() + 1);
+            height = static_cast<handle>(layout.y() + 1);
+
+            const auto num_coordinates = width * height * static_cast<handle>(layout.z() + 1);
+
+            if (num_coordinates > records.size())
+            {
+                records.resize(num_coordinates);
+            }
+
+            open.reserve(num_coordinates);
+        }
+    }
+    /**
+     * Returns the handle of the given coordinate. If no dense coordinate index is available and `c` has not been
+     * encountered before, a new handle and record are created.
+     *
+     * @param c Coordinate whose handle is desired.
+     * @return Handle of `c`.
+     */
+    [[nodiscard]] handle to_handle(const coordinate<Lyt>& c)
+    {
+        if constexpr (has_dense_coordinate_index)
+        {
+            assert(static_cast<handle>(c.x) < width && static_cast<handle>(c.y) < height &&
+                   "Coordinate is out of bounds");
+
+            return (static_cast<handle>(c.z) * height + c.y) * width + c.x;
+        }
+        else
+        {
+            const auto [it, inserted] = handles.try_emplace(c, coordinates.size());
+
+            if (inserted)
+            {
+                coordinates.push_back(c);
+                records.emplace_back();
+            }
+
+            return it->second;
+        }
+    }
+    /**
+     * Returns the coordinate that is identified by the given handle.
+     *
+     * @param h Handle whose coordinate is desired.
+     * @return Coordinate of `h`.
+     */
+    [[nodiscard]] coordinate<Lyt> to_coordinate(const handle h) const noexcept
+    {
+        if constexpr (has_dense_coordinate_index)
+        {
+            return {h % width, (h / width) % height, h / (width * height)};
+        }
+        else
+        {
+            return coordinates[h];
+        }
+    }
+    /**
+     * Returns the record of the given handle in the current search generation. Records that were written in a previous
+     * generation are re-initialized first.
+     *
+     * @param h Handle whose record is desired.
+     * @return Reference to the record of `h`. It is invalidated by subsequent calls to `to_handle`.
+     */
+    [[nodiscard]] coordinate_record& record(const handle h) noexcept
+    {
+        auto& r = records[h];
+
+        if (r.generation != generation)
+        {
+            r            = coordinate_record{};
+            r.generation = generation;
+        }
+
+        return r;
+    }
+    /**
+     * Returns the open list, i.e., the frontier of coordinate handles sorted by their f-values.
+     *
+     * @return Reference to the open list.
+     */
+    [[nodiscard]] indexed_d_ary_heap<Value>& open_list() noexcept
+    {
+        return open;
+    }
+
+  private:
+    /**
+     * Whether coordinates can be mapped to handles arithmetically.
+     */
+    static constexpr bool has_dense_coordinate_index = DenseIndex;
+    /**
+     * Open list that contains all coordinate handles to process next sorted by their f-value.
+     */
+    indexed_d_ary_heap<Value> open{};
+    /**
+     * Search records indexed by coordinate handles.
+     */
+    std::vector<coordinate_record> records{};
+    /**
+     * The current search generation. Records of other generations are considered uninitialized.
+     */
+    uint32_t generation{0};
+    /**
+     * Dimensions of the layout that is searched if a dense coordinate index is available.
+     */
+    handle width{0}, height{0};
+    /**
+     * Maps coordinates to their handles if no dense coordinate index is available.
+     */
+    phmap::flat_hash_map<coordinate<Lyt>, handle> handles{};
+    /**
+     * Maps handles back to their coordinates if no dense coordinate index is available.
+     */
+    std::vector<coordinate<Lyt>> coordinates{};
+};
+
 namespace detail
 {
 
-template <typename Path, typename Lyt, typename Dist, typename Cost>
+template <typename Path, typename Lyt, typename Dist, typename Cost, typename CtxLyt, bool DenseIndex>
 class a_star_impl
 {
   public:
+    /**
+     * The values used for g and f have a type in accordance with Dist and Cost.
+     */
+    using g_f_type = std::common_type_t<Dist, Cost>;
+
     a_star_impl(const Lyt& lyt, const routing_objective<Lyt>& obj, const distance_functor<Lyt, Dist>& dist_fn,
-                const cost_functor<Lyt, Cost>& cost_fn, const a_star_params& p) :
+                const cost_functor<Lyt, Cost>& cost_fn, const a_star_params& p,
+                a_star_context<CtxLyt, g_f_type, DenseIndex>& ctx) :
             layout{lyt},
             objective{obj},
             distance{dist_fn},
             cost{cost_fn},
-            params{p}
+            params{p},
+            context{ctx}
     {
-        open_list.push(coordinate_f{objective.source, 0});
+        context.reset(layout);
+
+        source_handle = context.to_handle(objective.source);
+        context.open_list().push(source_handle, 0);
     }
 
     /**
@@ -66,20 +284,23 @@ class a_star_impl
         assert(layout.is_within_bounds(objective.source) && layout.is_within_bounds(objective.target) &&
                "Both source and target coordinate have to be within the layout bounds");
 
+        auto& open_list = context.open_list();
+
         do {
             // get coordinate with lowest f-value
-            const auto current = get_lowest_f_coord();
+            const auto current       = open_list.pop();
+            const auto current_coord = context.to_coordinate(current);
 
             // if coord is the target, a path has been found
-            if (current == objective.target)
+            if (current_coord == objective.target)
             {
-                return reconstruct_path();
+                return reconstruct_path(current);
             }
             // don't examine the current coordinate again
-            closed_list.insert(current);
+            context.record(current).closed = true;
 
             // expand from current coordinate
-            expand(current);
+            expand(current_coord, current);
 
         } while (!open_list.empty());  // until the open list is empty
 
@@ -107,90 +328,23 @@ class a_star_impl
      * Routing parameters.
      */
     const a_star_params params;
-
-    /**
-     * The values used for g and f have a type in accordance with Dist and Cost.
-     */
-    using g_f_type = std::common_type_t<Dist, Cost>;
-    /**
-     * Stores a coordinate and its f-value.
-     */
-    struct coordinate_f
-    {
-        /**
-         * Coordinate.
-         */
-        coordinate<Lyt> coord;  // cannot be const because operator= is required by std::priority_queue
-        /**
-         * f-value of the coordinate.
-         */
-        g_f_type f;
-
-        /**
-         * Comparator for the priority queue. Compares only the f-values.
-         *
-         * @param other Other coordinate_f to compare with.
-         * @return `true` iff this f-value is greater than the other's.
-         */
-        bool operator>(const coordinate_f& other) const
-        {
-            return this->f > other.f;
-        }
-        /**
-         * Equality operator that only compares the stored coordinates. This allows for a convenient lookup in the
-         * priority queue.
-         *
-         * @param other Other coordinate_f to compare with.
-         * @return `true` iff this coord value is equal to the other's.
-         */
-        bool operator==(const coordinate_f& other) const
-        {
-            return this->coord == other.coord;
-        }
-    };
-
-    /**
-     * Priority queue for coordinates sorted by their f-values. Uses std::greater to get the smallest f-value on top...
-     * C++ is weird at times...
-     */
-    using a_star_priority_queue =
-        searchable_priority_queue<coordinate_f, std::vector<coordinate_f>, std::greater<coordinate_f>>;
-    /**
-     * Open list that contains all coordinates to process next sorted by their f-value.
-     */
-    a_star_priority_queue open_list{};
-    /**
-     * Closed list that acts as a set of already visited coordinates.
-     */
-    phmap::flat_hash_set<coordinate<Lyt>> closed_list{};
-    /**
-     * Stores the g-cost for each coordinate c, i.e., the length of the shortest path from source to c found so far.
-     */
-    phmap::parallel_flat_hash_map<coordinate<Lyt>, g_f_type> g_values{};
     /**
-     * Tracks the origin of each coordinate to recreate the path.
+     * Search context that holds the open list and the per-coordinate search records.
      */
-    phmap::parallel_flat_hash_map<coordinate<Lyt>, coordinate<Lyt>> came_from{};
+    a_star_context<CtxLyt, g_f_type, DenseIndex>& context;
     /**
-     * Fetches and pops the coordinate with the lowest f-value from the open list priority queue.
-     *
-     * @return Coordinate with the lowest f-value from the open list.
+     * Handle of `objective.source`.
      */
-    coordinate<Lyt> get_lowest_f_coord() noexcept
-    {
-        const auto current = open_list.top().coord;
-        open_list.pop();
-
-        return current;
-    }
+    typename a_star_context<CtxLyt, g_f_type, DenseIndex>::handle source_handle{0};
     /**
      * Expands the frontier of coordinates to visit next in the direction of the heuristic cost function.
      *
      * @param current Coordinate that is currently examined.
+     * @param current_handle Handle of `current`.
      */
-    void expand(const coordinate<Lyt>& current) noexcept
+    void expand(const coordinate<Lyt>& current, const std::size_t current_handle) noexcept
     {
-        const auto explore_successor = [this, current](auto successor)  // make a copy
+        const auto explore_successor = [this, current, current_handle](auto successor)  // make a copy
             noexcept
         {
             // return to ground layer to avoid getting stuck in crossing layer
@@ -234,38 +388,42 @@ class a_star_impl
                 }
             }
 
-            if (is_visited(successor))
+            const auto successor_handle = context.to_handle(successor);
+            auto&      successor_record = context.record(successor_handle);
+
+            if (successor_record.closed)
             {
                 return;  // skip any coordinate that is already in the closed list
             }
 
             // compute the g-value of cz. In this implementation, the costs of each 'step' are given by a function
-            const g_f_type tentative_g = g(current) + cost(current, successor);
+            const g_f_type tentative_g = context.record(current_handle).g + cost(current, successor);
 
-            // f-value does not matter because the comparator compares only the coordinates
-            const auto it = open_list.find({successor, 0});
-            if (it != open_list.end() && no_improvement(successor, tentative_g))
+            auto& open_list = context.open_list();
+
+            const auto is_open = open_list.contains(successor_handle);
+            if (is_open && tentative_g >= successor_record.g)
             {
                 return;  // skip the coordinate if it does not offer improvement
             }
 
             // track origin
-            came_from[successor] = current;
-            set_g(successor, tentative_g);
+            successor_record.came_from = current_handle;
+            successor_record.g         = tentative_g;
 
             // compute new f-value
             const auto f = tentative_g + static_cast<g_f_type>(distance(layout, successor, objective.target));
 
             // if successor is contained in the open list (frontier)
-            if (it != open_list.end())
+            if (is_open)
             {
                 // update its f-value
-                it->f = f;
+                open_list.decrease_key(successor_handle, f);
             }
             else
             {
                 // add successor to the open list
-                open_list.push({successor, f});
+                open_list.push(successor_handle, f);
             }
         };
 
@@ -281,65 +439,19 @@ class a_star_impl
         }
     }
     /**
-     * Checks if a coordinate has been visited already.
-     *
-     * @param c Coordinate to check.
-     * @return `true` iff c has already been visited.
-     */
-    bool is_visited(const coordinate<Lyt>& c) const noexcept
-    {
-        return closed_list.count(c) > 0;
-    }
-    /**
-     * Returns the g-value of a coordinate by accessing the g_values map. Returns 0 if no entry exists.
-     *
-     * @param c Coordinate whose g-value is desired.
-     * @return g-value of coordinate c or 0 if no value has been stored.
-     */
-    g_f_type g(const coordinate<Lyt>& c) const noexcept
-    {
-        if (const auto it = g_values.find(c); it != g_values.cend())
-        {
-            return it->second;
-        }
-
-        return 0ul;
-    }
-    /**
-     * Updates the g-value of the given coordinate to the given value.
-     *
-     * @param c Coordinate whose g-value is to be updated to g_val.
-     * @param g_val New g-value for c.
-     */
-    void set_g(const coordinate<Lyt>& c, const g_f_type g_val) noexcept
-    {
-        g_values.insert_or_assign(c, g_val);
-    }
-    /**
-     * Checks if the given g-value is greater or equal than the stored g-value of the given coordinate. If that is the
-     * case, the new g-value does not improve the path.
-     *
-     * @param c Coordinate to whose g-value is to be checked.
-     * @param g_val g-value to compare to c's.
-     * @return `true` iff the given g-value does not mean an improvement for the given coordinate.
-     */
-    bool no_improvement(const coordinate<Lyt>& c, const g_f_type g_val) noexcept
-    {
-        return g_val >= g(c);
-    }
-    /**
-     * Reconstruct the final path from the origin map that was created during the path finding algorithm.
+     * Reconstruct the final path from the origin records that were created during the path finding algorithm.
      *
+     * @param target_handle Handle of the target coordinate.
      * @return The shortest path connecting source and target.
      */
-    Path reconstruct_path() const noexcept
+    Path reconstruct_path(const std::size_t target_handle) noexcept
     {
         Path path{};
 
         // iterate backwards over the found connections and add them to the path
-        for (auto current = objective.target; current != objective.source; current = came_from.at(current))
+        for (auto current = target_handle; current != source_handle; current = context.record(current).came_from)
         {
-            path.push_back(current);
+            path.push_back(context.to_coordinate(current));
         }
         // finally, add the source coordinate
         path.push_back(objective.source);
@@ -402,7 +514,45 @@ template <typename Path, typename Lyt, typename Dist = uint64_t, typename Cost =
 {
     static_assert(is_coordinate_layout_v<Lyt>, "Lyt is not a coordinate layout");
 
-    return detail::a_star_impl<Path, Lyt, Dist, Cost>{layout, objective, dist_fn, cost_fn, params}.run();
+    // a dense coordinate index would require records for the entire layout area in every call; hence, records are only
+    // created for the explored coordinates. Pass a context to reuse its buffers across many searches instead
+    a_star_context<Lyt, std::common_type_t<Dist, Cost>, false> context{};
+
+    return detail::a_star_impl<Path, Lyt, Dist, Cost, Lyt, false>{layout, objective, dist_fn, cost_fn, params, context}
+        .run();
+}
+/**
+ * An overload of the A* path finding algorithm that reuses the buffers of the given search context instead of
+ * allocating new ones. This is beneficial if many paths are to be determined in succession, e.g., during iterative
+ * layout optimization. See `a_star_context` for more information.
+ *
+ * @tparam Path Type of the returned path.
+ * @tparam Lyt Type of the layout to perform path finding on.
+ * @tparam CtxLyt Layout type of the search context. Must use the same coordinate type as `Lyt`.
+ * @tparam Dist Distance value type to be used in the heuristic estimation function.
+ * @tparam Cost Cost value type to be used when determining moving cost between coordinates.
+ * @tparam DenseIndex Flag that indicates whether the search context maps coordinates to records arithmetically.
+ * @param layout The layout in which the shortest path between a source and target coordinate is to be found.
+ * @param objective Source-target coordinate pair.
+ * @param context Search context whose buffers are reused. It is reset before the search starts.
+ * @param dist_fn A distance functor that implements the desired heuristic estimation function.
+ * @param cost_fn A cost functor that implements the desired cost function.
+ * @param params Parameters.
+ * @return The shortest loop-less path in `layout` from `objective.source` to `objective.target`.
+ */
+template <typename Path, typename Lyt, typename CtxLyt, typename Dist = uint64_t, typename Cost = uint8_t,
+          bool DenseIndex>
+[[nodiscard]] Path a_star(const Lyt& layout, const routing_objective<Lyt>& objective,
+                          a_star_context<CtxLyt, std::common_type_t<Dist, Cost>, DenseIndex>& context,
+                          const distance_functor<Lyt, Dist>& dist_fn = manhattan_distance_functor<Lyt, uint64_t>(),
+                          const cost_functor<Lyt, Cost>&     cost_fn = unit_cost_functor<Lyt, uint8_t>(),
+                          const a_star_params&               params  = {}) noexcept
+{
+    static_assert(is_coordinate_layout_v<Lyt>, "Lyt is not a coordinate layout");
+
+    using impl = detail::a_star_impl<Path, Lyt, Dist, Cost, CtxLyt, DenseIndex>;
+
+    return impl{layout, objective, dist_fn, cost_fn, params, context}.run();
 }
 /**
  * A distance function that does not approximate but compute the actual minimum path length on the given layout via A*
@@ -6,12 +6,20 @@
 #define FICTION_DISTANCE_MAP_HPP
 
 #include "fiction/algorithms/path_finding/distance.hpp"
+#include "fiction/layouts/coordinates.hpp"
 #include "fiction/traits.hpp"
 
 #include <phmap.h>
 
+#include <algorithm>
+#include <cstddef>
 #include <cstdint>
 #include <functional>
+#include <limits>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
@@ -228,12 +236,10 @@ class smart_distance_cache_functor : public distance_functor<Lyt, Dist>
      * @param dist_fn Distance function.
      */
     explicit smart_distance_cache_functor(
-        const Lyt&                                                                             lyt,
+        [[maybe_unused]] const Lyt&                                                            lyt,
         const std::function<Dist(const Lyt&, const coordinate<Lyt>&, const coordinate<Lyt>&)>& dist_fn) :
             distance_functor<Lyt, Dist>(dist_fn)
-    {
-        distance_cache.reserve(lyt.area() * lyt.area());
-    }
+    {}
     /**
      * Override the call operator to first query the cache instead of the distance function. Only on a cache miss,
      * the distance function will be called and the result will be stored in the cache.
@@ -267,6 +273,501 @@ class smart_distance_cache_functor : public distance_functor<Lyt, Dist>
     mutable sparse_distance_map<Lyt, Dist> distance_cache{};
 };
 
+namespace detail
+{
+/**
+ * Value that marks unreachable coordinates in compact distance arrays.
+ */
+inline constexpr uint32_t unreachable_distance = std::numeric_limits<uint32_t>::max();
+/**
+ * Converts a compact distance to the given distance type. Unreachable coordinates are represented by
+ * `std::numeric_limits<Dist>::infinity()` if that value is supported by `Dist`, or by
+ * `std::numeric_limits<uint32_t>::max()`, otherwise (cf. `twoddwave_distance`).
+ *
+ * @tparam Dist Distance type.
+ * @param d Compact distance.
+ * @return `d` as `Dist`.
+ */
+template <typename Dist>
+[[nodiscard]] constexpr Dist to_distance(const uint32_t d) noexcept
+{
+    if constexpr (std::numeric_limits<Dist>::has_infinity)
+    {
+        if (d == unreachable_distance)
+        {
+            return std::numeric_limits<Dist>::infinity();
+        }
+    }
+
+    return static_cast<Dist>(d);
+}
+/**
+ * Computes the index of a coordinate's projection onto the ground layer of a layout with the given width.
+ *
+ * @tparam Lyt Coordinate layout type.
+ * @param width Layout width.
+ * @param c Coordinate.
+ * @return Coordinate index.
+ */
+template <typename Lyt>
+[[nodiscard]] constexpr std::size_t ground_coordinate_index(const uint64_t width, const coordinate<Lyt>& c) noexcept
+{
+    return static_cast<std::size_t>(c.y) * width + static_cast<std::size_t>(c.x);
+}
+/**
+ * Computes the hop distances between a root coordinate and all coordinates on the ground layer of the given layout via
+ * breadth-first search. In clocked layouts, only information flow along the clocking scheme is considered, i.e., the
+ * search follows outgoing clock zones if `forward` is `true` and incoming ones, otherwise. In unclocked layouts, all
+ * adjacent coordinates are considered. Obstructions and crossings are ignored. Hence, the computed distances are lower
+ * bounds for the lengths of all routes that are possible in any obstructed version of the layout.
+ *
+ * @tparam Lyt Coordinate layout type.
+ * @param lyt Layout.
+ * @param root Root coordinate.
+ * @param forward If `true`, distances from `root` are computed; otherwise, distances to `root` are computed.
+ * @return Distances indexed by `ground_coordinate_index`. Unreachable coordinates are marked as
+ * `unreachable_distance`.
+ */
+template <typename Lyt>
+[[nodiscard]] std::vector<uint32_t> ground_layer_hop_distances(const Lyt& lyt, const coordinate<Lyt>& root,
+                                                               const bool forward) noexcept
+{
+    const auto width  = static_cast<uint64_t>(lyt.x()) + 1;
+    const auto height = static_cast<uint64_t>(lyt.y()) + 1;
+
+    std::vector<uint32_t> distances(width * height, unreachable_distance);
+
+    std::vector<coordinate<Lyt>> queue{};
+    queue.reserve(width * height);
+
+    const coordinate<Lyt> ground_root{root.x, root.y};
+
+    distances[ground_coordinate_index<Lyt>(width, ground_root)] = 0;
+    queue.push_back(ground_root);
+
+    for (std::size_t head = 0; head < queue.size(); ++head)
+    {
+        const auto current          = queue[head];
+        const auto current_distance = distances[ground_coordinate_index<Lyt>(width, current)];
+
+        const auto visit = [&](const auto& next)
+        {
+            if (static_cast<uint64_t>(next.z) != 0)
+            {
+                return;
+            }
+
+            if (auto& d = distances[ground_coordinate_index<Lyt>(width, next)]; d == unreachable_distance)
+            {
+                d = current_distance + 1;
+                queue.push_back(next);
+            }
+        };
+
+        if constexpr (is_clocked_layout_v<Lyt>)
+        {
+            if (forward)
+            {
+                lyt.foreach_outgoing_clocked_zone(current, visit);
+            }
+            else
+            {
+                lyt.foreach_incoming_clocked_zone(current, visit);
+            }
+        }
+        else
+        {
+            lyt.foreach_adjacent_coordinate(current, visit);
+        }
+    }
+
+    return distances;
+}
+
+}  // namespace detail
+
+/**
+ * Parameters for the `distance_oracle`.
+ */
+struct distance_oracle_params
+{
+    /**
+     * Maximum number of targets whose distance arrays are kept in memory. If this number is exceeded, the least
+     * recently used array is evicted.
+     */
+    std::size_t max_cached_targets = 256ul;
+};
+/**
+ * A lazily evaluated distance oracle for clocked layouts. In contrast to a `distance_map`, which requires
+ * \f$\mathcal{O}(|L|^2)\f$ memory, the oracle only determines the distances to a target when the target is first
+ * queried. To this end, it runs a single breadth-first search against the direction of information flow and stores the
+ * distances from all coordinates to the target in a compact array of \f$|L|\f$ entries. At most
+ * `distance_oracle_params::max_cached_targets` such arrays are kept in a least-recently-used cache.
+ *
+ * The distances follow the clocking scheme but ignore obstructions and crossings (see
+ * `detail::ground_layer_hop_distances`). They are thus exact on unobstructed layouts and admissible as well as
+ * consistent A* heuristics on obstructed ones.
+ *
+ * All member functions are thread-safe, so a single oracle can be shared between concurrent path searches. Since
+ * layout copies share their storage, the oracle cannot observe changes to the layout directly. It discards all cached
+ * arrays whenever it is queried with different layout dimensions, but must not be used across different clocking
+ * schemes.
+ *
+ * @tparam Lyt Coordinate layout type with `offset::ucoord_t` coordinates.
+ * @tparam Dist Distance type.
+ */
+template <typename Lyt, typename Dist = uint64_t>
+class distance_oracle
+{
+  public:
+    /**
+     * Standard constructor.
+     *
+     * @param p Parameters.
+     */
+    explicit distance_oracle(const distance_oracle_params& p = {}) : ps{p}
+    {
+        static_assert(is_coordinate_layout_v<Lyt>, "Lyt is not a coordinate layout");
+        static_assert(std::is_same_v<coordinate<Lyt>, offset::ucoord_t>, "Lyt must use offset::ucoord_t coordinates");
+    }
+    /**
+     * Returns the distance from `source` to `target` in `lyt`. If the distances to `target` are not cached, they are
+     * computed first, possibly evicting the least recently used target.
+     *
+     * If `target` is not reachable from `source`, `std::numeric_limits<Dist>::infinity()` is returned if that value is
+     * supported by `Dist`, or `std::numeric_limits<uint32_t>::max()`, otherwise.
+     *
+     * @param lyt Layout.
+     * @param source Source coordinate.
+     * @param target Target coordinate.
+     * @return Distance from `source` to `target`.
+     */
+    [[nodiscard]] Dist distance(const Lyt& lyt, const coordinate<Lyt>& source, const coordinate<Lyt>& target)
+    {
+        const auto distances = distances_to(lyt, target);
+
+        return detail::to_distance<Dist>(
+            (*distances)[detail::ground_coordinate_index<Lyt>(static_cast<uint64_t>(lyt.x()) + 1, source)]);
+    }
+    /**
+     * Returns the number of targets whose distance arrays are currently cached.
+     *
+     * @return Number of cached targets.
+     */
+    [[nodiscard]] std::size_t num_cached_targets() const
+    {
+        const std::lock_guard<std::mutex> lock{mutex};
+
+        return cache.size();
+    }
+    /**
+     * Discards all cached distance arrays.
+     */
+    void clear()
+    {
+        const std::lock_guard<std::mutex> lock{mutex};
+
+        cache.clear();
+        recently_used.clear();
+    }
+
+  private:
+    /**
+     * Distances from all coordinates to a target, indexed by `detail::ground_coordinate_index`.
+     */
+    using target_distances = std::vector<uint32_t>;
+    /**
+     * Parameters.
+     */
+    const distance_oracle_params ps;
+    /**
+     * Mutex that guards the cache.
+     */
+    mutable std::mutex mutex{};
+    /**
+     * Layout dimensions that the cached arrays belong to.
+     */
+    uint64_t cached_width{0}, cached_height{0};
+    /**
+     * Indices of all cached targets, most recently used first.
+     */
+    std::list<std::size_t> recently_used{};
+    /**
+     * Maps the indices of cached targets to their distance arrays and their positions in `recently_used`.
+     */
+    phmap::flat_hash_map<std::size_t,
+                         std::pair<std::shared_ptr<const target_distances>, std::list<std::size_t>::iterator>>
+        cache{};
+    /**
+     * Returns the distance array of the given target, computing it on a cache miss. The array is handed out as a
+     * shared pointer so that it stays valid even if it is evicted concurrently.
+     *
+     * @param lyt Layout.
+     * @param target Target coordinate.
+     * @return Distances from all coordinates to `target`.
+     */
+    [[nodiscard]] std::shared_ptr<const target_distances> distances_to(const Lyt& lyt, const coordinate<Lyt>& target)
+    {
+        const auto width  = static_cast<uint64_t>(lyt.x()) + 1;
+        const auto height = static_cast<uint64_t>(lyt.y()) + 1;
+        const auto index  = detail::ground_coordinate_index<Lyt>(width, target);
+
+        {
+            const std::lock_guard<std::mutex> lock{mutex};
+
+            if (width != cached_width || height != cached_height)
+            {
+                cache.clear();
+                recently_used.clear();
+
+                cached_width  = width;
+                cached_height = height;
+            }
+            else if (const auto it = cache.find(index); it != cache.cend())
+            {
+                recently_used.splice(recently_used.begin(), recently_used, it->second.second);
+
+                return it->second.first;
+            }
+        }
+
+        // compute the distances without holding the lock so that other targets can be queried in the meantime
+        auto distances = std::make_shared<const target_distances>(
+            detail::ground_layer_hop_distances(lyt, target, false));
+
+        const std::lock_guard<std::mutex> lock{mutex};
+
+        // the layout might have been resized or another thread might have computed the same target in the meantime
+        if (width != cached_width || height != cached_height || ps.max_cached_targets == 0)
+        {
+            return distances;
+        }
+        if (const auto it = cache.find(index); it != cache.cend())
+        {
+            return it->second.first;
+        }
+
+        recently_used.push_front(index);
+        cache.emplace(index, std::make_pair(distances, recently_used.begin()));
+
+        while (cache.size() > ps.max_cached_targets)
+        {
+            cache.erase(recently_used.back());
+            recently_used.pop_back();
+        }
+
+        return distances;
+    }
+};
+/**
+ * A distance functor that queries a `distance_oracle`. It can be used as a drop-in replacement for any other distance
+ * functor in path-finding algorithms and provides the exact distance along the clocking scheme of unobstructed layouts
+ * as an admissible heuristic. Copies of the functor share the same oracle.
+ *
+ * @tparam Lyt Coordinate layout type with `offset::ucoord_t` coordinates.
+ * @tparam Dist Distance type.
+ */
+template <typename Lyt, typename Dist = uint64_t>
+class distance_oracle_functor : public distance_functor<Lyt, Dist>
+{
+  public:
+    /**
+     * Construct the distance functor with a new oracle.
+     *
+     * @param p Parameters for the oracle.
+     */
+    explicit distance_oracle_functor(const distance_oracle_params& p = {}) :
+            distance_oracle_functor(std::make_shared<distance_oracle<Lyt, Dist>>(p))
+    {}
+    /**
+     * Construct the distance functor from an existing oracle.
+     *
+     * @param o Distance oracle.
+     */
+    explicit distance_oracle_functor(std::shared_ptr<distance_oracle<Lyt, Dist>> o) :
+            distance_functor<Lyt, Dist>([](const Lyt&, const coordinate<Lyt>&, const coordinate<Lyt>&)
+                                        { return Dist{}; }),  // dummy distance function
+            oracle{std::move(o)}
+    {}
+    /**
+     * Override the call operator to query the oracle instead of the distance function.
+     *
+     * @param lyt Layout.
+     * @param source Source coordinate.
+     * @param target Target coordinate.
+     * @return Distance between source and target according to the oracle.
+     */
+    [[nodiscard]] Dist operator()(const Lyt& lyt, const coordinate<Lyt>& source,
+                                  const coordinate<Lyt>& target) const override
+    {
+        return oracle->distance(lyt, source, target);
+    }
+
+  protected:
+    /**
+     * Distance oracle.
+     */
+    const std::shared_ptr<distance_oracle<Lyt, Dist>> oracle;
+};
+/**
+ * A distance functor that implements the ALT (A*, landmarks, and triangle inequality) lower bound. Upon construction,
+ * the distances from and to a small set of landmark coordinates are computed along the clocking scheme of the given
+ * layout (see `detail::ground_layer_hop_distances`). By the triangle inequality, for each landmark \f$L\f$,
+ *
+ * \f$d(s, t) \geq \max\{d(s, L) - d(t, L), \; d(L, t) - d(L, s)\}\f$.
+ *
+ * The functor returns the maximum of these bounds over all landmarks. Since obstructions and crossings are ignored,
+ * the result is an admissible and consistent A* heuristic. On layouts with clocking schemes other than 2DDWave, it is
+ * usually much tighter than the Manhattan distance. If the bounds prove that `target` is not reachable from `source`,
+ * `std::numeric_limits<Dist>::infinity()` is returned if that value is supported by `Dist`, or
+ * `std::numeric_limits<uint32_t>::max()`, otherwise.
+ *
+ * Landmarks are chosen greedily, each being the coordinate farthest from all previously chosen ones, starting at the
+ * origin. The functor is immutable after construction and can thus be shared between threads. If it is queried with a
+ * layout of different dimensions or coordinates outside the original layout, it returns the trivial lower bound 0.
+ *
+ * @tparam Lyt Coordinate layout type with `offset::ucoord_t` coordinates.
+ * @tparam Dist Distance type.
+ */
+template <typename Lyt, typename Dist = uint64_t>
+class landmark_distance_functor : public distance_functor<Lyt, Dist>
+{
+  public:
+    /**
+     * Construct the distance functor by selecting landmarks in the given layout and computing their distances.
+     *
+     * @param lyt Layout.
+     * @param num_landmarks Number of landmarks to select. It is capped at the number of coordinates on the ground
+     * layer.
+     */
+    explicit landmark_distance_functor(const Lyt& lyt, const std::size_t num_landmarks = 8ul) :
+            distance_functor<Lyt, Dist>([](const Lyt&, const coordinate<Lyt>&, const coordinate<Lyt>&)
+                                        { return Dist{}; }),  // dummy distance function
+            width{static_cast<uint64_t>(lyt.x()) + 1},
+            height{static_cast<uint64_t>(lyt.y()) + 1}
+    {
+        static_assert(is_coordinate_layout_v<Lyt>, "Lyt is not a coordinate layout");
+        static_assert(std::is_same_v<coordinate<Lyt>, offset::ucoord_t>, "Lyt must use offset::ucoord_t coordinates");
+
+        const auto num_coordinates = static_cast<std::size_t>(width * height);
+
+        // separation of each coordinate from the closest landmark chosen so far
+        std::vector<uint32_t> separation(num_coordinates, detail::unreachable_distance);
+
+        coordinate<Lyt> next{0, 0};
+
+        for (std::size_t l = 0; l < std::min(num_landmarks, num_coordinates); ++l)
+        {
+            landmarks.push_back(next);
+            to_landmark.push_back(detail::ground_layer_hop_distances(lyt, next, false));
+            from_landmark.push_back(detail::ground_layer_hop_distances(lyt, next, true));
+
+            std::size_t farthest_index = 0;
+
+            for (std::size_t i = 0; i < num_coordinates; ++i)
+            {
+                separation[i] = std::min({separation[i], to_landmark.back()[i], from_landmark.back()[i]});
+
+                if (separation[i] > separation[farthest_index])
+                {
+                    farthest_index = i;
+                }
+            }
+
+            // all coordinates are landmarks already
+            if (separation[farthest_index] == 0)
+            {
+                break;
+            }
+
+            next = {farthest_index % width, farthest_index / width};
+        }
+    }
+    /**
+     * Override the call operator to compute the landmark lower bound instead of the distance function.
+     *
+     * @param lyt Layout.
+     * @param source Source coordinate.
+     * @param target Target coordinate.
+     * @return Lower bound on the distance between source and target.
+     */
+    [[nodiscard]] Dist operator()(const Lyt& lyt, const coordinate<Lyt>& source,
+                                  const coordinate<Lyt>& target) const override
+    {
+        if (static_cast<uint64_t>(lyt.x()) + 1 != width || static_cast<uint64_t>(lyt.y()) + 1 != height ||
+            static_cast<uint64_t>(source.x) >= width || static_cast<uint64_t>(source.y) >= height ||
+            static_cast<uint64_t>(target.x) >= width || static_cast<uint64_t>(target.y) >= height)
+        {
+            return Dist{};
+        }
+
+        const auto s = detail::ground_coordinate_index<Lyt>(width, source);
+        const auto t = detail::ground_coordinate_index<Lyt>(width, target);
+
+        uint32_t bound = 0;
+
+        for (std::size_t l = 0; l < landmarks.size(); ++l)
+        {
+            const auto s_to_l = to_landmark[l][s];
+            const auto t_to_l = to_landmark[l][t];
+
+            if (t_to_l != detail::unreachable_distance)
+            {
+                // if t reaches L but s does not, s cannot reach t either
+                if (s_to_l == detail::unreachable_distance)
+                {
+                    return detail::to_distance<Dist>(detail::unreachable_distance);
+                }
+
+                bound = std::max(bound, s_to_l > t_to_l ? s_to_l - t_to_l : 0u);
+            }
+
+            const auto l_to_s = from_landmark[l][s];
+            const auto l_to_t = from_landmark[l][t];
+
+            if (l_to_s != detail::unreachable_distance)
+            {
+                // if L reaches s but not t, s cannot reach t either
+                if (l_to_t == detail::unreachable_distance)
+                {
+                    return detail::to_distance<Dist>(detail::unreachable_distance);
+                }
+
+                bound = std::max(bound, l_to_t > l_to_s ? l_to_t - l_to_s : 0u);
+            }
+        }
+
+        return static_cast<Dist>(bound);
+    }
+    /**
+     * Returns the selected landmarks.
+     *
+     * @return Landmark coordinates.
+     */
+    [[nodiscard]] const std::vector<coordinate<Lyt>>& get_landmarks() const noexcept
+    {
+        return landmarks;
+    }
+
+  protected:
+    /**
+     * Dimensions of the layout the landmarks were computed for.
+     */
+    const uint64_t width, height;
+    /**
+     * Landmark coordinates.
+     */
+    std::vector<coordinate<Lyt>> landmarks{};
+    /**
+     * Distances from all coordinates to each landmark.
+     */
+    std::vector<std::vector<uint32_t>> to_landmark{};
+    /**
+     * Distances from each landmark to all coordinates.
+     */
+    std::vector<std::vector<uint32_t>> from_landmark{};
+};
+
 }  // namespace fiction
 
 #endif  // FICTION_DISTANCE_MAP_HPP
@@ -5,10 +5,12 @@
 #ifndef FICTION_ENUMERATE_ALL_PATHS_HPP
 #define FICTION_ENUMERATE_ALL_PATHS_HPP
 
+#include "fiction/algorithms/path_finding/a_star.hpp"
 #include "fiction/traits.hpp"
 #include "fiction/utils/routing_utils.hpp"
 
-#include <phmap.h>
+#include <cassert>
+#include <cstdint>
 
 namespace fiction
 {
@@ -27,15 +29,19 @@ struct enumerate_all_paths_params
 namespace detail
 {
 
-template <typename Path, typename Lyt>
+template <typename Path, typename Lyt, typename CtxLyt, typename Value>
 class enumerate_all_paths_impl
 {
   public:
-    enumerate_all_paths_impl(const Lyt& lyt, const routing_objective<Lyt>& obj, const enumerate_all_paths_params& p) :
+    enumerate_all_paths_impl(const Lyt& lyt, const routing_objective<Lyt>& obj, const enumerate_all_paths_params& p,
+                             a_star_context<CtxLyt, Value>& ctx) :
             layout{lyt},
             objective{obj},
-            params{p}
-    {}
+            params{p},
+            context{ctx}
+    {
+        context.reset(layout);
+    }
 
     /**
      * Enumerate all possible paths in a layout that start at `objective.source` and lead to `objective.target`.
@@ -69,9 +75,9 @@ class enumerate_all_paths_impl
      */
     const enumerate_all_paths_params params;
     /**
-     * Set of visited coordinates.
+     * Search context whose records' closed flags are used to mark visited coordinates.
      */
-    phmap::flat_hash_set<coordinate<Lyt>> visited{};
+    a_star_context<CtxLyt, Value>& context;
     /**
      * Collection of all enumerated paths.
      */
@@ -83,7 +89,7 @@ class enumerate_all_paths_impl
      */
     void mark_visited(const coordinate<Lyt>& c) noexcept
     {
-        visited.insert(c);
+        context.record(context.to_handle(c)).closed = true;
     }
     /**
      * Mark a coordinate as unvisited.
@@ -92,7 +98,7 @@ class enumerate_all_paths_impl
      */
     void mark_unvisited(const coordinate<Lyt>& c) noexcept
     {
-        visited.erase(c);
+        context.record(context.to_handle(c)).closed = false;
     }
     /**
      * Check if a coordinate has been visited.
@@ -100,9 +106,9 @@ class enumerate_all_paths_impl
      * @param c Coordinate to check.
      * @return `true` if the coordinate has been visited, `false` otherwise.
      */
-    [[nodiscard]] bool is_visited(const coordinate<Lyt>& c) const noexcept
+    [[nodiscard]] bool is_visited(const coordinate<Lyt>& c) noexcept
     {
-        return visited.count(c) > 0;
+        return context.record(context.to_handle(c)).closed;
     }
     /**
      * Recursively enumerate all paths from `src` to `tgt` in the given layout. This function is called recursively
@@ -241,7 +247,32 @@ template <typename Path, typename Lyt>
 {
     static_assert(is_coordinate_layout_v<Lyt>, "Lyt is not a coordinate layout");
 
-    return detail::enumerate_all_paths_impl<Path, Lyt>{layout, objective, params}.run();
+    a_star_context<Lyt> context{};
+
+    return detail::enumerate_all_paths_impl<Path, Lyt, Lyt, uint64_t>{layout, objective, params, context}.run();
+}
+/**
+ * An overload of `enumerate_all_paths` that reuses the buffers of the given search context to keep track of visited
+ * coordinates instead of allocating new ones. See `a_star_context` for more information.
+ *
+ * @tparam Path Type of the returned individual paths.
+ * @tparam Lyt Type of the layout to perform path finding on.
+ * @tparam CtxLyt Layout type of the search context. Must use the same coordinate type as `Lyt`.
+ * @tparam Value Value type of the search context.
+ * @param layout The layout whose paths are to be enumerated.
+ * @param objective Source-target coordinate pair.
+ * @param context Search context whose buffers are reused. It is reset before the enumeration starts.
+ * @param params Parameters.
+ * @return A collection of all unique paths in `layout` from `objective.source` to `objective.target`.
+ */
+template <typename Path, typename Lyt, typename CtxLyt, typename Value>
+[[nodiscard]] path_collection<Path> enumerate_all_paths(const Lyt& layout, const routing_objective<Lyt>& objective,
+                                                        a_star_context<CtxLyt, Value>&    context,
+                                                        const enumerate_all_paths_params& params = {}) noexcept
+{
+    static_assert(is_coordinate_layout_v<Lyt>, "Lyt is not a coordinate layout");
+
+    return detail::enumerate_all_paths_impl<Path, Lyt, CtxLyt, Value>{layout, objective, params, context}.run();
 }
 
 }  // namespace fiction
@@ -5,16 +5,15 @@
 #ifndef FICTION_JUMP_POINT_SEARCH_HPP
 #define FICTION_JUMP_POINT_SEARCH_HPP
 
+#include "fiction/algorithms/path_finding/a_star.hpp"
 #include "fiction/algorithms/path_finding/distance.hpp"
 #include "fiction/traits.hpp"
 #include "fiction/utils/routing_utils.hpp"
-#include "fiction/utils/stl_utils.hpp"
-
-#include <phmap.h>
 
 #include <algorithm>
 #include <cassert>
 #include <cmath>
+#include <cstddef>
 #include <cstdint>
 #include <iterator>
 #include <optional>
@@ -27,17 +26,22 @@ namespace fiction
 namespace detail
 {
 
-template <typename Path, typename Lyt, typename Dist>
+template <typename Path, typename Lyt, typename Dist, typename CtxLyt, bool DenseIndex>
 class jump_point_search_impl
 {
   public:
     jump_point_search_impl(const Lyt& lyt, const routing_objective<Lyt>& obj,
-                           const distance_functor<Lyt, Dist>& dist_fn) :
+                           const distance_functor<Lyt, Dist>&        dist_fn,
+                           a_star_context<CtxLyt, Dist, DenseIndex>& ctx) :
             layout{lyt},
             objective{obj},
-            distance{dist_fn}
+            distance{dist_fn},
+            context{ctx}
     {
-        open_list.push(coordinate_f{objective.source, 0});
+        context.reset(layout);
+
+        source_handle = context.to_handle(objective.source);
+        context.open_list().push(source_handle, 0);
     }
 
     [[nodiscard]] Path run() noexcept
@@ -48,20 +52,23 @@ class jump_point_search_impl
         assert(layout.is_within_bounds(objective.source) && layout.is_within_bounds(objective.target) &&
                "Both source and target coordinate have to be within the layout bounds");
 
+        auto& open_list = context.open_list();
+
         do {
             // get coordinate with lowest f-value
-            const auto current = get_lowest_f_coord();
+            const auto current       = open_list.pop();
+            const auto current_coord = context.to_coordinate(current);
 
             // if coord is the target, a path has been found
-            if (current == objective.target)
+            if (current_coord == objective.target)
             {
-                return reconstruct_path();
+                return reconstruct_path(current);
             }
             // don't examine the current coordinate again
-            closed_list.insert(current);
+            context.record(current).closed = true;
 
             // expand from current coordinate
-            expand(current);
+            expand(current_coord, current);
 
         } while (!open_list.empty());  // until the open list is empty
 
@@ -81,86 +88,23 @@ class jump_point_search_impl
      * The distance functor that implements the heuristic estimation function.
      */
     const distance_functor<Lyt, Dist> distance;
-
     /**
-     * Stores a coordinate and its f-value.
+     * Search context that holds the open list and the per-coordinate search records.
      */
-    struct coordinate_f
-    {
-        /**
-         * Coordinate.
-         */
-        coordinate<Lyt> coord;
-        /**
-         * f-value of the coordinate.
-         */
-        Dist f;
-
-        /**
-         * Comparator for the priority queue. Compares only the f-values.
-         *
-         * @param other Other coordinate_f to compare with.
-         * @return `true` iff this f-value is greater than the other's.
-         */
-        bool operator>(const coordinate_f& other) const
-        {
-            return this->f > other.f;
-        }
-        /**
-         * Equality operator that only compares the stored coordinates. This allows for a convenient lookup in the
-         * priority queue.
-         *
-         * @param other Other coordinate_f to compare with.
-         * @return `true` iff this coord value is equal to the other's.
-         */
-        bool operator==(const coordinate_f& other) const
-        {
-            return this->coord == other.coord;
-        }
-    };
-
-    /**
-     * Priority queue for coordinates sorted by their f-values. Uses std::greater to get the smallest f-value on top...
-     * C++ is weird at times...
-     */
-    using jump_point_search_priority_queue =
-        searchable_priority_queue<coordinate_f, std::vector<coordinate_f>, std::greater<coordinate_f>>;
-    /**
-     * Open list that contains all coordinates to process next sorted by their f-value.
-     */
-    jump_point_search_priority_queue open_list{};
-    /**
-     * Closed list that acts as a set of already visited coordinates.
-     */
-    phmap::flat_hash_set<coordinate<Lyt>> closed_list{};
+    a_star_context<CtxLyt, Dist, DenseIndex>& context;
     /**
-     * Stores the g-cost for each coordinate c, i.e., the length of the shortest path from source to c found so far.
+     * Handle of `objective.source`.
      */
-    phmap::parallel_flat_hash_map<coordinate<Lyt>, Dist> g_values{};
-    /**
-     * Tracks the origin of each coordinate to recreate the path.
-     */
-    phmap::parallel_flat_hash_map<coordinate<Lyt>, coordinate<Lyt>> came_from{};
-    /**
-     * Fetches and pops the coordinate with the lowest f-value from the open list priority queue.
-     *
-     * @return Coordinate with the lowest f-value from the open list.
-     */
-    [[nodiscard]] coordinate<Lyt> get_lowest_f_coord() noexcept
-    {
-        const auto current = open_list.top().coord;
-        open_list.pop();
-
-        return current;
-    }
+    std::size_t source_handle{0};
     /**
      * Expands the frontier of coordinates to visit next in the direction of the heuristic cost function.
      *
      * @param current Coordinate that is currently examined.
+     * @param current_handle Handle of `current`.
      */
-    void expand(const coordinate<Lyt>& current) noexcept
+    void expand(const coordinate<Lyt>& current, const std::size_t current_handle) noexcept
     {
-        const auto explore_successor = [this, current](const auto& successor) noexcept
+        const auto explore_successor = [this, current, current_handle](const auto& successor) noexcept
         {
             // check if the connection to the successor is obstructed
             if constexpr (has_is_obstructed_connection_v<Lyt>)
@@ -183,38 +127,43 @@ class jump_point_search_impl
             // compute the next jump point to prune the search space
             if (const auto jump_point = jump(current, successor); jump_point.has_value())
             {
-                if (is_visited(*jump_point))
+                const auto jump_point_handle = context.to_handle(*jump_point);
+                auto&      jump_point_record = context.record(jump_point_handle);
+
+                if (jump_point_record.closed)
                 {
                     return;  // skip any jump point that is already in the closed list
                 }
 
                 // compute the g-value of current. Add the distance to the jump point as it might not be adjacent
-                const auto tentative_g = g(current) + distance(layout, *jump_point, current);
+                const auto tentative_g =
+                    context.record(current_handle).g + distance(layout, *jump_point, current);
 
-                // f-value does not matter because the comparator compares only the coordinates
-                const auto it = open_list.find({*jump_point, 0});
-                if (it != open_list.end() && no_improvement(*jump_point, tentative_g))
+                auto& open_list = context.open_list();
+
+                const auto is_open = open_list.contains(jump_point_handle);
+                if (is_open && tentative_g >= jump_point_record.g)
                 {
                     return;  // skip the coordinate if it does not offer improvement
                 }
 
                 // track origin
-                came_from[*jump_point] = current;
-                set_g(*jump_point, tentative_g);
+                jump_point_record.came_from = current_handle;
+                jump_point_record.g         = tentative_g;
 
                 // compute new f-value
                 const auto f = tentative_g + distance(layout, *jump_point, objective.target);
 
                 // if successor is contained in the open list (frontier)
-                if (it != open_list.end())
+                if (is_open)
                 {
                     // update its f-value
-                    it->f = f;
+                    open_list.decrease_key(jump_point_handle, f);
                 }
                 else
                 {
                     // add successor to the open list
-                    open_list.push({*jump_point, f});
+                    open_list.push(jump_point_handle, f);
                 }
             }
 
@@ -332,65 +281,19 @@ class jump_point_search_impl
         return true;
     }
     /**
-     * Checks if a coordinate has been visited already.
-     *
-     * @param c Coordinate to check.
-     * @return `true` iff c has already been visited.
-     */
-    [[nodiscard]] bool is_visited(const coordinate<Lyt>& c) const noexcept
-    {
-        return closed_list.count(c) > 0;
-    }
-    /**
-     * Returns the g-value of a coordinate by accessing the g_values map. Returns 0 if no entry exists.
-     *
-     * @param c Coordinate whose g-value is desired.
-     * @return g-value of coordinate c or 0 if no value has been stored.
-     */
-    [[nodiscard]] Dist g(const coordinate<Lyt>& c) const noexcept
-    {
-        if (const auto it = g_values.find(c); it != g_values.cend())
-        {
-            return it->second;
-        }
-
-        return 0ul;
-    }
-    /**
-     * Updates the g-value of the given coordinate to the given value.
-     *
-     * @param c Coordinate whose g-value is to be updated to g_val.
-     * @param g_val New g-value for c.
-     */
-    void set_g(const coordinate<Lyt>& c, const Dist g_val) noexcept
-    {
-        g_values.insert_or_assign(c, g_val);
-    }
-    /**
-     * Checks if the given g-value is greater or equal than the stored g-value of the given coordinate. If that is the
-     * case, the new g-value does not improve the path.
-     *
-     * @param c Coordinate to whose g-value is to be checked.
-     * @param g_val g-value to compare to c's.
-     * @return `true` iff the given g-value does not mean an improvement for the given coordinate.
-     */
-    [[nodiscard]] bool no_improvement(const coordinate<Lyt>& c, const Dist g_val) noexcept
-    {
-        return g_val >= g(c);
-    }
-    /**
-     * Reconstruct the final path from the origin map that was created during the path finding algorithm.
+     * Reconstruct the final path from the origin records that were created during the path finding algorithm.
      *
+     * @param target_handle Handle of the target coordinate.
      * @return The shortest path connecting source and target.
      */
-    [[nodiscard]] Path reconstruct_path() const noexcept
+    [[nodiscard]] Path reconstruct_path(const std::size_t target_handle) noexcept
     {
         Path path{};
 
         // iterate backwards over the found connections and add them to the path
-        for (auto current = objective.target; current != objective.source; current = came_from.at(current))
+        for (auto current = target_handle; current != source_handle; current = context.record(current).came_from)
         {
-            path.push_back(current);
+            path.push_back(context.to_coordinate(current));
         }
         // finally, add the source coordinate
         path.push_back(objective.source);
@@ -536,7 +439,36 @@ jump_point_search(const Lyt& layout, const routing_objective<Lyt>& objective,
 {
     static_assert(is_cartesian_layout_v<Lyt>, "Lyt is not a Cartesian layout");
 
-    return detail::jump_point_search_impl<Path, Lyt, Dist>{layout, objective, dist_fn}.run();
+    // only create records for the explored coordinates; see `a_star`
+    a_star_context<Lyt, Dist, false> context{};
+
+    return detail::jump_point_search_impl<Path, Lyt, Dist, Lyt, false>{layout, objective, dist_fn, context}.run();
+}
+/**
+ * An overload of Jump Point Search that reuses the buffers of the given search context instead of allocating new ones.
+ * See `a_star_context` for more information.
+ *
+ * @tparam Path Type of the returned path.
+ * @tparam Lyt Type of the layout to perform path finding on.
+ * @tparam CtxLyt Layout type of the search context. Must use the same coordinate type as `Lyt`.
+ * @tparam Dist Distance value type to be used in the heuristic estimation function.
+ * @tparam DenseIndex Flag that indicates whether the search context maps coordinates to records arithmetically.
+ * @param layout The layout in which the shortest path between a source and target is to be found.
+ * @param objective Source-target coordinate pair.
+ * @param context Search context whose buffers are reused. It is reset before the search starts.
+ * @param dist_fn A distance functor that implements the desired heuristic estimation function.
+ * @return The shortest loop-less path in `layout` from `objective.source` to `objective.target`.
+ */
+template <typename Path, typename Lyt, typename CtxLyt, typename Dist = uint64_t, bool DenseIndex>
+[[nodiscard]] Path
+jump_point_search(const Lyt& layout, const routing_objective<Lyt>& objective,
+                  a_star_context<CtxLyt, Dist, DenseIndex>& context,
+                  const distance_functor<Lyt, Dist>&        dist_fn = manhattan_distance_functor<Lyt, Dist>()) noexcept
+{
+    static_assert(is_cartesian_layout_v<Lyt>, "Lyt is not a Cartesian layout");
+
+    return detail::jump_point_search_impl<Path, Lyt, Dist, CtxLyt, DenseIndex>{layout, objective, dist_fn, context}
+        .run();
 }
 
 }  // namespace fiction
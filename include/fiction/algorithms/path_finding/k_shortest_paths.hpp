@@ -35,20 +35,21 @@ struct yen_k_shortest_paths_params
 namespace detail
 {
 
-template <typename Path, typename Lyt>
+template <typename Path, typename Lyt, typename CtxLyt>
 class yen_k_shortest_paths_impl
 {
   public:
     yen_k_shortest_paths_impl(const Lyt& lyt, const routing_objective<Lyt>& obj, const uint32_t k,
-                              const yen_k_shortest_paths_params& p) :
+                              const yen_k_shortest_paths_params& p, a_star_context<CtxLyt>& ctx) :
             layout{lyt},
             objective{obj.source, obj.target},  // create a new objective due to potentially differing types
             num_shortest_paths{k},
-            params{p}
+            params{p},
+            context{ctx}
     {
         // start by determining the shortest path between source and target
         k_shortest_paths.push_back(
-            a_star<Path>(layout, objective, manhattan_distance_functor<obstruction_layout<Lyt>, uint64_t>(),
+            a_star<Path>(layout, objective, context, manhattan_distance_functor<obstruction_layout<Lyt>, uint64_t>(),
                          unit_cost_functor<obstruction_layout<Lyt>, uint8_t>(), params.astar_params));
     }
 
@@ -89,7 +90,7 @@ class yen_k_shortest_paths_impl
                 for (const auto& p : k_shortest_paths)
                 {
                     // if the root path is equal to a previous partial path
-                    if (p.size() >= i && std::equal(root_path.cbegin(), root_path.cend(), p.cbegin(), p.cbegin() + i))
+                    if (p.size() > i + 1 && std::equal(root_path.cbegin(), root_path.cend(), p.cbegin(), p.cbegin() + i))
                     {
                         // block the connection that was already used in the previous shortest path
                         layout.obstruct_connection(p[i], p[i + 1]);
@@ -113,7 +114,7 @@ class yen_k_shortest_paths_impl
 
                 // find an alternative path from the spur coordinate to the target and check that it is not empty
                 if (const auto spur_path =
-                        a_star<Path>(layout, {spur, objective.target},
+                        a_star<Path>(layout, {spur, objective.target}, context,
                                      manhattan_distance_functor<obstruction_layout<Lyt>, uint64_t>(),
                                      unit_cost_functor<obstruction_layout<Lyt>, uint8_t>(), params.astar_params);
                     !spur_path.empty())
@@ -174,6 +175,10 @@ class yen_k_shortest_paths_impl
      * Routing parameters.
      */
     const yen_k_shortest_paths_params params;
+    /**
+     * Search context that is shared by all internal A* calls.
+     */
+    a_star_context<CtxLyt>& context;
     /**
      * The list of k shortest paths that is created during the algorithm.
      */
@@ -271,7 +276,33 @@ template <typename Path, typename Lyt>
 {
     static_assert(is_coordinate_layout_v<Lyt>, "Lyt is not a coordinate layout");
 
-    return detail::yen_k_shortest_paths_impl<Path, Lyt>{layout, objective, k, params}.run();
+    a_star_context<Lyt> context{};
+
+    return detail::yen_k_shortest_paths_impl<Path, Lyt, Lyt>{layout, objective, k, params, context}.run();
+}
+/**
+ * An overload of Yen's algorithm for finding up to \f$k\f$ shortest paths that reuses the buffers of the given search
+ * context for all internal A* calls instead of allocating new ones. See `a_star_context` for more information.
+ *
+ * @tparam Path Type of the returned individual paths.
+ * @tparam Lyt Type of the layout to perform path finding on.
+ * @tparam CtxLyt Layout type of the search context. Must use the same coordinate type as `Lyt`.
+ * @param layout The layout in which the \f$k\f$ shortest paths are to be found.
+ * @param objective Source-target coordinate pair.
+ * @param k Maximum number of shortest paths to find.
+ * @param context Search context whose buffers are reused.
+ * @param params Parameters.
+ * @return A collection of up to \f$k\f$ shortest loop-less paths in `layout` from `objective.source` to
+ * `objective.target`.
+ */
+template <typename Path, typename Lyt, typename CtxLyt>
+[[nodiscard]] path_collection<Path> yen_k_shortest_paths(const Lyt& layout, const routing_objective<Lyt>& objective,
+                                                         const uint32_t k, a_star_context<CtxLyt>& context,
+                                                         const yen_k_shortest_paths_params& params = {}) noexcept
+{
+    static_assert(is_coordinate_layout_v<Lyt>, "Lyt is not a coordinate layout");
+
+    return detail::yen_k_shortest_paths_impl<Path, Lyt, CtxLyt>{layout, objective, k, params, context}.run();
 }
 
 }  // namespace fiction
@@ -39,6 +39,11 @@ struct color_routing_params
      * Yen's algorithm) instead of all paths.
      */
     std::optional<uint32_t> path_limit = std::nullopt;
+    /**
+     * Number of threads used to enumerate the paths of the routing objectives. If set to 0, the number of hardware
+     * threads is used.
+     */
+    uint64_t num_threads = 1ull;
     /**
      * The engine to use.
      */
@@ -47,6 +52,11 @@ struct color_routing_params
      * Allow partial solutions when the SAT engine is used.
      */
     bool partial_sat = false;
+    /**
+     * Keep a single SAT solver alive across all color numbers when the SAT engine is used instead of encoding the
+     * edge intersection graph anew for each of them. The encoding is limited by an upper bound determined via DSATUR.
+     */
+    bool incremental_sat = false;
 };
 
 struct color_routing_stats
@@ -90,8 +100,9 @@ class color_routing_impl
         mockturtle::stopwatch stop{pst.time_total};
 
         generate_edge_intersection_graph_params epg_params{};
-        epg_params.crossings  = ps.crossings;
-        epg_params.path_limit = ps.path_limit;
+        epg_params.crossings   = ps.crossings;
+        epg_params.path_limit  = ps.path_limit;
+        epg_params.num_threads = ps.num_threads;
 
         const auto edge_intersection_graph =
             generate_edge_intersection_graph(layout, objectives, epg_params, &pst.epg_stats);
@@ -108,6 +119,7 @@ class color_routing_impl
         dvc_ps.sat_params.clique_size_color_frequency = !ps.partial_sat;
         dvc_ps.sat_params.sat_search_tactic           = graph_coloring_sat_search_tactic::LINEARLY_ASCENDING;
         dvc_ps.sat_params.sat_engine                  = bill::solvers::glucose_41;
+        dvc_ps.sat_params.incremental                 = ps.incremental_sat;
 
         const auto vertex_coloring = determine_vertex_coloring(edge_intersection_graph, dvc_ps, &pst.color_stats);
 
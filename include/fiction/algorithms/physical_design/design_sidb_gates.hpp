@@ -17,10 +17,12 @@
 #include "fiction/traits.hpp"
 #include "fiction/utils/layout_utils.hpp"
 #include "fiction/utils/math_utils.hpp"
+#include "fiction/utils/performance_profile.hpp"
 
 #include <fmt/format.h>
 #include <kitty/traits.hpp>
 #include <mockturtle/utils/stopwatch.hpp>
+#include <nlohmann/json.hpp>
 
 #include <algorithm>
 #include <atomic>
@@ -136,6 +138,11 @@ struct design_sidb_gates_stats
      * The number of layouts that remain after third pruning (discarding layouts with unstable I/O signals).
      */
     std::size_t number_of_layouts_after_third_pruning{0};
+    /**
+     * Time spent in pruning and simulation, the number of evaluated gate candidates, and the memory usage of the entire
+     * process.
+     */
+    performance_profile profile{};
     /**
      * This function outputs the total time taken for the SiDB gate design process to the provided output stream.
      * If no output stream is provided, it defaults to standard output (`std::cout`).
@@ -145,8 +152,27 @@ struct design_sidb_gates_stats
     void report(std::ostream& out = std::cout) const
     {
         out << fmt::format("[i] total time  = {:.2f} secs\n", mockturtle::to_seconds(time_total));
+
+        profile.report(out);
     }
 };
+/**
+ * Converts SiDB gate design statistics into JSON.
+ *
+ * @param j JSON value to write to.
+ * @param stats Statistics to convert.
+ */
+inline void to_json(nlohmann::json& j, const design_sidb_gates_stats& stats)
+{
+    j = {{"runtime in seconds", mockturtle::to_seconds(stats.time_total)},
+         {"pruning runtime in seconds", mockturtle::to_seconds(stats.pruning_total)},
+         {"simulation engine", sidb_simulation_engine_name(stats.sim_engine)},
+         {"number of layouts", stats.number_of_layouts},
+         {"number of layouts after first pruning", stats.number_of_layouts_after_first_pruning},
+         {"number of layouts after second pruning", stats.number_of_layouts_after_second_pruning},
+         {"number of layouts after third pruning", stats.number_of_layouts_after_third_pruning},
+         {"profile", stats.profile}};
+}
 
 namespace detail
 {
@@ -198,6 +224,7 @@ class design_sidb_gates_impl
     [[nodiscard]] std::vector<Lyt> run_automatic_exhaustive_gate_designer() const noexcept
     {
         mockturtle::stopwatch stop{stats.time_total};
+        const auto            search = stats.profile.time_phase("exhaustive search");
 
         auto all_combinations = determine_all_combinations_of_distributing_k_entities_on_n_positions(
             params.number_of_canvas_sidbs, static_cast<std::size_t>(all_sidbs_in_canvas.size()));
@@ -224,6 +251,8 @@ class design_sidb_gates_impl
             // canvas SiDBs are added to the skeleton
             const auto layout_with_added_cells = skeleton_layout_with_canvas_sidbs(combination);
 
+            stats.profile.increment("evaluated layouts");
+
             if (const auto [status, sim_calls] = is_operational(
                     layout_with_added_cells, truth_table, params.operational_params, input_bdl_wires, output_bdl_wires);
                 status == operational_status::OPERATIONAL)
@@ -292,6 +321,8 @@ class design_sidb_gates_impl
      */
     [[nodiscard]] std::vector<Lyt> run_random_design() const noexcept
     {
+        const auto search = stats.profile.time_phase("random search");
+
         std::vector<Lyt> randomly_designed_gate_layouts = {};
 
         // Allow positive charges here, as a layout that displays positive charges without inputs may not exhibit them
@@ -337,6 +368,8 @@ class design_sidb_gates_impl
                                 });
                         }
 
+                        stats.profile.increment("evaluated layouts");
+
                         if (const auto [status, sim_calls] =
                                 is_operational(result_lyt.value(), truth_table, params.operational_params,
                                                input_bdl_wires, output_bdl_wires);
@@ -389,7 +422,8 @@ class design_sidb_gates_impl
 
         {
             mockturtle::stopwatch stop_pruning{stats.pruning_total};
-            gate_candidates = run_pruning();
+            const auto            pruning = stats.profile.time_phase("pruning");
+            gate_candidates               = run_pruning();
         }
 
         stats.number_of_layouts_after_first_pruning =
@@ -420,6 +454,8 @@ class design_sidb_gates_impl
 
         std::atomic<bool> gate_design_found = false;
 
+        const auto simulation = stats.profile.time_phase("simulation");
+
         const auto check_operational_status =
             [this, &gate_layouts, &mutex_to_protect_gate_designs, &gate_design_found](const auto& candidate) noexcept
         {
@@ -434,6 +470,8 @@ class design_sidb_gates_impl
             params.operational_params.strategy_to_analyze_operational_status =
                 is_operational_params::operational_analysis_strategy::SIMULATION_ONLY;
 
+            stats.profile.increment("evaluated layouts");
+
             if (const auto [status, sim_calls] = is_operational(candidate, truth_table, params.operational_params,
                                                                 input_bdl_wires, output_bdl_wires);
                 status == operational_status::OPERATIONAL)
@@ -794,25 +832,29 @@ template <typename Lyt, typename TT>
     assert(std::adjacent_find(spec.begin(), spec.end(),
                               [](const auto& a, const auto& b) { return a.num_vars() != b.num_vars(); }) == spec.end());
 
-    design_sidb_gates_stats                 st{};
-    detail::design_sidb_gates_impl<Lyt, TT> p{skeleton, spec, params, st};
+    design_sidb_gates_stats st{};
 
     std::vector<Lyt> result{};
-
-    if (params.design_mode ==
-        design_sidb_gates_params<cell<Lyt>>::design_sidb_gates_mode::AUTOMATIC_EXHAUSTIVE_GATE_DESIGNER)
     {
-        result = p.run_automatic_exhaustive_gate_designer();
-    }
+        const auto memory = st.profile.track_memory();
 
-    else if (params.design_mode == design_sidb_gates_params<cell<Lyt>>::design_sidb_gates_mode::QUICKCELL)
-    {
-        result = p.run_quickcell();
-    }
+        detail::design_sidb_gates_impl<Lyt, TT> p{skeleton, spec, params, st};
 
-    else
-    {
-        result = p.run_random_design();
+        if (params.design_mode ==
+            design_sidb_gates_params<cell<Lyt>>::design_sidb_gates_mode::AUTOMATIC_EXHAUSTIVE_GATE_DESIGNER)
+        {
+            result = p.run_automatic_exhaustive_gate_designer();
+        }
+
+        else if (params.design_mode == design_sidb_gates_params<cell<Lyt>>::design_sidb_gates_mode::QUICKCELL)
+        {
+            result = p.run_quickcell();
+        }
+
+        else
+        {
+            result = p.run_random_design();
+        }
     }
 
     if (stats)
@@ -16,6 +16,7 @@
 #include "fiction/utils/layout_utils.hpp"
 #include "fiction/utils/name_utils.hpp"
 #include "fiction/utils/network_utils.hpp"
+#include "fiction/utils/performance_profile.hpp"
 #include "fiction/utils/placement_utils.hpp"
 #include "fiction/utils/truth_table_utils.hpp"
 
@@ -29,6 +30,7 @@
 #include <mockturtle/views/depth_view.hpp>
 #include <mockturtle/views/fanout_view.hpp>
 #include <mockturtle/views/topo_view.hpp>
+#include <nlohmann/json.hpp>
 #if (PROGRESS_BARS)
 #include <mockturtle/utils/progress_bar.hpp>
 #endif
@@ -52,6 +54,7 @@
 #include <thread>
 #include <unordered_map>
 #include <unordered_set>
+#include <utility>
 #include <vector>
 
 namespace fiction
@@ -108,6 +111,19 @@ struct exact_physical_design_params
      * @note This is an unstable beta feature.
      */
     std::size_t num_threads = 1ul;
+    /**
+     * Flag to indicate that the threads launched via `num_threads` should act as a solver portfolio. Each thread
+     * configures its Z3 solvers with a different random seed, aspect ratios proven UNSAT by one thread prune all
+     * aspect ratios they dominate for every other thread, and all workers are cancelled as soon as a minimal-area
+     * layout has been proven. Only has an effect if `num_threads > 1`.
+     *
+     * @note This is an unstable beta feature.
+     */
+    bool portfolio = false;
+    /**
+     * Base random seed for the solver portfolio. The solvers of thread \f$i\f$ use seed `portfolio_seed + i`.
+     */
+    unsigned portfolio_seed = 0u;
     /**
      * Flag to indicate that crossings may be used.
      */
@@ -140,6 +156,15 @@ struct exact_physical_design_params
      * Flag to indicate that the number of used crossing tiles should be minimized.
      */
     bool minimize_crossings = false;
+    /**
+     * Flag to indicate that symmetry breaking constraints should be added that exclude layouts which could be
+     * translated towards the origin, i.e., layouts whose first row or first column is empty. Such layouts would fit
+     * into a smaller aspect ratio that has already been examined. Only applies to Cartesian layouts clocked by 2DDWave,
+     * Columnar, or Row, whose clock zones are invariant under translation up to a relabeling of the clock numbers, and
+     * only if global synchronization is not enforced via path length constraints, no synchronization elements and no
+     * black list are used, and `fixed_size` is not set.
+     */
+    bool break_translation_symmetry = false;
     /**
      * Sets a timeout in ms for the solving process. Standard is 4294967 seconds as defined by Z3.
      */
@@ -149,6 +174,36 @@ struct exact_physical_design_params
      */
     technology_constraints technology_specifics = technology_constraints::NONE;
 };
+/**
+ * Statistics of a single worker thread in the solver portfolio.
+ */
+struct exact_physical_design_thread_stats
+{
+    /**
+     * Random seed the thread's solvers were configured with.
+     */
+    unsigned random_seed{0u};
+    /**
+     * Time the thread spent in solver calls.
+     */
+    mockturtle::stopwatch<>::duration time_solving{0};
+    /**
+     * Number of aspect ratios for which an SMT instance was generated and solved.
+     */
+    uint32_t num_solved_aspect_ratios{0ul};
+    /**
+     * Number of aspect ratios that were proven UNSAT by this thread.
+     */
+    uint32_t num_unsat{0ul};
+    /**
+     * Number of aspect ratios that were pruned by bounds learned from other threads, either before or while solving.
+     */
+    uint32_t num_pruned{0ul};
+    /**
+     * Number of conflicts and decisions reported by the thread's solvers.
+     */
+    uint64_t num_conflicts{0ull}, num_decisions{0ull};
+};
 /**
  * Statistics.
  */
@@ -160,6 +215,23 @@ struct exact_physical_design_stats
     uint64_t num_gates{0ull}, num_wires{0ull}, num_crossings{0ull};
 
     uint32_t num_aspect_ratios{0ul};
+    /**
+     * Number of aspect ratios that were discarded because they exceed the upper bounds specified in the parameters.
+     */
+    uint32_t num_aspect_ratios_beyond_bounds{0ul};
+    /**
+     * Number of aspect ratios within the upper bounds that were discarded as infeasible before any SMT instance was
+     * generated, e.g., because they cannot host all I/O pins or do not provide enough tiles with sufficient degrees.
+     */
+    uint32_t num_skipped_aspect_ratios{0ul};
+    /**
+     * Per-thread solver statistics. Only populated in portfolio mode.
+     */
+    std::vector<exact_physical_design_thread_stats> thread_stats{};
+    /**
+     * Time spent in fanout substitution and SMT solving as well as the memory usage of the entire process.
+     */
+    performance_profile profile{};
 
     void report(std::ostream& out = std::cout) const
     {
@@ -168,8 +240,52 @@ struct exact_physical_design_stats
         out << fmt::format("[i] num. gates      = {}\n", num_gates);
         out << fmt::format("[i] num. wires      = {}\n", num_wires);
         out << fmt::format("[i] num. crossings  = {}\n", num_crossings);
+
+        for (auto i = 0ul; i < thread_stats.size(); ++i)
+        {
+            const auto& tst = thread_stats[i];
+
+            out << fmt::format("[i] thread {:<2} (seed {}): {:.2f} secs solving, {} solved, {} UNSAT, {} pruned, {} "
+                               "conflicts, {} decisions\n",
+                               i, tst.random_seed, mockturtle::to_seconds(tst.time_solving),
+                               tst.num_solved_aspect_ratios, tst.num_unsat, tst.num_pruned, tst.num_conflicts,
+                               tst.num_decisions);
+        }
+
+        profile.report(out);
     }
 };
+/**
+ * Converts exact physical design statistics into JSON.
+ *
+ * @param j JSON value to write to.
+ * @param stats Statistics to convert.
+ */
+inline void to_json(nlohmann::json& j, const exact_physical_design_stats& stats)
+{
+    auto threads = nlohmann::json::array();
+    for (const auto& tst : stats.thread_stats)
+    {
+        threads.push_back({{"random seed", tst.random_seed},
+                           {"solving time in seconds", mockturtle::to_seconds(tst.time_solving)},
+                           {"solved aspect ratios", tst.num_solved_aspect_ratios},
+                           {"UNSAT aspect ratios", tst.num_unsat},
+                           {"pruned aspect ratios", tst.num_pruned},
+                           {"conflicts", tst.num_conflicts},
+                           {"decisions", tst.num_decisions}});
+    }
+
+    j = {{"runtime in seconds", mockturtle::to_seconds(stats.time_total)},
+         {"number of gates", stats.num_gates},
+         {"number of wires", stats.num_wires},
+         {"number of crossings", stats.num_crossings},
+         {"examined aspect ratios", stats.num_aspect_ratios},
+         {"aspect ratios beyond bounds", stats.num_aspect_ratios_beyond_bounds},
+         {"skipped aspect ratios", stats.num_skipped_aspect_ratios},
+         {"layout", {{"x-size", stats.x_size}, {"y-size", stats.y_size}, {"area", stats.x_size * stats.y_size}}},
+         {"threads", threads},
+         {"profile", stats.profile}};
+}
 
 namespace detail
 {
@@ -203,7 +319,7 @@ class exact_impl
     {
         if (ps.num_threads > 1)
         {
-            return run_asynchronously();
+            return ps.portfolio ? run_portfolio() : run_asynchronously();
         }
 
         return run_synchronously();
@@ -281,21 +397,65 @@ class exact_impl
                 node2pos{ntk},
                 depth_ntk{ntk},
                 inv_levels{inverse_levels(ntk)}
-        {}
+        {
+            // precompute how many nodes require at least a certain number of incoming/outgoing connections
+            network.foreach_node(
+                [this](const auto& n)
+                {
+                    if (skip_const_or_io_node(n))
+                    {
+                        return;
+                    }
+
+                    const auto count_degree = [](std::vector<uint32_t>& histogram, const uint32_t degree)
+                    {
+                        if (histogram.size() <= degree)
+                        {
+                            histogram.resize(degree + 1, 0u);
+                        }
+                        for (auto d = 0u; d <= degree; ++d)
+                        {
+                            ++histogram[d];
+                        }
+                    };
+
+                    count_degree(nodes_with_min_in_degree, network_in_degree(n));
+                    count_degree(nodes_with_min_out_degree, network_out_degree(n));
+                });
+
+            probe.replace_clocking_scheme(layout.get_clocking_scheme());
+        }
+        /**
+         * Checks whether a given aspect ratio extends beyond the upper bounds specified in the parameters.
+         *
+         * @param ar Aspect ratio to evaluate.
+         * @return `true` iff `ar` exceeds the upper bound on the area or on one of the dimensions.
+         */
+        [[nodiscard]] bool exceeds_upper_bounds(const typename Lyt::aspect_ratio& ar) const noexcept
+        {
+            return (ar.x + 1) * (ar.y + 1) > params.upper_bound_area || ar.x >= params.upper_bound_x ||
+                   ar.y >= params.upper_bound_y;
+        }
         /**
          * Evaluates a given aspect ratio regarding the stored configurations whether it can be skipped, i.e., does not
          * need to be explored by the SMT solver. The better this function is at predicting unsatisfying inputs, the
          * more UNSAT instances can be skipped without losing the optimality guarantee. This function should never be
-         * overly restrictive!
+         * overly restrictive! Aspect ratios beyond the upper bounds are not considered here but by
+         * `exceeds_upper_bounds`.
          *
          * @param ar Aspect ratio to evaluate.
          * @return `true` if ar can safely be skipped because it is UNSAT anyway.
          */
-        [[nodiscard]] bool skippable(const typename Lyt::aspect_ratio& ar) const noexcept
+        [[nodiscard]] bool skippable(const typename Lyt::aspect_ratio& ar) const
         {
-            // skip aspect ratios that extend beyond the specified upper bounds
-            if ((ar.x + 1) * (ar.y + 1) > params.upper_bound_area || ar.x >= params.upper_bound_x ||
-                ar.y >= params.upper_bound_y)
+            // if border I/Os are enforced, skip all aspect ratios whose border cannot host all I/O pins
+            if (params.border_io && params.io_pins &&
+                num_border_tiles(ar) < static_cast<uint64_t>(network.num_pis()) + network.num_pos())
+            {
+                return true;
+            }
+            // skip all aspect ratios that do not provide enough tiles with sufficient in- and out-degrees
+            if (layout.is_regularly_clocked() && !has_sufficient_tile_degrees(ar))
             {
                 return true;
             }
@@ -308,6 +468,16 @@ class exact_impl
                     return true;
                 }
             }
+            // 2DDWave clocking optimization
+            else if (layout.is_clocking_scheme(clock_name::TWODDWAVE) && is_cartesian_layout_v<Lyt>)
+            {
+                // information flows eastwards and southwards only; skip all aspect ratios whose longest monotone path
+                // is too short for the network's depth
+                if (ar.x + ar.y < depth_ntk.depth())
+                {
+                    return true;
+                }
+            }
             // Columnar clocking optimization
             else if (layout.is_clocking_scheme(clock_name::COLUMNAR))
             {
@@ -351,6 +521,23 @@ class exact_impl
             check_point = std::make_shared<solver_check_point>(fetch_solver(ar));
             ++lc;
             solver = check_point->state->solver;
+
+            if (random_seed.has_value())
+            {
+                z3::params p{*ctx};
+                p.set("random_seed", *random_seed);
+                solver->set(p);
+            }
+        }
+        /**
+         * Configures all solvers that are created or reused from here on to use the given random seed. Used to
+         * diversify the solvers in a portfolio.
+         *
+         * @param seed Random seed to pass to Z3.
+         */
+        void set_random_seed(const unsigned seed) noexcept
+        {
+            random_seed = seed;
         }
         /**
          * Sets the given timeout for the current solver.
@@ -377,7 +564,9 @@ class exact_impl
         {
             generate_smt_instance();
 
-            if (const auto z3_result = solver->check(check_point->assumptions); z3_result == z3::sat)
+            last_result = solver->check(check_point->assumptions);
+
+            if (last_result == z3::sat)
             {
                 // optimize the generated result
                 if (auto opt = optimize(); opt != nullptr)
@@ -413,8 +602,147 @@ class exact_impl
         {
             return solver->statistics();
         }
+        /**
+         * Checks whether the last call to `is_satisfiable` returned `false` because the instance was proven UNSAT as
+         * opposed to the solver giving up, e.g., due to a timeout or an interrupt.
+         *
+         * @return `true` iff the last solver call resulted in UNSAT.
+         */
+        [[nodiscard]] bool is_proven_unsat() const noexcept
+        {
+            return last_result == z3::unsat;
+        }
+        /**
+         * Returns the number of conflicts and decisions that the current solver accumulated since this function was
+         * last called on the same solver state. Since solver states are reused across incremental calls, Z3's
+         * cumulative statistics would otherwise be counted multiple times.
+         *
+         * @return Pair of newly accumulated conflicts and decisions.
+         */
+        [[nodiscard]] std::pair<uint64_t, uint64_t> fetch_solver_effort()
+        {
+            uint64_t conflicts{0ull}, decisions{0ull};
+
+            const auto stats = solver->statistics();
+            for (auto i = 0u; i < stats.size(); ++i)
+            {
+                if (!stats.is_uint(i))
+                {
+                    continue;
+                }
+
+                if (const auto key = stats.key(i); key == "conflicts" || key == "sat conflicts")
+                {
+                    conflicts += stats.uint_value(i);
+                }
+                else if (key == "decisions" || key == "sat decisions")
+                {
+                    decisions += stats.uint_value(i);
+                }
+            }
+
+            auto& state = *check_point->state;
+
+            const std::pair<uint64_t, uint64_t> effort{conflicts - std::min(conflicts, state.num_conflicts),
+                                                       decisions - std::min(decisions, state.num_decisions)};
+
+            state.num_conflicts = conflicts;
+            state.num_decisions = decisions;
+
+            return effort;
+        }
 
       private:
+        /**
+         * Number of nodes that require at least \f$i\f$ incoming connections at index \f$i\f$.
+         */
+        std::vector<uint32_t> nodes_with_min_in_degree{};
+        /**
+         * Number of nodes that require at least \f$i\f$ outgoing connections at index \f$i\f$.
+         */
+        std::vector<uint32_t> nodes_with_min_out_degree{};
+        /**
+         * Empty layout with the clocking scheme of `layout` that is resized to every aspect ratio evaluated by
+         * `has_sufficient_tile_degrees` to look up the tiles' in- and out-degrees.
+         */
+        mutable Lyt probe{};
+        /**
+         * Computes the number of tiles located at the border of a layout of the given aspect ratio.
+         *
+         * @param ar Aspect ratio to evaluate.
+         * @return Number of border tiles in `ar`.
+         */
+        [[nodiscard]] static uint64_t num_border_tiles(const typename Lyt::aspect_ratio& ar) noexcept
+        {
+            const auto width = static_cast<uint64_t>(ar.x) + 1, height = static_cast<uint64_t>(ar.y) + 1;
+
+            if (width <= 2 || height <= 2)
+            {
+                return width * height;
+            }
+
+            return 2 * (width + height) - 4;
+        }
+        /**
+         * Checks whether a regularly clocked layout of the given aspect ratio provides enough tiles with sufficient
+         * in- and out-degrees to host all nodes of the network. Each node must be placed on its own ground tile. Hence,
+         * for every degree \f$d\f$, the number of tiles whose clocking provides at least \f$d\f$ incoming
+         * (outgoing) clock zones must not be smaller than the number of nodes with at least \f$d\f$ fan-ins
+         * (fan-outs). This check respects the clocking scheme's `max_in_degree` and `max_out_degree` as well as the
+         * reduced degrees of border tiles. The degrees are read from `probe`, which is resized to `ar` instead of
+         * constructing a new layout for every aspect ratio.
+         *
+         * @param ar Aspect ratio to evaluate.
+         * @return `true` iff the aspect ratio could host all nodes with respect to their degrees.
+         */
+        [[nodiscard]] bool has_sufficient_tile_degrees(const typename Lyt::aspect_ratio& ar) const
+        {
+            const auto clk = layout.get_clocking_scheme();
+
+            if (nodes_with_min_in_degree.size() > clk.max_in_degree + 1ul ||
+                nodes_with_min_out_degree.size() > clk.max_out_degree + 1ul)
+            {
+                return false;
+            }
+
+            probe.resize({ar.x, ar.y, 0});
+
+            std::vector<uint64_t> tiles_with_min_in_degree(nodes_with_min_in_degree.size(), 0ull),
+                tiles_with_min_out_degree(nodes_with_min_out_degree.size(), 0ull);
+
+            probe.foreach_ground_tile(
+                [&](const auto& t)
+                {
+                    const auto in = static_cast<std::size_t>(probe.in_degree(t)),
+                               out = static_cast<std::size_t>(probe.out_degree(t));
+
+                    for (auto d = 0ul; d <= std::min(in, tiles_with_min_in_degree.size() - 1); ++d)
+                    {
+                        ++tiles_with_min_in_degree[d];
+                    }
+                    for (auto d = 0ul; d <= std::min(out, tiles_with_min_out_degree.size() - 1); ++d)
+                    {
+                        ++tiles_with_min_out_degree[d];
+                    }
+                });
+
+            for (auto d = 0ul; d < nodes_with_min_in_degree.size(); ++d)
+            {
+                if (tiles_with_min_in_degree[d] < nodes_with_min_in_degree[d])
+                {
+                    return false;
+                }
+            }
+            for (auto d = 0ul; d < nodes_with_min_out_degree.size(); ++d)
+            {
+                if (tiles_with_min_out_degree[d] < nodes_with_min_out_degree[d])
+                {
+                    return false;
+                }
+            }
+
+            return true;
+        }
         /**
          * During incremental SMT calls, several created assertions need to be reformulated. To still be able to reuse
          * information like learned clauses and lemmas, the push/pop strategy is not employed. Instead, assumption
@@ -445,6 +773,10 @@ class exact_impl
              * Watched literals for eastern and southern constraints which are used to reformulate them.
              */
             assumption_literals lit;
+            /**
+             * Solver effort that has already been accounted for in the statistics.
+             */
+            uint64_t num_conflicts{0ull}, num_decisions{0ull};
         };
         /**
          * Alias for a pointer to a solver state.
@@ -539,6 +871,14 @@ class exact_impl
          * Shortcut to the solver stored in check_point.
          */
         solver_ptr solver;
+        /**
+         * Result of the last solver call.
+         */
+        z3::check_result last_result{z3::unknown};
+        /**
+         * Random seed to configure all solvers with. If not set, Z3's default is used.
+         */
+        std::optional<unsigned> random_seed{};
         /**
          * Returns the lc-th eastern assumption literal from the stored context.
          *
@@ -592,7 +932,8 @@ class exact_impl
 
                 // deep-copy solver state
                 const auto   state     = it_x->second;
-                solver_state new_state = {state->solver, {get_lit_e(), state->lit.s}};
+                solver_state new_state = {state->solver, {get_lit_e(), state->lit.s}, state->num_conflicts,
+                                          state->num_decisions};
 
                 // reset eastern constraints
                 new_state.solver->add(!(state->lit.e));
@@ -616,7 +957,8 @@ class exact_impl
 
                 // deep-copy solver state
                 const auto   state     = it_y->second;
-                solver_state new_state = {state->solver, {state->lit.e, get_lit_s()}};
+                solver_state new_state = {state->solver, {state->lit.e, get_lit_s()}, state->num_conflicts,
+                                          state->num_decisions};
 
                 // reset southern constraints
                 new_state.solver->add(!(state->lit.s));
@@ -639,7 +981,7 @@ class exact_impl
             }
 
             // create new state
-            solver_state new_state{std::make_shared<z3::solver>(*ctx), {get_lit_e(), get_lit_s()}};
+            solver_state new_state{std::make_shared<z3::solver>(*ctx), {get_lit_e(), get_lit_s()}, 0ull, 0ull};
 
             return {std::make_shared<solver_state>(new_state), added_tiles, {}, create_assumptions(new_state)};
         }
@@ -2566,6 +2908,91 @@ class exact_impl
             prevent_insufficiencies();
             define_number_of_connections();
             utilize_hierarchical_information();
+
+            if (params.break_translation_symmetry && is_translation_invariant())
+            {
+                break_translation_symmetry();
+            }
+        }
+        /**
+         * Checks whether every layout of the current aspect ratio whose first row or first column is empty could be
+         * translated towards the origin without invalidating it. This is the case for Cartesian layouts that are
+         * clocked by a linear scheme which is invariant under translation up to a relabeling of clock numbers, i.e.,
+         * 2DDWave, Columnar, or Row, as long as no constraints depend on absolute tile positions or clock numbers.
+         *
+         * @return `true` iff translation symmetry breaking constraints can be added safely.
+         */
+        [[nodiscard]] bool is_translation_invariant() const noexcept
+        {
+            if constexpr (!is_cartesian_layout_v<Lyt>)
+            {
+                return false;
+            }
+            else
+            {
+                if (!(layout.is_clocking_scheme(clock_name::TWODDWAVE) ||
+                      layout.is_clocking_scheme(clock_name::COLUMNAR) || layout.is_clocking_scheme(clock_name::ROW)))
+                {
+                    return false;
+                }
+
+                // path length constraints incorporate absolute clock numbers of PIs
+                if (!params.desynchronize && !params.border_io)
+                {
+                    return false;
+                }
+
+                return !params.synchronization_elements && !params.fixed_size &&
+                       params.technology_specifics == technology_constraints::NONE && black_list.empty();
+            }
+        }
+        /**
+         * Adds constraints to the solver that enforce the first row and the first column of the layout to be occupied
+         * by at least one node or edge. Any layout violating these constraints could be translated towards the origin
+         * and, thereby, fit into a smaller aspect ratio that has been examined before. Symmetry breaking constraints.
+         */
+        void break_translation_symmetry()
+        {
+            const auto occupied = [this](const typename Lyt::tile& t) -> z3::expr
+            {
+                z3::expr_vector occ{*ctx};
+
+                network.foreach_node(
+                    [this, &t, &occ](const auto& n)
+                    {
+                        if (!skip_const_or_io_node(n))
+                        {
+                            occ.push_back(get_tn(t, n));
+                        }
+                    });
+
+                foreach_edge(network,
+                             [this, &t, &occ](const auto& e)
+                             {
+                                 if (!skip_const_or_io_edge(e))
+                                 {
+                                     occ.push_back(get_te(t, e));
+                                 }
+                             });
+
+                return z3::mk_or(occ);
+            };
+
+            z3::expr_vector first_row{*ctx};
+            for (decltype(layout.x()) x = 0; x <= layout.x(); ++x)
+            {
+                first_row.push_back(occupied({x, 0}));
+            }
+
+            z3::expr_vector first_column{*ctx};
+            for (decltype(layout.y()) y = 0; y <= layout.y(); ++y)
+            {
+                first_column.push_back(occupied({0, y}));
+            }
+
+            // use a tracking literal to disable constraints in case of UNSAT
+            solver->add(mk_as(z3::mk_or(first_row), lit().e && lit().s));
+            solver->add(mk_as(z3::mk_or(first_column), lit().e && lit().s));
         }
         /**
          * Creates and returns a z3::optimize if optimization criteria were set by the configuration. The optimize gets
@@ -2880,8 +3307,19 @@ class exact_impl
                 return std::nullopt;
             }
 
+            if (handler.exceeds_upper_bounds(ar))
+            {
+                const std::lock_guard<std::mutex> guard(ari_mutex);
+                pst.num_aspect_ratios_beyond_bounds++;
+
+                continue;
+            }
+
             if (handler.skippable(ar))
             {
+                const std::lock_guard<std::mutex> guard(ari_mutex);
+                pst.num_skipped_aspect_ratios++;
+
                 continue;
             }
 
@@ -2907,6 +3345,7 @@ class exact_impl
             try
             {
                 mockturtle::stopwatch stop{pst.time_total};
+                const auto            solving = pst.profile.time_phase("SMT solving");
 
                 if (handler.is_satisfiable())  // found a layout
                 {
@@ -3050,6 +3489,411 @@ class exact_impl
 
         return std::nullopt;
     }
+    /**
+     * Thread-safe store of aspect ratios that have been proven UNSAT by any thread of the solver portfolio. Without
+     * border I/Os, every layout of aspect ratio \f$x \times y\f$ can be embedded into any larger aspect ratio
+     * \f$x' \times y'\f$ with \f$x \leq x'\f$ and \f$y \leq y'\f$ by leaving the additional tiles empty.
+     * Consequently, an UNSAT aspect ratio proves all aspect ratios it dominates to be UNSAT as well.
+     */
+    class shared_bound_store
+    {
+      public:
+        /**
+         * Records that the given aspect ratio was proven UNSAT.
+         *
+         * @param ar Aspect ratio that was proven UNSAT.
+         */
+        void add_unsat(const typename Lyt::aspect_ratio& ar)
+        {
+            const std::lock_guard<std::mutex> guard{mutex};
+
+            // aspect ratios that are dominated by the new one do not need to be stored anymore
+            unsat_aspect_ratios.erase(std::remove_if(unsat_aspect_ratios.begin(), unsat_aspect_ratios.end(),
+                                                     [&ar](const auto& u) { return dominates(ar, u); }),
+                                      unsat_aspect_ratios.end());
+
+            unsat_aspect_ratios.push_back(ar);
+        }
+        /**
+         * Checks whether the given aspect ratio is known to be UNSAT because it is dominated by a stored one.
+         *
+         * @param ar Aspect ratio to check.
+         * @return `true` iff `ar` is dominated by an aspect ratio that was proven UNSAT.
+         */
+        [[nodiscard]] bool is_pruned(const typename Lyt::aspect_ratio& ar) const
+        {
+            const std::lock_guard<std::mutex> guard{mutex};
+
+            return std::any_of(unsat_aspect_ratios.cbegin(), unsat_aspect_ratios.cend(),
+                               [&ar](const auto& u) { return dominates(u, ar); });
+        }
+        /**
+         * Checks whether aspect ratio `ar1` dominates aspect ratio `ar2`, i.e., whether `ar2` fits into `ar1`.
+         *
+         * @param ar1 Potentially dominating aspect ratio.
+         * @param ar2 Potentially dominated aspect ratio.
+         * @return `true` iff `ar2` fits into `ar1`.
+         */
+        [[nodiscard]] static bool dominates(const typename Lyt::aspect_ratio& ar1,
+                                            const typename Lyt::aspect_ratio& ar2) noexcept
+        {
+            return ar2.x <= ar1.x && ar2.y <= ar1.y;
+        }
+
+      private:
+        /**
+         * Restricts access to the stored aspect ratios.
+         */
+        mutable std::mutex mutex{};
+        /**
+         * Pareto front of aspect ratios that were proven UNSAT.
+         */
+        std::vector<typename Lyt::aspect_ratio> unsat_aspect_ratios{};
+    };
+    /**
+     * Aspect ratios proven UNSAT by the solver portfolio.
+     */
+    shared_bound_store unsat_bounds{};
+    /**
+     * Restricts access to the thread_info list in portfolio mode.
+     */
+    std::mutex ti_mutex{};
+    /**
+     * Flag that is raised as soon as the solver portfolio has proven a minimal-area layout.
+     */
+    std::atomic<bool> portfolio_done{false};
+    /**
+     * State of a thread in the solver portfolio that is shared with all other threads.
+     */
+    struct portfolio_thread_info : public thread_info
+    {
+        /**
+         * Flag to indicate that the thread is currently solving an instance.
+         */
+        bool active{false};
+        /**
+         * Flag to indicate that the thread's current aspect ratio has been pruned by another thread.
+         */
+        bool pruned{false};
+    };
+    /**
+     * Checks whether the solver portfolio has proven the found result to be minimal, i.e., whether no thread is still
+     * working on an aspect ratio with a smaller area. If so, all remaining workers are interrupted. Must be called
+     * while holding `ti_mutex`.
+     *
+     * @param pti_list List of shared thread info.
+     */
+    void cancel_if_minimal(std::vector<portfolio_thread_info>& pti_list)
+    {
+        std::optional<typename Lyt::aspect_ratio> result_ar{};
+        {
+            const std::lock_guard<std::mutex> guard{rar_mutex};
+            result_ar = result_aspect_ratio;
+        }
+
+        if (!result_ar.has_value())
+        {
+            return;
+        }
+
+        if (std::any_of(pti_list.cbegin(), pti_list.cend(), [&result_ar](const auto& pti)
+                        { return pti.active && area(pti.worker_aspect_ratio) < area(*result_ar); }))
+        {
+            return;
+        }
+
+        portfolio_done = true;
+
+        for (auto& pti : pti_list)
+        {
+            if (pti.active && pti.ctx)
+            {
+                pti.ctx->interrupt();
+            }
+        }
+    }
+    /**
+     * Thread function for the portfolio solving strategy. Works like `explore_asynchronously` but configures its
+     * solvers with a thread-specific random seed, shares proven UNSAT aspect ratios with all other threads via
+     * `unsat_bounds`, interrupts threads whose current aspect ratio gets pruned that way, and stops all threads as
+     * soon as the minimality of a found layout is proven. Since an interrupted Z3 context cannot be reused, a thread
+     * that got interrupted due to pruning continues with a fresh context and handler.
+     *
+     * @param t_num Thread's identifier.
+     * @param pti_list Pointer to a list of shared thread info that the threads use for communication.
+     * @param start Point in time at which the portfolio was launched. Used to respect the timeout.
+     * @return A found layout or `std::nullopt` if being interrupted.
+     */
+    [[nodiscard]] std::optional<Lyt>
+    explore_portfolio(const unsigned t_num, const std::shared_ptr<std::vector<portfolio_thread_info>>& pti_list,
+                      const std::chrono::steady_clock::time_point start)
+    {
+        auto& tst = pst.thread_stats[t_num];
+
+        tst.random_seed = ps.portfolio_seed + t_num;
+
+        // without border I/Os, smaller layouts can be embedded into larger ones; translation symmetry breaking may
+        // render aspect ratios UNSAT whose smaller counterparts have not been examined yet by other threads
+        const auto monotone = !ps.border_io && !ps.break_translation_symmetry;
+
+        Lyt                           layout{{}, scheme};
+        std::unique_ptr<smt_handler> handler{};
+
+        const auto reset_handler = [&]
+        {
+            const auto ctx = std::make_shared<z3::context>();
+
+            handler = std::make_unique<smt_handler>(ctx, layout, *ntk, ps, black_list);
+            handler->set_random_seed(tst.random_seed);
+
+            const std::lock_guard<std::mutex> guard{ti_mutex};
+            (*pti_list)[t_num].ctx = ctx;
+        };
+
+        const auto deactivate = [&]
+        {
+            const std::lock_guard<std::mutex> guard{ti_mutex};
+            (*pti_list)[t_num].active = false;
+            cancel_if_minimal(*pti_list);
+        };
+
+        reset_handler();
+
+        while (!portfolio_done)
+        {
+            typename Lyt::aspect_ratio ar;
+
+            // mutually exclusive access to the aspect ratio iterator
+            {
+                const std::lock_guard<std::mutex> guard(ari_mutex);
+
+                ++ari;
+                ar = *ari;  // operations ++ and * are split to prevent a vector copy construction
+
+                // log the examination of a new aspect ratio
+                pst.num_aspect_ratios++;
+            }
+
+            if ((ar.x + 1) * (ar.y + 1) > ps.upper_bound_area || (ar.x >= ps.upper_bound_x && ar.y >= ps.upper_bound_y))
+            {
+                return std::nullopt;
+            }
+
+            if (handler->exceeds_upper_bounds(ar))
+            {
+                const std::lock_guard<std::mutex> guard(ari_mutex);
+                pst.num_aspect_ratios_beyond_bounds++;
+
+                continue;
+            }
+
+            if (handler->skippable(ar))
+            {
+                const std::lock_guard<std::mutex> guard(ari_mutex);
+                pst.num_skipped_aspect_ratios++;
+
+                continue;
+            }
+
+            if (monotone && unsat_bounds.is_pruned(ar))
+            {
+                ++tst.num_pruned;
+                continue;
+            }
+
+            // mutually exclusive access to the result aspect ratio
+            {
+                const std::lock_guard<std::mutex> guard(rar_mutex);
+
+                // stop working if a result with smaller or equal area is available already
+                if (result_aspect_ratio && area(*result_aspect_ratio) <= area(ar))
+                {
+                    return std::nullopt;
+                }
+            }
+
+            {
+                const std::lock_guard<std::mutex> guard{ti_mutex};
+
+                auto& pti               = (*pti_list)[t_num];
+                pti.worker_aspect_ratio = ar;
+                pti.active              = true;
+                pti.pruned              = false;
+            }
+
+            handler->update(ar);
+
+            try
+            {
+                update_timeout(*handler, std::chrono::steady_clock::now() - start);
+
+                const auto solving = pst.profile.time_phase("SMT solving");
+
+                const auto sat =
+                    mockturtle::call_with_stopwatch(tst.time_solving, [&handler] { return handler->is_satisfiable(); });
+
+                ++tst.num_solved_aspect_ratios;
+
+                const auto [conflicts, decisions] = handler->fetch_solver_effort();
+                tst.num_conflicts += conflicts;
+                tst.num_decisions += decisions;
+
+                if (sat)
+                {
+                    auto is_best = false;
+                    {
+                        const std::lock_guard<std::mutex> guard(rar_mutex);
+
+                        if (!result_aspect_ratio || area(*result_aspect_ratio) > area(ar))
+                        {
+                            result_aspect_ratio = ar;
+                            is_best             = true;
+                        }
+                    }
+
+                    if (!is_best)
+                    {
+                        deactivate();
+                        return std::nullopt;
+                    }
+
+                    const std::lock_guard<std::mutex> guard{ti_mutex};
+
+                    (*pti_list)[t_num].active = false;
+
+                    // interrupt other threads that are working on larger aspect ratios
+                    for (auto& pti : *pti_list)
+                    {
+                        if (pti.active && pti.ctx && area(ar) <= area(pti.worker_aspect_ratio))
+                        {
+                            pti.ctx->interrupt();
+                        }
+                    }
+
+                    cancel_if_minimal(*pti_list);
+
+                    return layout;
+                }
+
+                if (handler->is_proven_unsat())
+                {
+                    ++tst.num_unsat;
+                    handler->store_solver_state(ar);
+
+                    if (monotone)
+                    {
+                        unsat_bounds.add_unsat(ar);
+
+                        const std::lock_guard<std::mutex> guard{ti_mutex};
+
+                        // interrupt other threads that are working on aspect ratios that have just been pruned
+                        for (auto i = 0u; i < pti_list->size(); ++i)
+                        {
+                            if (auto& pti = (*pti_list)[i]; i != t_num && pti.active && pti.ctx &&
+                                                             shared_bound_store::dominates(ar, pti.worker_aspect_ratio))
+                            {
+                                pti.pruned = true;
+                                pti.ctx->interrupt();
+                            }
+                        }
+                    }
+
+                    deactivate();
+
+                    continue;
+                }
+            }
+            catch (const z3::exception&)  // timed out or interrupted
+            {}
+
+            // the solver gave up; continue with a fresh context only if this thread was interrupted due to pruning
+            bool pruned = false;
+            {
+                const std::lock_guard<std::mutex> guard{ti_mutex};
+                pruned = (*pti_list)[t_num].pruned;
+            }
+
+            deactivate();
+
+            if (!pruned || portfolio_done)
+            {
+                return std::nullopt;
+            }
+
+            ++tst.num_pruned;
+            reset_handler();
+        }
+
+        return std::nullopt;
+    }
+    /**
+     * Launches params.num_threads threads that act as a solver portfolio and evaluates their return statements.
+     *
+     * @return A placed and routed gate-level layout or std::nullopt in case a timeout or an upper bound was reached.
+     */
+    [[nodiscard]] std::optional<Lyt> run_portfolio()
+    {
+        Lyt layout{{}, scheme};
+
+        pst.thread_stats.assign(ps.num_threads, exact_physical_design_thread_stats{});
+
+        {
+            mockturtle::stopwatch stop{pst.time_total};
+
+            const auto start = std::chrono::steady_clock::now();
+
+            const auto pti_list = std::make_shared<std::vector<portfolio_thread_info>>(ps.num_threads);
+
+            std::vector<std::future<std::optional<Lyt>>> fut(ps.num_threads);
+
+#if (PROGRESS_BARS)
+            mockturtle::progress_bar bar("[i] examining layout aspect ratios using a portfolio of {} threads");
+            bar(ps.num_threads);
+#endif
+
+            for (auto i = 0u; i < ps.num_threads; ++i)
+            {
+                fut[i] = std::async(std::launch::async, &exact_impl::explore_portfolio, this, i, pti_list, start);
+            }
+
+            std::vector<std::optional<Lyt>> results{};
+            results.reserve(ps.num_threads);
+
+            for (auto& f : fut)
+            {
+                results.push_back(f.get());
+            }
+
+            if (result_aspect_ratio)
+            {
+                const auto result_ar_val = *result_aspect_ratio;
+
+                // in case multiple threads returned a layout, get the actual winner
+                for (auto& l : results)
+                {
+                    if (l.has_value() && l->x() == result_ar_val.x && l->y() == result_ar_val.y)
+                    {
+                        layout = std::move(*l);
+                        break;
+                    }
+                }
+            }
+        }
+
+        if (result_aspect_ratio.has_value())
+        {
+            // statistical information
+            pst.x_size        = layout.x() + 1;
+            pst.y_size        = layout.y() + 1;
+            pst.num_gates     = layout.num_gates();
+            pst.num_wires     = layout.num_wires();
+            pst.num_crossings = layout.num_crossings();
+
+            return layout;
+        }
+
+        return std::nullopt;
+    }
     /**
      * Does the same as explore_asynchronously but without thread synchronization overhead.
      *
@@ -3076,8 +3920,15 @@ class exact_impl
             // log the examination of a new aspect ratio
             pst.num_aspect_ratios++;
 
+            if (handler.exceeds_upper_bounds(ar))
+            {
+                pst.num_aspect_ratios_beyond_bounds++;
+                continue;
+            }
+
             if (handler.skippable(ar))
             {
+                pst.num_skipped_aspect_ratios++;
                 continue;
             }
 
@@ -3089,6 +3940,8 @@ class exact_impl
 
             try
             {
+                const auto solving = pst.profile.time_phase("SMT solving");
+
                 const auto sat =
                     mockturtle::call_with_stopwatch(pst.time_total, [&handler] { return handler.is_satisfiable(); });
 
@@ -3141,7 +3994,9 @@ class exact_impl
  * de-synchronization enabled, and 2DDWave clocking given. Multi-threading can sometimes speed up the process,
  * especially for large networks. Note that the more threads are being used, the less information can be shared across
  * the individual solver runs which destroys the benefits of incremental solving and thereby, comparatively, slows down
- * each run.
+ * each run. In portfolio mode (`exact_physical_design_params::portfolio`), the threads additionally use differently
+ * seeded solvers, share aspect ratios proven UNSAT to prune dominated ones, and terminate as soon as a minimal-area
+ * layout has been proven.
  *
  * The SMT instance works with a single layer of variables even though it is possible to allow crossings in the
  * solution. The reduced number of variables saves a considerable amount of runtime. That's why
@@ -3206,15 +4061,25 @@ std::optional<Lyt> exact(const Ntk& ntk, const exact_physical_design_params& ps
         }
     }
 
-    mockturtle::names_view<technology_network> intermediate_ntk{
-        fanout_substitution<mockturtle::names_view<technology_network>>(
-            ntk, {fanout_substitution_params::substitution_strategy::BREADTH, clocking_scheme->max_out_degree, 1ul})};
-
     exact_physical_design_stats st{};
 
-    detail::exact_impl<Lyt> p{intermediate_ntk, ps, st};
+    std::optional<Lyt> result{};
+    {
+        const auto memory = st.profile.track_memory();
+
+        mockturtle::names_view<technology_network> intermediate_ntk{st.profile.call_with_phase_timer(
+            "fanout substitution",
+            [&ntk, &clocking_scheme]
+            {
+                return fanout_substitution<mockturtle::names_view<technology_network>>(
+                    ntk, {fanout_substitution_params::substitution_strategy::BREADTH, clocking_scheme->max_out_degree,
+                          1ul});
+            })};
+
+        detail::exact_impl<Lyt> p{intermediate_ntk, ps, st};
 
-    auto result = p.run();
+        result = p.run();
+    }
 
     if (pst)
     {
@@ -3277,15 +4142,25 @@ std::optional<Lyt> exact_with_blacklist(const Ntk& ntk, const surface_black_list
         }
     }
 
-    mockturtle::names_view<technology_network> intermediate_ntk{
-        fanout_substitution<mockturtle::names_view<technology_network>>(
-            ntk, {fanout_substitution_params::substitution_strategy::BREADTH, clocking_scheme->max_out_degree, 1ul})};
-
     exact_physical_design_stats st{};
 
-    detail::exact_impl<Lyt> p{intermediate_ntk, ps, st, black_list};
+    std::optional<Lyt> result{};
+    {
+        const auto memory = st.profile.track_memory();
 
-    auto result = p.run();
+        mockturtle::names_view<technology_network> intermediate_ntk{st.profile.call_with_phase_timer(
+            "fanout substitution",
+            [&ntk, &clocking_scheme]
+            {
+                return fanout_substitution<mockturtle::names_view<technology_network>>(
+                    ntk, {fanout_substitution_params::substitution_strategy::BREADTH, clocking_scheme->max_out_degree,
+                          1ul});
+            })};
+
+        detail::exact_impl<Lyt> p{intermediate_ntk, ps, st, black_list};
+
+        result = p.run();
+    }
 
     if (pst)
     {
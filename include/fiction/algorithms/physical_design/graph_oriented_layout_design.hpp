@@ -11,11 +11,13 @@
 #include "fiction/algorithms/physical_design/post_layout_optimization.hpp"
 #include "fiction/layouts/bounding_box.hpp"
 #include "fiction/layouts/clocking_scheme.hpp"
+#include "fiction/layouts/gate_level_layout.hpp"
 #include "fiction/layouts/obstruction_layout.hpp"
 #include "fiction/traits.hpp"
 #include "fiction/types.hpp"
 #include "fiction/utils/name_utils.hpp"
 #include "fiction/utils/network_utils.hpp"
+#include "fiction/utils/performance_profile.hpp"
 #include "fiction/utils/placement_utils.hpp"
 #include "fiction/utils/routing_utils.hpp"
 
@@ -25,7 +27,10 @@
 #include <mockturtle/utils/stopwatch.hpp>
 #include <mockturtle/views/fanout_view.hpp>
 #include <mockturtle/views/immutable_view.hpp>
+#include <nlohmann/json.hpp>
+#include <phmap.h>
 
+#include <algorithm>
 #include <array>
 #include <atomic>
 #include <cassert>
@@ -36,13 +41,14 @@
 #include <future>
 #include <iostream>
 #include <limits>
+#include <memory>
 #include <mutex>
 #include <optional>
 #include <queue>
 #include <stdexcept>
 #include <string>
 #include <tuple>
-#include <unordered_map>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
@@ -157,6 +163,20 @@ struct graph_oriented_layout_design_params
      * Default value: `false`
      */
     bool enable_multithreading = false;
+    /**
+     * Number of vertices of each search space graph that are expanded concurrently per step. Whereas
+     * `enable_multithreading` only distributes different search space graphs across threads, this option parallelizes
+     * the search within each graph and thereby also benefits the `HIGH_EFFICIENCY` mode.
+     *
+     * Besides the vertex to be expanded next, the vertices that follow it in the frontier are expanded speculatively.
+     * Such an expansion is only used once its vertex is taken from the frontier and if no solution that changes the
+     * pruning has been found in the meantime. Otherwise, the vertex is expanded again. Unless `enable_multithreading`
+     * is set as well, the search therefore explores the same vertices and returns the same layout as with one
+     * expansion per step.
+     *
+     * Default value: `1`, i.e., vertices are expanded one at a time.
+     */
+    uint64_t num_parallel_expansions = 1u;
     /**
      * Verbosity.
      */
@@ -191,6 +211,11 @@ struct graph_oriented_layout_design_stats
      * Number of crossings.
      */
     uint64_t num_crossings{0ull};
+    /**
+     * Time spent in the initialization and the expansion of the search space graphs as well as the memory usage of the
+     * entire process.
+     */
+    performance_profile profile{};
     /**
      * Reports the statistics to the given output stream.
      *
@@ -203,8 +228,25 @@ struct graph_oriented_layout_design_stats
         out << fmt::format("[i] num. gates      = {}\n", num_gates);
         out << fmt::format("[i] num. wires      = {}\n", num_wires);
         out << fmt::format("[i] num. crossings  = {}\n", num_crossings);
+
+        profile.report(out);
     }
 };
+/**
+ * Converts graph-oriented layout design statistics into JSON.
+ *
+ * @param j JSON value to write to.
+ * @param stats Statistics to convert.
+ */
+inline void to_json(nlohmann::json& j, const graph_oriented_layout_design_stats& stats)
+{
+    j = {{"runtime in seconds", mockturtle::to_seconds(stats.time_total)},
+         {"number of gates", stats.num_gates},
+         {"number of wires", stats.num_wires},
+         {"number of crossings", stats.num_crossings},
+         {"layout", {{"x-size", stats.x_size}, {"y-size", stats.y_size}, {"area", stats.x_size * stats.y_size}}},
+         {"profile", stats.profile}};
+}
 
 namespace detail
 {
@@ -216,31 +258,111 @@ namespace detail
 template <typename Lyt>
 using coord_vec_type = std::vector<tile<Lyt>>;
 /**
- * This struct defines a hash function for a nested vector of layout tiles.
- * It calculates a combined hash value for a vector of tiles based on the coordinates of each tile.
+ * Alias for the routes that connect a placed node to its fan-ins, stored in the order in which they were established.
+ *
+ * @tparam Lyt Cartesian gate-level layout type.
+ */
+template <typename Lyt>
+using placement_routes = std::vector<layout_coordinate_path<Lyt>>;
+/**
+ * A persistent partial layout in a search space graph. Instead of a full layout, each state only stores the delta it
+ * adds to its parent, i.e., the position of one newly placed node and the routes that connect it to its fan-ins. A
+ * partial layout is rebuilt by replaying these deltas along the parent chain, which does not require any path
+ * finding. States are immutable and shared between all vertices that extend them.
+ *
+ * @tparam Lyt Cartesian gate-level layout type.
+ */
+template <typename Lyt>
+struct partial_layout_state
+{
+    /**
+     * The state this one extends or `nullptr` if it places the first node.
+     */
+    std::shared_ptr<const partial_layout_state<Lyt>> parent{};
+    /**
+     * The position of the node placed by this state.
+     */
+    tile<Lyt> position{};
+    /**
+     * The routes connecting the placed node to its fan-ins.
+     */
+    placement_routes<Lyt> routes{};
+};
+/**
+ * Computes the Zobrist key for placing the `index`-th node of a placement sequence at the given position. Instead of a
+ * table of random numbers whose size would depend on the layout dimensions, keys are derived by passing the index and
+ * the position through the SplitMix64 finalizer. The hash of a placement sequence is the XOR of the keys of all its
+ * elements and can thus be extended in constant time.
+ *
+ * @tparam Lyt Cartesian gate-level layout type.
+ * @param index The index of the placed node in the placement sequence.
+ * @param position The position of the placed node.
+ * @return The Zobrist key of the placement.
+ */
+template <typename Lyt>
+[[nodiscard]] uint64_t placement_zobrist_key(const uint64_t index, const tile<Lyt>& position) noexcept
+{
+    const auto mix = [](uint64_t z) noexcept
+    {
+        z = (z ^ (z >> 30u)) * 0xbf58476d1ce4e5b9ull;
+        z = (z ^ (z >> 27u)) * 0x94d049bb133111ebull;
+
+        return z ^ (z >> 31u);
+    };
+
+    auto key = mix(index + 0x9e3779b97f4a7c15ull);
+    key      = mix(key ^ static_cast<uint64_t>(position.x));
+    key      = mix(key ^ static_cast<uint64_t>(position.y));
+
+    return mix(key ^ static_cast<uint64_t>(position.z));
+}
+/**
+ * A vertex in a search space graph, representing a sequence of node placements. The vertex refers to the partial
+ * layout that its predecessors have established and stores only the position of its own node. Its routes are
+ * determined when the vertex is expanded.
  *
  * @tparam Lyt Cartesian gate-level layout type.
  */
 template <typename Lyt>
-struct nested_vector_hash
+struct search_vertex
 {
     /**
-     * Computes a hash value for a vector of `tile` objects.
+     * The partial layout this vertex extends or `nullptr` if it is the root vertex or one of its direct successors.
+     */
+    std::shared_ptr<const partial_layout_state<Lyt>> parent{};
+    /**
+     * The position of the node placed by this vertex. Meaningless for the root vertex.
+     */
+    tile<Lyt> position{};
+    /**
+     * The number of placed nodes, i.e., the length of the placement sequence.
+     */
+    uint64_t size = 0ul;
+    /**
+     * Zobrist hash of the placement sequence (see `placement_zobrist_key`). Two distinct sequences share a hash with a
+     * probability of about 2^-64, which is negligible for a heuristic search.
+     */
+    uint64_t hash = 0ul;
+    /**
+     * Checks if the vertex is the root vertex, i.e., if no node has been placed yet.
      *
-     * @param vec The vector of tiles to be hashed.
-     * @return A combined hash value for the vector of tiles.
+     * @return `true` iff the placement sequence is empty.
      */
-    std::size_t operator()(const coord_vec_type<Lyt>& vec) const
+    [[nodiscard]] bool empty() const noexcept
     {
-        std::size_t       hash  = 0ul;
-        const std::size_t prime = 0x9e3779b9;
-        for (const auto& tile : vec)
-        {
-            hash ^= std::hash<uint64_t>{}(tile.x) + prime + (hash << 6u) + (hash >> 2u);
-            hash ^= std::hash<uint64_t>{}(tile.y) + prime + (hash << 6u) + (hash >> 2u);
-            hash ^= std::hash<uint64_t>{}(tile.z) + prime + (hash << 6u) + (hash >> 2u);
-        }
-        return hash;
+        return size == 0ul;
+    }
+    /**
+     * Creates the successor vertex that places the next node at the given position.
+     *
+     * @param state The partial layout established by this vertex or `nullptr` if this is the root vertex.
+     * @param next The position of the next node.
+     * @return The successor vertex.
+     */
+    [[nodiscard]] search_vertex successor(std::shared_ptr<const partial_layout_state<Lyt>> state,
+                                          const tile<Lyt>&                                 next) const noexcept
+    {
+        return {std::move(state), next, size + 1, hash ^ placement_zobrist_key<Lyt>(size, next)};
     }
 };
 /**
@@ -269,7 +391,7 @@ class priority_queue
      * @param item The element to be added.
      * @param priority The priority of the element.
      */
-    void put(const coord_vec_type<Lyt>& item, double priority)
+    void put(const search_vertex<Lyt>& item, double priority)
     {
         elements.emplace(priority, counter++, item);
     }
@@ -278,12 +400,42 @@ class priority_queue
      *
      * @return The element with the highest priority.
      */
-    coord_vec_type<Lyt> get()
+    search_vertex<Lyt> get()
     {
-        coord_vec_type<Lyt> item = std::get<2>(elements.top());
+        search_vertex<Lyt> item = std::get<2>(elements.top());
         elements.pop();
         return item;
     }
+    /**
+     * Returns the elements with the highest priorities in the order in which they would be retrieved without removing
+     * them from the queue.
+     *
+     * @param n Maximum number of elements to return.
+     * @return Up to `n` elements with the highest priorities.
+     */
+    [[nodiscard]] std::vector<search_vertex<Lyt>> peek(const std::size_t n)
+    {
+        std::vector<queue_element> top_elements{};
+        top_elements.reserve(n);
+
+        while (!elements.empty() && top_elements.size() < n)
+        {
+            top_elements.push_back(elements.top());
+            elements.pop();
+        }
+
+        std::vector<search_vertex<Lyt>> items{};
+        items.reserve(top_elements.size());
+
+        // re-insert the elements with their original counters, which preserves the order of the queue
+        for (auto& element : top_elements)
+        {
+            items.push_back(std::get<2>(element));
+            elements.push(std::move(element));
+        }
+
+        return items;
+    }
 
   private:
     /**
@@ -293,11 +445,52 @@ class priority_queue
     /**
      * Tuple containing the priority, counter, and element.
      */
-    using queue_element = std::tuple<double, std::size_t, coord_vec_type<Lyt>>;
+    using queue_element = std::tuple<double, std::size_t, search_vertex<Lyt>>;
+    /**
+     * Orders elements by priority first and insertion order second. Since the counter is unique, the vertices
+     * themselves never need to be compared.
+     */
+    struct greater_element
+    {
+        bool operator()(const queue_element& lhs, const queue_element& rhs) const noexcept
+        {
+            return std::tie(std::get<0>(lhs), std::get<1>(lhs)) > std::tie(std::get<0>(rhs), std::get<1>(rhs));
+        }
+    };
     /**
      * Priority queue containing elements with associated priorities.
      */
-    std::priority_queue<queue_element, std::vector<queue_element>, std::greater<queue_element>> elements;
+    std::priority_queue<queue_element, std::vector<queue_element>, greater_element> elements;
+};
+/**
+ * The result of expanding a vertex of a search space graph.
+ *
+ * @tparam Lyt Cartesian gate-level layout type.
+ */
+template <typename Lyt>
+struct vertex_expansion
+{
+    /**
+     * The successor vertices with their priorities.
+     */
+    std::vector<std::pair<search_vertex<Lyt>, double>> successors{};
+    /**
+     * The layout after relocating its POs if the vertex completes the placement and does not exceed `bound`.
+     */
+    std::optional<Lyt> solution{};
+    /**
+     * Cost of `solution` w.r.t. the cost objective of the search space graph before relocating its POs.
+     */
+    uint64_t cost{0ul};
+    /**
+     * Cost of `solution` w.r.t. the desired cost objective after relocating its POs.
+     */
+    uint64_t optimized_cost{0ul};
+    /**
+     * Cost of the best solution that was known for the cost objective of the search space graph when the vertex was
+     * expanded. Partial layouts whose costs reach it are pruned.
+     */
+    uint64_t bound{std::numeric_limits<uint64_t>::max()};
 };
 /**
  * Alias for a dictionary that maps nodes from a mockturtle network to signals in a layout.
@@ -341,7 +534,7 @@ struct search_space_graph
     /**
      * The current vertex in the search space graph.
      */
-    coord_vec_type<Lyt> current_vertex{};
+    search_vertex<Lyt> current_vertex{};
     /**
      * The network associated with this search space graph.
      */
@@ -359,9 +552,9 @@ struct search_space_graph
      */
     bool frontier_flag = true;
     /**
-     * The cost so far for reaching each vertex in the layout.
+     * The cost so far for reaching each vertex, keyed by the Zobrist hash of its placement sequence.
      */
-    std::unordered_map<coord_vec_type<Lyt>, double, detail::nested_vector_hash<Lyt>> cost_so_far{};
+    phmap::flat_hash_map<uint64_t, double> cost_so_far{};
     /**
      * The maximum number of positions to be considered for expansions.
      */
@@ -370,6 +563,11 @@ struct search_space_graph
      * Priority queue containing vertices of the search space graph.
      */
     detail::priority_queue<Lyt> frontier{};
+    /**
+     * Speculative expansions of the vertices that follow the current one in the frontier, keyed by the Zobrist hash of
+     * their placement sequences.
+     */
+    phmap::flat_hash_map<uint64_t, vertex_expansion<Lyt>> speculative_expansions{};
     /**
      * Create planar layouts.
      */
@@ -416,7 +614,7 @@ class topo_view_co_to_ci : public mockturtle::immutable_view<Ntk>
     /*! \brief Reimplementation of `node_to_index`. */
     [[nodiscard]] uint32_t node_to_index(const node& n) const
     {
-        return std::distance(std::cbegin(topo_order), std::find(std::cbegin(topo_order), std::cend(topo_order), n));
+        return topo_index[Ntk::node_to_index(n)];
     }
     /*! \brief Reimplementation of `index_to_node`. */
     [[nodiscard]] node index_to_node(const uint32_t index) const
@@ -449,7 +647,8 @@ class topo_view_co_to_ci : public mockturtle::immutable_view<Ntk>
     {
         this->incr_trav_id();
         this->incr_trav_id();
-        topo_order.reserve(this->size());
+        topo_order.clear();
+        topo_order.reserve(Ntk::size());
 
         /* constants and PIs */
         const auto c0 = this->get_node(this->get_constant(false));
@@ -463,6 +662,8 @@ class topo_view_co_to_ci : public mockturtle::immutable_view<Ntk>
         }
 
         Ntk::foreach_co([this](auto f) { create_topo_rec(this->get_node(f)); });
+
+        update_topo_index();
     }
 
   private:
@@ -490,7 +691,20 @@ class topo_view_co_to_ci : public mockturtle::immutable_view<Ntk>
         topo_order.push_back(n);
     }
 
-    std::vector<node> topo_order;
+    /*! \brief Maps each node to its position in `topo_order`. Nodes that are not part of the order are mapped to its
+     * size. */
+    void update_topo_index()
+    {
+        topo_index.assign(Ntk::size(), static_cast<uint32_t>(topo_order.size()));
+
+        for (uint32_t i = 0u; i < topo_order.size(); ++i)
+        {
+            topo_index[Ntk::node_to_index(topo_order[i])] = i;
+        }
+    }
+
+    std::vector<node>     topo_order;
+    std::vector<uint32_t> topo_index;
 };
 /**
  * @brief Custom view class derived from mockturtle::topo_view.
@@ -528,7 +742,7 @@ class topo_view_ci_to_co : public mockturtle::immutable_view<Ntk>
     /*! \brief Reimplementation of `node_to_index`. */
     [[nodiscard]] uint32_t node_to_index(const node& n) const
     {
-        return std::distance(std::cbegin(topo_order), std::find(std::cbegin(topo_order), std::cend(topo_order), n));
+        return topo_index[Ntk::node_to_index(n)];
     }
     /*! \brief Reimplementation of `index_to_node`. */
     [[nodiscard]] node index_to_node(const uint32_t index) const
@@ -562,7 +776,8 @@ class topo_view_ci_to_co : public mockturtle::immutable_view<Ntk>
     {
         this->incr_trav_id();
         this->incr_trav_id();
-        topo_order.reserve(this->size());
+        topo_order.clear();
+        topo_order.reserve(Ntk::size());
 
         /* constants and PIs */
         const auto c0 = this->get_node(this->get_constant(false));
@@ -576,6 +791,8 @@ class topo_view_ci_to_co : public mockturtle::immutable_view<Ntk>
         }
 
         Ntk::foreach_ci([this](const auto& n) { create_topo_rec(n); });
+
+        update_topo_index();
     }
 
   private:
@@ -613,7 +830,20 @@ class topo_view_ci_to_co : public mockturtle::immutable_view<Ntk>
         this->foreach_fanout(n, [this](const auto& fo) { create_topo_rec(fo); });
     }
 
-    std::vector<node> topo_order;
+    /*! \brief Maps each node to its position in `topo_order`. Nodes that are not part of the order are mapped to its
+     * size. */
+    void update_topo_index()
+    {
+        topo_index.assign(Ntk::size(), static_cast<uint32_t>(topo_order.size()));
+
+        for (uint32_t i = 0u; i < topo_order.size(); ++i)
+        {
+            topo_index[Ntk::node_to_index(topo_order[i])] = i;
+        }
+    }
+
+    std::vector<node>     topo_order;
+    std::vector<uint32_t> topo_index;
 };
 /**
  * When checking for possible paths on a layout between two tiles SRC and DEST, one of them could also be the new tile
@@ -707,10 +937,10 @@ class graph_oriented_layout_design_impl
         ssg_vec.resize(num_search_space_graphs);
 
         // initialize layout to keep track of current best solution
-        Lyt best_lyt{{}, twoddwave_clocking<Lyt>()};
+        DesignLyt best_lyt{{}, twoddwave_clocking<DesignLyt>()};
 
         // initialize search space graphs
-        initialize();
+        pst.profile.call_with_phase_timer("initialization", [this] { initialize(); });
 
         // check if a timeout was set
         const bool timeout_set = (timeout != std::numeric_limits<uint64_t>::max());
@@ -724,19 +954,21 @@ class graph_oriented_layout_design_impl
         // main loop
         while (!timeout_limit_reached)
         {
+            const auto expansion = pst.profile.time_phase("search space expansion");
+
             // if multithreading is enabled
             if (ps.enable_multithreading)
             {
                 // mutex to protect the best found layout and statistics
                 std::mutex                                   update_best_layout_mutex{};
-                std::vector<std::future<std::optional<Lyt>>> futures{};
+                std::vector<std::future<std::optional<DesignLyt>>> futures{};
                 futures.reserve(ssg_vec.size());
 
                 // process `ssg_vec` in parallel using std::async
                 for (auto& ssg : ssg_vec)
                 {
                     futures.emplace_back(std::async(std::launch::async,
-                                                    [&]() -> std::optional<Lyt>
+                                                    [&]() -> std::optional<DesignLyt>
                                                     {
                                                         auto result = process_ssg(ssg);
                                                         if (result)
@@ -747,6 +979,11 @@ class graph_oriented_layout_design_impl
                                                             restore_names(ssg.network, best_lyt);
                                                             update_stats(best_lyt);
 
+                                                            if (ps.verbose)
+                                                            {
+                                                                print_placement_info(best_lyt);
+                                                            }
+
                                                             if (ps.return_first)
                                                             {
                                                                 return best_lyt;
@@ -762,7 +999,7 @@ class graph_oriented_layout_design_impl
                     const auto result = future.get();  // blocking wait to get the result from the future
                     if (result)
                     {
-                        return *result;  // return the first found layout if ps.return_first is true
+                        return to_layout(*result);  // return the first found layout if ps.return_first is true
                     }
                 }
             }
@@ -778,15 +1015,20 @@ class graph_oriented_layout_design_impl
                         restore_names(ssg.network, best_lyt);
                         update_stats(best_lyt);
 
+                        if (ps.verbose)
+                        {
+                            print_placement_info(best_lyt);
+                        }
+
                         if (ps.return_first)
                         {
-                            return *result;
+                            return to_layout(*result);
                         }
                     }
                 }
             }
 
-            // update current_vertex and frontier_flag (non-parallel for now)
+            // update current_vertex and frontier_flag
             for (auto& ssg : ssg_vec)
             {
                 if (ssg.frontier_flag)
@@ -814,8 +1056,7 @@ class graph_oriented_layout_design_impl
             {
                 // terminate the algorithm if the specified timeout was set or a solution was found in low-effort mode
                 if ((ps.mode == graph_oriented_layout_design_params::effort_mode::HIGH_EFFICIENCY &&
-                     (improve_area_solution || improve_wire_solution || improve_crossing_solution ||
-                      improve_acp_solution || improve_custom_solution)) ||
+                     solution_found()) ||
                     timeout_set)
                 {
                     timeout_limit_reached = true;
@@ -824,19 +1065,23 @@ class graph_oriented_layout_design_impl
         }
 
         // check if any layout was found
-        if (improve_area_solution || improve_wire_solution || improve_crossing_solution || improve_acp_solution ||
-            improve_custom_solution)
+        if (solution_found())
         {
-            return best_lyt;
+            return to_layout(best_lyt);
         }
         return std::nullopt;
     }
 
   private:
     /**
-     * Alias for an obstruction layout based on the given layout type.
+     * Layout type that is used during the search. It equals `Lyt` but maps tiles to nodes via `dense_tile_storage` if
+     * possible because partial layouts are small, densely populated, and queried extensively during routing.
      */
-    using ObstrLyt = obstruction_layout<Lyt>;
+    using DesignLyt = with_tile_storage_t<Lyt, dense_tile_storage>;
+    /**
+     * Alias for an obstruction layout based on the design layout type.
+     */
+    using ObstrLyt = obstruction_layout<DesignLyt>;
     /**
      * The network to be placed and routed.
      */
@@ -906,33 +1151,6 @@ class graph_oriented_layout_design_impl
      * Current best solution w.r.t. area after relocating POs.
      */
     std::atomic<uint64_t> best_optimized_solution{std::numeric_limits<uint64_t>::max()};
-    /**
-     * Flag indicating that an initial solution has been found with the layout area as cost objective.
-     * When set to `true`, subsequent search space graphs with the layout area as cost objective can be pruned.
-     */
-    std::atomic<bool> improve_area_solution = false;
-    /**
-     * Flag indicating that an initial solution has been found with the number of wire segments as cost objective.
-     * When set to `true`, subsequent search space graphs with the number of wire segments as cost objective can be
-     * pruned.
-     */
-    std::atomic<bool> improve_wire_solution = false;
-    /**
-     * Flag indicating that an initial solution has been found with the number of crossings as cost objective.
-     * When set to `true`, subsequent search space graphs with the number of crossings as cost objective can be pruned.
-     */
-    std::atomic<bool> improve_crossing_solution = false;
-    /**
-     * Flag indicating that an initial solution has been found with the area-crossings product as cost objective.
-     * When set to `true`, subsequent search space graphs with the area-crossing product as cost objective can be
-     * pruned.
-     */
-    std::atomic<bool> improve_acp_solution = false;
-    /**
-     * Flag indicating that an initial solution has been found with a custom cost objective.
-     * When set to `true`, subsequent search space graphs with a custom cost objective can be pruned.
-     */
-    std::atomic<bool> improve_custom_solution = false;
     /**
      * In high-efficiency mode, only 2 search space graphs are used
      */
@@ -974,12 +1192,80 @@ class graph_oriented_layout_design_impl
                    num_search_space_graphs_high_effort :
                    num_search_space_graphs_high_efficiency;
     }
+    /**
+     * Returns the cost of the best solution found so far w.r.t. the given cost objective.
+     *
+     * @param cost_objective The cost objective.
+     * @return Reference to the cost of the best solution, which is the maximum possible value as long as no solution
+     * has been found.
+     */
+    [[nodiscard]] std::atomic<uint64_t>&
+    best_solution(const graph_oriented_layout_design_params::cost_objective cost_objective) noexcept
+    {
+        switch (cost_objective)
+        {
+            case graph_oriented_layout_design_params::cost_objective::AREA:
+            {
+                return best_area_solution;
+            }
+            case graph_oriented_layout_design_params::cost_objective::WIRES:
+            {
+                return best_wire_solution;
+            }
+            case graph_oriented_layout_design_params::cost_objective::CROSSINGS:
+            {
+                return best_crossing_solution;
+            }
+            case graph_oriented_layout_design_params::cost_objective::ACP:
+            {
+                return best_acp_solution;
+            }
+            default:
+            {
+                return best_custom_solution;
+            }
+        }
+    }
+    /**
+     * Checks if a solution has been found w.r.t. any cost objective.
+     *
+     * @return `true` iff a solution has been found.
+     */
+    [[nodiscard]] bool solution_found() const noexcept
+    {
+        constexpr auto none = std::numeric_limits<uint64_t>::max();
+
+        return best_area_solution != none || best_wire_solution != none || best_crossing_solution != none ||
+               best_acp_solution != none || best_custom_solution != none;
+    }
+    /**
+     * Atomically replaces the given value by the candidate if the candidate is smaller. Search space graphs that are
+     * processed concurrently may publish their solutions at the same time.
+     *
+     * @param value The value to update.
+     * @param candidate The candidate value.
+     * @return `true` iff `value` was replaced.
+     */
+    static bool fetch_min(std::atomic<uint64_t>& value, const uint64_t candidate) noexcept
+    {
+        auto current = value.load();
+
+        while (candidate < current)
+        {
+            if (value.compare_exchange_weak(current, candidate))
+            {
+                return true;
+            }
+        }
+
+        return false;
+    }
     /**
      * This function updates statistical metrics.
      *
      * @param best_lyt The new best layout found.
      */
-    void update_stats(const Lyt& best_lyt)
+    void update_stats(const DesignLyt& best_lyt)
     {
         // Statistical information
         pst.x_size        = best_lyt.x() + 1;
@@ -988,6 +1274,23 @@ class graph_oriented_layout_design_impl
         pst.num_wires     = best_lyt.num_wires();
         pst.num_crossings = best_lyt.num_crossings();
     }
+    /**
+     * Converts a layout of the type used during the search into the requested layout type.
+     *
+     * @param lyt Layout found during the search.
+     * @return `lyt` as a layout of type `Lyt`.
+     */
+    [[nodiscard]] static Lyt to_layout(const DesignLyt& lyt)
+    {
+        if constexpr (std::is_same_v<DesignLyt, Lyt>)
+        {
+            return lyt;
+        }
+        else
+        {
+            return Lyt{lyt};
+        }
+    }
     /**
      * Checks if there is a path between the source and destination tiles in the given layout.
      *
@@ -1012,7 +1315,7 @@ class graph_oriented_layout_design_impl
             using dist = twoddwave_distance_functor<ObstrLyt, uint64_t>;
             using cost = unit_cost_functor<ObstrLyt, uint8_t>;
 
-            static a_star_params a_star_crossing_params{};
+            a_star_params a_star_crossing_params{};
             a_star_crossing_params.crossings = !planar;
 
             return a_star<layout_coordinate_path<ObstrLyt>>(layout, {src, dest}, dist(), cost(),
@@ -1384,24 +1687,26 @@ class graph_oriented_layout_design_impl
         return true;
     }
     /**
-     * Places a node with a single input in the layout and routes it.
+     * Routes a node with a single input that has already been placed in the layout.
      *
      * @param position The tile representing the position for placement.
      * @param layout The layout in which to place the node.
      * @param node2pos A dictionary mapping nodes from the network to signals in the layout.
      * @param fc A vector of nodes that precede the single fanin node.
      * @param planar Only consider crossing-free paths.
+     * @return The established route.
      */
-    void route_single_input_node(const tile<ObstrLyt>& position, ObstrLyt& layout,
-                                 node_dict_type<ObstrLyt, tec_nt>& node2pos, const fanin_container<tec_nt>& fc,
-                                 const bool planar = false) noexcept
+    placement_routes<ObstrLyt> route_single_input_node(const tile<ObstrLyt>& position, ObstrLyt& layout,
+                                                       node_dict_type<ObstrLyt, tec_nt>& node2pos,
+                                                       const fanin_container<tec_nt>&    fc,
+                                                       const bool                        planar = false) noexcept
     {
         const auto& pre   = fc.fanin_nodes[0];
         const auto  pre_t = static_cast<tile<ObstrLyt>>(node2pos[pre]);
 
         layout.move_node(layout.get_node(position), position, {});
 
-        const auto path = check_path(layout, pre_t, position, new_gate_location::NONE, planar);
+        auto path = check_path(layout, pre_t, position, new_gate_location::NONE, planar);
         assert(!path.empty());
 
         route_path(layout, path);
@@ -1410,19 +1715,23 @@ class graph_oriented_layout_design_impl
         {
             layout.obstruct_coordinate(el);
         }
+
+        return {std::move(path)};
     }
     /**
-     * Places a node with two inputs in the layout and routes it.
+     * Routes a node with two inputs that has already been placed in the layout.
      *
      * @param position The tile representing the position for placement.
      * @param layout The layout in which to place the node.
      * @param node2pos A dictionary mapping nodes from the network to signals in the layout.
      * @param fc A vector of nodes that precede the double fanin node.
      * @param planar Only consider crossing-free paths.
+     * @return The established routes from the first and the second fan-in.
      */
-    void route_double_input_node(const tile<ObstrLyt>& position, ObstrLyt& layout,
-                                 node_dict_type<ObstrLyt, tec_nt>& node2pos, const fanin_container<tec_nt>& fc,
-                                 const bool planar = false) noexcept
+    placement_routes<ObstrLyt> route_double_input_node(const tile<ObstrLyt>& position, ObstrLyt& layout,
+                                                       node_dict_type<ObstrLyt, tec_nt>& node2pos,
+                                                       const fanin_container<tec_nt>&    fc,
+                                                       const bool                        planar = false) noexcept
     {
         const auto& pre1 = fc.fanin_nodes[0];
         const auto& pre2 = fc.fanin_nodes[1];
@@ -1432,7 +1741,7 @@ class graph_oriented_layout_design_impl
 
         layout.move_node(layout.get_node(position), position, {});
 
-        const auto path_1 = check_path(layout, pre1_t, position, new_gate_location::NONE, planar);
+        auto path_1 = check_path(layout, pre1_t, position, new_gate_location::NONE, planar);
         assert(!path_1.empty());
 
         for (const auto& el : path_1)
@@ -1440,7 +1749,7 @@ class graph_oriented_layout_design_impl
             layout.obstruct_coordinate(el);
         }
 
-        const auto path_2 = check_path(layout, pre2_t, position, new_gate_location::NONE, planar);
+        auto path_2 = check_path(layout, pre2_t, position, new_gate_location::NONE, planar);
         assert(!path_2.empty());
 
         for (const auto& el : path_2)
@@ -1450,23 +1759,25 @@ class graph_oriented_layout_design_impl
 
         route_path(layout, path_1);
         route_path(layout, path_2);
+
+        return {std::move(path_1), std::move(path_2)};
     }
     /**
-     * Executes a single placement step in the layout for the given network node. It determines the type of the node,
-     * places it accordingly, and checks if a solution was found.
+     * Places the current network node at the given position without routing it.
      *
      * @param position The tile representing the position for placement.
      * @param layout The layout in which to place the node.
      * @param place_info The placement context containing current node, primary output index, node to position mapping,
      * and PI to node mapping.
      * @param ssg The search space graph.
-     * @return A boolean indicating if a solution was found.
+     * @return The fan-ins of the placed node.
      */
-    [[nodiscard]] bool place_and_route(const tile<ObstrLyt>& position, ObstrLyt& layout,
-                                       search_space_graph<ObstrLyt>& ssg, placement_info<ObstrLyt>& place_info) noexcept
+    fanin_container<tec_nt> place_node(const tile<ObstrLyt>& position, ObstrLyt& layout,
+                                       const search_space_graph<ObstrLyt>& ssg,
+                                       placement_info<ObstrLyt>&           place_info) noexcept
     {
         // vector to store preceding nodes
-        const auto fc = fanins(ssg.network, ssg.nodes_to_place[place_info.current_node]);
+        auto fc = fanins(ssg.network, ssg.nodes_to_place[place_info.current_node]);
 
         if (ssg.network.is_pi(ssg.nodes_to_place[place_info.current_node]))
         {
@@ -1492,8 +1803,6 @@ class graph_oriented_layout_design_impl
                 place_info.node2pos[ssg.nodes_to_place[place_info.current_node]] =
                     place(layout, position, ssg.network, ssg.nodes_to_place[place_info.current_node], a);
             }
-
-            route_single_input_node(position, layout, place_info.node2pos, fc, ssg.planar);
         }
         else
         {
@@ -1506,10 +1815,24 @@ class graph_oriented_layout_design_impl
 
             place_info.node2pos[ssg.nodes_to_place[place_info.current_node]] = place(
                 layout, position, ssg.network, ssg.nodes_to_place[place_info.current_node], a1, a2, fc.constant_fanin);
-
-            route_double_input_node(position, layout, place_info.node2pos, fc, ssg.planar);
         }
 
+        return fc;
+    }
+    /**
+     * Finalizes a placement step by obstructing the position of the placed node and advancing to the next node.
+     *
+     * @param position The tile representing the position of the placed node.
+     * @param layout The layout in which the node was placed.
+     * @param place_info The placement context containing current node, primary output index, node to position mapping,
+     * and PI to node mapping.
+     * @param ssg The search space graph.
+     * @return A boolean indicating if a solution was found.
+     */
+    [[nodiscard]] bool complete_placement(const tile<ObstrLyt>& position, ObstrLyt& layout,
+                                          const search_space_graph<ObstrLyt>& ssg,
+                                          placement_info<ObstrLyt>&           place_info) noexcept
+    {
         place_info.current_node++;
         layout.obstruct_coordinate({position.x, position.y, 0});
         layout.obstruct_coordinate({position.x, position.y, 1});
@@ -1523,13 +1846,76 @@ class graph_oriented_layout_design_impl
 
         return found_solution;
     }
+    /**
+     * Executes a single placement step in the layout for the given network node. It determines the type of the node,
+     * places it accordingly, routes it via A*, and checks if a solution was found.
+     *
+     * @param position The tile representing the position for placement.
+     * @param layout The layout in which to place the node.
+     * @param place_info The placement context containing current node, primary output index, node to position mapping,
+     * and PI to node mapping.
+     * @param ssg The search space graph.
+     * @param routes Receives the routes established for the placed node.
+     * @return A boolean indicating if a solution was found.
+     */
+    [[nodiscard]] bool place_and_route(const tile<ObstrLyt>& position, ObstrLyt& layout,
+                                       const search_space_graph<ObstrLyt>& ssg, placement_info<ObstrLyt>& place_info,
+                                       placement_routes<ObstrLyt>& routes) noexcept
+    {
+        const auto fc = place_node(position, layout, ssg, place_info);
+
+        if (!ssg.network.is_pi(ssg.nodes_to_place[place_info.current_node]))
+        {
+            routes = (fc.fanin_nodes.size() == 1) ?
+                         route_single_input_node(position, layout, place_info.node2pos, fc, ssg.planar) :
+                         route_double_input_node(position, layout, place_info.node2pos, fc, ssg.planar);
+        }
+
+        return complete_placement(position, layout, ssg, place_info);
+    }
+    /**
+     * Repeats a placement step that has been executed by `place_and_route` before on an identical partial layout. The
+     * recorded routes are re-established directly, i.e., without path finding.
+     *
+     * @param state The partial layout state that recorded the placement step.
+     * @param layout The layout in which to place the node.
+     * @param place_info The placement context containing current node, primary output index, node to position mapping,
+     * and PI to node mapping.
+     * @param ssg The search space graph.
+     * @return A boolean indicating if a solution was found.
+     */
+    [[nodiscard]] bool replay_placement(const partial_layout_state<ObstrLyt>& state, ObstrLyt& layout,
+                                        const search_space_graph<ObstrLyt>& ssg,
+                                        placement_info<ObstrLyt>&           place_info) noexcept
+    {
+        static_cast<void>(place_node(state.position, layout, ssg, place_info));
+
+        if (!state.routes.empty())
+        {
+            layout.move_node(layout.get_node(state.position), state.position, {});
+
+            for (const auto& path : state.routes)
+            {
+                for (const auto& el : path)
+                {
+                    layout.obstruct_coordinate(el);
+                }
+            }
+            for (const auto& path : state.routes)
+            {
+                route_path(layout, path);
+            }
+        }
+
+        return complete_placement(state.position, layout, ssg, place_info);
+    }
     /**
      * Outputs placement information, including the current runtime, the number of evaluated paths in the search space
      * graphs and the layout dimensions.
      *
      * @param lyt Current layout.
      */
-    void print_placement_info(const ObstrLyt& lyt) const
+    void print_placement_info(const DesignLyt& lyt) const
     {
         std::cout << "\n[i] Found improved solution:\n";
 
@@ -1559,8 +1945,8 @@ class graph_oriented_layout_design_impl
     ObstrLyt initialize_layout(uint64_t min_layout_width, const bool planar = false)
     {
         const auto layout_depth = planar ? 0 : 1;
-        Lyt        lyt{{min_layout_width - 1, 0, layout_depth}, twoddwave_clocking<Lyt>()};
-        return obstruction_layout<Lyt>(lyt);
+        DesignLyt  lyt{{min_layout_width - 1, 0, layout_depth}, twoddwave_clocking<DesignLyt>()};
+        return obstruction_layout<DesignLyt>(lyt);
     }
     /**
      * Adjusts the layout size based on the last position.
@@ -1587,7 +1973,8 @@ class graph_oriented_layout_design_impl
             layout.resize({layout.x(), layout.y() + 1, layout.z()});
         }
     }
-    std::uint64_t calculate_cost(const Lyt& layout, graph_oriented_layout_design_params::cost_objective cost_function)
+    std::uint64_t calculate_cost(const DesignLyt&                                    layout,
+                                 graph_oriented_layout_design_params::cost_objective cost_function)
     {
         uint64_t cost = 0;
         if (cost_function == graph_oriented_layout_design_params::cost_objective::AREA)
@@ -1611,7 +1998,8 @@ class graph_oriented_layout_design_impl
         }
         else if (cost_function == graph_oriented_layout_design_params::cost_objective::CUSTOM)
         {
-            cost = custom_cost_objective(layout);
+            // the custom cost objective is defined on the requested layout type
+            cost = custom_cost_objective(to_layout(layout));
         }
         return cost;
     }
@@ -1621,22 +2009,32 @@ class graph_oriented_layout_design_impl
      * @param possible_positions A vector of possible positions to be considered.
      * @param layout The layout to be used.
      * @param ssg The search space graph.
-     * @return A pair containing the next positions with their priorities and an optional layout.
+     * @param vertex The vertex that is expanded.
+     * @param state The partial layout established by `vertex` or `nullptr` if it is the root vertex.
+     * @return The next positions with their priorities.
      */
-    std::pair<std::vector<std::pair<coord_vec_type<ObstrLyt>, double>>, std::optional<ObstrLyt>>
+    std::vector<std::pair<search_vertex<ObstrLyt>, double>>
     generate_next_positions(const coord_vec_type<ObstrLyt>& possible_positions, ObstrLyt& layout,
-                            const search_space_graph<ObstrLyt>& ssg)
+                            const search_space_graph<ObstrLyt>&                          ssg,
+                            const search_vertex<ObstrLyt>&                               vertex,
+                            const std::shared_ptr<const partial_layout_state<ObstrLyt>>& state)
     {
-        std::vector<std::pair<coord_vec_type<ObstrLyt>, double>> next_positions;
+        std::vector<std::pair<search_vertex<ObstrLyt>, double>> next_positions;
         next_positions.reserve(2 * ssg.num_expansions);
 
+        // apart from the layout area, the cost does not depend on the position and thus only needs to be computed once
+        const double normalized_cost =
+            ssg.cost == graph_oriented_layout_design_params::cost_objective::AREA ?
+                0.0 :
+                static_cast<double>(calculate_cost(layout, ssg.cost)) /
+                    static_cast<double>(1000 * ssg.nodes_to_place.size());
+
         for (const auto& position : possible_positions)
         {
-            auto new_sequence = ssg.current_vertex;
-            new_sequence.push_back(position);
+            auto new_sequence = vertex.successor(state, position);
 
             const auto remaining_nodes_to_place =
-                static_cast<double>(ssg.nodes_to_place.size() - (ssg.current_vertex.size() + 1));
+                static_cast<double>(ssg.nodes_to_place.size() - (vertex.size + 1));
 
             if (ssg.cost == graph_oriented_layout_design_params::cost_objective::AREA)
             {
@@ -1655,33 +2053,42 @@ class graph_oriented_layout_design_impl
             }
             else
             {
-                const double cost = static_cast<double>(calculate_cost(layout, ssg.cost)) /
-                                    static_cast<double>(1000 * ssg.nodes_to_place.size());
-
-                double priority = remaining_nodes_to_place + cost;
+                double priority = remaining_nodes_to_place + normalized_cost;
 
                 next_positions.push_back({new_sequence, priority});
             }
         }
 
-        return {next_positions, std::nullopt};
+        return next_positions;
     }
     /**
-     * Computes possible expansions and their priorities for the current vertex in the search space graph.
+     * Computes possible expansions and their priorities for the given vertex in the search space graph.
      * It handles placement of nodes, checks for valid paths, and finds potential next positions based on priorities.
+     * The partial layout of the predecessors is rebuilt from their recorded routes, so only the node placed by the
+     * given vertex is routed via A*. The resulting partial layout state is shared by all generated successors.
+     *
+     * Since neither the search space graph, the partial layout states, nor the best solutions are modified, the result
+     * only depends on the vertex and the given bound. Several vertices of the same search space graph can thus be
+     * expanded concurrently.
      *
      * @param ssg The search space graph.
-     * @return A pair containing a vector of next positions with their priorities and an optional layout.
-     * If an improved solution is found, the layout is returned.
-     * If the layout is invalid or no improvement is possible, std::nullopt is returned.
-     */
-    [[nodiscard]] std::pair<std::vector<std::pair<coord_vec_type<ObstrLyt>, double>>, std::optional<ObstrLyt>>
-    expand(search_space_graph<ObstrLyt>& ssg) noexcept
+     * @param vertex The vertex to expand.
+     * @param bound Cost of the best solution found so far w.r.t. the cost objective of `ssg`. Partial layouts whose
+     * costs reach it are pruned.
+     * @return The expansion of `vertex`. It contains the successors with their priorities, a solution if `vertex`
+     * completes the placement without exceeding `bound`, or neither if the layout is invalid or was pruned.
+     */
+    [[nodiscard]] vertex_expansion<ObstrLyt> expand(const search_space_graph<ObstrLyt>& ssg,
+                                                    const search_vertex<ObstrLyt>&      vertex,
+                                                    const uint64_t                      bound) noexcept
     {
-        const auto min_layout_width = ssg.network.num_pis();
+        vertex_expansion<ObstrLyt> expansion{};
+        expansion.bound = bound;
 
-        std::vector<std::pair<coord_vec_type<ObstrLyt>, double>> next_positions;
-        next_positions.reserve(2 * ssg.num_expansions);
+        // pruning is only possible once a solution is known
+        const bool improve_solution = (bound != std::numeric_limits<uint64_t>::max());
+
+        const auto min_layout_width = ssg.network.num_pis();
 
         auto layout = initialize_layout(min_layout_width, ssg.planar);
 
@@ -1692,97 +2099,51 @@ class graph_oriented_layout_design_impl
         coord_vec_type<ObstrLyt> possible_positions{};
         possible_positions.reserve(2 * ssg.num_expansions);
 
-        if (ssg.current_vertex.empty())
+        if (vertex.empty())
         {
             possible_positions = get_possible_positions(layout, ssg, place_info);
+
+            expansion.successors = generate_next_positions(possible_positions, layout, ssg, vertex, nullptr);
+
+            return expansion;
         }
 
-        for (uint64_t idx = 0ul; idx < ssg.current_vertex.size(); ++idx)
+        // collect the partial layout states established by the predecessors of the current vertex, oldest first
+        std::vector<const partial_layout_state<ObstrLyt>*> predecessors{};
+        predecessors.reserve(vertex.size - 1);
+
+        for (const auto* state = vertex.parent.get(); state != nullptr; state = state->parent.get())
         {
-            const auto position = ssg.current_vertex[idx];
+            predecessors.push_back(state);
+        }
+        std::reverse(predecessors.begin(), predecessors.end());
 
-            bool found_solution = place_and_route(position, layout, ssg, place_info);
+        assert(predecessors.size() == vertex.size - 1);
 
-            uint64_t cost         = 0ul;
-            uint64_t desired_cost = 0ul;
+        // the partial layout established by the current vertex; only its own node needs to be routed
+        auto current_state      = std::make_shared<partial_layout_state<ObstrLyt>>();
+        current_state->parent   = vertex.parent;
+        current_state->position = vertex.position;
 
-            bool     improve_solution = improve_custom_solution;
-            uint64_t best_solution    = best_custom_solution;
+        for (uint64_t idx = 0ul; idx < vertex.size; ++idx)
+        {
+            const bool is_current_vertex = (idx == predecessors.size());
+            const auto position          = is_current_vertex ? current_state->position : predecessors[idx]->position;
 
-            switch (ssg.cost)
-            {
-                case graph_oriented_layout_design_params::cost_objective::AREA:
-                {
-                    improve_solution = improve_area_solution;
-                    best_solution    = best_area_solution;
-                    break;
-                }
-                case graph_oriented_layout_design_params::cost_objective::WIRES:
-                {
-                    improve_solution = improve_wire_solution;
-                    best_solution    = best_wire_solution;
-                    break;
-                }
-                case graph_oriented_layout_design_params::cost_objective::CROSSINGS:
-                {
-                    improve_solution = improve_crossing_solution;
-                    best_solution    = best_crossing_solution;
-                    break;
-                }
-                case graph_oriented_layout_design_params::cost_objective::ACP:
-                {
-                    improve_solution = improve_acp_solution;
-                    best_solution    = best_acp_solution;
-                    break;
-                }
-                default:
-                {
-                    break;
-                }
-            }
+            bool found_solution =
+                is_current_vertex ? place_and_route(position, layout, ssg, place_info, current_state->routes) :
+                                    replay_placement(*predecessors[idx], layout, ssg, place_info);
+
+            uint64_t cost = 0ul;
 
             if (improve_solution)
             {
                 cost = calculate_cost(layout, ssg.cost);
             }
 
-            if (found_solution && (!improve_solution || cost <= best_solution))
+            if (found_solution && (!improve_solution || cost <= bound))
             {
-                cost = calculate_cost(layout, ssg.cost);
-
-                switch (ssg.cost)
-                {
-                    case graph_oriented_layout_design_params::cost_objective::AREA:
-                    {
-                        improve_area_solution = true;
-                        best_area_solution    = cost;
-                        break;
-                    }
-                    case graph_oriented_layout_design_params::cost_objective::WIRES:
-                    {
-                        improve_wire_solution = true;
-                        best_wire_solution    = cost;
-                        break;
-                    }
-                    case graph_oriented_layout_design_params::cost_objective::CROSSINGS:
-                    {
-                        improve_crossing_solution = true;
-                        best_crossing_solution    = cost;
-                        break;
-                    }
-                    case graph_oriented_layout_design_params::cost_objective::ACP:
-                    {
-                        improve_acp_solution = true;
-                        best_acp_solution    = cost;
-                        break;
-                    }
-                    default:
-                    {
-                        improve_custom_solution = true;
-                        best_custom_solution    = cost;
-                        break;
-                    }
-                }
+                expansion.cost = calculate_cost(layout, ssg.cost);
 
                 fiction::post_layout_optimization_params plo_params{};
                 plo_params.optimize_pos_only   = true;
@@ -1793,100 +2154,139 @@ class graph_oriented_layout_design_impl
                 const auto bb_after_plo = fiction::bounding_box_2d(layout);
                 layout.resize({bb_after_plo.get_max().x, bb_after_plo.get_max().y, layout.z()});
 
-                desired_cost = calculate_cost(layout, ps.cost);
-
-                if (desired_cost < best_optimized_solution)
-                {
-                    best_optimized_solution = desired_cost;
-
-                    if (ps.verbose)
-                    {
-                        print_placement_info(layout);
-                    }
-
-                    return {{}, layout};
-                }
+                expansion.optimized_cost = calculate_cost(layout, ps.cost);
+                expansion.solution       = std::move(layout);
 
-                return {{}, std::nullopt};
+                return expansion;
             }
 
-            improve_solution = improve_custom_solution;
-            best_solution    = best_custom_solution;
-
-            switch (ssg.cost)
+            if (improve_solution && cost >= bound)
             {
-                case graph_oriented_layout_design_params::cost_objective::AREA:
-                {
-                    improve_solution = improve_area_solution;
-                    best_solution    = best_area_solution;
-                    break;
-                }
-                case graph_oriented_layout_design_params::cost_objective::WIRES:
-                {
-                    improve_solution = improve_wire_solution;
-                    best_solution    = best_wire_solution;
-                    break;
-                }
-                case graph_oriented_layout_design_params::cost_objective::CROSSINGS:
-                {
-                    improve_solution = improve_crossing_solution;
-                    best_solution    = best_crossing_solution;
-                    break;
-                }
-                case graph_oriented_layout_design_params::cost_objective::ACP:
-                {
-                    improve_solution = improve_acp_solution;
-                    best_solution    = best_acp_solution;
-                    break;
-                }
-                default:
-                {
-                    break;
-                }
-            }
-            if (improve_solution && cost >= best_solution)
-            {
-                return {{}, std::nullopt};
+                return expansion;
             }
 
             adjust_layout_size(position, layout, ssg, place_info);
             // check if it's the last position in the current vertex
-            if (idx == (ssg.current_vertex.size() - 1))
+            if (is_current_vertex)
             {
                 if (!valid_layout(layout, ssg, place_info))
                 {
-                    return {{}, std::nullopt};
+                    return expansion;
                 }
 
                 possible_positions = get_possible_positions(layout, ssg, place_info);
             }
         }
 
-        return generate_next_positions(possible_positions, layout, ssg);
+        expansion.successors = generate_next_positions(possible_positions, layout, ssg, vertex, current_state);
+
+        return expansion;
     }
     /**
-     * This function performs an expansion step on the given SSG and updates the frontier and cost information.
+     * Expands the current vertex of the given search space graph. If several vertices are to be expanded per step, the
+     * vertices that follow the current one in the frontier are expanded speculatively at the same time. A speculative
+     * expansion is used in a later step if its vertex becomes the current one and the bound has not changed since.
+     *
+     * @param ssg The search space graph.
+     * @param bound Cost of the best solution found so far w.r.t. the cost objective of `ssg`.
+     * @return The expansion of the current vertex.
+     */
+    [[nodiscard]] vertex_expansion<ObstrLyt> expand_current_vertex(search_space_graph<ObstrLyt>& ssg,
+                                                                   const uint64_t                bound)
+    {
+        const auto& vertex = ssg.current_vertex;
+
+        if (ps.num_parallel_expansions <= 1)
+        {
+            return expand(ssg, vertex, bound);
+        }
+
+        const auto take_speculative_expansion =
+            [&ssg, bound](const uint64_t hash) -> std::optional<vertex_expansion<ObstrLyt>>
+        {
+            if (const auto it = ssg.speculative_expansions.find(hash);
+                it != ssg.speculative_expansions.end() && it->second.bound == bound)
+            {
+                return std::move(it->second);
+            }
+
+            return std::nullopt;
+        };
+
+        auto current_expansion = take_speculative_expansion(vertex.hash);
+
+        // expand the vertices that are likely to become current in the next steps unless that has already been done
+        phmap::flat_hash_map<uint64_t, vertex_expansion<ObstrLyt>>                 speculative_expansions{};
+        std::vector<std::pair<uint64_t, std::future<vertex_expansion<ObstrLyt>>>> futures{};
+
+        for (const auto& next : ssg.frontier.peek(ps.num_parallel_expansions - 1))
+        {
+            // the same placement sequence may have been queued repeatedly with decreasing costs
+            if (next.hash == vertex.hash || speculative_expansions.count(next.hash) > 0 ||
+                std::any_of(futures.cbegin(), futures.cend(),
+                            [&next](const auto& future) { return future.first == next.hash; }))
+            {
+                continue;
+            }
+
+            if (auto expansion = take_speculative_expansion(next.hash); expansion.has_value())
+            {
+                speculative_expansions.emplace(next.hash, std::move(*expansion));
+            }
+            else
+            {
+                futures.emplace_back(next.hash, std::async(std::launch::async, [this, &ssg, next, bound]()
+                                                           { return expand(ssg, next, bound); }));
+            }
+        }
+
+        auto expansion = current_expansion.has_value() ? std::move(*current_expansion) : expand(ssg, vertex, bound);
+
+        for (auto& [hash, future] : futures)
+        {
+            speculative_expansions.emplace(hash, future.get());
+        }
+
+        // discard the speculative expansions of vertices that have been overtaken in the frontier
+        ssg.speculative_expansions = std::move(speculative_expansions);
+
+        return expansion;
+    }
+    /**
+     * This function performs an expansion step on the given SSG and updates the frontier and cost information. A found
+     * solution is published to the other search space graphs here, i.e., not during the possibly concurrent
+     * expansions.
      *
      * @param ssg The search space graph to process.
      * @return An optional layout. Returns a layout if one is found during expansion; otherwise, std::nullopt.
      */
-    std::optional<Lyt> process_ssg(search_space_graph<ObstrLyt>& ssg)
+    std::optional<DesignLyt> process_ssg(search_space_graph<ObstrLyt>& ssg)
     {
         if (ssg.frontier_flag)
         {
-            const auto expansion = expand(ssg);
-            if (expansion.second)
+            auto& best_solution_for_cost = best_solution(ssg.cost);
+
+            const auto expansion = expand_current_vertex(ssg, best_solution_for_cost.load());
+
+            if (expansion.solution)
             {
-                return expansion.second;
+                fetch_min(best_solution_for_cost, expansion.cost);
+
+                if (fetch_min(best_optimized_solution, expansion.optimized_cost))
+                {
+                    return *expansion.solution;
+                }
+
+                return std::nullopt;
             }
 
             // Update costs and frontier
-            for (const auto& [next, cost] : expansion.first)
+            for (const auto& [next, cost] : expansion.successors)
             {
-                if (ssg.cost_so_far.find(next) == ssg.cost_so_far.cend() || cost < ssg.cost_so_far[next])
+                if (const auto it = ssg.cost_so_far.find(next.hash); it == ssg.cost_so_far.cend() || cost < it->second)
                 {
-                    ssg.cost_so_far[next] = cost;
-                    double priority       = cost;
+                    ssg.cost_so_far[next.hash] = cost;
+                    double priority            = cost;
                     ssg.frontier.put(next, priority);
                 }
             }
@@ -1922,9 +2322,9 @@ class graph_oriented_layout_design_impl
                 ++pi_loc_it;
             }
 
-            graph.cost_so_far[graph.current_vertex] = 0;
-            graph.num_expansions                    = ps.num_vertex_expansions;
-            graph.planar                            = ps.planar;
+            graph.cost_so_far[graph.current_vertex.hash] = 0;
+            graph.num_expansions                         = ps.num_vertex_expansions;
+            graph.planar                                 = ps.planar;
         }
     }
     /**
@@ -2132,10 +2532,16 @@ std::optional<Lyt> graph_oriented_layout_design(Ntk& ntk, graph_oriented_layout_
         throw std::invalid_argument("No custom cost objective provided.");
     }
 
-    graph_oriented_layout_design_stats                  st{};
-    detail::graph_oriented_layout_design_impl<Lyt, Ntk> p{ntk, ps, st, custom_cost_objective};
+    graph_oriented_layout_design_stats st{};
+
+    std::optional<Lyt> result{};
+    {
+        const auto memory = st.profile.track_memory();
 
-    const auto result = p.run();
+        detail::graph_oriented_layout_design_impl<Lyt, Ntk> p{ntk, ps, st, custom_cost_objective};
+
+        result = p.run();
+    }
 
     if (pst)
     {
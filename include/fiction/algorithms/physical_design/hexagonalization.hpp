@@ -19,13 +19,19 @@
 #include <fmt/format.h>
 #include <mockturtle/traits.hpp>
 #include <mockturtle/utils/stopwatch.hpp>
+#include <phmap.h>
 
 #include <algorithm>
+#include <array>
+#include <atomic>
 #include <cassert>
 #include <cmath>
+#include <cstddef>
 #include <cstdint>
 #include <iostream>
 #include <stdexcept>
+#include <system_error>
+#include <thread>
 #include <vector>
 
 #pragma GCC diagnostic push
@@ -82,6 +88,23 @@ struct hexagonalization_params
      * Output extension mode. Defaults to none
      */
     io_pin_extension_mode output_pin_extension = NONE;
+    /**
+     * Route all objectives that arise from extending primary inputs/outputs together with a negotiated-congestion
+     * router (PathFinder) instead of one after another. Paths may initially share coordinates, which are penalized
+     * increasingly over several rip-up and reroute iterations until all paths are disjoint. If the negotiation does not
+     * converge, the objectives are routed one after another.
+     */
+    bool negotiated_congestion_routing = false;
+    /**
+     * Maximum number of rip-up and reroute iterations of the negotiated-congestion router.
+     */
+    uint64_t max_negotiation_iterations = 32ull;
+    /**
+     * Number of threads used to compute the coordinate transformation of the Cartesian tiles. Each thread maps entire
+     * diagonals, while the resulting gates are placed in diagonal order afterward. Thus, the result does not depend on
+     * the number of threads. If set to 0, the number of hardware threads is used.
+     */
+    uint64_t num_threads = 1ull;
 };
 
 /**
@@ -93,6 +116,16 @@ struct hexagonalization_stats
      * Runtime of the hexagonalization process.
      */
     mockturtle::stopwatch<>::duration time_total{0};
+    /**
+     * Total number of rip-up and reroute iterations of the negotiated-congestion router for the primary inputs and
+     * outputs.
+     */
+    uint64_t num_negotiation_iterations{0ull};
+    /**
+     * Flag indicating that negotiated-congestion routing was enabled and all of its negotiations converged, i.e., no
+     * objectives had to be routed one after another instead.
+     */
+    bool negotiation_converged{false};
     /**
      * Reports the statistics to the given output stream.
      *
@@ -101,6 +134,12 @@ struct hexagonalization_stats
     void report(std::ostream& out = std::cout) const
     {
         out << fmt::format("[i] total time = {:.2f} secs\n", mockturtle::to_seconds(time_total));
+
+        if (num_negotiation_iterations > 0)
+        {
+            out << fmt::format("[i] negotiation iterations = {} ({})\n", num_negotiation_iterations,
+                               negotiation_converged ? "converged" : "not converged");
+        }
     }
 };
 
@@ -373,6 +412,34 @@ get_offset(const CartLyt& lyt, const uint64_t cartesian_layout_width, const uint
     return {offset_to_add, offset_to_subtract};
 }
 
+/**
+ * The result of the coordinate transformation for a single non-PI tile of a Cartesian layout, i.e., all information
+ * required to place its gate in the hexagonal layout.
+ *
+ * @tparam HexLyt Even-row hexagonal gate-level layout type.
+ * @tparam CartLyt Cartesian gate-level layout type.
+ */
+template <typename HexLyt, typename CartLyt>
+struct hexagonal_placement
+{
+    /**
+     * Tile of the gate in the hexagonal layout.
+     */
+    tile<HexLyt> hex_tile{};
+    /**
+     * Node of the gate in the Cartesian layout.
+     */
+    mockturtle::node<CartLyt> node{};
+    /**
+     * Tiles of the gate's fanins in the hexagonal layout.
+     */
+    std::array<tile<HexLyt>, 2> hex_fanins{};
+    /**
+     * Number of fanins.
+     */
+    uint8_t num_fanins{0};
+};
+
 template <typename HexLyt, typename CartLyt>
 class hexagonalization_impl
 {
@@ -418,6 +485,7 @@ class hexagonalization_impl
 
         // initialize statistics for hexagonalization
         hexagonalization_stats stats{};
+        stats.negotiation_converged = ps.negotiated_congestion_routing;
 
         // artificial scope to restrict the lifetime of the stopwatch
         {
@@ -505,83 +573,88 @@ class hexagonalization_impl
             }
 
             // process internal nodes by iterating diagonally over the Cartesian layout
-            for (uint64_t k = 0; k < layout_width + layout_height - 1; ++k)
-            {
-                for (uint64_t x = 0; x <= k; ++x)
-                {
-                    const auto y = k - x;
+            const auto num_diagonals = layout_width + layout_height - 1;
 
-                    // ensure coordinate is within layout bounds
-                    if (y < layout_height && x < layout_width)
-                    {
-                        // iterate through all layers
-                        for (uint64_t z = 0; z <= hex_depth; ++z)
-                        {
-                            // define the current Cartesian tile
-                            tile<CartLyt> old_tile{x, y, z};
+            std::vector<std::vector<hexagonal_placement<HexLyt, CartLyt>>> placements(num_diagonals);
 
-                            // convert the Cartesian tile to a hexagonal tile and adjust x-coordinate
-                            auto hex_tile = detail::to_hex<CartLyt, HexLyt>(old_tile, layout_height);
-                            hex_tile.x += offset_to_add - offset_to_subtract;
+            const auto x_shift      = offset_to_add - offset_to_subtract;
+            const auto map_diagonal = [this, layout_width, layout_height, hex_depth, x_shift](const uint64_t k)
+            { return compute_placements(k, layout_width, layout_height, hex_depth, x_shift); };
 
-                            // skip processing if tile is empty
-                            if (layout.is_empty_tile(old_tile))
-                            {
-                                continue;
-                            }
+            // compute the coordinate transformation of all diagonals in parallel if requested
+            const auto num_workers = std::min(static_cast<uint64_t>(num_diagonals), determine_num_threads());
 
-                            // retrieve node associated with the current tile
-                            const auto node = layout.get_node(old_tile);
+            if (num_workers > 1)
+            {
+                std::atomic<uint64_t> next_diagonal{0};
 
-                            // skip if node is a primary input
-                            if (layout.is_pi(node))
-                            {
-                                continue;
-                            }
+                const auto map_diagonals = [&placements, &next_diagonal, &map_diagonal, num_diagonals]
+                {
+                    for (auto k = next_diagonal++; k < num_diagonals; k = next_diagonal++)
+                    {
+                        placements[k] = map_diagonal(k);
+                    }
+                };
 
-                            // get incoming data flow signals for the tile
-                            const auto signals = layout.incoming_data_flow(old_tile);
+                std::vector<std::thread> workers{};
+                workers.reserve(num_workers - 1);
 
-                            // process single input signals (buffer or inverter)
-                            if (signals.size() == 1)
-                            {
-                                const auto hex_source = [&signals, layout_height, offset_to_add, offset_to_subtract]
-                                {
-                                    auto t = detail::to_hex<CartLyt, HexLyt>(signals[0], layout_height);
-                                    t.x += offset_to_add - offset_to_subtract;
-                                    return t;
-                                }();
+                try
+                {
+                    for (uint64_t i = 1; i < num_workers; ++i)
+                    {
+                        workers.emplace_back(map_diagonals);
+                    }
+                }
+                catch (const std::system_error&)
+                {
+                    // the calling thread maps all diagonals that no other thread takes
+                }
 
-                                // create a hex signal from the source
-                                const auto hex_signal = hex_layout.make_signal(hex_layout.get_node(hex_source));
+                map_diagonals();
 
-                                // create appropriate gate in hex layout based on node type
-                                if (!layout.is_po(node))
-                                {
-                                    [[maybe_unused]] const auto s =
-                                        place(hex_layout, hex_tile, layout, node, hex_signal);
-                                }
-                            }
-                            else if (signals.size() == 2)
-                            {
-                                // process two-input gates
-                                auto hex_tile_a = detail::to_hex<CartLyt, HexLyt>(signals[0], layout_height);
-                                auto hex_tile_b = detail::to_hex<CartLyt, HexLyt>(signals[1], layout_height);
+                for (auto& worker : workers)
+                {
+                    worker.join();
+                }
+            }
 
-                                // adjust coordinates for offset
-                                hex_tile_a.x += offset_to_add - offset_to_subtract;
-                                hex_tile_b.x += offset_to_add - offset_to_subtract;
+            // place the gates diagonal by diagonal such that all fanins already exist
+            for (uint64_t k = 0; k < num_diagonals; ++k)
+            {
+                if (num_workers <= 1)
+                {
+                    placements[k] = map_diagonal(k);
+                }
 
-                                // create signals for both inputs
-                                const auto hex_signal_a = hex_layout.make_signal(hex_layout.get_node(hex_tile_a));
-                                const auto hex_signal_b = hex_layout.make_signal(hex_layout.get_node(hex_tile_b));
+                for (const auto& p : placements[k])
+                {
+                    // process single input signals (buffer or inverter)
+                    if (p.num_fanins == 1)
+                    {
+                        // create a hex signal from the source
+                        const auto hex_signal = hex_layout.make_signal(hex_layout.get_node(p.hex_fanins[0]));
 
-                                [[maybe_unused]] const auto s =
-                                    place(hex_layout, hex_tile, layout, node, hex_signal_a, hex_signal_b);
-                            }
+                        // create appropriate gate in hex layout based on node type
+                        if (!layout.is_po(p.node))
+                        {
+                            [[maybe_unused]] const auto s = place(hex_layout, p.hex_tile, layout, p.node, hex_signal);
                         }
                     }
+                    // process two-input gates
+                    else
+                    {
+                        // create signals for both inputs
+                        const auto hex_signal_a = hex_layout.make_signal(hex_layout.get_node(p.hex_fanins[0]));
+                        const auto hex_signal_b = hex_layout.make_signal(hex_layout.get_node(p.hex_fanins[1]));
+
+                        [[maybe_unused]] const auto s =
+                            place(hex_layout, p.hex_tile, layout, p.node, hex_signal_a, hex_signal_b);
+                    }
                 }
+
+                // release the memory of the placed diagonal
+                placements[k] = {};
             }
 
             // map primary outputs to hex layout
@@ -741,60 +814,57 @@ class hexagonalization_impl
                 using dist = manhattan_distance_functor<decltype(layout_obstruct), uint64_t>;
                 using cost = unit_cost_functor<decltype(layout_obstruct), uint8_t>;
 
-                // for each routing objective, find a path and route it
-                for (const auto& obj : objectives)
-                {
-                    auto target        = obj.target;
-                    auto update_target = false;
+                // route all objectives together via negotiated congestion if requested
+                const auto routed = ps.negotiated_congestion_routing &&
+                                    route_objectives_negotiated(hex_layout, objectives, crossings, stats);
 
-                    // for planar extension, check if target is in the crossing layer
-                    if (!crossings && obj.target.z == 1)
-                    {
-                        target.z      = 0;
-                        update_target = true;
-                    }
+                stats.negotiation_converged = stats.negotiation_converged && routed;
 
-                    if (auto new_path =
-                            a_star<path>(layout_obstruct, {obj.source, target}, dist(), cost(), params_astar);
-                        !new_path.empty())
+                // otherwise, for each routing objective, find a path and route it
+                if (!routed)
+                {
+                    for (const auto& obj : objectives)
                     {
-                        // for planar extension, if target is in the crossing layer, update path
-                        if (update_target)
+                        auto target        = obj.target;
+                        auto update_target = false;
+
+                        // for planar extension, check if target is in the crossing layer
+                        if (!crossings && obj.target.z == 1)
                         {
-                            new_path.back().z = 1;
+                            target.z      = 0;
+                            update_target = true;
                         }
 
-                        route_path(hex_layout, new_path);
-
-                        for (const auto& t : new_path)
+                        if (auto new_path =
+                                a_star<path>(layout_obstruct, {obj.source, target}, dist(), cost(), params_astar);
+                            !new_path.empty())
                         {
-                            layout_obstruct.obstruct_coordinate(t);
+                            // for planar extension, if target is in the crossing layer, update path
+                            if (update_target)
+                            {
+                                new_path.back().z = 1;
+                            }
+
+                            route_path(hex_layout, new_path);
+
+                            for (const auto& t : new_path)
+                            {
+                                layout_obstruct.obstruct_coordinate(t);
+                            }
+                            // if the flag is set, re-collect and update fanins
+                            if (obj.update_first_fanin)
+                            {
+                                reverse_fanins(hex_layout, obj.target);
+                            }
                         }
-                        // if the flag is set, re-collect and update fanins
-                        if (obj.update_first_fanin)
+                        else
                         {
-                            std::vector<mockturtle::signal<HexLyt>> fins{};
-                            fins.reserve(2);
-
-                            hex_layout.foreach_fanin(hex_layout.get_node(obj.target),
-                                                     [&fins, &hex_layout](const auto& i)
-                                                     {
-                                                         auto fout = static_cast<tile<HexLyt>>(i);
-                                                         fins.push_back(
-                                                             hex_layout.make_signal(hex_layout.get_node(fout)));
-                                                     });
-
-                            std::reverse(fins.begin(), fins.end());
-                            hex_layout.move_node(hex_layout.get_node(obj.target), obj.target, fins);
+                            throw hexagonalization_io_pin_routing_error(
+                                fmt::format("After extending PI to tile {} at the top border, rerouting to its fanout "
+                                            "at tile {} was not possible with crossings {}",
+                                            obj.source, obj.target, crossings ? "enabled" : "disabled"));
                         }
                     }
-                    else
-                    {
-                        throw hexagonalization_io_pin_routing_error(
-                            fmt::format("After extending PI to tile {} at the top border, rerouting to its fanout at "
-                                        "tile {} was not possible with crossings {}",
-                                        obj.source, obj.target, crossings ? "enabled" : "disabled"));
-                    }
                 }
             }
 
@@ -848,43 +918,52 @@ class hexagonalization_impl
                 using dist = manhattan_distance_functor<decltype(layout_obstruct), uint64_t>;
                 using cost = unit_cost_functor<decltype(layout_obstruct), uint8_t>;
 
-                // for each routing objective, find a path and route it
-                for (const auto& obj : objectives)
-                {
-                    auto source        = obj.source;
-                    auto update_source = false;
+                // route all objectives together via negotiated congestion if requested
+                const auto routed = ps.negotiated_congestion_routing &&
+                                    route_objectives_negotiated(hex_layout, objectives, crossings, stats);
 
-                    // for planar extension, check if source is in the crossing layer
-                    if (!crossings && obj.source.z == 1)
-                    {
-                        source.z      = 0;
-                        update_source = true;
-                    }
+                stats.negotiation_converged = stats.negotiation_converged && routed;
 
-                    if (auto new_path =
-                            a_star<path>(layout_obstruct, {source, obj.target}, dist(), cost(), params_astar);
-                        !new_path.empty())
+                // otherwise, for each routing objective, find a path and route it
+                if (!routed)
+                {
+                    for (const auto& obj : objectives)
                     {
-                        // for planar extension, if source or target are in the crossing layer, update path
-                        if (update_source)
+                        auto source        = obj.source;
+                        auto update_source = false;
+
+                        // for planar extension, check if source is in the crossing layer
+                        if (!crossings && obj.source.z == 1)
                         {
-                            new_path.front().z = 1;
+                            source.z      = 0;
+                            update_source = true;
                         }
 
-                        route_path(hex_layout, new_path);
+                        if (auto new_path =
+                                a_star<path>(layout_obstruct, {source, obj.target}, dist(), cost(), params_astar);
+                            !new_path.empty())
+                        {
+                            // for planar extension, if source or target are in the crossing layer, update path
+                            if (update_source)
+                            {
+                                new_path.front().z = 1;
+                            }
+
+                            route_path(hex_layout, new_path);
 
-                        for (const auto& t : new_path)
+                            for (const auto& t : new_path)
+                            {
+                                layout_obstruct.obstruct_coordinate(t);
+                            }
+                        }
+                        else
                         {
-                            layout_obstruct.obstruct_coordinate(t);
+                            throw hexagonalization_io_pin_routing_error(
+                                fmt::format("After extending PO to tile {} at the bottom border, rerouting from its "
+                                            "fanin at tile {} was not possible with crossings {}",
+                                            obj.target, obj.source, crossings ? "enabled" : "disabled"));
                         }
                     }
-                    else
-                    {
-                        throw hexagonalization_io_pin_routing_error(
-                            fmt::format("After extending PO to tile {} at the bottom border, rerouting from its fanin "
-                                        "at tile {} was not possible with crossings {}",
-                                        obj.target, obj.source, crossings ? "enabled" : "disabled"));
-                    }
                 }
             }
 
@@ -919,6 +998,252 @@ class hexagonalization_impl
      * Hexagonalization statistics.
      */
     hexagonalization_stats* pst;
+    /**
+     * Determines the number of threads to use for the coordinate transformation.
+     *
+     * @return Number of threads.
+     */
+    [[nodiscard]] uint64_t determine_num_threads() const noexcept
+    {
+        if (ps.num_threads != 0)
+        {
+            return ps.num_threads;
+        }
+
+        return std::max(uint64_t{1}, static_cast<uint64_t>(std::thread::hardware_concurrency()));
+    }
+    /**
+     * Computes the coordinate transformation for all non-empty non-PI tiles on the given diagonal of the Cartesian
+     * layout. This function only reads from the Cartesian layout and can, therefore, be called concurrently for
+     * different diagonals.
+     *
+     * @param k Index of the diagonal, i.e., the sum of the x- and y-coordinates of its tiles.
+     * @param layout_width Width of the Cartesian layout.
+     * @param layout_height Height of the Cartesian layout.
+     * @param hex_depth Depth of the hexagonal layout.
+     * @param x_shift Value to add to all x-coordinates on the hexagonal layout (modulo 2^64).
+     * @return Placements of the tiles on diagonal `k` in ascending order of their x- and z-coordinates.
+     */
+    [[nodiscard]] std::vector<hexagonal_placement<HexLyt, CartLyt>>
+    compute_placements(const uint64_t k, const uint64_t layout_width, const uint64_t layout_height,
+                       const uint64_t hex_depth, const uint64_t x_shift) const
+    {
+        std::vector<hexagonal_placement<HexLyt, CartLyt>> placements{};
+
+        const auto to_shifted_hex = [layout_height, x_shift](const tile<CartLyt>& t)
+        {
+            auto hex_tile = detail::to_hex<CartLyt, HexLyt>(t, layout_height);
+            hex_tile.x += x_shift;
+            return hex_tile;
+        };
+
+        for (uint64_t x = 0; x <= k; ++x)
+        {
+            const auto y = k - x;
+
+            // ensure coordinate is within layout bounds
+            if (y >= layout_height || x >= layout_width)
+            {
+                continue;
+            }
+
+            // iterate through all layers
+            for (uint64_t z = 0; z <= hex_depth; ++z)
+            {
+                const tile<CartLyt> old_tile{x, y, z};
+
+                // skip processing if tile is empty
+                if (layout.is_empty_tile(old_tile))
+                {
+                    continue;
+                }
+
+                const auto node = layout.get_node(old_tile);
+
+                // skip if node is a primary input
+                if (layout.is_pi(node))
+                {
+                    continue;
+                }
+
+                // get incoming data flow signals for the tile
+                const auto signals = layout.incoming_data_flow(old_tile);
+
+                if (signals.size() != 1 && signals.size() != 2)
+                {
+                    continue;
+                }
+
+                hexagonal_placement<HexLyt, CartLyt> placement{};
+                placement.hex_tile   = to_shifted_hex(old_tile);
+                placement.node       = node;
+                placement.num_fanins = static_cast<uint8_t>(signals.size());
+
+                for (std::size_t i = 0; i < signals.size(); ++i)
+                {
+                    placement.hex_fanins[i] = to_shifted_hex(signals[i]);
+                }
+
+                placements.push_back(placement);
+            }
+        }
+
+        return placements;
+    }
+    /**
+     * Reverses the order of the fanins of the gate at the given tile. This is necessary if an extended primary input
+     * was the first fanin of an asymmetric gate.
+     *
+     * @param hex_layout The hexagonal layout.
+     * @param t Tile of the gate.
+     */
+    static void reverse_fanins(HexLyt& hex_layout, const tile<HexLyt>& t) noexcept
+    {
+        std::vector<mockturtle::signal<HexLyt>> fins{};
+        fins.reserve(2);
+
+        hex_layout.foreach_fanin(hex_layout.get_node(t),
+                                 [&fins, &hex_layout](const auto& i)
+                                 {
+                                     auto fout = static_cast<tile<HexLyt>>(i);
+                                     fins.push_back(hex_layout.make_signal(hex_layout.get_node(fout)));
+                                 });
+
+        std::reverse(fins.begin(), fins.end());
+        hex_layout.move_node(hex_layout.get_node(t), t, fins);
+    }
+    /**
+     * Routes all given objectives together using negotiated congestion as proposed in \"PathFinder: A
+     * Negotiation-Based Performance-Driven Router for FPGAs\" by L. McMurchie and C. Ebeling in FPGA 1995.
+     *
+     * In each iteration, every path is ripped up and rerouted via A* with respect to the current layout. Paths of
+     * different objectives are allowed to share coordinates. However, the cost of a coordinate grows with the number of
+     * other paths currently using it (present congestion) and with the congestion it experienced in all previous
+     * iterations (history). Once no coordinate is shared anymore, all paths are routed in the layout. Source and target
+     * coordinates may be shared, e.g., by several objectives with the same fanout gate.
+     *
+     * @param hex_layout The hexagonal layout.
+     * @param objectives The routing objectives.
+     * @param crossings Flag to indicate whether paths may cross wires of the layout.
+     * @param stats Statistics in which the number of iterations is accumulated.
+     * @return `true` iff the negotiation converged and all paths were routed.
+     */
+    [[nodiscard]] bool
+    route_objectives_negotiated(HexLyt& hex_layout,
+                                const std::vector<routing_objective_with_fanin_update_information<HexLyt>>& objectives,
+                                const bool crossings, hexagonalization_stats& stats) const noexcept
+    {
+        using obstr_lyt = obstruction_layout<HexLyt>;
+        using path      = layout_coordinate_path<obstr_lyt>;
+        using dist      = manhattan_distance_functor<obstr_lyt, uint64_t>;
+
+        const obstr_lyt     layout_obstruct{hex_layout};
+        const a_star_params params_astar{crossings};
+
+        // number of paths that currently use each coordinate
+        phmap::flat_hash_map<coordinate<HexLyt>, uint64_t> occupancy{};
+        // accumulated congestion of each coordinate over all previous iterations
+        phmap::flat_hash_map<coordinate<HexLyt>, double> history{};
+        // weight of the present congestion, which increases in each iteration
+        double present_factor = 0.5;
+
+        const cost_functor<obstr_lyt, double> cost{
+            [&occupancy, &history, &present_factor](const coordinate<HexLyt>&, const coordinate<HexLyt>& tgt)
+            {
+                const auto occ  = occupancy.find(tgt);
+                const auto hist = history.find(tgt);
+
+                const auto present = occ == occupancy.cend() ? 0.0 : static_cast<double>(occ->second);
+                const auto base    = hist == history.cend() ? 1.0 : 1.0 + hist->second;
+
+                return base * (1.0 + present_factor * present);
+            }};
+
+        // updates the occupancy by all coordinates of the given path except for its source and target
+        const auto occupy = [&occupancy](const path& p, const bool add)
+        {
+            for (std::size_t i = 1; i + 1 < p.size(); ++i)
+            {
+                if (add)
+                {
+                    ++occupancy[p[i]];
+                }
+                else if (const auto it = occupancy.find(p[i]); --it->second == 0)
+                {
+                    occupancy.erase(it);
+                }
+            }
+        };
+
+        a_star_context<obstr_lyt, double> context{};
+
+        std::vector<path> paths(objectives.size());
+
+        for (uint64_t iteration = 0; iteration < ps.max_negotiation_iterations; ++iteration)
+        {
+            ++stats.num_negotiation_iterations;
+
+            for (std::size_t i = 0; i < objectives.size(); ++i)
+            {
+                // rip up the previous path
+                occupy(paths[i], false);
+
+                auto source = objectives[i].source;
+                auto target = objectives[i].target;
+
+                // for planar extension, route to and from the ground layer
+                if (!crossings)
+                {
+                    source.z = 0;
+                    target.z = 0;
+                }
+
+                paths[i] = a_star<path>(layout_obstruct, {source, target}, context, dist(), cost, params_astar);
+
+                if (paths[i].empty())
+                {
+                    return false;
+                }
+
+                paths[i].front().z = objectives[i].source.z;
+                paths[i].back().z  = objectives[i].target.z;
+
+                occupy(paths[i], true);
+            }
+
+            // accumulate the history of all shared coordinates
+            bool congested = false;
+
+            for (const auto& [c, num_paths] : occupancy)
+            {
+                if (num_paths > 1)
+                {
+                    congested = true;
+                    history[c] += static_cast<double>(num_paths - 1);
+                }
+            }
+
+            if (!congested)
+            {
+                for (std::size_t i = 0; i < objectives.size(); ++i)
+                {
+                    route_path(hex_layout, paths[i]);
+
+                    // if the flag is set, re-collect and update fanins
+                    if (objectives[i].update_first_fanin)
+                    {
+                        reverse_fanins(hex_layout, objectives[i].target);
+                    }
+                }
+
+                return true;
+            }
+
+            present_factor *= 2.0;
+        }
+
+        return false;
+    }
 };
 
 }  // namespace detail
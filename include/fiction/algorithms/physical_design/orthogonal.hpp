@@ -6,12 +6,14 @@
 #define FICTION_ORTHOGONAL_HPP
 
 #include "fiction/algorithms/network_transformation/fanout_substitution.hpp"
+#include "fiction/io/fgl_format.hpp"
 #include "fiction/io/print_layout.hpp"
 #include "fiction/layouts/clocking_scheme.hpp"
 #include "fiction/networks/views/edge_color_view.hpp"
 #include "fiction/traits.hpp"
 #include "fiction/utils/name_utils.hpp"
 #include "fiction/utils/network_utils.hpp"
+#include "fiction/utils/performance_profile.hpp"
 #include "fiction/utils/placement_utils.hpp"
 
 #include <fmt/format.h>
@@ -20,11 +22,20 @@
 #include <mockturtle/utils/stopwatch.hpp>
 #include <mockturtle/views/fanout_view.hpp>
 #include <mockturtle/views/topo_view.hpp>
+#include <nlohmann/json.hpp>
 
 #include <algorithm>
+#include <cassert>
 #include <cstdint>
+#include <fstream>
+#include <initializer_list>
+#include <limits>
 #include <optional>
+#include <ostream>
 #include <set>
+#include <string>
+#include <string_view>
+#include <utility>
 #include <vector>
 
 #if (PROGRESS_BARS)
@@ -43,6 +54,12 @@ struct orthogonal_physical_design_params
      * Number of clock phases to use. 3 and 4 are supported.
      */
     num_clks number_of_clock_phases = num_clks::FOUR;
+    /**
+     * Run the algorithm twice on Cartesian layouts. The first pass only determines the number of elements to place
+     * without constructing the layout, which is then used to pre-allocate the layout's storage in the second pass. This
+     * avoids rehashing and reallocations when laying out very large networks. The result is identical either way.
+     */
+    bool two_pass = false;
 };
 
 struct orthogonal_physical_design_stats
@@ -51,6 +68,11 @@ struct orthogonal_physical_design_stats
 
     uint64_t x_size{0ull}, y_size{0ull};
     uint64_t num_gates{0ull}, num_wires{0ull}, num_crossings{0ull};
+    /**
+     * Time spent in fanout substitution, edge coloring, and arrangement as well as the memory usage of the entire
+     * process.
+     */
+    performance_profile profile{};
 
     void report(std::ostream& out = std::cout) const
     {
@@ -59,8 +81,25 @@ struct orthogonal_physical_design_stats
         out << fmt::format("[i] num. gates      = {}\n", num_gates);
         out << fmt::format("[i] num. wires      = {}\n", num_wires);
         out << fmt::format("[i] num. crossings  = {}\n", num_crossings);
+
+        profile.report(out);
     }
 };
+/**
+ * Converts orthogonal physical design statistics into JSON.
+ *
+ * @param j JSON value to write to.
+ * @param stats Statistics to convert.
+ */
+inline void to_json(nlohmann::json& j, const orthogonal_physical_design_stats& stats)
+{
+    j = {{"runtime in seconds", mockturtle::to_seconds(stats.time_total)},
+         {"number of gates", stats.num_gates},
+         {"number of wires", stats.num_wires},
+         {"number of crossings", stats.num_crossings},
+         {"layout", {{"x-size", stats.x_size}, {"y-size", stats.y_size}, {"area", stats.x_size * stats.y_size}}},
+         {"profile", stats.profile}};
+}
 
 namespace detail
 {
@@ -335,20 +374,39 @@ mockturtle::signal<Lyt> connect_and_place(Lyt& lyt, const tile<Lyt>& t, const Nt
         std::swap(pre1_t, pre2_t);
     }
 
-    return place(lyt, t, ntk, n, wire_south(lyt, pre1_t, t), wire_east(lyt, pre2_t, t), c);
+    if constexpr (is_gate_level_layout_v<Lyt>)
+    {
+        return place(lyt, t, ntk, n, wire_south(lyt, pre1_t, t), wire_east(lyt, pre2_t, t), c);
+    }
+    else
+    {
+        return lyt.place(t, ntk, n, wire_south(lyt, pre1_t, t), wire_east(lyt, pre2_t, t), c);
+    }
 }
 
 template <typename Lyt, typename Ntk>
 mockturtle::signal<Lyt> connect_and_place(Lyt& lyt, const tile<Lyt>& t, const Ntk& ntk, const mockturtle::node<Ntk>& n,
                                           const tile<Lyt>& pre_t)
 {
+    const auto place_gate = [&lyt, &t, &ntk, &n](const auto& a)
+    {
+        if constexpr (is_gate_level_layout_v<Lyt>)
+        {
+            return place(lyt, t, ntk, n, a);
+        }
+        else
+        {
+            return lyt.place(t, ntk, n, a);
+        }
+    };
+
     if (lyt.is_westwards_of(t, pre_t))
     {
-        return place(lyt, t, ntk, n, wire_east(lyt, pre_t, t));
+        return place_gate(wire_east(lyt, pre_t, t));
     }
     if (lyt.is_northwards_of(t, pre_t))
     {
-        return place(lyt, t, ntk, n, wire_south(lyt, pre_t, t));
+        return place_gate(wire_south(lyt, pre_t, t));
     }
 
     assert(false);  // gates cannot be placed elsewhere
@@ -427,12 +485,386 @@ void place_outputs(Lyt& layout, const coloring_container<Ntk>& ctn, uint32_t po_
         });
 }
 
+/**
+ * A lightweight stand-in for a Cartesian gate-level layout of type `Lyt` that the orthogonal algorithm can be run on
+ * without constructing the layout. Instead of nodes and their tiles, it only stores the occupied extent of each row and
+ * each column. This suffices to detect crossings because the orthogonal algorithm extends rows strictly eastwards and
+ * columns strictly southwards such that the occupied tiles of each row and column are contiguous. Thereby, memory
+ * consumption is linear in the layout's side lengths instead of its number of wire segments.
+ *
+ * All created elements are counted, which allows to pre-allocate the storage of the actual layout. Additionally, they
+ * can be written to an output stream in the FGL format as soon as they are created.
+ *
+ * @tparam Lyt Cartesian gate-level layout type to emulate.
+ */
+template <typename Lyt>
+class orthogonal_layout_stream
+{
+  public:
+    using tile         = typename Lyt::tile;
+    using signal       = tile;
+    using node         = uint32_t;
+    using aspect_ratio = typename Lyt::aspect_ratio;
+    /**
+     * Standard constructor. Creates a stream that only counts the created elements.
+     *
+     * @param ar Highest possible position in the layout.
+     */
+    explicit orthogonal_layout_stream(const aspect_ratio& ar) :
+            dimension{ar},
+            row_extents(static_cast<std::size_t>(ar.y) + 1),
+            column_extents(static_cast<std::size_t>(ar.x) + 1)
+    {}
+    /**
+     * Standard constructor. Creates a stream that writes all created elements to the given output stream in the FGL
+     * format. The FGL header is written immediately. The FGL footer is written by `close`.
+     *
+     * @param ar Highest possible position in the layout.
+     * @param s Output stream to write the FGL data into.
+     * @param layout_name Name of the layout.
+     * @param clocking_scheme_name Name of the layout's clocking scheme.
+     */
+    orthogonal_layout_stream(const aspect_ratio& ar, std::ostream& s, const std::string_view layout_name,
+                             const std::string_view clocking_scheme_name) :
+            orthogonal_layout_stream(ar)
+    {
+        os = &s;
+
+        write_fgl_preamble(*os);
+
+        *os << fcn::OPEN_LAYOUT_METADATA;
+        *os << fmt::format(fcn::LAYOUT_METADATA, layout_name, "cartesian", x(), y(), z());
+        *os << fcn::OPEN_CLOCKING << fmt::format(fcn::CLOCKING_SCHEME_NAME, clocking_scheme_name)
+            << fcn::CLOSE_CLOCKING;
+        *os << fcn::CLOSE_LAYOUT_METADATA;
+
+        *os << fcn::OPEN_GATES;
+    }
+    /**
+     * Writes the FGL footer if an output stream is attached.
+     */
+    void close()
+    {
+        if (os != nullptr)
+        {
+            *os << fcn::CLOSE_GATES << fcn::CLOSE_FGL;
+            os->flush();
+        }
+    }
+
+    [[nodiscard]] auto x() const noexcept
+    {
+        return dimension.x;
+    }
+
+    [[nodiscard]] auto y() const noexcept
+    {
+        return dimension.y;
+    }
+
+    [[nodiscard]] auto z() const noexcept
+    {
+        return dimension.z;
+    }
+
+    [[nodiscard]] tile above(const tile& t) const noexcept
+    {
+        return {t.x, t.y, 1};
+    }
+
+    [[nodiscard]] tile east(const tile& t) const noexcept
+    {
+        return {t.x + 1, t.y, t.z};
+    }
+
+    [[nodiscard]] tile south(const tile& t) const noexcept
+    {
+        return {t.x, t.y + 1, t.z};
+    }
+
+    [[nodiscard]] bool is_northwards_of(const tile& c1, const tile& c2) const noexcept
+    {
+        return (c1.z == c2.z) && (c1.y > c2.y) && (c1.x == c2.x);
+    }
+
+    [[nodiscard]] bool is_westwards_of(const tile& c1, const tile& c2) const noexcept
+    {
+        return (c1.z == c2.z) && (c1.y == c2.y) && (c1.x > c2.x);
+    }
+
+    [[nodiscard]] bool is_at_eastern_border(const tile& t) const noexcept
+    {
+        return t.x == x();
+    }
+
+    [[nodiscard]] tile eastern_border_of(const tile& t) const noexcept
+    {
+        return {x(), t.y, t.z};
+    }
+    /**
+     * Returns whether the given ground tile is unoccupied. Only ground tiles can be queried.
+     *
+     * @param t Ground tile to check.
+     * @return `true` iff neither the row nor the column of `t` extends over it.
+     */
+    [[nodiscard]] bool is_empty_tile(const tile& t) const noexcept
+    {
+        assert(t.z == 0 && "only ground tiles are tracked");
+
+        return !row_extents[t.y].contains(t.x) && !column_extents[t.x].contains(t.y);
+    }
+    /**
+     * Replacement for `reserve_input_nodes` that stores the names of all primary inputs of the given network and maps
+     * them to their index.
+     *
+     * @tparam Ntk Logic network type.
+     * @param ntk Network whose primary inputs are to be reserved.
+     * @return A map from the network's primary inputs to their index.
+     */
+    template <typename Ntk>
+    [[nodiscard]] mockturtle::node_map<node, Ntk> reserve_input_nodes(const Ntk& ntk)
+    {
+        mockturtle::node_map<node, Ntk> pi_map{ntk};
+
+        pi_names.reserve(ntk.num_pis());
+
+        ntk.foreach_pi(
+            [this, &ntk, &pi_map](const auto& pi)
+            {
+                std::string pi_name{};
+
+                if constexpr (mockturtle::has_has_name_v<Ntk> && mockturtle::has_get_name_v<Ntk>)
+                {
+                    if (const auto pi_signal = ntk.make_signal(pi); ntk.has_name(pi_signal))
+                    {
+                        pi_name = ntk.get_name(pi_signal);
+                    }
+                }
+
+                pi_map[pi] = static_cast<node>(pi_names.size());
+                pi_names.push_back(pi_name.empty() ? fmt::format("pi{}", pi_names.size()) : pi_name);
+            });
+
+        return pi_map;
+    }
+    /**
+     * Places a primary input that has been reserved via `reserve_input_nodes`.
+     *
+     * @param n Index of the primary input.
+     * @param t Tile to place the primary input onto.
+     * @return Signal pointing to the placed primary input.
+     */
+    signal move_node(const node n, const tile& t)
+    {
+        occupy(t);
+        ++num_identities;
+        ++num_nodes;
+
+        write_element("PI", pi_names[n], t, {});
+
+        return t;
+    }
+
+    signal create_buf(const signal& a, const tile& t)
+    {
+        occupy(t, a);
+        ++num_identities;
+        ++num_nodes;
+
+        if (t.z != 0)
+        {
+            ++num_crossing_segments;
+        }
+
+        write_element("BUF", "", t, {a});
+
+        return t;
+    }
+
+    signal create_po(const signal& a, const std::string& name, const tile& t)
+    {
+        // POs are placed at the eastern border after all other elements and are never crossed
+        row_extents[t.y].extend(t.x);
+        ++num_identities;
+        ++num_nodes;
+
+        write_element("PO", name.empty() ? fmt::format("po{}", num_outputs) : name, t, {a});
+        ++num_outputs;
+
+        return t;
+    }
+    /**
+     * Places a 1-input gate in accordance with `fiction::place`.
+     */
+    template <typename Ntk>
+    signal place(const tile& t, const Ntk& ntk, const mockturtle::node<Ntk>& n, const signal& a)
+    {
+        if constexpr (has_is_inv_v<Ntk>)
+        {
+            if (ntk.is_inv(n))
+            {
+                occupy(t);
+                ++num_logic_gates;
+                ++num_nodes;
+
+                write_element("INV", "", t, {a});
+
+                return t;
+            }
+        }
+
+        return create_buf(a, t);
+    }
+    /**
+     * Places a 2-input gate in accordance with `fiction::place`.
+     */
+    template <typename Ntk>
+    signal place(const tile& t, const Ntk& ntk, const mockturtle::node<Ntk>& n, const signal& a, const signal& b,
+                 const std::optional<bool>& c)
+    {
+        occupy(t);
+        ++num_logic_gates;
+        ++num_nodes;
+
+        if (os != nullptr)
+        {
+            if constexpr (mockturtle::has_is_maj_v<Ntk>)
+            {
+                if (ntk.is_maj(n))
+                {
+                    assert(c.has_value());
+
+                    write_element(*c ? "OR" : "AND", "", t, {a, b});
+
+                    return t;
+                }
+            }
+
+            write_element(fgl_gate_type(ntk.node_function(n)), "", t, {a, b});
+        }
+
+        return t;
+    }
+
+    [[nodiscard]] uint64_t num_gates() const noexcept
+    {
+        return num_logic_gates;
+    }
+
+    [[nodiscard]] uint64_t num_wires() const noexcept
+    {
+        return num_identities;
+    }
+
+    [[nodiscard]] uint64_t num_crossings() const noexcept
+    {
+        return num_crossing_segments;
+    }
+    /**
+     * Returns the number of nodes that the emulated layout would contain including the two constants.
+     *
+     * @return Number of all nodes.
+     */
+    [[nodiscard]] uint64_t size() const noexcept
+    {
+        return num_nodes;
+    }
+
+  private:
+    /**
+     * Contiguous range of occupied positions in a row or column.
+     */
+    struct extent
+    {
+        uint64_t begin{std::numeric_limits<uint64_t>::max()};
+        uint64_t end{0ull};
+
+        [[nodiscard]] bool contains(const uint64_t v) const noexcept
+        {
+            return begin <= v && v <= end;
+        }
+
+        void extend(const uint64_t v) noexcept
+        {
+            begin = std::min(begin, v);
+            end   = std::max(end, v);
+        }
+    };
+    /**
+     * Highest possible position in the layout.
+     */
+    const aspect_ratio dimension;
+    /**
+     * Occupied extent of each row and column.
+     */
+    std::vector<extent> row_extents, column_extents;
+    /**
+     * Names of all primary inputs.
+     */
+    std::vector<std::string> pi_names{};
+    /**
+     * Element counters.
+     */
+    uint64_t num_logic_gates{0ull}, num_identities{0ull}, num_crossing_segments{0ull}, num_outputs{0ull};
+    /**
+     * Number of nodes including the two constants.
+     */
+    uint64_t num_nodes{2ull};
+    /**
+     * Output stream to write FGL data into or `nullptr` if elements are only counted.
+     */
+    std::ostream* os{nullptr};
+    /**
+     * ID of the next element that is written.
+     */
+    uint64_t next_id{0ull};
+    /**
+     * Marks a gate tile as occupied, which extends both its row and its column.
+     */
+    void occupy(const tile& t) noexcept
+    {
+        row_extents[t.y].extend(t.x);
+        column_extents[t.x].extend(t.y);
+    }
+    /**
+     * Marks a wire tile as occupied, which extends either its row or its column depending on its incoming signal.
+     */
+    void occupy(const tile& t, const signal& a) noexcept
+    {
+        if (a.y == t.y)
+        {
+            row_extents[t.y].extend(t.x);
+        }
+        else
+        {
+            column_extents[t.x].extend(t.y);
+        }
+    }
+    /**
+     * Writes an element to the attached output stream, if any, in the same way as `write_fgl_layout` does.
+     */
+    void write_element(const std::string_view type, const std::string_view name, const tile& t,
+                       const std::initializer_list<signal> incoming)
+    {
+        if (os != nullptr)
+        {
+            write_fgl_element(*os, next_id++, type, name, t, incoming);
+        }
+    }
+};
+
 template <typename Lyt, typename Ntk>
 class orthogonal_impl
 {
   public:
     orthogonal_impl(const Ntk& src, const orthogonal_physical_design_params& p, orthogonal_physical_design_stats& st) :
-            ntk{mockturtle::fanout_view{fanout_substitution<mockturtle::names_view<technology_network>>(src)}},
+            ntk{st.profile.call_with_phase_timer(
+                "fanout substitution",
+                [&src]
+                {
+                    return mockturtle::fanout_view{
+                        fanout_substitution<mockturtle::names_view<technology_network>>(src)};
+                })},
             ps{p},
             pst{st}
     {}
@@ -442,14 +874,78 @@ class orthogonal_impl
         // measure run time
         mockturtle::stopwatch stop{pst.time_total};
         // compute a coloring
-        const auto ctn = east_south_edge_coloring(ntk);
+        const auto ctn =
+            pst.profile.call_with_phase_timer("edge coloring", [this] { return east_south_edge_coloring(ntk); });
+        // find multi-output nodes
+        const auto multi_output_nodes = find_multi_output_nodes(ctn);
+
+        const auto ar = determine_layout_size<Lyt>(ctn, static_cast<uint32_t>(multi_output_nodes.size()));
+
+        // instantiate the layout
+        Lyt layout{ar, twoddwave_clocking<Lyt>(ps.number_of_clock_phases)};
+
+        if constexpr (is_cartesian_layout_v<Lyt>)
+        {
+            if (ps.two_pass)
+            {
+                // first pass: determine the number of nodes without constructing the layout
+                const auto counting = pst.profile.time_phase("counting pass");
 
-        mockturtle::node_map<mockturtle::signal<Lyt>, decltype(ctn.color_ntk)> node2pos{ctn.color_ntk};
+                orthogonal_layout_stream<Lyt> counter{ar};
+                arrange(counter, ctn, multi_output_nodes);
 
+                layout.reserve_nodes(counter.size());
+            }
+        }
+
+        // (second pass:) arrange the layout
+        pst.profile.call_with_phase_timer("arrangement", [&] { arrange(layout, ctn, multi_output_nodes); });
+
+        collect_statistics(layout);
+
+        return layout;
+    }
+    /**
+     * Runs the algorithm without constructing a layout and writes the result directly to the given output stream in
+     * the FGL format.
+     *
+     * @param os Output stream to write the FGL data into.
+     */
+    void run(std::ostream& os)
+    {
+        // measure run time
+        mockturtle::stopwatch stop{pst.time_total};
+        // compute a coloring
+        const auto ctn =
+            pst.profile.call_with_phase_timer("edge coloring", [this] { return east_south_edge_coloring(ntk); });
         // find multi-output nodes
+        const auto multi_output_nodes = find_multi_output_nodes(ctn);
+
+        const auto ar = determine_layout_size<Lyt>(ctn, static_cast<uint32_t>(multi_output_nodes.size()));
+
+        orthogonal_layout_stream<Lyt> layout{ar, os, ntk.get_network_name(),
+                                             twoddwave_clocking<Lyt>(ps.number_of_clock_phases).name};
+
+        pst.profile.call_with_phase_timer("arrangement", [&] { arrange(layout, ctn, multi_output_nodes); });
+
+        layout.close();
+
+        collect_statistics(layout);
+    }
+
+  private:
+    mockturtle::topo_view<mockturtle::fanout_view<mockturtle::names_view<technology_network>>> ntk;
+
+    orthogonal_physical_design_params ps;
+    orthogonal_physical_design_stats& pst;
+
+    uint32_t po_counter{0};
+
+    template <typename Ctn>
+    [[nodiscard]] std::vector<mockturtle::node<decltype(ntk)>> find_multi_output_nodes(const Ctn& ctn) const
+    {
         std::vector<mockturtle::node<decltype(ntk)>> output_nodes{};
         std::vector<mockturtle::node<decltype(ntk)>> multi_output_nodes{};
-        uint32_t                                     num_multi_output_nodes{0};
 
         ctn.color_ntk.foreach_po(
             [&](const auto& po)
@@ -457,18 +953,42 @@ class orthogonal_impl
                 if (std::find(output_nodes.cbegin(), output_nodes.cend(), po) != output_nodes.cend())
                 {
                     multi_output_nodes.push_back(po);
-                    ++num_multi_output_nodes;
                 }
 
                 output_nodes.push_back(po);
             });
 
-        // instantiate the layout
-        Lyt layout{determine_layout_size<Lyt>(ctn, num_multi_output_nodes),
-                   twoddwave_clocking<Lyt>(ps.number_of_clock_phases)};
+        return multi_output_nodes;
+    }
+    /**
+     * Arranges the colored network on the given target, which is either a gate-level layout of type `Lyt` or an
+     * `orthogonal_layout_stream` thereof.
+     *
+     * @tparam Target Gate-level layout or `orthogonal_layout_stream` type.
+     * @tparam Ctn Coloring container type.
+     * @param layout Target to arrange the network on.
+     * @param ctn Contains the colored network.
+     * @param multi_output_nodes Nodes that drive more than one PO.
+     */
+    template <typename Target, typename Ctn>
+    void arrange(Target& layout, const Ctn& ctn, const std::vector<mockturtle::node<decltype(ntk)>>& multi_output_nodes)
+    {
+        po_counter = 0;
+
+        mockturtle::node_map<mockturtle::signal<Target>, decltype(ctn.color_ntk)> node2pos{ctn.color_ntk};
 
         // reserve PI nodes without positions
-        auto pi2node = reserve_input_nodes(layout, ctn.color_ntk);
+        auto pi2node = [&layout, &ctn]
+        {
+            if constexpr (is_gate_level_layout_v<Target>)
+            {
+                return reserve_input_nodes(layout, ctn.color_ntk);
+            }
+            else
+            {
+                return layout.reserve_input_nodes(ctn.color_ntk);
+            }
+        }();
 
         // first x-pos to use for gates is 1 because PIs take up the 0th column
         tile<Lyt> latest_pos{1, 0};
@@ -617,26 +1137,24 @@ class orthogonal_impl
         // place outputs after the main algorithm to handle possible multi-output or unordered nodes
         place_outputs(layout, ctn, po_counter, node2pos);
 
-        // restore possibly set signal names
-        restore_names(ctn.color_ntk, layout, node2pos);
-
-        // statistical information
+        if constexpr (is_gate_level_layout_v<Target>)
+        {
+            // restore possibly set signal names
+            restore_names(ctn.color_ntk, layout, node2pos);
+        }
+    }
+    /**
+     * Fills the statistics with information about the given (emulated) layout.
+     */
+    template <typename Target>
+    void collect_statistics(const Target& layout) const noexcept
+    {
         pst.x_size        = layout.x() + 1;
         pst.y_size        = layout.y() + 1;
         pst.num_gates     = layout.num_gates();
         pst.num_wires     = layout.num_wires();
         pst.num_crossings = layout.num_crossings();
-
-        return layout;
     }
-
-  private:
-    mockturtle::topo_view<mockturtle::fanout_view<mockturtle::names_view<technology_network>>> ntk;
-
-    orthogonal_physical_design_params ps;
-    orthogonal_physical_design_stats& pst;
-
-    uint32_t po_counter{0};
 };
 
 }  // namespace detail
@@ -689,17 +1207,96 @@ Lyt orthogonal(const Ntk& ntk, orthogonal_physical_design_params ps = {},
         throw high_degree_fanin_exception();
     }
 
-    orthogonal_physical_design_stats  st{};
-    detail::orthogonal_impl<Lyt, Ntk> p{ntk, ps, st};
+    orthogonal_physical_design_stats st{};
+
+    std::optional<Lyt> result{};
+    {
+        const auto memory = st.profile.track_memory();
 
-    auto result = p.run();
+        detail::orthogonal_impl<Lyt, Ntk> p{ntk, ps, st};
+
+        result = p.run();
+    }
 
     if (pst)
     {
         *pst = st;
     }
 
-    return result;
+    return std::move(*result);
+}
+
+/**
+ * Runs the orthogonal physical design algorithm on the given network and writes the resulting Cartesian layout
+ * directly to the given output stream in the FGL format instead of constructing it in memory. Only the occupied extent
+ * of each row and column is stored during placement such that memory consumption no longer depends on the number of
+ * wire segments. This enables the processing of networks whose layouts would otherwise not fit into main memory. The
+ * written layout is equal to the one returned by `orthogonal` and can be read via `read_fgl_layout`.
+ *
+ * May throw a high_degree_fanin_exception if `ntk` contains any node with a fan-in larger than 2.
+ *
+ * @tparam Lyt Cartesian gate-level layout type that is emulated.
+ * @tparam Ntk Network type that acts as specification.
+ * @param ntk The network that is to place and route.
+ * @param os The output stream to write into.
+ * @param ps Parameters.
+ * @param pst Statistics.
+ */
+template <typename Lyt, typename Ntk>
+void write_orthogonal_fgl_layout(const Ntk& ntk, std::ostream& os, orthogonal_physical_design_params ps = {},
+                                 orthogonal_physical_design_stats* pst = nullptr)
+{
+    static_assert(is_gate_level_layout_v<Lyt>, "Lyt is not a gate-level layout");
+    static_assert(is_cartesian_layout_v<Lyt>, "Lyt is not a Cartesian layout");
+    static_assert(mockturtle::is_network_type_v<Ntk>, "Ntk is not a network type");
+
+    // check for input degree
+    if (has_high_degree_fanin_nodes(ntk, 2))
+    {
+        throw high_degree_fanin_exception();
+    }
+
+    orthogonal_physical_design_stats st{};
+    {
+        const auto memory = st.profile.track_memory();
+
+        detail::orthogonal_impl<Lyt, Ntk> p{ntk, ps, st};
+
+        p.run(os);
+    }
+
+    if (pst)
+    {
+        *pst = st;
+    }
+}
+/**
+ * Runs the orthogonal physical design algorithm on the given network and writes the resulting Cartesian layout
+ * directly to a file in the FGL format.
+ *
+ * This overload uses a file name to create and write into.
+ *
+ * @tparam Lyt Cartesian gate-level layout type that is emulated.
+ * @tparam Ntk Network type that acts as specification.
+ * @param ntk The network that is to place and route.
+ * @param filename The file name to create and write into. Should preferably use the .fgl extension.
+ * @param ps Parameters.
+ * @param pst Statistics.
+ */
+template <typename Lyt, typename Ntk>
+void write_orthogonal_fgl_layout(const Ntk& ntk, const std::string_view& filename,
+                                 orthogonal_physical_design_params ps = {},
+                                 orthogonal_physical_design_stats* pst = nullptr)
+{
+    std::ofstream os{filename.data(), std::ofstream::out};
+
+    if (!os.is_open())
+    {
+        throw std::ofstream::failure("could not open file");
+    }
+
+    write_orthogonal_fgl_layout<Lyt>(ntk, os, ps, pst);
+    os.close();
 }
 
 }  // namespace fiction
@@ -16,20 +16,27 @@
 #include "fiction/layouts/clocking_scheme.hpp"
 #include "fiction/layouts/obstruction_layout.hpp"
 #include "fiction/traits.hpp"
+#include "fiction/utils/performance_profile.hpp"
 #include "fiction/utils/routing_utils.hpp"
 
 #include <mockturtle/traits.hpp>
 #include <mockturtle/utils/stopwatch.hpp>
+#include <nlohmann/json.hpp>
 #include <phmap.h>
 
 #include <algorithm>
+#include <atomic>
 #include <chrono>
 #include <cmath>
+#include <cstddef>
 #include <cstdint>
 #include <iostream>
 #include <limits>
 #include <optional>
 #include <ostream>
+#include <queue>
+#include <system_error>
+#include <thread>
 #include <unordered_set>
 #include <utility>
 #include <vector>
@@ -62,6 +69,27 @@ struct post_layout_optimization_params
      * at every algorithm step and the functional correctness has to be ensured by completing essential algorithm steps.
      */
     uint64_t timeout = std::numeric_limits<uint64_t>::max();
+    /**
+     * Relocate gates in batches of consecutive gates whose footprints, i.e., the regions that their relocations can
+     * affect, are disjoint. The gates of a batch are relocated concurrently on separate copies of the layout. In this
+     * mode, rerouting is restricted to the footprint of the respective gate, which makes the result independent of the
+     * batch composition and thus of `num_threads`. Defaults to false.
+     */
+    bool parallel_relocation = false;
+    /**
+     * Number of threads to use if `parallel_relocation` is enabled. If set to 0, the number of hardware threads is
+     * used.
+     */
+    uint64_t num_threads = 0ull;
+    /**
+     * Visit gates in the order of their estimated gain instead of diagonally. The gain of a gate estimates how far it
+     * could move towards the origin, i.e., the difference between the diagonal of its position and the diagonal of the
+     * bottom-right corner of its fan-ins' bounding box. Gates without gain are not visited at all. After a gate has
+     * been moved, only its fan-ins and fan-outs are re-scored and visited again. Thereby, most of the area reduction is
+     * usually achieved with a fraction of the relocation attempts. This option is ignored if `parallel_relocation` is
+     * enabled. Defaults to false.
+     */
+    bool gain_driven_relocation = false;
 };
 
 /**
@@ -109,6 +137,15 @@ struct post_layout_optimization_stats
      * Number of crossings after the post-layout optimization process.
      */
     uint64_t num_crossings_after{0ull};
+    /**
+     * Number of gate relocation attempts.
+     */
+    uint64_t num_relocation_attempts{0ull};
+    /**
+     * Time spent in wiring reduction, gate relocation, and output optimization as well as the memory usage of the
+     * entire process.
+     */
+    performance_profile profile{};
     /**
      * Reports the statistics to the given output stream.
      *
@@ -125,8 +162,35 @@ struct post_layout_optimization_stats
         out << fmt::format("[i] num. wires after optimization       = {}\n", num_wires_after);
         out << fmt::format("[i] num. crossings before optimization  = {}\n", num_crossings_before);
         out << fmt::format("[i] num. crossings after optimization   = {}\n", num_crossings_after);
+        out << fmt::format("[i] num. relocation attempts            = {}\n", num_relocation_attempts);
+
+        profile.report(out);
     }
 };
+/**
+ * Converts post-layout optimization statistics into JSON.
+ *
+ * @param j JSON value to write to.
+ * @param stats Statistics to convert.
+ */
+inline void to_json(nlohmann::json& j, const post_layout_optimization_stats& stats)
+{
+    j = {{"runtime in seconds", mockturtle::to_seconds(stats.time_total)},
+         {"number of wires before", stats.num_wires_before},
+         {"number of wires after", stats.num_wires_after},
+         {"number of crossings before", stats.num_crossings_before},
+         {"number of crossings after", stats.num_crossings_after},
+         {"number of relocation attempts", stats.num_relocation_attempts},
+         {"layout before",
+          {{"x-size", stats.x_size_before},
+           {"y-size", stats.y_size_before},
+           {"area", stats.x_size_before * stats.y_size_before}}},
+         {"layout after",
+          {{"x-size", stats.x_size_after},
+           {"y-size", stats.y_size_after},
+           {"area", stats.x_size_after * stats.y_size_after}}},
+         {"profile", stats.profile}};
+}
 
 namespace detail
 {
@@ -339,6 +403,117 @@ void optimize_output_positions(Lyt& lyt) noexcept
         }
     }
 }
+/**
+ * The footprint of a gate relocation is the rectangular region of the ground layer and the crossing layer that contains
+ * the gate, its fan-ins and fan-outs, their wiring, and all candidate positions. In 2DDWave-clocked layouts, any path
+ * between two tiles lies within their bounding box. Hence, relocating the gate neither modifies nor depends on tiles
+ * outside its footprint if rerouting is restricted to it, apart from reading and relinking directly adjacent tiles.
+ */
+struct relocation_footprint
+{
+    /**
+     * Minimum x-coordinate.
+     */
+    uint64_t min_x{0ull};
+    /**
+     * Minimum y-coordinate.
+     */
+    uint64_t min_y{0ull};
+    /**
+     * Maximum x-coordinate.
+     */
+    uint64_t max_x{0ull};
+    /**
+     * Maximum y-coordinate.
+     */
+    uint64_t max_y{0ull};
+    /**
+     * Checks whether the given coordinate lies within the footprint.
+     *
+     * @tparam Coord Coordinate type.
+     * @param c Coordinate to check.
+     * @return `true` iff `c` lies within the footprint.
+     */
+    template <typename Coord>
+    [[nodiscard]] bool contains(const Coord& c) const noexcept
+    {
+        return static_cast<uint64_t>(c.x) >= min_x && static_cast<uint64_t>(c.x) <= max_x &&
+               static_cast<uint64_t>(c.y) >= min_y && static_cast<uint64_t>(c.y) <= max_y;
+    }
+    /**
+     * Checks whether the relocations of two gates could interfere, i.e., whether the footprints extended by the
+     * adjacent tiles overlap.
+     *
+     * @param other Footprint to compare with.
+     * @return `true` iff the relocations with this and the `other` footprint cannot be performed independently.
+     */
+    [[nodiscard]] bool conflicts_with(const relocation_footprint& other) const noexcept
+    {
+        // a relocation accesses its footprint and the tiles directly adjacent to it, i.e., the footprint extended by 1
+        // in each direction; two such extended regions are disjoint iff the footprints are more than 2 tiles apart
+        return min_x <= other.max_x + 2 && other.min_x <= max_x + 2 && min_y <= other.max_y + 2 &&
+               other.min_y <= max_y + 2;
+    }
+};
+/**
+ * A view of an obstruction layout that additionally considers all coordinates outside a given footprint as obstructed.
+ * It is used to restrict path finding to the footprint of a gate relocation.
+ *
+ * @tparam Lyt Obstruction layout type.
+ */
+template <typename Lyt>
+class footprint_obstruction_view : public Lyt
+{
+  public:
+    /**
+     * Standard constructor.
+     *
+     * @param lyt Obstruction layout.
+     * @param fp Footprint outside of which all coordinates are considered obstructed.
+     */
+    footprint_obstruction_view(const Lyt& lyt, const relocation_footprint& fp) : Lyt(lyt), footprint{fp}
+    {
+        static_assert(has_is_obstructed_coordinate_v<Lyt>, "Lyt is not an obstruction layout");
+    }
+    /**
+     * Checks if the given coordinate lies outside the footprint or is obstructed in the underlying layout.
+     *
+     * @param c Coordinate to check.
+     * @return `true` iff `c` is obstructed.
+     */
+    [[nodiscard]] bool is_obstructed_coordinate(const coordinate<Lyt>& c) const noexcept
+    {
+        return !footprint.contains(c) || Lyt::is_obstructed_coordinate(c);
+    }
+
+  private:
+    /**
+     * Footprint to which path finding is restricted.
+     */
+    const relocation_footprint footprint;
+};
+/**
+ * The outcome of a gate relocation attempt. It allows to reproduce the attempt on another copy of the layout without
+ * searching for a new position again.
+ *
+ * @tparam Lyt Cartesian gate-level layout type.
+ */
+template <typename Lyt>
+struct gate_relocation
+{
+    /**
+     * Original position of the gate.
+     */
+    tile<Lyt> old_pos{};
+    /**
+     * Position at which the gate was rerouted, or `std::nullopt` if its original wiring was restored.
+     */
+    std::optional<tile<Lyt>> new_pos{std::nullopt};
+    /**
+     * Whether the gate was moved to a better position.
+     */
+    bool improved{false};
+};
 /**
  * Custom comparison function for sorting tiles based on the sum of their coordinates that breaks ties based on the
  * x-coordinate.
@@ -401,6 +576,8 @@ class post_layout_optimization_impl
 
             if (!timeout_limit_reached)
             {
+                const auto wiring = pst.profile.time_phase("wiring reduction");
+
                 fiction::wiring_reduction(layout, wiring_reduction_params, &wiring_reduction_stats);
             }
         }
@@ -416,7 +593,10 @@ class post_layout_optimization_impl
 
                 if (moved_at_least_one_gate && !ps.optimize_pos_only && !timeout_limit_reached)
                 {
-                    fiction::wiring_reduction(layout, wiring_reduction_params, &wiring_reduction_stats);
+                    pst.profile.call_with_phase_timer(
+                        "wiring reduction",
+                        [this, &layout]
+                        { fiction::wiring_reduction(layout, wiring_reduction_params, &wiring_reduction_stats); });
 
                     // check if wiring reduction made any improvements
                     if (wiring_reduction_stats.area_improvement != 0ull ||
@@ -426,6 +606,8 @@ class post_layout_optimization_impl
                     }
                 }
 
+                const auto relocation_phase = pst.profile.time_phase("gate relocation");
+
                 // gather all relevant gate tiles for relocation
                 std::vector<tile<Lyt>> gate_tiles{};
                 gate_tiles.reserve(layout.num_gates() + layout.num_pis() - layout.num_pos());
@@ -458,21 +640,35 @@ class post_layout_optimization_impl
                 // reset the gate movement flag
                 moved_at_least_one_gate = false;
 
-                // attempt to relocate each gate tile
-                for (const auto& gate_tile : gate_tiles)
+                if (ps.parallel_relocation)
                 {
-                    if (!timeout_limit_reached)
+                    moved_at_least_one_gate = relocate_gates_in_batches(layout, gate_tiles);
+                }
+                else if (ps.gain_driven_relocation)
+                {
+                    moved_at_least_one_gate = relocate_gates_by_gain(layout, gate_tiles);
+                }
+                else
+                {
+                    // attempt to relocate each gate tile
+                    for (const auto& gate_tile : gate_tiles)
                     {
-                        if (!ps.optimize_pos_only || (ps.optimize_pos_only && layout.is_po_tile(gate_tile)))
+                        if (!timeout_limit_reached)
                         {
-                            if (improve_gate_location(layout, gate_tile))
+                            if (!ps.optimize_pos_only || (ps.optimize_pos_only && layout.is_po_tile(gate_tile)))
                             {
-                                moved_at_least_one_gate = true;
+                                gate_relocation<ObstrLyt> relocation{gate_tile};
+                                ++pst.num_relocation_attempts;
+
+                                if (improve_gate_location(layout, relocation, astar_context))
+                                {
+                                    moved_at_least_one_gate = true;
+                                }
                             }
-                        }
 
-                        // update the remaining timeout after each relocation attempt
-                        update_timeout();
+                            // update the remaining timeout after each relocation attempt
+                            update_timeout();
+                        }
                     }
                 }
 
@@ -485,6 +681,8 @@ class post_layout_optimization_impl
         // if the optimization did not time out, optimize the output positions
         if (!timeout_limit_reached)
         {
+            const auto output_optimization = pst.profile.time_phase("output optimization");
+
             optimize_output_positions(layout);
         }
 
@@ -537,9 +735,9 @@ class post_layout_optimization_impl
      */
     tile<Lyt> max_non_po{0, 0};
     /**
-     * Timeout limit reached.
+     * Timeout limit reached. It is shared by all threads if gates are relocated in parallel.
      */
-    bool timeout_limit_reached = false;
+    std::atomic<bool> timeout_limit_reached{false};
     /**
      * Wiring reduction parameters.
      */
@@ -548,6 +746,10 @@ class post_layout_optimization_impl
      * Wiring reduction stats.
      */
     fiction::wiring_reduction_stats wiring_reduction_stats{};
+    /**
+     * Search context that is reused by all A* calls during sequential gate relocation.
+     */
+    a_star_context<ObstrLyt> astar_context{};
     /**
      * Utility function to move wires that cross over empty tiles down one layer. This can happen if the wiring of a
      * gate is deleted.
@@ -649,10 +851,11 @@ class post_layout_optimization_impl
         auto fanout1 = tile<ObstrLyt>{};
         auto fanout2 = tile<ObstrLyt>{};
 
+        // gates have at most two fan-ins and two fan-outs
         phmap::parallel_flat_hash_set<tile<ObstrLyt>> fanins_set{};
-        fanins_set.reserve(lyt.num_wires() + lyt.num_gates() - 2);
+        fanins_set.reserve(2);
         phmap::parallel_flat_hash_set<tile<ObstrLyt>> fanouts_set{};
-        fanouts_set.reserve(lyt.num_wires() + lyt.num_gates() - 2);
+        fanouts_set.reserve(2);
 
         lyt.foreach_fanin(lyt.get_node(op),
                           [&lyt, &fanins_set, &op, &fanin1, &fanin2, &ffd, this](const auto& fin)
@@ -754,18 +957,35 @@ class post_layout_optimization_impl
      * @param lyt Obstructed gate-level layout.
      * @param start_tile The starting coordinate of the path.
      * @param end_tile The ending coordinate of the path.
+     * @param context Search context to use for A*.
+     * @param footprint If given, the path is restricted to this footprint.
      * @return The computed path as a sequence of coordinates in the layout.
      */
     layout_coordinate_path<ObstrLyt> get_path_and_obstruct(ObstrLyt& lyt, const tile<ObstrLyt>& start_tile,
-                                                           const tile<ObstrLyt>& end_tile)
+                                                           const tile<ObstrLyt>& end_tile,
+                                                           a_star_context<ObstrLyt>& context,
+                                                           const std::optional<relocation_footprint>& footprint)
     {
-        using dist = twoddwave_distance_functor<ObstrLyt, uint64_t>;
-        using cost = unit_cost_functor<ObstrLyt, uint8_t>;
-        static a_star_params astar_params{};
+        a_star_params astar_params{};
         astar_params.crossings = !ps.planar_optimization;
 
-        const auto path =
-            a_star<layout_coordinate_path<ObstrLyt>>(lyt, {start_tile, end_tile}, dist(), cost(), astar_params);
+        layout_coordinate_path<ObstrLyt> path{};
+
+        if (footprint.has_value())
+        {
+            using view_lyt = footprint_obstruction_view<ObstrLyt>;
+
+            path = a_star<layout_coordinate_path<ObstrLyt>>(
+                view_lyt{lyt, *footprint}, {start_tile, end_tile}, context,
+                twoddwave_distance_functor<view_lyt, uint64_t>(), unit_cost_functor<view_lyt, uint8_t>(),
+                astar_params);
+        }
+        else
+        {
+            path = a_star<layout_coordinate_path<ObstrLyt>>(lyt, {start_tile, end_tile}, context,
+                                                            twoddwave_distance_functor<ObstrLyt, uint64_t>(),
+                                                            unit_cost_functor<ObstrLyt, uint8_t>(), astar_params);
+        }
 
         // obstruct the tiles along the computed path.
         for (const auto& tile : path)
@@ -802,14 +1022,17 @@ class post_layout_optimization_impl
      * @param moved_gate           Reference to a boolean flag that will be set to `true` if the gate is successfully
      * moved.
      * @param old_pos              The original tile position of the gate before the relocation attempt.
+     * @param context              Search context to use for rerouting.
+     * @param footprint            If given, rerouting is restricted to this footprint.
      *
      * @return `true` if the gate was successfully relocated to `new_pos` and all routing paths were established.
      *         `false` if the relocation resulted in no movement (i.e., `new_pos` is the same as `old_pos`).
      */
     bool check_new_position(ObstrLyt& lyt, const tile<ObstrLyt>& new_pos, uint64_t& num_gate_relocations,
                             tile<ObstrLyt>& current_pos, const std::vector<tile<Lyt>>& fanins,
-                            const std::vector<tile<Lyt>>& fanouts, bool& moved_gate,
-                            const tile<ObstrLyt>& old_pos) noexcept
+                            const std::vector<tile<Lyt>>& fanouts, bool& moved_gate, const tile<ObstrLyt>& old_pos,
+                            a_star_context<ObstrLyt>& context,
+                            const std::optional<relocation_footprint>& footprint) noexcept
     {
         if (lyt.is_empty_tile(new_pos) && lyt.is_empty_tile({new_pos.x, new_pos.y, 1}))
         {
@@ -827,22 +1050,22 @@ class post_layout_optimization_impl
             // get paths for fanins and fanouts
             if (!fanins.empty())
             {
-                new_path_from_fanin_1_to_gate = get_path_and_obstruct(lyt, fanins[0], new_pos);
+                new_path_from_fanin_1_to_gate = get_path_and_obstruct(lyt, fanins[0], new_pos, context, footprint);
             }
 
             if (fanins.size() == 2)
             {
-                new_path_from_fanin_2_to_gate = get_path_and_obstruct(lyt, fanins[1], new_pos);
+                new_path_from_fanin_2_to_gate = get_path_and_obstruct(lyt, fanins[1], new_pos, context, footprint);
             }
 
             if (!fanouts.empty())
             {
-                new_path_from_gate_to_fanout_1 = get_path_and_obstruct(lyt, new_pos, fanouts[0]);
+                new_path_from_gate_to_fanout_1 = get_path_and_obstruct(lyt, new_pos, fanouts[0], context, footprint);
             }
 
             if (fanouts.size() == 2)
             {
-                new_path_from_gate_to_fanout_2 = get_path_and_obstruct(lyt, new_pos, fanouts[1]);
+                new_path_from_gate_to_fanout_2 = get_path_and_obstruct(lyt, new_pos, fanouts[1], context, footprint);
             }
 
             if (!(!fanins.empty() && new_path_from_fanin_1_to_gate.empty()) &&
@@ -1002,16 +1225,31 @@ class post_layout_optimization_impl
      * - if a new coordinate is found and wiring is possible, it is applied and incoming signals are updated
      * - if no better coordinate is found, the old wiring is restored
      *
+     * If `replay` is `true`, no coordinates are tested. Instead, the outcome stored in `relocation` is reproduced. This
+     * requires a layout that coincides with the one of the original attempt within the footprint of the relocation.
+     *
      * @param lyt Obstructed gate-level layout.
-     * @param old_pos Old position of the gate to be moved.
+     * @param relocation Relocation attempt that contains the old position of the gate to be moved. Its outcome is
+     * stored in it unless `replay` is `true`.
+     * @param context Search context to use for rerouting.
+     * @param replay Whether to reproduce the outcome stored in `relocation`.
      * @return `true` if the gate was moved successfully, `false` otherwise.
      */
-    bool improve_gate_location(ObstrLyt& lyt, const tile<ObstrLyt>& old_pos) noexcept
+    bool improve_gate_location(ObstrLyt& lyt, gate_relocation<ObstrLyt>& relocation, a_star_context<ObstrLyt>& context,
+                               const bool replay = false) noexcept
     {
+        const auto old_pos = relocation.old_pos;
+
         const auto& [fanins, fanouts, to_clear, old_path_from_fanin_1_to_gate, old_path_from_fanin_2_to_gate,
                      old_path_from_gate_to_fanout_1, old_path_from_gate_to_fanout_2] =
             get_fanin_and_fanouts(lyt, old_pos);
 
+        if (!replay)
+        {
+            relocation.new_pos  = std::nullopt;
+            relocation.improved = false;
+        }
+
         uint64_t min_x = 0;
         uint64_t min_y = 0;
 
@@ -1032,6 +1270,11 @@ class post_layout_optimization_impl
 
         auto new_pos = tile<ObstrLyt>{};
 
+        // restrict rerouting to the footprint of the relocation to make it independent of all other tiles
+        const auto footprint = ps.parallel_relocation ?
+                                   std::make_optional(determine_footprint(lyt, old_pos, fanins, fanouts)) :
+                                   std::nullopt;
+
         // if gate is directly connected to one of its fanins, no improvement is possible
         for (const auto& fanin : fanins)
         {
@@ -1085,8 +1328,16 @@ class post_layout_optimization_impl
 
         uint64_t num_gate_relocations = 0;
 
+        // reproduce the outcome of the original attempt instead of testing coordinates
+        if (replay && relocation.new_pos.has_value() &&
+            !check_new_position(lyt, *relocation.new_pos, num_gate_relocations, current_pos, fanins, fanouts,
+                                moved_gate, old_pos, context, footprint))
+        {
+            return false;
+        }
+
         // iterate over layout diagonally
-        for (uint64_t k = 0; k < lyt.x() + lyt.y() + 1; ++k)
+        for (uint64_t k = 0; !replay && k < lyt.x() + lyt.y() + 1; ++k)
         {
             for (uint64_t x = 0; x < k + 1; ++x)
             {
@@ -1108,8 +1359,11 @@ class post_layout_optimization_impl
                 {
                     new_pos = tile<ObstrLyt>{x, y};
                     if (!check_new_position(lyt, new_pos, num_gate_relocations, current_pos, fanins, fanouts,
-                                            moved_gate, old_pos))
+                                            moved_gate, old_pos, context, footprint))
                     {
+                        // the gate was rerouted at its original position
+                        relocation.new_pos = new_pos;
+
                         return false;
                     }
                 }
@@ -1130,8 +1384,339 @@ class post_layout_optimization_impl
             return false;
         }
 
+        if (!replay)
+        {
+            relocation.new_pos  = current_pos;
+            relocation.improved = true;
+        }
+
         return true;
     }
+    /**
+     * Determines the footprint of relocating the gate at `old_pos`, i.e., the bounding box of the gate, its fan-ins and
+     * fan-outs, and all candidate positions that `improve_gate_location` may test.
+     *
+     * @param lyt Obstructed gate-level layout.
+     * @param old_pos Position of the gate to be moved.
+     * @param fanins Fan-ins of the gate.
+     * @param fanouts Fan-outs of the gate.
+     * @return Footprint of the relocation.
+     */
+    [[nodiscard]] relocation_footprint determine_footprint(const ObstrLyt& lyt, const tile<ObstrLyt>& old_pos,
+                                                           const std::vector<tile<Lyt>>& fanins,
+                                                           const std::vector<tile<Lyt>>& fanouts) const noexcept
+    {
+        const auto max_diagonal = static_cast<uint64_t>(old_pos.x + old_pos.y);
+
+        // candidate positions lie to the bottom right of all fan-ins
+        uint64_t min_candidate_x = 0;
+        uint64_t min_candidate_y = 0;
+
+        relocation_footprint footprint{0, 0, old_pos.x, old_pos.y};
+
+        if (!fanins.empty())
+        {
+            footprint.min_x = std::numeric_limits<uint64_t>::max();
+            footprint.min_y = std::numeric_limits<uint64_t>::max();
+        }
+
+        for (const auto& fanin : fanins)
+        {
+            footprint.min_x = std::min(footprint.min_x, static_cast<uint64_t>(fanin.x));
+            footprint.min_y = std::min(footprint.min_y, static_cast<uint64_t>(fanin.y));
+
+            min_candidate_x = std::max(min_candidate_x, static_cast<uint64_t>(fanin.x));
+            min_candidate_y = std::max(min_candidate_y, static_cast<uint64_t>(fanin.y));
+        }
+
+        for (const auto& fanout : fanouts)
+        {
+            footprint.max_x = std::max(footprint.max_x, static_cast<uint64_t>(fanout.x));
+            footprint.max_y = std::max(footprint.max_y, static_cast<uint64_t>(fanout.y));
+        }
+
+        // candidate positions do not exceed the layout boundaries and the diagonal of the gate
+        footprint.max_x = std::max(footprint.max_x, std::min(static_cast<uint64_t>(lyt.x()),
+                                                             max_diagonal - std::min(min_candidate_y, max_diagonal)));
+        footprint.max_y = std::max(footprint.max_y, std::min(static_cast<uint64_t>(lyt.y()),
+                                                             max_diagonal - std::min(min_candidate_x, max_diagonal)));
+
+        return footprint;
+    }
+    /**
+     * Relocates the given gates in batches. Each batch consists of consecutive gates whose footprints do not conflict.
+     * Its gates are relocated concurrently, each on a different copy of the layout. Afterward, the outcome of each
+     * relocation is replayed on all other copies to synchronize them. Since rerouting is restricted to the footprints,
+     * the result equals the one of relocating the gates one after another.
+     *
+     * @param layout Obstructed gate-level layout.
+     * @param gate_tiles Gate tiles sorted by `compare_gate_tiles`.
+     * @return `true` if at least one gate was moved, `false` otherwise.
+     */
+    bool relocate_gates_in_batches(ObstrLyt& layout, const std::vector<tile<Lyt>>& gate_tiles)
+    {
+        const auto num_workers = static_cast<std::size_t>(
+            ps.num_threads == 0 ? std::max(std::thread::hardware_concurrency(), 1u) : ps.num_threads);
+
+        // the first worker operates on the layout itself, all others on deep copies
+        std::vector<ObstrLyt> copies{};
+        copies.reserve(num_workers - 1);
+
+        for (std::size_t w = 1; w < num_workers; ++w)
+        {
+            copies.push_back(layout.clone());
+        }
+
+        const auto worker_layout = [&layout, &copies](const std::size_t w) -> ObstrLyt&
+        { return w == 0 ? layout : copies[w - 1]; };
+
+        std::vector<a_star_context<ObstrLyt>> contexts(num_workers);
+
+        // runs the given function for the first n workers concurrently; since each worker operates on its own layout
+        // copy and search context, workers for which no thread can be created are run on the calling thread instead
+        const auto for_each_worker = [](const std::size_t n, const auto& fn)
+        {
+            std::vector<std::thread> threads{};
+            threads.reserve(n);
+
+            std::size_t w = 1;
+
+            try
+            {
+                for (; w < n; ++w)
+                {
+                    threads.emplace_back(fn, w);
+                }
+            }
+            catch (const std::system_error&)
+            {
+                // fall through to run the remaining workers sequentially
+            }
+
+            fn(std::size_t{0});
+
+            for (; w < n; ++w)
+            {
+                fn(w);
+            }
+
+            for (auto& t : threads)
+            {
+                t.join();
+            }
+        };
+
+        bool moved_at_least_one_gate = false;
+
+        std::vector<gate_relocation<ObstrLyt>> batch{};
+        std::vector<relocation_footprint>      footprints{};
+
+        for (std::size_t next = 0; next < gate_tiles.size() && !timeout_limit_reached;)
+        {
+            batch.clear();
+            footprints.clear();
+
+            // assemble the next batch of consecutive gates
+            while (next < gate_tiles.size() && batch.size() < num_workers)
+            {
+                const auto& gate_tile = gate_tiles[next];
+
+                if (ps.optimize_pos_only && !layout.is_po_tile(gate_tile))
+                {
+                    ++next;
+                    continue;
+                }
+
+                const auto ffd       = get_fanin_and_fanouts(layout, gate_tile);
+                const auto footprint = determine_footprint(layout, gate_tile, ffd.fanins, ffd.fanouts);
+
+                if (std::any_of(footprints.cbegin(), footprints.cend(),
+                                [&footprint](const auto& fp) { return fp.conflicts_with(footprint); }))
+                {
+                    break;
+                }
+
+                batch.push_back({gate_tile});
+                footprints.push_back(footprint);
+                ++next;
+            }
+
+            if (batch.empty())
+            {
+                break;
+            }
+
+            pst.num_relocation_attempts += batch.size();
+
+            // relocate all gates of the batch concurrently
+            for_each_worker(batch.size(), [this, &batch, &contexts, &worker_layout](const std::size_t w)
+                            { improve_gate_location(worker_layout(w), batch[w], contexts[w]); });
+
+            // synchronize the copies by replaying the relocations that were performed on other copies
+            for_each_worker(num_workers,
+                            [this, &batch, &contexts, &worker_layout](const std::size_t w)
+                            {
+                                for (std::size_t i = 0; i < batch.size(); ++i)
+                                {
+                                    if (i != w)
+                                    {
+                                        improve_gate_location(worker_layout(w), batch[i], contexts[w], true);
+                                    }
+                                }
+                            });
+
+            if (std::any_of(batch.cbegin(), batch.cend(), [](const auto& r) { return r.improved; }))
+            {
+                moved_at_least_one_gate = true;
+            }
+
+            // update the remaining timeout after each batch
+            update_timeout();
+        }
+
+        return moved_at_least_one_gate;
+    }
+    /**
+     * Checks whether the given tile holds a gate that is subject to relocation, i.e., a non-wire gate, a fan-out, a PI,
+     * or a PO.
+     *
+     * @param lyt Obstructed gate-level layout.
+     * @param t Tile to check.
+     * @return `true` iff the gate at `t` can be relocated.
+     */
+    [[nodiscard]] bool is_relocatable_gate_tile(const ObstrLyt& lyt, const tile<ObstrLyt>& t) const noexcept
+    {
+        if (lyt.is_empty_tile(t))
+        {
+            return false;
+        }
+
+        const auto node = lyt.get_node(t);
+
+        return (lyt.is_gate(node) && !lyt.is_wire(node)) || lyt.is_fanout(node) || lyt.is_pi_tile(t) ||
+               lyt.is_po_tile(t);
+    }
+    /**
+     * Estimates the gain of relocating the gate at the given tile, i.e., the difference between the diagonal of its
+     * position and the diagonal of the bottom-right corner of its fan-ins' bounding box. No position on a smaller
+     * diagonal can be reached. If the gate is directly connected to one of its fan-ins, it cannot be moved at all.
+     *
+     * @param lyt Obstructed gate-level layout.
+     * @param pos Position of the gate.
+     * @return Estimated number of diagonals that the gate could move towards the origin.
+     */
+    [[nodiscard]] uint64_t estimate_relocation_gain(const ObstrLyt& lyt, const tile<ObstrLyt>& pos) noexcept
+    {
+        const auto ffd = get_fanin_and_fanouts(lyt, pos);
+
+        uint64_t min_x = 0;
+        uint64_t min_y = 0;
+
+        for (const auto& fanin : ffd.fanins)
+        {
+            for (const auto& i : lyt.incoming_data_flow(pos))
+            {
+                if (i == fanin)
+                {
+                    return 0;
+                }
+            }
+
+            min_x = std::max(min_x, static_cast<uint64_t>(fanin.x));
+            min_y = std::max(min_y, static_cast<uint64_t>(fanin.y));
+        }
+
+        const auto diagonal = static_cast<uint64_t>(pos.x + pos.y);
+
+        return diagonal > min_x + min_y ? diagonal - (min_x + min_y) : 0;
+    }
+    /**
+     * Relocates the given gates in the order of their estimated gain (see `estimate_relocation_gain`). Ties are broken
+     * by `compare_gate_tiles`. Scores are updated lazily: if the gain of a gate changed since it was queued, it is
+     * queued again with its current gain instead of being relocated. After a gate has been moved, its fan-ins and
+     * fan-outs are queued again because their wiring changed.
+     *
+     * @param layout Obstructed gate-level layout.
+     * @param gate_tiles Tiles of all gates to relocate.
+     * @return `true` if at least one gate was moved, `false` otherwise.
+     */
+    bool relocate_gates_by_gain(ObstrLyt& layout, const std::vector<tile<Lyt>>& gate_tiles)
+    {
+        using entry = std::pair<uint64_t, tile<ObstrLyt>>;
+
+        // the entry with the highest gain and, among those, the smallest diagonal is on top
+        const auto lower_priority = [](const entry& a, const entry& b)
+        { return a.first < b.first || (a.first == b.first && compare_gate_tiles<Lyt>(b.second, a.second)); };
+
+        std::priority_queue<entry, std::vector<entry>, decltype(lower_priority)> queue{lower_priority};
+        phmap::flat_hash_set<tile<ObstrLyt>>                                     queued{};
+
+        const auto enqueue = [this, &layout, &queue, &queued](const tile<ObstrLyt>& t)
+        {
+            if (queued.count(t) > 0 || !is_relocatable_gate_tile(layout, t) ||
+                (ps.optimize_pos_only && !layout.is_po_tile(t)))
+            {
+                return;
+            }
+
+            if (const auto gain = estimate_relocation_gain(layout, t); gain > 0)
+            {
+                queue.emplace(gain, t);
+                queued.insert(t);
+            }
+        };
+
+        for (const auto& gate_tile : gate_tiles)
+        {
+            enqueue(gate_tile);
+        }
+
+        bool moved_at_least_one_gate = false;
+
+        while (!queue.empty() && !timeout_limit_reached)
+        {
+            const auto [gain, gate_tile] = queue.top();
+            queue.pop();
+            queued.erase(gate_tile);
+
+            if (!is_relocatable_gate_tile(layout, gate_tile))
+            {
+                continue;
+            }
+
+            // re-score outdated entries instead of relocating them
+            if (estimate_relocation_gain(layout, gate_tile) != gain)
+            {
+                enqueue(gate_tile);
+                continue;
+            }
+
+            gate_relocation<ObstrLyt> relocation{gate_tile};
+            ++pst.num_relocation_attempts;
+
+            if (improve_gate_location(layout, relocation, astar_context))
+            {
+                moved_at_least_one_gate = true;
+
+                // the wiring of the gate's fan-ins and fan-outs changed
+                const auto ffd = get_fanin_and_fanouts(layout, *relocation.new_pos);
+
+                for (const auto& fanin : ffd.fanins)
+                {
+                    enqueue(fanin);
+                }
+                for (const auto& fanout : ffd.fanouts)
+                {
+                    enqueue(fanout);
+                }
+            }
+
+            // update the remaining timeout after each relocation attempt
+            update_timeout();
+        }
+
+        return moved_at_least_one_gate;
+    }
 };
 
 }  // namespace detail
@@ -1156,6 +1741,9 @@ class post_layout_optimization_impl
  * As outputs have to lay on the border of a layout for better accessibility, they are also moved to new borders
  * determined based on the location of all other gates.
  *
+ * If `parallel_relocation` is enabled, gates whose relocations cannot interfere with each other are relocated
+ * concurrently. The result is the same for any number of threads.
+ *
  * @note This function requires the gate-level layout to be 2DDWave-clocked!
  *
  * @tparam Lyt Cartesian gate-level layout type.
@@ -1178,10 +1766,14 @@ void post_layout_optimization(const Lyt& lyt, post_layout_optimization_params ps
     }
 
     // initialize stats for runtime measurement
-    post_layout_optimization_stats             st{};
-    detail::post_layout_optimization_impl<Lyt> p{lyt, ps, st};
+    post_layout_optimization_stats st{};
+    {
+        const auto memory = st.profile.track_memory();
 
-    p.run();
+        detail::post_layout_optimization_impl<Lyt> p{lyt, ps, st};
+
+        p.run();
+    }
 
     if (pst != nullptr)
     {
@@ -14,17 +14,23 @@
 #include "fiction/layouts/coordinates.hpp"
 #include "fiction/layouts/obstruction_layout.hpp"
 #include "fiction/traits.hpp"
+#include "fiction/utils/performance_profile.hpp"
 #include "fiction/utils/routing_utils.hpp"
 
 #include <mockturtle/traits.hpp>
 #include <mockturtle/utils/stopwatch.hpp>
+#include <nlohmann/json.hpp>
+#include <phmap.h>
 
+#include <algorithm>
 #include <chrono>
 #include <cmath>
+#include <cstddef>
 #include <cstdint>
 #include <functional>
 #include <iostream>
 #include <limits>
+#include <optional>
 #include <ostream>
 #include <utility>
 #include <vector>
@@ -43,6 +49,16 @@ struct wiring_reduction_params
      * at every algorithm step and the functional correctness has to be ensured by completing essential algorithm steps.
      */
     uint64_t timeout = std::numeric_limits<uint64_t>::max();
+    /**
+     * Maintain one search layout per search direction across all iterations and update it in place after each deletion
+     * instead of recreating it. Only the obstructions of the rows or columns affected by a deletion are recomputed.
+     */
+    bool incremental_search = false;
+    /**
+     * Find several non-overlapping paths for wire deletion per search pass on a breadth-first level graph (cf. Dinic's
+     * maximum flow algorithm) instead of running one A* search per path.
+     */
+    bool disjoint_paths = false;
 };
 
 /**
@@ -78,6 +94,10 @@ struct wiring_reduction_stats
      * Number of wire segments after the wiring reduction process.
      */
     uint64_t num_wires_after{0ull};
+    /**
+     * Number of search passes, i.e., A* searches or level graph constructions, for paths of excess wiring.
+     */
+    uint64_t num_search_passes{0ull};
     /**
      * Improvement in the number wire segments.
      */
@@ -86,6 +106,11 @@ struct wiring_reduction_stats
      * Improvement in layout area.
      */
     double area_improvement{0ull};
+    /**
+     * Time spent in the construction of the wiring reduction layouts, in the path search, and in the wire deletion as
+     * well as the memory usage of the entire process.
+     */
+    performance_profile profile{};
 
     /**
      * Reports the statistics to the given output stream.
@@ -101,8 +126,33 @@ struct wiring_reduction_stats
         out << fmt::format("[i] num. wires before optimization  = {}\n", num_wires_before);
         out << fmt::format("[i] num. wires after optimization   = {}\n", num_wires_after);
         out << fmt::format("[i] wiring reduction                = {}%\n", wiring_improvement);
+        out << fmt::format("[i] num. search passes              = {}\n", num_search_passes);
+
+        profile.report(out);
     }
 };
+/**
+ * Converts wiring reduction statistics into JSON.
+ *
+ * @param j JSON value to write to.
+ * @param stats Statistics to convert.
+ */
+inline void to_json(nlohmann::json& j, const wiring_reduction_stats& stats)
+{
+    j = {{"runtime in seconds", mockturtle::to_seconds(stats.time_total)},
+         {"number of wires before", stats.num_wires_before},
+         {"number of wires after", stats.num_wires_after},
+         {"number of search passes", stats.num_search_passes},
+         {"layout before",
+          {{"x-size", stats.x_size_before},
+           {"y-size", stats.y_size_before},
+           {"area", stats.x_size_before * stats.y_size_before}}},
+         {"layout after",
+          {{"x-size", stats.x_size_after},
+           {"y-size", stats.y_size_after},
+           {"area", stats.x_size_after * stats.y_size_after}}},
+         {"profile", stats.profile}};
+}
 
 namespace detail
 {
@@ -367,250 +417,261 @@ template <typename OffsetCoordinateType>
 using wiring_reduction_layout_type = obstruction_layout<wiring_reduction_layout<OffsetCoordinateType>>;
 
 /**
- * Create a wiring_reduction_layout suitable for finding excess wiring based on a Cartesian layout.
- *
- * This function generates a new layout suitable for finding excess wiring by shifting the input layout based on
- * specified offsets. The generated layout is wrapped in an obstruction_layout. The shifted layout is constructed by
- * iterating through the input Cartesian layout diagonally and obstructing connections and coordinates accordingly.
+ * Marks the obstructions that a single node of a Cartesian gate-level layout induces on a layout used for finding
+ * excess wiring. This is the per-node step of `create_wiring_reduction_layout`.
  *
  * @tparam Lyt Type of the input Cartesian gate-level layout.
- * @param lyt The input Cartesian gate-level layout to be shifted.
- * @param x_offset The offset for shifting in the x-direction. Defaults to 0 if not specified.
- * @param y_offset The offset for shifting in the y-direction. Defaults to 0 if not specified.
- * @param search_direction If set to horizontally, paths are searched from left to right, otherwise from top to bottom.
- * @return wiring_reduction_layout suitable for finding excess wiring via A*.
+ * @tparam WiringReductionLyt Type of the layout to mark obstructions on. It has to provide `obstruct_coordinate`,
+ * `obstruct_connection`, and `get_search_direction`.
+ * @param lyt The input Cartesian gate-level layout.
+ * @param node The node of `lyt` whose obstructions are to be marked.
+ * @param wiring_reduction_lyt The layout to mark obstructions on.
+ * @param x_offset The offset for shifting in the x-direction.
+ * @param y_offset The offset for shifting in the y-direction.
  */
-template <typename Lyt>
-wiring_reduction_layout_type<coordinate<Lyt>>
-create_wiring_reduction_layout(const Lyt& lyt, const uint64_t x_offset = 0, const uint64_t y_offset = 0,
-                               search_direction direction = search_direction::HORIZONTAL) noexcept
+template <typename Lyt, typename WiringReductionLyt>
+void obstruct_node(const Lyt& lyt, const mockturtle::node<Lyt>& node, WiringReductionLyt& wiring_reduction_lyt,
+                   const uint64_t x_offset, const uint64_t y_offset) noexcept
 {
-    static_assert(is_gate_level_layout_v<Lyt>, "Lyt is not a gate-level layout");
-    static_assert(is_cartesian_layout_v<Lyt>, "Lyt is not a Cartesian layout");
+    const tile<Lyt> old_coord = lyt.get_tile(node);
+    const tile<Lyt> new_coord{old_coord.x + x_offset, old_coord.y + y_offset, old_coord.z};
 
-    // create a wiring_reduction_layout with specified offsets
-    wiring_reduction_layout<coordinate<Lyt>> obs_wiring_reduction_layout{
-        {lyt.x() + x_offset + 1, lyt.y() + y_offset + 1, lyt.z()},
-        direction};
+    // skip if the tile is empty
+    if (lyt.is_empty_tile(old_coord))
+    {
+        return;
+    }
+    // handle Primary Inputs (PI) and Primary Outputs (PO)
+    if (lyt.is_pi(node) || lyt.is_po(node))
+    {
+        wiring_reduction_lyt.obstruct_coordinate(new_coord);
+        wiring_reduction_lyt.obstruct_coordinate({new_coord.x, new_coord.y, 1});
+    }
 
-    auto wiring_reduction_lyt = wiring_reduction_layout_type<coordinate<Lyt>>(obs_wiring_reduction_layout);
+    // utility function to check if a tile hosts a single wire only, which is not a fanout or hosts a
+    // crossing:
+    //
+    // =
+    auto is_single_wire = [&lyt, &old_coord](const uint64_t add_x_offset, const uint64_t add_y_offset)
+    {
+        return lyt.is_wire_tile({old_coord.x - add_x_offset, old_coord.y - add_y_offset, 0}) &&
+               !lyt.is_fanout(lyt.get_node({old_coord.x - add_x_offset, old_coord.y - add_y_offset, 0}) &&
+                              lyt.is_empty_tile({old_coord.x - add_x_offset, old_coord.y - add_y_offset, 1}));
+    };
+
+    // utility function to check for crossings with outgoing wires to the bottom layer:
+    //
+    // +→=
+    // ↓
+    // =
+    auto is_crossing = [&lyt, &old_coord](const uint64_t add_x_offset, const uint64_t add_y_offset)
+    {
+        return lyt.has_northern_incoming_signal({old_coord.x - add_x_offset, old_coord.y - add_y_offset + 1, 0}) &&
+               lyt.has_western_incoming_signal({old_coord.x - add_x_offset + 1, old_coord.y - add_y_offset, 0});
+    };
 
-    // iterate through nodes in the layout
-    lyt.foreach_node(
-        [&lyt, &wiring_reduction_lyt, &x_offset, &y_offset](const auto& node)
+    // utility function to fully obstruct a coordinate
+    auto obstruct_coordinate =
+        [&wiring_reduction_lyt, &new_coord](const uint64_t add_x_offset, const uint64_t add_y_offset)
+    {
+        wiring_reduction_lyt.obstruct_coordinate({new_coord.x - add_x_offset, new_coord.y - add_y_offset, 0});
+        wiring_reduction_lyt.obstruct_coordinate({new_coord.x - add_x_offset, new_coord.y - add_y_offset, 1});
+    };
+
+    // handle single input gates and wires
+    if (const auto signals = lyt.incoming_data_flow(old_coord); signals.size() == 1)
+    {
+        const auto      incoming_signal = signals[0];
+        const tile<Lyt> shifted_tile{incoming_signal.x + x_offset, incoming_signal.y + y_offset, incoming_signal.z};
+
+        // obstruct the connection between the gate and its incoming signal
+        wiring_reduction_lyt.obstruct_connection(shifted_tile, new_coord);
+
+        // obstruct horizontal/vertical wires, non-wire gates (inv) and fanouts
+        if (!lyt.is_wire(node) || (lyt.fanout_size(node) != 1) || (old_coord.z != 0) ||
+            (lyt.has_western_incoming_signal({old_coord}) && lyt.has_eastern_outgoing_signal({old_coord}) &&
+             (wiring_reduction_lyt.get_search_direction() == search_direction::HORIZONTAL)) ||
+            (lyt.has_northern_incoming_signal({old_coord}) && lyt.has_southern_outgoing_signal({old_coord}) &&
+             (wiring_reduction_lyt.get_search_direction() == search_direction::VERTICAL)))
         {
-            const tile<Lyt> old_coord = lyt.get_tile(node);
-            const tile<Lyt> new_coord{old_coord.x + x_offset, old_coord.y + y_offset, old_coord.z};
+            obstruct_coordinate(0, 0);
+        }
 
-            // skip if the tile is empty
-            if (lyt.is_empty_tile(old_coord))
+        // for bent wires from north to east, obstruct the connection between the wire and the
+        // coordinate to the bottom right/ top left
+        else if (lyt.has_northern_incoming_signal({old_coord}) && lyt.has_eastern_outgoing_signal({old_coord}))
+        {
+            if (wiring_reduction_lyt.get_search_direction() == search_direction::HORIZONTAL)
             {
-                return;
+                {
+                    wiring_reduction_lyt.obstruct_connection(new_coord,
+                                                             {new_coord.x + 1, new_coord.y + 1, new_coord.z});
+
+                    // special cases:
+                    // →=
+                    //  ↓
+                    // ...
+                    //  ↓
+                    //  =→
+                    for (uint64_t i = 1; is_single_wire(0, i); ++i)
+                    {
+                        if (lyt.has_western_incoming_signal({old_coord.x, old_coord.y - i, old_coord.z}))
+                        {
+                            obstruct_coordinate(0, i);
+                            break;
+                        }
+                    }
+                }
             }
-            // handle Primary Inputs (PI) and Primary Outputs (PO)
-            if (lyt.is_pi(node) || lyt.is_po(node))
+
+            else
             {
-                wiring_reduction_lyt.obstruct_coordinate(new_coord);
-                wiring_reduction_lyt.obstruct_coordinate({new_coord.x, new_coord.y, 1});
+                wiring_reduction_lyt.obstruct_connection({new_coord.x - 1, new_coord.y - 1, new_coord.z}, new_coord);
             }
+        }
 
-            // utility function to check if a tile hosts a single wire only, which is not a fanout or hosts a
-            // crossing:
-            //
-            // =
-            auto is_single_wire = [&lyt, &old_coord](const uint64_t add_x_offset, const uint64_t add_y_offset)
-            {
-                return lyt.is_wire_tile({old_coord.x - add_x_offset, old_coord.y - add_y_offset, 0}) &&
-                       !lyt.is_fanout(lyt.get_node({old_coord.x - add_x_offset, old_coord.y - add_y_offset, 0}) &&
-                                      lyt.is_empty_tile({old_coord.x - add_x_offset, old_coord.y - add_y_offset, 1}));
-            };
-
-            // utility function to check for crossings with outgoing wires to the bottom layer:
-            //
-            // +→=
-            // ↓
-            // =
-            auto is_crossing = [&lyt, &old_coord](const uint64_t add_x_offset, const uint64_t add_y_offset)
+        // for bent wires from west to south, obstruct the connection between the wire and the
+        // coordinate to the top left/ bottom right
+        else if (lyt.has_western_incoming_signal({old_coord}) && lyt.has_southern_outgoing_signal({old_coord}))
+        {
+            if (wiring_reduction_lyt.get_search_direction() == search_direction::HORIZONTAL)
             {
-                return lyt.has_northern_incoming_signal(
-                           {old_coord.x - add_x_offset, old_coord.y - add_y_offset + 1, 0}) &&
-                       lyt.has_western_incoming_signal({old_coord.x - add_x_offset + 1, old_coord.y - add_y_offset, 0});
-            };
-
-            // utility function to fully obstruct a coordinate
-            auto obstruct_coordinate =
-                [&wiring_reduction_lyt, &new_coord](const uint64_t add_x_offset, const uint64_t add_y_offset)
+                wiring_reduction_lyt.obstruct_connection({new_coord.x - 1, new_coord.y - 1, new_coord.z}, new_coord);
+            }
+            else
             {
-                wiring_reduction_lyt.obstruct_coordinate({new_coord.x - add_x_offset, new_coord.y - add_y_offset, 0});
-                wiring_reduction_lyt.obstruct_coordinate({new_coord.x - add_x_offset, new_coord.y - add_y_offset, 1});
-            };
+                wiring_reduction_lyt.obstruct_connection(new_coord, {new_coord.x + 1, new_coord.y + 1, new_coord.z});
 
-            // handle single input gates and wires
-            if (const auto signals = lyt.incoming_data_flow(old_coord); signals.size() == 1)
-            {
-                const auto      incoming_signal = signals[0];
-                const tile<Lyt> shifted_tile{incoming_signal.x + x_offset, incoming_signal.y + y_offset,
-                                             incoming_signal.z};
-
-                // obstruct the connection between the gate and its incoming signal
-                wiring_reduction_lyt.obstruct_connection(shifted_tile, new_coord);
-
-                // obstruct horizontal/vertical wires, non-wire gates (inv) and fanouts
-                if (!lyt.is_wire(node) || (lyt.fanout_size(node) != 1) || (old_coord.z != 0) ||
-                    (lyt.has_western_incoming_signal({old_coord}) && lyt.has_eastern_outgoing_signal({old_coord}) &&
-                     (wiring_reduction_lyt.get_search_direction() == search_direction::HORIZONTAL)) ||
-                    (lyt.has_northern_incoming_signal({old_coord}) && lyt.has_southern_outgoing_signal({old_coord}) &&
-                     (wiring_reduction_lyt.get_search_direction() == search_direction::VERTICAL)))
+                // special cases:
+                // ↓
+                // =→...→=
+                //       ↓
+                for (uint64_t i = 1; is_single_wire(i, 0); ++i)
                 {
-                    obstruct_coordinate(0, 0);
+                    if (lyt.has_northern_incoming_signal({old_coord.x - i, old_coord.y, old_coord.z}))
+                    {
+                        obstruct_coordinate(i, 0);
+                        break;
+                    }
                 }
+            }
+        }
+    }
 
-                // for bent wires from north to east, obstruct the connection between the wire and the
-                // coordinate to the bottom right/ top left
-                else if (lyt.has_northern_incoming_signal({old_coord}) && lyt.has_eastern_outgoing_signal({old_coord}))
+    // handle double input gates (AND, OR, ...)
+    else if (signals.size() == 2)
+    {
+        const auto signal_a = signals[0];
+        const auto signal_b = signals[1];
+
+        const auto shifted_tile_a = tile<Lyt>{signal_a.x + x_offset, signal_a.y + y_offset, signal_a.z};
+        const auto shifted_tile_b = tile<Lyt>{signal_b.x + x_offset, signal_b.y + y_offset, signal_b.z};
+
+        wiring_reduction_lyt.obstruct_connection(shifted_tile_a, new_coord);
+        wiring_reduction_lyt.obstruct_connection(shifted_tile_b, new_coord);
+
+        obstruct_coordinate(0, 0);
+    }
+
+    if (const auto signals = lyt.incoming_data_flow(old_coord); (old_coord.z == 1) || (signals.size() == 2))
+    {
+        // special cases (where the crossing can also be placed further to the left or top):
+        // +→=
+        // ↓ ↓
+        // =→&
+        //
+        // or:
+        //
+        // +→=
+        // ↓ ↓
+        // =→+
+        if (is_single_wire(1, 0) && is_single_wire(0, 1))
+        {
+            bool obstruct = false;
+
+            for (uint64_t i = 1; true; ++i)
+            {
+                if (is_crossing(1, 1))
+                {
+                    obstruct = true;
+                    break;
+                }
+                if (wiring_reduction_lyt.get_search_direction() == search_direction::HORIZONTAL)
                 {
-                    if (wiring_reduction_lyt.get_search_direction() == search_direction::HORIZONTAL)
+                    if (!is_single_wire(1, i) || !is_single_wire(0, i + 1) ||
+                        !lyt.has_northern_incoming_signal({old_coord.x - 1, old_coord.y - i + 1, 0}) ||
+                        !lyt.has_northern_incoming_signal({old_coord.x, old_coord.y - i, 0}))
                     {
-                        {
-                            wiring_reduction_lyt.obstruct_connection(new_coord,
-                                                                     {new_coord.x + 1, new_coord.y + 1, new_coord.z});
-
-                            // special cases:
-                            // →=
-                            //  ↓
-                            // ...
-                            //  ↓
-                            //  =→
-                            for (uint64_t i = 1; is_single_wire(0, i); ++i)
-                            {
-                                if (lyt.has_western_incoming_signal({old_coord.x, old_coord.y - i, old_coord.z}))
-                                {
-                                    obstruct_coordinate(0, i);
-                                    break;
-                                }
-                            }
-                        }
+                        break;
                     }
-
-                    else
+                    if (is_crossing(1, i + 1))
                     {
-                        wiring_reduction_lyt.obstruct_connection({new_coord.x - 1, new_coord.y - 1, new_coord.z},
-                                                                 new_coord);
+                        obstruct = true;
+                        break;
                     }
                 }
-
-                // for bent wires from west to south, obstruct the connection between the wire and the
-                // coordinate to the top left/ bottom right
-                else if (lyt.has_western_incoming_signal({old_coord}) && lyt.has_southern_outgoing_signal({old_coord}))
+                else
                 {
-                    if (wiring_reduction_lyt.get_search_direction() == search_direction::HORIZONTAL)
+                    if (!is_single_wire(i, 1) || !is_single_wire(i + 1, 0) ||
+                        !lyt.has_western_incoming_signal({old_coord.x - i, old_coord.y, 0}) ||
+                        !lyt.has_western_incoming_signal({old_coord.x - i + 1, old_coord.y - i, 0}))
                     {
-                        wiring_reduction_lyt.obstruct_connection({new_coord.x - 1, new_coord.y - 1, new_coord.z},
-                                                                 new_coord);
+                        break;
                     }
-                    else
+                    if (is_crossing(i + 1, 1))
                     {
-                        wiring_reduction_lyt.obstruct_connection(new_coord,
-                                                                 {new_coord.x + 1, new_coord.y + 1, new_coord.z});
-
-                        // special cases:
-                        // ↓
-                        // =→...→=
-                        //       ↓
-                        for (uint64_t i = 1; is_single_wire(i, 0); ++i)
-                        {
-                            if (lyt.has_northern_incoming_signal({old_coord.x - i, old_coord.y, old_coord.z}))
-                            {
-                                obstruct_coordinate(i, 0);
-                                break;
-                            }
-                        }
+                        obstruct = true;
+                        break;
                     }
                 }
             }
 
-            // handle double input gates (AND, OR, ...)
-            else if (signals.size() == 2)
+            if (obstruct)
             {
-                const auto signal_a = signals[0];
-                const auto signal_b = signals[1];
-
-                const auto shifted_tile_a = tile<Lyt>{signal_a.x + x_offset, signal_a.y + y_offset, signal_a.z};
-                const auto shifted_tile_b = tile<Lyt>{signal_b.x + x_offset, signal_b.y + y_offset, signal_b.z};
-
-                wiring_reduction_lyt.obstruct_connection(shifted_tile_a, new_coord);
-                wiring_reduction_lyt.obstruct_connection(shifted_tile_b, new_coord);
-
-                obstruct_coordinate(0, 0);
+                if (wiring_reduction_lyt.get_search_direction() == search_direction::HORIZONTAL)
+                {
+                    obstruct_coordinate(1, 0);
+                }
+                else
+                {
+                    obstruct_coordinate(0, 1);
+                }
             }
+        }
+    }
+}
+/**
+ * Create a wiring_reduction_layout suitable for finding excess wiring based on a Cartesian layout.
+ *
+ * This function generates a new layout suitable for finding excess wiring by shifting the input layout based on
+ * specified offsets. The generated layout is wrapped in an obstruction_layout. The shifted layout is constructed by
+ * iterating through the input Cartesian layout diagonally and obstructing connections and coordinates accordingly.
+ *
+ * @tparam Lyt Type of the input Cartesian gate-level layout.
+ * @param lyt The input Cartesian gate-level layout to be shifted.
+ * @param x_offset The offset for shifting in the x-direction. Defaults to 0 if not specified.
+ * @param y_offset The offset for shifting in the y-direction. Defaults to 0 if not specified.
+ * @param search_direction If set to horizontally, paths are searched from left to right, otherwise from top to bottom.
+ * @return wiring_reduction_layout suitable for finding excess wiring via A*.
+ */
+template <typename Lyt>
+wiring_reduction_layout_type<coordinate<Lyt>>
+create_wiring_reduction_layout(const Lyt& lyt, const uint64_t x_offset = 0, const uint64_t y_offset = 0,
+                               search_direction direction = search_direction::HORIZONTAL) noexcept
+{
+    static_assert(is_gate_level_layout_v<Lyt>, "Lyt is not a gate-level layout");
+    static_assert(is_cartesian_layout_v<Lyt>, "Lyt is not a Cartesian layout");
 
-            if (const auto signals = lyt.incoming_data_flow(old_coord); (old_coord.z == 1) || (signals.size() == 2))
-            {
-                // special cases (where the crossing can also be placed further to the left or top):
-                // +→=
-                // ↓ ↓
-                // =→&
-                //
-                // or:
-                //
-                // +→=
-                // ↓ ↓
-                // =→+
-                if (is_single_wire(1, 0) && is_single_wire(0, 1))
-                {
-                    bool obstruct = false;
+    // create a wiring_reduction_layout with specified offsets
+    wiring_reduction_layout<coordinate<Lyt>> obs_wiring_reduction_layout{
+        {lyt.x() + x_offset + 1, lyt.y() + y_offset + 1, lyt.z()},
+        direction};
 
-                    for (uint64_t i = 1; true; ++i)
-                    {
-                        if (is_crossing(1, 1))
-                        {
-                            obstruct = true;
-                            break;
-                        }
-                        if (wiring_reduction_lyt.get_search_direction() == search_direction::HORIZONTAL)
-                        {
-                            if (!is_single_wire(1, i) || !is_single_wire(0, i + 1) ||
-                                !lyt.has_northern_incoming_signal({old_coord.x - 1, old_coord.y - i + 1, 0}) ||
-                                !lyt.has_northern_incoming_signal({old_coord.x, old_coord.y - i, 0}))
-                            {
-                                break;
-                            }
-                            if (is_crossing(1, i + 1))
-                            {
-                                obstruct = true;
-                                break;
-                            }
-                        }
-                        else
-                        {
-                            if (!is_single_wire(i, 1) || !is_single_wire(i + 1, 0) ||
-                                !lyt.has_western_incoming_signal({old_coord.x - i, old_coord.y, 0}) ||
-                                !lyt.has_western_incoming_signal({old_coord.x - i + 1, old_coord.y - i, 0}))
-                            {
-                                break;
-                            }
-                            if (is_crossing(i + 1, 1))
-                            {
-                                obstruct = true;
-                                break;
-                            }
-                        }
-                    }
+    auto wiring_reduction_lyt = wiring_reduction_layout_type<coordinate<Lyt>>(obs_wiring_reduction_layout);
 
-                    if (obstruct)
-                    {
-                        if (wiring_reduction_lyt.get_search_direction() == search_direction::HORIZONTAL)
-                        {
-                            obstruct_coordinate(1, 0);
-                        }
-                        else
-                        {
-                            obstruct_coordinate(0, 1);
-                        }
-                    }
-                }
-            }
-        });
+    // iterate through nodes in the layout
+    lyt.foreach_node([&lyt, &wiring_reduction_lyt, &x_offset, &y_offset](const auto& node)
+                     { obstruct_node(lyt, node, wiring_reduction_lyt, x_offset, y_offset); });
 
     return wiring_reduction_lyt;
 }
@@ -667,19 +728,20 @@ void add_obstructions(WiringReductionLyt& lyt) noexcept
  * @param lyt Reference to the layout.
  * @param start The starting coordinate of the path.
  * @param end The ending coordinate of the path.
+ * @param context Search context that is reused across calls.
  * @return The computed path as a sequence of coordinates in the layout.
  */
 template <typename WiringReductionLyt>
-[[nodiscard]] layout_coordinate_path<WiringReductionLyt> get_path(WiringReductionLyt&                   lyt,
-                                                                  const coordinate<WiringReductionLyt>& start,
-                                                                  const coordinate<WiringReductionLyt>& end) noexcept
+[[nodiscard]] layout_coordinate_path<WiringReductionLyt>
+get_path(WiringReductionLyt& lyt, const coordinate<WiringReductionLyt>& start,
+         const coordinate<WiringReductionLyt>& end, a_star_context<WiringReductionLyt>& context) noexcept
 {
     using dist = manhattan_distance_functor<WiringReductionLyt, uint64_t>;
     using cost = unit_cost_functor<WiringReductionLyt, uint8_t>;
 
     static const a_star_params params{false};
 
-    return a_star<layout_coordinate_path<WiringReductionLyt>>(lyt, {start, end}, dist(), cost(), params);
+    return a_star<layout_coordinate_path<WiringReductionLyt>>(lyt, {start, end}, context, dist(), cost(), params);
 }
 /**
  * Update the to-delete list based on a possible path in a wiring_reduction_layout.
@@ -717,6 +779,391 @@ void update_to_delete_list(WiringReductionLyt& lyt, const layout_coordinate_path
         }
     }
 }
+/**
+ * Finds several non-overlapping paths for wire deletion in a single search pass over a `wiring_reduction_layout`.
+ *
+ * The pass works like a blocking flow phase of Dinic's maximum flow algorithm. First, a breadth-first search from the
+ * top-left to the bottom-right corner assigns a level to each reachable coordinate. Afterward, a depth-first search
+ * repeatedly extracts paths that only advance from one level to the next. Each extracted path is added to the to-delete
+ * list via `update_to_delete_list`, which obstructs its coordinates such that no subsequent path can overlap it.
+ * Coordinates from which the bottom-right corner is no longer reachable on the level graph are pruned for the rest of
+ * the pass. Hence, a single pass replaces a separate A* search for each of the paths it finds.
+ *
+ * @tparam Lyt Type of the Cartesian gate-level layout.
+ * @tparam WiringReductionLyt Type of the `wiring_reduction_layout`.
+ * @param lyt The `wiring_reduction_layout` to search paths in.
+ * @param to_delete Reference to the to-delete list to be updated with new coordinates.
+ * @return Number of paths found in this pass.
+ */
+template <typename Lyt, typename WiringReductionLyt>
+uint64_t find_disjoint_paths(WiringReductionLyt& lyt, layout_coordinate_path<WiringReductionLyt>& to_delete) noexcept
+{
+    constexpr auto unreachable = std::numeric_limits<uint64_t>::max();
+
+    const coordinate<WiringReductionLyt> source{0, 0};
+    const coordinate<WiringReductionLyt> target{lyt.x(), lyt.y()};
+
+    const auto width = static_cast<uint64_t>(lyt.x()) + 1;
+    const auto index = [width](const auto& c) noexcept { return static_cast<uint64_t>(c.y) * width + c.x; };
+
+    const auto is_traversable = [&lyt, &target](const auto& current, const auto& successor) noexcept
+    {
+        return (successor == target || !lyt.is_obstructed_coordinate(successor)) &&
+               !lyt.is_obstructed_connection(current, successor);
+    };
+
+    // assign levels to all coordinates that are reachable from the source
+    std::vector<uint64_t> level(width * (static_cast<uint64_t>(lyt.y()) + 1), unreachable);
+    level[index(source)] = 0;
+
+    std::vector<coordinate<WiringReductionLyt>> queue{source};
+
+    for (std::size_t head = 0; head < queue.size(); ++head)
+    {
+        const auto current = queue[head];
+
+        lyt.foreach_adjacent_coordinate(
+            current,
+            [&level, &queue, &index, &is_traversable, &current](const auto& successor)
+            {
+                if (level[index(successor)] == unreachable && is_traversable(current, successor))
+                {
+                    level[index(successor)] = level[index(current)] + 1;
+                    queue.push_back(successor);
+                }
+            });
+    }
+
+    if (level[index(target)] == unreachable)
+    {
+        return 0;
+    }
+
+    // extract paths along the level graph until the source is exhausted
+    std::vector<bool> dead(level.size(), false);
+
+    layout_coordinate_path<WiringReductionLyt> path{source};
+
+    uint64_t num_paths = 0;
+
+    while (!path.empty())
+    {
+        const auto current = path.back();
+
+        if (current == target)
+        {
+            update_to_delete_list<Lyt, WiringReductionLyt>(lyt, path, to_delete);
+            ++num_paths;
+
+            path.assign(1, source);
+            continue;
+        }
+
+        std::optional<coordinate<WiringReductionLyt>> next{};
+
+        lyt.foreach_adjacent_coordinate(
+            current,
+            [&next, &level, &dead, &index, &is_traversable, &current](const auto& successor)
+            {
+                if (!next.has_value() && level[index(successor)] == level[index(current)] + 1 &&
+                    !dead[index(successor)] && is_traversable(current, successor))
+                {
+                    next = successor;
+                }
+            });
+
+        if (next.has_value())
+        {
+            path.append(*next);
+        }
+        else
+        {
+            // the target cannot be reached from here anymore
+            dead[index(current)] = true;
+            path.pop_back();
+        }
+    }
+
+    return num_paths;
+}
+/**
+ * A `wiring_reduction_layout` for a fixed search direction that is kept alive across the iterations of the wiring
+ * reduction algorithm instead of being recreated via `create_wiring_reduction_layout` after each deletion.
+ *
+ * All obstructions are reference-counted and recorded per tile of the gate-level layout that induced them. When wires
+ * are deleted along a path from left to right, tiles above the topmost deleted coordinate keep their position.
+ * Likewise, tiles to the left of the leftmost deleted coordinate keep their position when wires are deleted along a
+ * path from top to bottom. Therefore, only the obstructions induced by the affected rows or columns (plus the one
+ * before, whose outgoing signals may point into the affected region) are withdrawn and recomputed. The resulting
+ * obstructions are identical to the ones of a freshly created layout.
+ *
+ * The gate-level layout may only shrink over the lifetime of this object.
+ *
+ * @tparam Lyt Type of the Cartesian gate-level layout.
+ */
+template <typename Lyt>
+class incremental_wiring_reduction_layout
+{
+  public:
+    /**
+     * The wiring reduction layout type that is maintained.
+     */
+    using search_layout = wiring_reduction_layout_type<coordinate<Lyt>>;
+    /**
+     * Standard constructor. Creates the wiring reduction layout of `lyt` for the given search direction including the
+     * obstructions along its edges.
+     *
+     * @param lyt The Cartesian gate-level layout to derive the wiring reduction layout from.
+     * @param direction The search direction.
+     */
+    incremental_wiring_reduction_layout(const Lyt& lyt, const search_direction direction) :
+            width{static_cast<uint64_t>(lyt.x()) + 1},
+            height{static_cast<uint64_t>(lyt.y()) + 1},
+            depth{static_cast<uint64_t>(lyt.z()) + 1},
+            search_lyt{wiring_reduction_layout<coordinate<Lyt>>{{lyt.x() + 2, lyt.y() + 2, lyt.z()}, direction}},
+            induced(width * height * depth)
+    {
+        induce_obstructions(lyt, 0, 0);
+    }
+    /**
+     * Returns the maintained wiring reduction layout.
+     *
+     * @return The wiring reduction layout.
+     */
+    [[nodiscard]] search_layout& get_layout() noexcept
+    {
+        return search_lyt;
+    }
+    /**
+     * Brings the wiring reduction layout up to date after the coordinates in `deleted` have been removed from `lyt` via
+     * `delete_wires`. If the coordinates were found on this layout, their obstructions that were placed by
+     * `update_to_delete_list` are lifted as well.
+     *
+     * @param lyt The Cartesian gate-level layout after the deletion.
+     * @param deleted The to-delete list that was passed to `delete_wires`.
+     * @param direction The search direction in which the deleted coordinates were found.
+     */
+    void update(const Lyt& lyt, const layout_coordinate_path<search_layout>& deleted,
+                const search_direction direction) noexcept
+    {
+        if (deleted.empty())
+        {
+            return;
+        }
+
+        // lift the obstructions of the deleted paths unless they were induced by a tile
+        for (const auto& c : deleted)
+        {
+            for (const uint64_t z : {0ull, 1ull})
+            {
+                if (const coordinate<Lyt> shifted{c.x + 1, c.y + 1, z}; coordinate_count.count(shifted) == 0)
+                {
+                    search_lyt.clear_obstructed_coordinate(shifted);
+                }
+            }
+        }
+
+        // determine the first row (or column) whose tiles may induce different obstructions than before
+        uint64_t first = std::numeric_limits<uint64_t>::max();
+
+        for (const auto& c : deleted)
+        {
+            first = std::min(first, static_cast<uint64_t>(direction == search_direction::HORIZONTAL ? c.y : c.x));
+        }
+
+        first = first == 0 ? 0 : first - 1;
+
+        const auto min_x = direction == search_direction::HORIZONTAL ? uint64_t{0} : first;
+        const auto min_y = direction == search_direction::HORIZONTAL ? first : uint64_t{0};
+
+        // withdraw the obstructions induced by the affected region and the edges
+        withdraw(edge_induced);
+
+        for (uint64_t y = min_y; y < height; ++y)
+        {
+            for (uint64_t x = min_x; x < width; ++x)
+            {
+                for (uint64_t z = 0; z < depth; ++z)
+                {
+                    withdraw(induced[index(x, y, z)]);
+                }
+            }
+        }
+
+        search_lyt.resize({lyt.x() + 2, lyt.y() + 2, lyt.z()});
+
+        induce_obstructions(lyt, min_x, min_y);
+    }
+
+  private:
+    /**
+     * An obstructed coordinate or connection that was induced by a tile.
+     */
+    struct induced_obstruction
+    {
+        /**
+         * The obstructed coordinate or the source of the obstructed connection.
+         */
+        coordinate<Lyt> source;
+        /**
+         * The target of the obstructed connection. Equal to `source` for obstructed coordinates.
+         */
+        coordinate<Lyt> target;
+        /**
+         * Whether this obstruction is a connection.
+         */
+        bool is_connection;
+    };
+    /**
+     * Provides the obstruction interface used by `obstruct_node` and `add_obstructions` and records every obstruction
+     * in the list of the tile that induces it.
+     */
+    class obstruction_recorder
+    {
+      public:
+        obstruction_recorder(incremental_wiring_reduction_layout& owner,
+                             std::vector<induced_obstruction>&    records) noexcept :
+                lyt{owner},
+                obstructions{records}
+        {}
+
+        void obstruct_coordinate(const coordinate<Lyt>& c) noexcept
+        {
+            if (++lyt.coordinate_count[c] == 1)
+            {
+                lyt.search_lyt.obstruct_coordinate(c);
+            }
+
+            obstructions.push_back({c, c, false});
+        }
+
+        void obstruct_connection(const coordinate<Lyt>& src, const coordinate<Lyt>& tgt) noexcept
+        {
+            if (++lyt.connection_count[std::make_pair(src, tgt)] == 1)
+            {
+                lyt.search_lyt.obstruct_connection(src, tgt);
+            }
+
+            obstructions.push_back({src, tgt, true});
+        }
+
+        [[nodiscard]] search_direction get_search_direction() const noexcept
+        {
+            return lyt.search_lyt.get_search_direction();
+        }
+
+        [[nodiscard]] auto x() const noexcept
+        {
+            return lyt.search_lyt.x();
+        }
+
+        [[nodiscard]] auto y() const noexcept
+        {
+            return lyt.search_lyt.y();
+        }
+
+      private:
+        incremental_wiring_reduction_layout& lyt;
+
+        std::vector<induced_obstruction>& obstructions;
+    };
+    /**
+     * Width of the gate-level layout at construction time.
+     */
+    const uint64_t width;
+    /**
+     * Height of the gate-level layout at construction time.
+     */
+    const uint64_t height;
+    /**
+     * Number of layers of the gate-level layout at construction time.
+     */
+    const uint64_t depth;
+    /**
+     * The maintained wiring reduction layout.
+     */
+    search_layout search_lyt;
+    /**
+     * The obstructions induced by each tile of the gate-level layout.
+     */
+    std::vector<std::vector<induced_obstruction>> induced;
+    /**
+     * The obstructions along the edges of the wiring reduction layout.
+     */
+    std::vector<induced_obstruction> edge_induced{};
+    /**
+     * Number of tiles that induce each obstructed coordinate.
+     */
+    phmap::flat_hash_map<coordinate<Lyt>, uint64_t> coordinate_count{};
+    /**
+     * Number of tiles that induce each obstructed connection.
+     */
+    phmap::flat_hash_map<std::pair<coordinate<Lyt>, coordinate<Lyt>>, uint64_t> connection_count{};
+    /**
+     * Computes the index of the given tile in `induced`.
+     */
+    [[nodiscard]] std::size_t index(const uint64_t x, const uint64_t y, const uint64_t z) const noexcept
+    {
+        return static_cast<std::size_t>((y * width + x) * depth + z);
+    }
+    /**
+     * Records the obstructions induced by all non-empty tiles of `lyt` that are located at or beyond the given minimum
+     * coordinates as well as the obstructions along the edges of the wiring reduction layout.
+     *
+     * @param lyt The Cartesian gate-level layout.
+     * @param min_x Minimum x-coordinate of the tiles to consider.
+     * @param min_y Minimum y-coordinate of the tiles to consider.
+     */
+    void induce_obstructions(const Lyt& lyt, const uint64_t min_x, const uint64_t min_y) noexcept
+    {
+        for (uint64_t y = min_y; y <= lyt.y(); ++y)
+        {
+            for (uint64_t x = min_x; x <= lyt.x(); ++x)
+            {
+                for (uint64_t z = 0; z <= lyt.z(); ++z)
+                {
+                    if (const tile<Lyt> t{x, y, z}; !lyt.is_empty_tile(t))
+                    {
+                        obstruction_recorder recorder{*this, induced[index(x, y, z)]};
+                        obstruct_node(lyt, lyt.get_node(t), recorder, 1, 1);
+                    }
+                }
+            }
+        }
+
+        obstruction_recorder recorder{*this, edge_induced};
+        add_obstructions(recorder);
+    }
+    /**
+     * Withdraws the given obstructions and lifts those that are no longer induced by any tile.
+     *
+     * @param obstructions The obstructions to withdraw. The list is cleared afterward.
+     */
+    void withdraw(std::vector<induced_obstruction>& obstructions) noexcept
+    {
+        for (const auto& o : obstructions)
+        {
+            if (o.is_connection)
+            {
+                if (const auto it = connection_count.find(std::make_pair(o.source, o.target)); --it->second == 0)
+                {
+                    connection_count.erase(it);
+                    search_lyt.clear_obstructed_connection(o.source, o.target);
+                }
+            }
+            else
+            {
+                if (const auto it = coordinate_count.find(o.source); --it->second == 0)
+                {
+                    coordinate_count.erase(it);
+                    search_lyt.clear_obstructed_coordinate(o.source);
+                }
+            }
+        }
+
+        obstructions.clear();
+    }
+};
 /**
  * Offset matrix type alias.
  */
@@ -1085,6 +1532,21 @@ class wiring_reduction_impl
             timeout_limit_is_reached = (elapsed_ms >= params.timeout);
         };
 
+        // search context that is reused by all A* calls on the wiring reduction layouts
+        a_star_context<wiring_reduction_layout_type<coordinate<Lyt>>> astar_context{};
+
+        // wiring reduction layouts that are maintained across iterations in incremental mode
+        std::optional<incremental_wiring_reduction_layout<Lyt>> horizontal_lyt{};
+        std::optional<incremental_wiring_reduction_layout<Lyt>> vertical_lyt{};
+
+        if (ps.incremental_search)
+        {
+            const auto construction = pst.profile.time_phase("layout construction");
+
+            horizontal_lyt.emplace(layout, search_direction::HORIZONTAL);
+            vertical_lyt.emplace(layout, search_direction::VERTICAL);
+        }
+
         // perform wiring reduction iteratively until no further wires can be deleted
         while (found_wires && !timeout_limit_reached)
         {
@@ -1100,9 +1562,21 @@ class wiring_reduction_impl
                     break;
                 }
 
-                // create wiring reduction layout for the current direction
-                auto wiring_reduction_lyt = create_wiring_reduction_layout<Lyt>(layout, 1, 1, direction);
-                add_obstructions(wiring_reduction_lyt);
+                // create wiring reduction layout for the current direction unless it is maintained incrementally
+                std::optional<wiring_reduction_layout_type<coordinate<Lyt>>> created_lyt{};
+
+                if (!ps.incremental_search)
+                {
+                    const auto construction = pst.profile.time_phase("layout construction");
+
+                    created_lyt.emplace(create_wiring_reduction_layout<Lyt>(layout, 1, 1, direction));
+                    add_obstructions(*created_lyt);
+                }
+
+                auto& wiring_reduction_lyt =
+                    ps.incremental_search ?
+                        (direction == search_direction::HORIZONTAL ? horizontal_lyt : vertical_lyt)->get_layout() :
+                        *created_lyt;
 
                 // update the remaining timeout
                 update_timeout();
@@ -1115,33 +1589,64 @@ class wiring_reduction_impl
                 // reset the list of wires to delete
                 to_delete.clear();
 
-                // get the initial possible path for wire deletion
-                auto possible_path =
-                    get_path(wiring_reduction_lyt, {0, 0}, {wiring_reduction_lyt.x(), wiring_reduction_lyt.y()});
-
-                // iterate while there is a possible path and timeout not reached
-                while (!possible_path.empty() && !timeout_limit_reached)
+                if (const auto search = pst.profile.time_phase("path search"); ps.disjoint_paths)
                 {
-                    // update the list of wires to delete based on the current path
-                    update_to_delete_list<Lyt, wiring_reduction_layout_type<coordinate<Lyt>>>(wiring_reduction_lyt,
-                                                                                              possible_path, to_delete);
+                    // extract non-overlapping paths pass by pass until no further path exists
+                    while (!timeout_limit_reached)
+                    {
+                        ++pst.num_search_passes;
 
-                    // update the remaining timeout after processing the path
-                    update_timeout();
+                        if (find_disjoint_paths<Lyt>(wiring_reduction_lyt, to_delete) == 0)
+                        {
+                            break;
+                        }
+
+                        // update the remaining timeout after processing the pass
+                        update_timeout();
+                    }
+                }
+                else
+                {
+                    // get the initial possible path for wire deletion
+                    ++pst.num_search_passes;
+                    auto possible_path = get_path(wiring_reduction_lyt, {0, 0},
+                                                  {wiring_reduction_lyt.x(), wiring_reduction_lyt.y()}, astar_context);
 
-                    if (!timeout_limit_reached)
+                    // iterate while there is a possible path and timeout not reached
+                    while (!possible_path.empty() && !timeout_limit_reached)
                     {
-                        // get the next possible path for wire deletion
-                        possible_path = get_path(wiring_reduction_lyt, {0, 0},
-                                                 {wiring_reduction_lyt.x(), wiring_reduction_lyt.y()});
+                        // update the list of wires to delete based on the current path
+                        update_to_delete_list<Lyt, wiring_reduction_layout_type<coordinate<Lyt>>>(
+                            wiring_reduction_lyt, possible_path, to_delete);
+
+                        // update the remaining timeout after processing the path
+                        update_timeout();
+
+                        if (!timeout_limit_reached)
+                        {
+                            // get the next possible path for wire deletion
+                            ++pst.num_search_passes;
+                            possible_path =
+                                get_path(wiring_reduction_lyt, {0, 0},
+                                         {wiring_reduction_lyt.x(), wiring_reduction_lyt.y()}, astar_context);
+                        }
                     }
                 }
 
                 if (!to_delete.empty())
                 {
+                    const auto deletion = pst.profile.time_phase("wire deletion");
+
                     // delete the identified wires from the layout
                     delete_wires(layout, wiring_reduction_lyt, to_delete);
                     found_wires = true;
+
+                    // bring the maintained wiring reduction layouts up to date
+                    if (ps.incremental_search)
+                    {
+                        horizontal_lyt->update(layout, to_delete, direction);
+                        vertical_lyt->update(layout, to_delete, direction);
+                    }
                 }
             }
         }
@@ -1228,10 +1733,14 @@ void wiring_reduction(const Lyt& lyt, wiring_reduction_params ps = {}, wiring_re
     }
 
     // initialize stats for runtime measurement
-    wiring_reduction_stats             st{};
-    detail::wiring_reduction_impl<Lyt> p{lyt, ps, st};
+    wiring_reduction_stats st{};
+    {
+        const auto memory = st.profile.track_memory();
 
-    p.run();
+        detail::wiring_reduction_impl<Lyt> p{lyt, ps, st};
+
+        p.run();
+    }
 
     if (pst)
     {
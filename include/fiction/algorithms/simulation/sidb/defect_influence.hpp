@@ -10,6 +10,7 @@
 #include "fiction/algorithms/simulation/sidb/quickexact.hpp"
 #include "fiction/algorithms/simulation/sidb/sidb_simulation_domain.hpp"
 #include "fiction/algorithms/simulation/sidb/sidb_simulation_result.hpp"
+#include "fiction/io/sidb_simulation_domain_stream.hpp"
 #include "fiction/layouts/bounding_box.hpp"
 #include "fiction/technology/sidb_defect_surface.hpp"
 #include "fiction/technology/sidb_defects.hpp"
@@ -25,9 +26,12 @@
 #include <cassert>
 #include <cstdint>
 #include <cstdlib>
+#include <memory>
 #include <optional>
 #include <random>
+#include <string>
 #include <thread>
+#include <tuple>
 #include <unordered_set>
 #include <vector>
 
@@ -72,6 +76,11 @@ struct defect_influence_params
      * Definition of defect influence.
      */
     influence_definition influence_def{influence_definition::OPERATIONALITY_CHANGE};
+    /**
+     * Parameters for streaming each evaluated defect position to a file as soon as its influence is known. This allows
+     * for resuming long-running computations. By default, no file is written.
+     */
+    sidb_simulation_domain_stream_params stream{};
 };
 
 /**
@@ -142,6 +151,13 @@ class defect_influence_impl
             stats{st}
     {
         determine_nw_se_cells();
+
+        if (!params.stream.filename.empty())
+        {
+            influence_stream = std::make_unique<sidb_simulation_domain_stream<defect_influence_domain<Lyt>>>(
+                params.stream, std::vector<std::string>{"x", "y", "z"}, std::vector<std::string>{"influence status"},
+                influence_domain);
+        }
     }
 
     /**
@@ -444,6 +460,10 @@ class defect_influence_impl
      * The defect influence domain of the layout.
      */
     defect_influence_domain<Lyt> influence_domain{};
+    /**
+     * The stream that each evaluated defect position is appended to or `nullptr` if no stream file is given.
+     */
+    std::unique_ptr<sidb_simulation_domain_stream<defect_influence_domain<Lyt>>> influence_stream{nullptr};
     /**
      * The statistics of the defect influence domain computation.
      */
@@ -523,6 +543,21 @@ class defect_influence_impl
 
         return std::nullopt;
     }
+    /**
+     * Adds a value to the defect influence domain and appends it to the stream file, if any.
+     *
+     * @param defect_cell The defect position to associate with the value.
+     * @param value The value to add.
+     */
+    void add_to_domain(const typename Lyt::cell& defect_cell, const std::tuple<defect_influence_status>& value)
+    {
+        influence_domain.add_value(defect_cell, value);
+
+        if (influence_stream)
+        {
+            influence_stream->append(defect_cell, value);
+        }
+    }
     /**
      * This function evaluates if the defect at position `c` influences the layout.
      *
@@ -546,7 +581,7 @@ class defect_influence_impl
         const auto non_influential = [this, &defect_cell]()
         {
             ++num_simulator_invocations;
-            influence_domain.add_value(defect_cell, {defect_influence_status::NON_INFLUENTIAL});
+            add_to_domain(defect_cell, {defect_influence_status::NON_INFLUENTIAL});
 
             return defect_influence_status::NON_INFLUENTIAL;
         };
@@ -554,7 +589,7 @@ class defect_influence_impl
         const auto influential = [this, &defect_cell]()
         {
             ++num_simulator_invocations;
-            influence_domain.add_value(defect_cell, {defect_influence_status::INFLUENTIAL});
+            add_to_domain(defect_cell, {defect_influence_status::INFLUENTIAL});
 
             return defect_influence_status::INFLUENTIAL;
         };
@@ -858,6 +893,8 @@ class defect_influence_impl
  * @param params Defect influence domain computation parameters.
  * @param stats Statistics.
  * @return The defect influence domain of the layout.
+ * @throws std::invalid_argument if the stream file to resume from does not store a defect influence domain.
+ * @throws std::ofstream::failure if the stream file could not be opened.
  */
 template <typename Lyt, typename TT>
 [[nodiscard]] defect_influence_domain<Lyt>
@@ -893,6 +930,8 @@ defect_influence_grid_search(const Lyt& lyt, const std::vector<TT>& spec,
  * @param params Defect influence domain computation parameters.
  * @param stats Statistics.
  * @return The defect influence domain of the layout.
+ * @throws std::invalid_argument if the stream file to resume from does not store a defect influence domain.
+ * @throws std::ofstream::failure if the stream file could not be opened.
  */
 template <typename Lyt>
 [[nodiscard]] defect_influence_domain<Lyt>
@@ -927,6 +966,8 @@ defect_influence_grid_search(const Lyt& lyt, const defect_influence_params<cell<
  * @param params Defect influence domain computation parameters.
  * @param stats Statistics.
  * @return The (partial) defect influence domain of the layout.
+ * @throws std::invalid_argument if the stream file to resume from does not store a defect influence domain.
+ * @throws std::ofstream::failure if the stream file could not be opened.
  */
 template <typename Lyt, typename TT>
 [[nodiscard]] defect_influence_domain<Lyt>
@@ -962,6 +1003,8 @@ defect_influence_random_sampling(const Lyt& lyt, const std::vector<TT>& spec, st
  * @param params Defect influence domain computation parameters.
  * @param stats Statistics.
  * @return The (partial) defect influence domain of the layout.
+ * @throws std::invalid_argument if the stream file to resume from does not store a defect influence domain.
+ * @throws std::ofstream::failure if the stream file could not be opened.
  */
 template <typename Lyt>
 [[nodiscard]] defect_influence_domain<Lyt>
@@ -1020,6 +1063,8 @@ defect_influence_random_sampling(const Lyt& lyt, std::size_t samples,
  * @param params Defect influence domain computation parameters.
  * @param stats Defect influence computation statistics.
  * @return The (partial) defect influence domain of the layout.
+ * @throws std::invalid_argument if the stream file to resume from does not store a defect influence domain.
+ * @throws std::ofstream::failure if the stream file could not be opened.
  */
 template <typename Lyt, typename TT>
 [[nodiscard]] defect_influence_domain<Lyt>
@@ -1071,6 +1116,8 @@ defect_influence_quicktrace(const Lyt& lyt, const std::vector<TT>& spec, const s
  * @param params Defect influence domain computation parameters.
  * @param stats Defect influence computation statistics.
  * @return The (partial) defect influence domain of the layout.
+ * @throws std::invalid_argument if the stream file to resume from does not store a defect influence domain.
+ * @throws std::ofstream::failure if the stream file could not be opened.
  */
 template <typename Lyt>
 [[nodiscard]] defect_influence_domain<Lyt>
@@ -13,10 +13,12 @@
 #include "fiction/technology/sidb_charge_state.hpp"
 #include "fiction/technology/sidb_cluster_hierarchy.hpp"
 #include "fiction/traits.hpp"
+#include "fiction/utils/performance_profile.hpp"
 
 #include <btree.h>
 #include <fmt/format.h>
 #include <mockturtle/utils/stopwatch.hpp>
+#include <nlohmann/json.hpp>
 
 #include <algorithm>
 #include <array>
@@ -91,6 +93,11 @@ struct ground_state_space_results
      * be counted. This may be used to estimate the time it would take *ClusterComplete* to unfold the hierarchy.
      */
     const uint64_t projector_state_count{};
+    /**
+     * Time spent in the construction of the cluster hierarchy, the charge space updates, and the merges as well as the
+     * memory usage of the entire process.
+     */
+    const performance_profile profile{};
     /**
      * Report *Ground State Space* statistics. A quick heuristic to assess the quality of the pruning is captured by the
      * size of the charge space of the top cluster, which depends on the charge spaces of all clusters below it.
@@ -109,8 +116,24 @@ struct ground_state_space_results
         os << fmt::format("[i] Ground State Space took {:.4f} {}seconds",
                           gss_runtime > 1.0 ? gss_runtime : gss_runtime * 1000, gss_runtime > 1.0 ? "" : "milli")
            << std::endl;
+
+        profile.report(os);
     }
 };
+/**
+ * Converts *Ground State Space* results into JSON. The cluster hierarchy itself is not included.
+ *
+ * @param j JSON value to write to.
+ * @param results Results to convert.
+ */
+inline void to_json(nlohmann::json& j, const ground_state_space_results& results)
+{
+    j = {{"runtime in seconds", mockturtle::to_seconds(results.runtime)},
+         {"top level multisets", results.top_cluster ? results.top_cluster->charge_space.size() : 0},
+         {"maximum top level multisets", results.maximum_top_level_multisets},
+         {"projector states", results.projector_state_count},
+         {"profile", results.profile}};
+}
 
 namespace detail
 {
@@ -127,7 +150,8 @@ class ground_state_space_impl
      */
     ground_state_space_impl(const Lyt& lyt, const ground_state_space_params parameters) noexcept :
             params{parameters},
-            top_cluster{to_sidb_cluster(sidb_cluster_hierarchy(lyt))},
+            top_cluster{profile.call_with_phase_timer("cluster hierarchy construction",
+                                                      [&lyt] { return to_sidb_cluster(sidb_cluster_hierarchy(lyt)); })},
             clustering{
                 get_initial_clustering(top_cluster, get_local_potential_bounds(lyt, params.simulation_parameters))},
             mu_bounds_with_error{constants::ERROR_MARGIN - params.simulation_parameters.mu_minus,
@@ -149,19 +173,24 @@ class ground_state_space_impl
         mockturtle::stopwatch<>::duration time_counter{};
         {
             const mockturtle::stopwatch stop{time_counter};
+            const auto                  memory = profile.track_memory();
 
             while (!terminate)
             {
-                while (!update_charge_spaces())
-                {}
-
-                move_up_hierarchy();
+                profile.call_with_phase_timer("charge space updates",
+                                              [this]
+                                              {
+                                                  while (!update_charge_spaces())
+                                                  {}
+                                              });
+
+                profile.call_with_phase_timer("merging", [this] { move_up_hierarchy(); });
             }
         }
 
         const uint64_t max_multisets = maximum_top_level_multisets(top_cluster->num_sidbs());
 
-        return ground_state_space_results{top_cluster, time_counter, max_multisets, projector_state_count};
+        return ground_state_space_results{top_cluster, time_counter, max_multisets, projector_state_count, profile};
     }
 
   private:
@@ -1173,6 +1202,11 @@ class ground_state_space_impl
         return params.simulation_parameters.base == 3 ? ((number_of_sidbs + 1) * (number_of_sidbs + 2)) / 2 :
                                                         number_of_sidbs + 1;
     }
+    /**
+     * Profile of the construction. It is declared first such that the construction of the cluster hierarchy in the
+     * constructor can be profiled as well.
+     */
+    performance_profile profile{};
     /**
      * Parameters used during the construction.
      */
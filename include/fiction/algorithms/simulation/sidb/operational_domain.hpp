@@ -16,16 +16,19 @@
 #include "fiction/algorithms/simulation/sidb/sidb_simulation_engine.hpp"
 #include "fiction/algorithms/simulation/sidb/sidb_simulation_parameters.hpp"
 #include "fiction/algorithms/simulation/sidb/sidb_simulation_result.hpp"
+#include "fiction/io/sidb_simulation_domain_stream.hpp"
 #include "fiction/technology/cell_technologies.hpp"
 #include "fiction/technology/constants.hpp"
 #include "fiction/traits.hpp"
 #include "fiction/utils/hash.hpp"
 #include "fiction/utils/math_utils.hpp"
+#include "fiction/utils/performance_profile.hpp"
 
 #include <btree.h>
 #include <fmt/format.h>
 #include <kitty/traits.hpp>
 #include <mockturtle/utils/stopwatch.hpp>
+#include <nlohmann/json.hpp>
 
 #include <algorithm>
 #include <atomic>
@@ -35,14 +38,17 @@
 #include <cstdlib>
 #include <iterator>
 #include <limits>
+#include <memory>
 #include <numeric>
 #include <optional>
 #include <queue>
 #include <random>
 #include <stdexcept>
+#include <string>
 #include <thread>
 #include <tuple>
 #include <type_traits>
+#include <utility>
 #include <vector>
 
 namespace fiction
@@ -344,6 +350,27 @@ struct operational_domain_value_range
  */
 struct operational_domain_params
 {
+    /**
+     * Storage for the computed parameter points.
+     */
+    enum class domain_storage : uint8_t
+    {
+        /**
+         * Use `DENSE_GRID` for grid search and `HASH_MAP` for all other techniques.
+         */
+        AUTOMATIC,
+        /**
+         * Store the parameter points in a hash map. The memory consumption is proportional to the number of evaluated
+         * parameter points, which is preferable if only a small part of the parameter space is sampled.
+         */
+        HASH_MAP,
+        /**
+         * Store the parameter points in a dense array that is addressed by their step indices. The memory consumption
+         * is proportional to the total number of parameter points, but no lock is required to add points and no copy
+         * is created when iterating them.
+         */
+        DENSE_GRID
+    };
     /**
      * The parameters used to determine if a layout is operational or non-operational.
      */
@@ -355,6 +382,15 @@ struct operational_domain_params
     std::vector<operational_domain_value_range> sweep_dimensions{
         operational_domain_value_range{sweep_parameter::EPSILON_R, 1.0, 10.0, 0.1},
         operational_domain_value_range{sweep_parameter::LAMBDA_TF, 1.0, 10.0, 0.1}};
+    /**
+     * Storage for the computed parameter points.
+     */
+    domain_storage storage = domain_storage::AUTOMATIC;
+    /**
+     * Parameters for streaming each evaluated parameter point to a file as soon as its operational status is known.
+     * This allows for resuming long-running computations. By default, no file is written.
+     */
+    sidb_simulation_domain_stream_params stream{};
 };
 /**
  * Statistics for the operational domain computation. The statistics are used across the different operational domain
@@ -386,11 +422,58 @@ struct operational_domain_stats
      * Total number of parameter points in the parameter space.
      */
     std::size_t num_total_parameter_points{0};
+    /**
+     * Time spent in the different stages of the computation, e.g., random sampling, flood fill, or contour tracing, as
+     * well as the memory usage of the entire process.
+     */
+    performance_profile profile{};
 };
+/**
+ * Converts operational domain statistics into JSON.
+ *
+ * @param j JSON value to write to.
+ * @param stats Statistics to convert.
+ */
+inline void to_json(nlohmann::json& j, const operational_domain_stats& stats)
+{
+    j = {{"runtime in seconds", mockturtle::to_seconds(stats.time_total)},
+         {"number of simulator invocations", stats.num_simulator_invocations},
+         {"number of evaluated parameter combinations", stats.num_evaluated_parameter_combinations},
+         {"number of operational parameter combinations", stats.num_operational_parameter_combinations},
+         {"number of non-operational parameter combinations", stats.num_non_operational_parameter_combinations},
+         {"number of total parameter points", stats.num_total_parameter_points},
+         {"profile", stats.profile}};
+}
 
 namespace detail
 {
 
+/**
+ * Converts a sweep parameter to a string representation. This is used to write the parameter name to the CSV file.
+ *
+ * @param param The sweep parameter to be converted.
+ * @return The string representation of the sweep parameter.
+ */
+[[nodiscard]] static inline std::string sweep_parameter_to_string(const sweep_parameter& param) noexcept
+{
+    switch (param)
+    {
+        case sweep_parameter::EPSILON_R:
+        {
+            return "epsilon_r";
+        }
+        case sweep_parameter::LAMBDA_TF:
+        {
+            return "lambda_tf";
+        }
+        case sweep_parameter::MU_MINUS:
+        {
+            return "mu_minus";
+        }
+    }
+
+    return "";
+}
 /**
  * This function validates the given sweep parameters for the operational domain computation. It checks if the minimum
  * value of any sweep dimension is larger than the corresponding maximum value. Additionally, it checks if the step size
@@ -425,15 +508,17 @@ class operational_domain_impl
     /**
      * Standard constructor. Initializes the lyt, the truth table, the parameters and the statistics. Also
      * detects the output BDL pair, which is necessary for the operational domain computation. The lyt must
-     * have exactly one output BDL pair.
+     * have exactly one output BDL pair. If a stream file is given in `ps`, it is opened as well.
      *
      * @param lyt SiDB cell-level lyt to be evaluated.
      * @param tt Expected Boolean function of the lyt given as a multi-output truth table.
      * @param ps Parameters for the operational domain computation.
      * @param st Statistics of the process.
+     * @throws std::invalid_argument if the stream file should be resumed but does not match the sweep dimensions.
+     * @throws std::ofstream::failure if the stream file could not be opened.
      */
     operational_domain_impl(const Lyt& lyt, const std::vector<TT>& tt, const operational_domain_params& ps,
-                            operational_domain_stats& st) noexcept :
+                            operational_domain_stats& st) :
             layout{lyt},
             truth_table{tt},
             params{ps},
@@ -490,6 +575,8 @@ class operational_domain_impl
                                     (static_cast<double>(i) * params.sweep_dimensions[d].step));
             }
         }
+
+        open_stream();
     }
     /**
      * Additional Constructor. Initializes the layout, the parameters and the statistics.
@@ -547,6 +634,9 @@ class operational_domain_impl
     [[nodiscard]] OpDomain grid_search() noexcept
     {
         mockturtle::stopwatch stop{stats.time_total};
+        const auto            memory = stats.profile.track_memory();
+
+        prepare_storage(true);
 
         const auto all_index_combinations = cartesian_combinations(indices);
 
@@ -563,11 +653,13 @@ class operational_domain_impl
         // expensive operational points
         std::shuffle(all_step_points.begin(), all_step_points.end(), std::mt19937_64{std::random_device{}()});
 
-        simulate_operational_status_in_parallel(all_step_points);
+        stats.profile.call_with_phase_timer("grid search",
+                                            [this, &all_step_points]
+                                            { simulate_operational_status_in_parallel(all_step_points); });
 
         log_stats();
 
-        return op_domain;
+        return std::move(op_domain);
     }
     /**
      * Performs a random sampling of the specified number of samples within the specified parameter range. The
@@ -579,14 +671,19 @@ class operational_domain_impl
     [[nodiscard]] OpDomain random_sampling(const std::size_t samples) noexcept
     {
         mockturtle::stopwatch stop{stats.time_total};
+        const auto            memory = stats.profile.track_memory();
+
+        prepare_storage(false);
 
         const auto step_point_samples = generate_random_step_points(samples);
 
-        simulate_operational_status_in_parallel(step_point_samples);
+        stats.profile.call_with_phase_timer("random sampling",
+                                            [this, &step_point_samples]
+                                            { simulate_operational_status_in_parallel(step_point_samples); });
 
         log_stats();
 
-        return op_domain;
+        return std::move(op_domain);
     }
     /**
      * Performs flood fill to determine the operational domain. The algorithm first performs a random sampling of the
@@ -608,6 +705,9 @@ class operational_domain_impl
                "Flood fill is only supported for two and three dimensions");
 
         mockturtle::stopwatch stop{stats.time_total};
+        const auto            memory = stats.profile.track_memory();
+
+        prepare_storage(false);
 
         auto step_point_samples = generate_random_step_points(samples);
 
@@ -616,7 +716,11 @@ class operational_domain_impl
             step_point_samples.push_back(to_step_point(given_parameter_point.value()));
         }
 
-        simulate_operational_status_in_parallel(step_point_samples);
+        stats.profile.call_with_phase_timer("random sampling",
+                                            [this, &step_point_samples]
+                                            { simulate_operational_status_in_parallel(step_point_samples); });
+
+        const auto flood = stats.profile.time_phase("flood fill");
 
         // a queue of (x, y[, z]) dimension step points to be evaluated
         std::queue<step_point> queue{};
@@ -681,7 +785,7 @@ class operational_domain_impl
 
         log_stats();
 
-        return op_domain;
+        return std::move(op_domain);
     }
     /**
      * Performs contour tracing to determine the operational domain. The algorithm first performs a random sampling of
@@ -699,10 +803,17 @@ class operational_domain_impl
         assert(num_dimensions == 2 && "Contour tracing is only supported for two dimensions");
 
         mockturtle::stopwatch stop{stats.time_total};
+        const auto            memory = stats.profile.track_memory();
+
+        prepare_storage(false);
 
         const auto step_point_samples = generate_random_step_points(samples);
 
-        simulate_operational_status_in_parallel(step_point_samples);
+        stats.profile.call_with_phase_timer("random sampling",
+                                            [this, &step_point_samples]
+                                            { simulate_operational_status_in_parallel(step_point_samples); });
+
+        const auto tracing = stats.profile.time_phase("contour tracing");
 
         const auto next_clockwise_point = [](std::vector<step_point>& neighborhood,
                                              const step_point&        backtrack) noexcept -> step_point
@@ -781,7 +892,7 @@ class operational_domain_impl
 
         log_stats();
 
-        return op_domain;
+        return std::move(op_domain);
     }
     /**
      * Performs a grid search over the specified parameter ranges. For each physical parameter combination found for
@@ -797,6 +908,12 @@ class operational_domain_impl
         sidb_simulation_domain<parameter_point, uint64_t> suitable_params_domain{};
 
         mockturtle::stopwatch stop{stats.time_total};
+        const auto            memory = stats.profile.track_memory();
+
+        if (prepare_storage(true))
+        {
+            suitable_params_domain.use_grid_storage(grid_axes());
+        }
 
         // Cartesian product of all step point indices
         const auto all_index_combinations = cartesian_combinations(indices);
@@ -810,37 +927,43 @@ class operational_domain_impl
         std::vector<std::thread> threads{};
         threads.reserve(num_threads);
 
-        // launch threads, each with its own slice of random step points
-        for (auto i = 0ul; i < num_threads; ++i)
         {
-            const auto start = i * slice_size;
-            const auto end   = std::min(start + slice_size, all_index_combinations.size());
+            const auto search = stats.profile.time_phase("grid search");
 
-            if (start >= end)
+            // launch threads, each with its own slice of random step points
+            for (auto i = 0ul; i < num_threads; ++i)
             {
-                break;  // no more work to distribute
-            }
+                const auto start = i * slice_size;
+                const auto end   = std::min(start + slice_size, all_index_combinations.size());
 
-            threads.emplace_back(
-                [this, &lyt, start, end, &all_index_combinations]
+                if (start >= end)
                 {
-                    for (auto it = all_index_combinations.cbegin() + static_cast<int64_t>(start);
-                         it != all_index_combinations.cbegin() + static_cast<int64_t>(end); ++it)
+                    break;  // no more work to distribute
+                }
+
+                threads.emplace_back(
+                    [this, &lyt, start, end, &all_index_combinations]
                     {
-                        is_step_point_suitable(lyt, step_point{*it});  // construct a step_point
-                    }
-                });
-        }
+                        for (auto it = all_index_combinations.cbegin() + static_cast<int64_t>(start);
+                             it != all_index_combinations.cbegin() + static_cast<int64_t>(end); ++it)
+                        {
+                            is_step_point_suitable(lyt, step_point{*it});  // construct a step_point
+                        }
+                    });
+            }
 
-        // wait for all threads to complete
-        for (auto& thread : threads)
-        {
-            if (thread.joinable())
+            // wait for all threads to complete
+            for (auto& thread : threads)
             {
-                thread.join();
+                if (thread.joinable())
+                {
+                    thread.join();
+                }
             }
         }
 
+        const auto classification = stats.profile.time_phase("excited state classification");
+
         sidb_simulation_parameters simulation_parameters = params.operational_params.simulation_parameters;
 
         op_domain.for_each(
@@ -952,6 +1075,10 @@ class operational_domain_impl
      * The operational domain of the layout.
      */
     OpDomain op_domain{};
+    /**
+     * The stream that each evaluated parameter point is appended to or `nullptr` if no stream file is given.
+     */
+    std::unique_ptr<sidb_simulation_domain_stream<OpDomain>> domain_stream{nullptr};
     /**
      * Forward-declare step_point.
      */
@@ -1033,6 +1160,87 @@ class operational_domain_impl
             return step_values < other.step_values;
         }
     };
+    /**
+     * Opens the stream file given in the parameters, if any. If resuming is enabled, the parameter points stored in an
+     * existing file are loaded into the operational domain such that they are not evaluated again.
+     */
+    void open_stream()
+    {
+        if (params.stream.filename.empty())
+        {
+            return;
+        }
+
+        std::vector<std::string> key_columns{};
+        key_columns.reserve(num_dimensions);
+
+        for (auto d = 0u; d < num_dimensions; ++d)
+        {
+            key_columns.push_back(sweep_parameter_to_string(params.sweep_dimensions[d].dimension));
+        }
+
+        std::vector<std::string> value_columns{"operational status"};
+
+        if constexpr (std::is_same_v<OpDomain, critical_temperature_domain>)
+        {
+            value_columns.emplace_back("critical temperature");
+        }
+
+        domain_stream = std::make_unique<sidb_simulation_domain_stream<OpDomain>>(
+            params.stream, std::move(key_columns), std::move(value_columns), op_domain);
+    }
+    /**
+     * Adds a value to the operational domain and appends it to the stream file, if any.
+     *
+     * @param param_point The parameter point to associate with the value.
+     * @param value The value to add.
+     */
+    void add_to_domain(const parameter_point& param_point, const typename OpDomain::mapped_type& value)
+    {
+        op_domain.add_value(param_point, value);
+
+        if (domain_stream)
+        {
+            domain_stream->append(param_point, value);
+        }
+    }
+    /**
+     * Switches the operational domain to a dense grid storage if requested by the parameters.
+     *
+     * @param exhaustive Whether the entire parameter space is going to be evaluated. This determines the storage if
+     * `params.storage` is `AUTOMATIC`.
+     * @return `true` iff the operational domain uses a dense grid storage.
+     */
+    bool prepare_storage(const bool exhaustive)
+    {
+        using storage = operational_domain_params::domain_storage;
+
+        if (params.storage == storage::DENSE_GRID || (params.storage == storage::AUTOMATIC && exhaustive))
+        {
+            op_domain.use_grid_storage(grid_axes());
+
+            return true;
+        }
+
+        return false;
+    }
+    /**
+     * Returns the axes of the dense grid that contains all step points.
+     *
+     * @return One axis per dimension.
+     */
+    [[nodiscard]] std::vector<sidb_simulation_domain_axis> grid_axes() const
+    {
+        std::vector<sidb_simulation_domain_axis> axes{};
+        axes.reserve(num_dimensions);
+
+        for (auto d = 0u; d < num_dimensions; ++d)
+        {
+            axes.push_back({params.sweep_dimensions[d].min, params.sweep_dimensions[d].step, values[d].size()});
+        }
+
+        return axes;
+    }
     /**
      * Converts a step point to a parameter point.
      *
@@ -1133,7 +1341,8 @@ class operational_domain_impl
      * non-operational state is found. In the worst case, the function performs \f$2^i\f$ simulations, where \f$i\f$ is
      * the number of inputs of the layout. This function is used by all operational domain computation techniques.
      *
-     * Any investigated point is added to the stored `op_domain`, regardless of its operational status.
+     * Any investigated point is added to the stored `op_domain`, regardless of its operational status, and appended to
+     * the stream file, if any.
      *
      * @param sp Step point to be investigated.
      * @return The operational status of the layout under the given simulation parameters.
@@ -1153,12 +1362,12 @@ class operational_domain_impl
             {
                 if (ct_value.has_value())
                 {
-                    op_domain.add_value(param_point, std::tuple{operational_status::OPERATIONAL, ct_value.value()});
+                    add_to_domain(param_point, std::tuple{operational_status::OPERATIONAL, ct_value.value()});
                 }
             }
             else
             {
-                op_domain.add_value(param_point, std::make_tuple(operational_status::OPERATIONAL));
+                add_to_domain(param_point, std::make_tuple(operational_status::OPERATIONAL));
             }
 
             return operational_status::OPERATIONAL;
@@ -1168,11 +1377,11 @@ class operational_domain_impl
         {
             if constexpr (std::is_same_v<OpDomain, critical_temperature_domain>)
             {
-                op_domain.add_value(param_point, std::tuple{operational_status::NON_OPERATIONAL, 0.0});
+                add_to_domain(param_point, std::tuple{operational_status::NON_OPERATIONAL, 0.0});
             }
             else
             {
-                op_domain.add_value(param_point, std::make_tuple(operational_status::NON_OPERATIONAL));
+                add_to_domain(param_point, std::make_tuple(operational_status::NON_OPERATIONAL));
             }
 
             return operational_status::NON_OPERATIONAL;
@@ -1709,7 +1918,9 @@ class operational_domain_impl
  * @param params Operational domain computation parameters.
  * @param stats Operational domain computation statistics.
  * @return The operational domain of the layout.
- * @throws std::invalid_argument if the given sweep parameters are invalid.
+ * @throws std::invalid_argument if the given sweep parameters are invalid or do not match the stream file to resume
+ * from.
+ * @throws std::ofstream::failure if the stream file could not be opened.
  */
 template <typename Lyt, typename TT>
 [[nodiscard]] operational_domain operational_domain_grid_search(const Lyt& lyt, const std::vector<TT>& spec,
@@ -1755,7 +1966,9 @@ template <typename Lyt, typename TT>
  * @param params Operational domain computation parameters.
  * @param stats Operational domain computation statistics.
  * @return The operational domain of the layout.
- * @throws std::invalid_argument if the given sweep parameters are invalid.
+ * @throws std::invalid_argument if the given sweep parameters are invalid or do not match the stream file to resume
+ * from.
+ * @throws std::ofstream::failure if the stream file could not be opened.
  */
 template <typename Lyt, typename TT>
 [[nodiscard]] operational_domain operational_domain_random_sampling(const Lyt& lyt, const std::vector<TT>& spec,
@@ -1812,7 +2025,9 @@ template <typename Lyt, typename TT>
  * @param params Operational domain computation parameters.
  * @param stats Operational domain computation statistics.
  * @return The operational domain of the layout.
- * @throws std::invalid_argument if the given sweep parameters are invalid.
+ * @throws std::invalid_argument if the given sweep parameters are invalid or do not match the stream file to resume
+ * from.
+ * @throws std::ofstream::failure if the stream file could not be opened.
  */
 template <typename Lyt, typename TT>
 [[nodiscard]] operational_domain
@@ -1876,7 +2091,9 @@ operational_domain_flood_fill(const Lyt& lyt, const std::vector<TT>& spec, const
  * @param params Operational domain computation parameters.
  * @param stats Operational domain computation statistics.
  * @return The operational domain of the layout.
- * @throws std::invalid_argument if the given sweep parameters are invalid.
+ * @throws std::invalid_argument if the given sweep parameters are invalid or do not match the stream file to resume
+ * from.
+ * @throws std::ofstream::failure if the stream file could not be opened.
  */
 template <typename Lyt, typename TT>
 [[nodiscard]] operational_domain operational_domain_contour_tracing(const Lyt& lyt, const std::vector<TT>& spec,
@@ -1927,7 +2144,9 @@ template <typename Lyt, typename TT>
  * @param params Operational domain computation parameters.
  * @param stats Operational domain computation statistics.
  * @return The critical temperature domain of the layout.
- * @throws std::invalid_argument if the given sweep parameters are invalid.
+ * @throws std::invalid_argument if the given sweep parameters are invalid or do not match the stream file to resume
+ * from.
+ * @throws std::ofstream::failure if the stream file could not be opened.
  */
 template <typename Lyt, typename TT>
 [[nodiscard]] critical_temperature_domain
@@ -1973,7 +2192,9 @@ critical_temperature_domain_grid_search(const Lyt& lyt, const std::vector<TT>& s
  * @param params Operational domain computation parameters.
  * @param stats Operational domain computation statistics.
  * @return The critical temperature domain of the layout.
- * @throws std::invalid_argument if the given sweep parameters are invalid.
+ * @throws std::invalid_argument if the given sweep parameters are invalid or do not match the stream file to resume
+ * from.
+ * @throws std::ofstream::failure if the stream file could not be opened.
  */
 template <typename Lyt, typename TT>
 [[nodiscard]] critical_temperature_domain
@@ -2025,7 +2246,9 @@ critical_temperature_domain_random_sampling(const Lyt& lyt, const std::vector<TT
  * @param params Operational domain computation parameters.
  * @param stats Operational domain computation statistics.
  * @return The critical temperature domain of the layout.
- * @throws std::invalid_argument if the given sweep parameters are invalid.
+ * @throws std::invalid_argument if the given sweep parameters are invalid or do not match the stream file to resume
+ * from.
+ * @throws std::ofstream::failure if the stream file could not be opened.
  */
 template <typename Lyt, typename TT>
 [[nodiscard]] critical_temperature_domain
@@ -2085,7 +2308,9 @@ critical_temperature_domain_flood_fill(const Lyt& lyt, const std::vector<TT>& sp
  * @param params Operational domain computation parameters.
  * @param stats Operational domain computation statistics.
  * @return The critical temperature domain of the layout.
- * @throws std::invalid_argument if the given sweep parameters are invalid.
+ * @throws std::invalid_argument if the given sweep parameters are invalid or do not match the stream file to resume
+ * from.
+ * @throws std::ofstream::failure if the stream file could not be opened.
  */
 template <typename Lyt, typename TT>
 [[nodiscard]] critical_temperature_domain
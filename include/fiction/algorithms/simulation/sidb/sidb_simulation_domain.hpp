@@ -5,20 +5,57 @@
 #ifndef FICTION_SIDB_SIMULATION_DOMAIN_HPP
 #define FICTION_SIDB_SIMULATION_DOMAIN_HPP
 
+#include "fiction/technology/constants.hpp"
 #include "fiction/utils/phmap_utils.hpp"
 
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstdint>
 #include <cstdio>
+#include <functional>
+#include <memory>
+#include <numeric>
 #include <optional>
+#include <stdexcept>
 #include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
 namespace fiction
 {
 
+/**
+ * Describes one dimension of a regularly sampled simulation domain, i.e., the values \f$\text{min} + i \cdot
+ * \text{step}\f$ for \f$i = 0, \dots, \text{num_values} - 1\f$.
+ */
+struct sidb_simulation_domain_axis
+{
+    /**
+     * The first value of the dimension.
+     */
+    double min{0.0};
+    /**
+     * The distance between two consecutive values of the dimension.
+     */
+    double step{1.0};
+    /**
+     * The number of values of the dimension.
+     */
+    std::size_t num_values{0};
+};
 /**
  * The `sidb_simulation_domain` is designed to represent a generic simulation domain where keys are
  * associated with values stored as tuples. It uses a `locked_parallel_flat_hash_map` to ensure
  * thread-safe access to the stored data. All methods of this class are thread-safe.
  *
+ * If the keys represent points of a regular sweep, i.e., `Key` can be constructed from and converted to a
+ * `std::vector<double>` via `get_parameters()`, the domain can additionally be switched to a dense grid storage via
+ * `use_grid_storage`. Values of keys that lie on the grid are then stored in a flat array addressed by their step
+ * indices, which neither requires a global lock for writing nor a copy for iterating. Keys that do not lie on the grid
+ * are still stored in the hash map.
+ *
  * @tparam Key The type of the key used to identify entries in the domain.
  * @tparam MappedTypes Value types stored in the tuple.
  */
@@ -26,6 +63,14 @@ template <typename Key, typename... MappedTypes>
 class sidb_simulation_domain
 {
   public:
+    /**
+     * Type of the keys.
+     */
+    using key_type = Key;
+    /**
+     * Type of the values associated with the keys.
+     */
+    using mapped_type = std::tuple<MappedTypes...>;
     /**
      * Constructs a new `sidb_simulation_domain` instance.
      */
@@ -33,6 +78,45 @@ class sidb_simulation_domain
     {
         static_assert(sizeof...(MappedTypes) > 0, "MappedTypes must not be empty");
     }
+    /**
+     * Copy constructor. The grid storage, if any, is copied as well.
+     *
+     * @param other The domain to copy.
+     */
+    sidb_simulation_domain(const sidb_simulation_domain& other) :
+            domain_values{other.domain_values},
+            grid{other.grid ? std::make_unique<dense_grid>(*other.grid) : nullptr}
+    {}
+    /**
+     * Move constructor.
+     */
+    sidb_simulation_domain(sidb_simulation_domain&&) = default;
+    /**
+     * Copy assignment operator. The grid storage, if any, is copied as well.
+     *
+     * @param other The domain to copy.
+     * @return Reference to this domain.
+     */
+    sidb_simulation_domain& operator=(const sidb_simulation_domain& other)
+    {
+        if (this != &other)
+        {
+            domain_values = other.domain_values;
+            grid          = other.grid ? std::make_unique<dense_grid>(*other.grid) : nullptr;
+        }
+
+        return *this;
+    }
+    /**
+     * Move assignment operator.
+     *
+     * @return Reference to this domain.
+     */
+    sidb_simulation_domain& operator=(sidb_simulation_domain&&) = default;
+    /**
+     * Destructor.
+     */
+    ~sidb_simulation_domain() = default;
     /**
      * Adds a value to the operational domain. This function is thread-safe and uses the `try_emplace` method.
      *
@@ -41,6 +125,15 @@ class sidb_simulation_domain
      */
     void add_value(const Key& key, const std::tuple<MappedTypes...>& value)
     {
+        if (grid)
+        {
+            if (const auto index = grid->index_of(key); index.has_value())
+            {
+                grid->try_emplace(*index, value);
+                return;
+            }
+        }
+
         domain_values.try_emplace(key, value);
     }
     /**
@@ -50,7 +143,7 @@ class sidb_simulation_domain
      */
     [[nodiscard]] std::size_t size() const
     {
-        return domain_values.size();
+        return domain_values.size() + (grid ? grid->size() : 0);
     }
     /**
      * Checks whether the operational domain is empty.
@@ -59,11 +152,12 @@ class sidb_simulation_domain
      */
     [[nodiscard]] bool empty() const noexcept
     {
-        return domain_values.empty();
+        return domain_values.empty() && (!grid || grid->size() == 0);
     }
     /**
      * Applies a callable to all key-value pairs in the container. For thread-safety, this function operates on a copy
-     * of the underlying map created at the time of the function call.
+     * of the underlying map created at the time of the function call. Values in the grid storage are visited in the
+     * order of their step indices without copying them. The callable may safely add values to this domain or query it.
      *
      * @tparam Fn Functor type.
      * @param fn Functor to apply to each key-value pair.
@@ -71,6 +165,16 @@ class sidb_simulation_domain
     template <typename Fn>
     void for_each(Fn&& fn) const
     {
+        if (grid)
+        {
+            grid->for_each(fn);
+
+            if (domain_values.empty())
+            {
+                return;
+            }
+        }
+
         // copy for thread-safety
         const auto domain_values_copy = domain_values;
 
@@ -86,18 +190,325 @@ class sidb_simulation_domain
      */
     [[nodiscard]] std::optional<std::tuple<MappedTypes...>> contains(const Key& key) const
     {
+        if (grid)
+        {
+            if (const auto index = grid->index_of(key); index.has_value())
+            {
+                return grid->at(*index);
+            }
+        }
+
         std::optional<std::tuple<MappedTypes...>> result;
 
         domain_values.if_contains(key, [&result](const auto& entry) { result = entry.second; });
 
         return result;
     }
+    /**
+     * Switches this domain to a dense grid storage spanned by the given axes. One slot is allocated for each point of
+     * the grid such that the memory consumption is proportional to the number of grid points, regardless of how many
+     * of them are actually assigned a value. Therefore, this storage is best suited for exhaustive sweeps. Values that
+     * have been added before and whose keys lie on the grid are moved to the grid storage.
+     *
+     * This function is only available if `Key` can be constructed from a `std::vector<double>` and provides its
+     * parameter values via `get_parameters()`. It must not be called concurrently with any other member function.
+     *
+     * @param axes The axes of the grid. The first axis is the most significant one when ordering the grid points.
+     * @throws std::invalid_argument if an axis has a non-finite minimum or a step size that is not positive and finite.
+     */
+    void use_grid_storage(const std::vector<sidb_simulation_domain_axis>& axes)
+    {
+        static_assert(is_grid_key_v, "Key does not represent points of a regular sweep");
+
+        for (const auto& axis : axes)
+        {
+            if (!std::isfinite(axis.min) || !std::isfinite(axis.step) || axis.step <= 0.0)
+            {
+                throw std::invalid_argument("Invalid grid axis: 'min' must be finite and 'step' must be positive");
+            }
+        }
+
+        auto new_grid = std::make_unique<dense_grid>(axes);
+
+        if (grid)
+        {
+            grid->for_each([&new_grid, this](const Key& key, const auto& value)
+                           { move_to_grid_or_map(*new_grid, key, value); });
+        }
+
+        const auto domain_values_copy = domain_values;
+        domain_values.clear();
+
+        for (const auto& [key, value] : domain_values_copy)
+        {
+            move_to_grid_or_map(*new_grid, key, value);
+        }
+
+        grid = std::move(new_grid);
+    }
+    /**
+     * Checks whether this domain uses a dense grid storage.
+     *
+     * @return `true` iff `use_grid_storage` has been called on this domain.
+     */
+    [[nodiscard]] bool has_grid_storage() const noexcept
+    {
+        return grid != nullptr;
+    }
 
   protected:
     /**
      * The domain values stored in a thread-safe map.
      */
     locked_parallel_flat_hash_map<Key, std::tuple<MappedTypes...>> domain_values{};
+
+  private:
+    /**
+     * Whether `Key` represents a point of a regular sweep and, thus, can be stored in a dense grid.
+     */
+    static constexpr bool is_grid_key_v = std::is_constructible_v<Key, std::vector<double>>;
+    /**
+     * A dense grid that stores one value per grid point in a flat array. Each slot is guarded by an atomic state that
+     * is set once a value has been written completely. Thereby, values of different grid points can be written
+     * concurrently without any lock, and reading a slot never observes a partially written value.
+     */
+    class dense_grid
+    {
+      public:
+        /**
+         * Standard constructor. Allocates one slot per grid point.
+         *
+         * @param grid_axes The axes of the grid.
+         */
+        explicit dense_grid(const std::vector<sidb_simulation_domain_axis>& grid_axes) :
+                axes{grid_axes},
+                num_points{std::accumulate(axes.cbegin(), axes.cend(), std::size_t{1},
+                                           [](const auto product, const auto& axis)
+                                           { return product * axis.num_values; })},
+                values(num_points),
+                states(num_points)
+        {}
+        /**
+         * Copy constructor.
+         *
+         * @param other The grid to copy.
+         */
+        dense_grid(const dense_grid& other) :
+                axes{other.axes},
+                num_points{other.num_points},
+                values(num_points),
+                states(num_points)
+        {
+            for (std::size_t i = 0; i < num_points; ++i)
+            {
+                if (other.states[i].load(std::memory_order_acquire) == slot_state::ASSIGNED)
+                {
+                    values[i] = other.values[i];
+                    states[i].store(slot_state::ASSIGNED, std::memory_order_relaxed);
+                }
+            }
+
+            num_assigned.store(other.num_assigned.load());
+        }
+        /**
+         * Returns the slot index of the given key.
+         *
+         * Keys whose parameters are not finite or lie outside of \f$[\text{min}, \text{max}]\f$ of an axis, up to
+         * `constants::ERROR_MARGIN`, are never mapped to a slot and, thus, end up in the hash map.
+         *
+         * @param key The key to determine the slot index for.
+         * @return The slot index of `key` or `std::nullopt` if `key` does not lie on the grid.
+         */
+        [[nodiscard]] std::optional<std::size_t> index_of(const Key& key) const noexcept
+        {
+            if constexpr (is_grid_key_v)
+            {
+                const auto& parameters = key.get_parameters();
+
+                if (parameters.size() != axes.size())
+                {
+                    return std::nullopt;
+                }
+
+                std::size_t index = 0;
+
+                for (std::size_t d = 0; d < axes.size(); ++d)
+                {
+                    const auto& axis = axes[d];
+
+                    if (axis.num_values == 0)
+                    {
+                        return std::nullopt;
+                    }
+
+                    const auto max = axis.min + static_cast<double>(axis.num_values - 1) * axis.step;
+
+                    // the negated comparison also rejects NaN
+                    if (!(parameters[d] >= axis.min - constants::ERROR_MARGIN &&
+                          parameters[d] <= max + constants::ERROR_MARGIN))
+                    {
+                        return std::nullopt;
+                    }
+
+                    const auto step = std::round((parameters[d] - axis.min) / axis.step);
+
+                    if (step < 0.0 || step >= static_cast<double>(axis.num_values) ||
+                        std::fabs(axis.min + step * axis.step - parameters[d]) >= constants::ERROR_MARGIN)
+                    {
+                        return std::nullopt;
+                    }
+
+                    index = index * axis.num_values + static_cast<std::size_t>(step);
+                }
+
+                return index;
+            }
+            else
+            {
+                return std::nullopt;
+            }
+        }
+        /**
+         * Writes the given value to the given slot unless the slot has already been claimed by another write.
+         *
+         * @param index The slot index.
+         * @param value The value to write.
+         */
+        void try_emplace(const std::size_t index, const std::tuple<MappedTypes...>& value) noexcept
+        {
+            uint8_t expected = slot_state::EMPTY;
+
+            if (states[index].compare_exchange_strong(expected, slot_state::WRITING, std::memory_order_acquire))
+            {
+                values[index] = value;
+                states[index].store(slot_state::ASSIGNED, std::memory_order_release);
+                ++num_assigned;
+            }
+        }
+        /**
+         * Returns the value of the given slot.
+         *
+         * @param index The slot index.
+         * @return The value of the slot or `std::nullopt` if no value has been written to it (yet).
+         */
+        [[nodiscard]] std::optional<std::tuple<MappedTypes...>> at(const std::size_t index) const noexcept
+        {
+            if (states[index].load(std::memory_order_acquire) == slot_state::ASSIGNED)
+            {
+                return values[index];
+            }
+
+            return std::nullopt;
+        }
+        /**
+         * Returns the number of slots that have been assigned a value.
+         *
+         * @return Number of assigned slots.
+         */
+        [[nodiscard]] std::size_t size() const noexcept
+        {
+            return num_assigned.load();
+        }
+        /**
+         * Applies a callable to all assigned slots in the order of their indices.
+         *
+         * @tparam Fn Functor type.
+         * @param fn Functor to apply to each key-value pair.
+         */
+        template <typename Fn>
+        void for_each(Fn&& fn) const
+        {
+            if constexpr (is_grid_key_v)
+            {
+                std::vector<std::size_t> steps(axes.size(), 0);
+                std::vector<double>      parameters(axes.size(), 0.0);
+
+                for (std::size_t i = 0; i < num_points; ++i)
+                {
+                    // determine the step in each dimension from the slot index
+                    for (std::size_t d = axes.size(), remainder = i; d-- > 0;)
+                    {
+                        steps[d] = remainder % axes[d].num_values;
+                        remainder /= axes[d].num_values;
+                    }
+
+                    if (states[i].load(std::memory_order_acquire) != slot_state::ASSIGNED)
+                    {
+                        continue;
+                    }
+
+                    for (std::size_t d = 0; d < axes.size(); ++d)
+                    {
+                        parameters[d] = axes[d].min + static_cast<double>(steps[d]) * axes[d].step;
+                    }
+
+                    std::invoke(fn, Key{parameters}, values[i]);
+                }
+            }
+        }
+
+      private:
+        /**
+         * Possible states of a slot.
+         */
+        enum slot_state : uint8_t
+        {
+            /**
+             * No value has been written to the slot.
+             */
+            EMPTY,
+            /**
+             * A value is currently being written to the slot.
+             */
+            WRITING,
+            /**
+             * The slot holds a value.
+             */
+            ASSIGNED
+        };
+        /**
+         * The axes of the grid.
+         */
+        const std::vector<sidb_simulation_domain_axis> axes;
+        /**
+         * The total number of grid points.
+         */
+        const std::size_t num_points;
+        /**
+         * The values of all slots.
+         */
+        std::vector<std::tuple<MappedTypes...>> values;
+        /**
+         * The states of all slots.
+         */
+        std::vector<std::atomic<uint8_t>> states;
+        /**
+         * The number of assigned slots.
+         */
+        std::atomic<std::size_t> num_assigned{0};
+    };
+    /**
+     * The dense grid storage or `nullptr` if only the hash map is used.
+     */
+    std::unique_ptr<dense_grid> grid{nullptr};
+    /**
+     * Adds the given key-value pair to the given grid if the key lies on it and to the hash map otherwise.
+     *
+     * @param target_grid The grid to add the key-value pair to.
+     * @param key The key.
+     * @param value The value.
+     */
+    void move_to_grid_or_map(dense_grid& target_grid, const Key& key, const std::tuple<MappedTypes...>& value)
+    {
+        if (const auto index = target_grid.index_of(key); index.has_value())
+        {
+            target_grid.try_emplace(*index, value);
+        }
+        else
+        {
+            domain_values.try_emplace(key, value);
+        }
+    }
 };
 
 }  // namespace fiction
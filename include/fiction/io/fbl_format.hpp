@@ -0,0 +1,276 @@
+//
+// Created by marcel on 19.10.26.
+//
+
+#ifndef FICTION_FBL_FORMAT_HPP
+#define FICTION_FBL_FORMAT_HPP
+
+#include "fiction/technology/cell_technologies.hpp"
+#include "fiction/traits.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+namespace fiction
+{
+
+/**
+ * Exception thrown when an error occurs during parsing of an .fbl file containing a gate-level or cell-level layout.
+ */
+class fbl_parsing_error : public std::runtime_error
+{
+  public:
+    /**
+     * Constructs a `fbl_parsing_error` object with the given error message.
+     *
+     * @param msg The error message describing the parsing error.
+     */
+    explicit fbl_parsing_error(const std::string_view& msg) noexcept : std::runtime_error(msg.data()) {}
+};
+/**
+ * Exception thrown by `write_fbl_layout` if the given layout cannot be stored in an .fbl file, e.g., because the file
+ * could not be parsed again.
+ */
+class fbl_write_error : public std::invalid_argument
+{
+  public:
+    /**
+     * Constructs a `fbl_write_error` object with the given error message.
+     *
+     * @param msg The error message describing why the layout cannot be stored.
+     */
+    explicit fbl_write_error(const std::string_view& msg) noexcept : std::invalid_argument(msg.data()) {}
+};
+
+namespace detail
+{
+
+/**
+ * Appends the little-endian encoding of the given unsigned integer to the given buffer.
+ *
+ * @tparam T Unsigned integer type.
+ * @param buffer Buffer to append to.
+ * @param value Value to encode.
+ */
+template <typename T>
+void append_little_endian(std::string& buffer, const T value)
+{
+    static_assert(std::is_unsigned_v<T>, "T is not an unsigned integer type");
+
+    for (std::size_t i = 0; i < sizeof(T); ++i)
+    {
+        buffer.push_back(static_cast<char>(static_cast<uint8_t>(value >> (8u * i))));
+    }
+}
+/**
+ * Decodes an unsigned integer from its little-endian encoding.
+ *
+ * @tparam T Unsigned integer type.
+ * @param bytes Pointer to the first of `sizeof(T)` bytes.
+ * @return The decoded value.
+ */
+template <typename T>
+[[nodiscard]] T load_little_endian(const char* bytes) noexcept
+{
+    static_assert(std::is_unsigned_v<T>, "T is not an unsigned integer type");
+
+    T value{0};
+
+    for (std::size_t i = 0; i < sizeof(T); ++i)
+    {
+        value |= static_cast<T>(static_cast<T>(static_cast<uint8_t>(bytes[i])) << (8u * i));
+    }
+
+    return value;
+}
+
+/**
+ * Definitions of the fiction binary layout (FBL) format. All integers are stored in little-endian byte order. A file
+ * consists of
+ *
+ * - a header: magic number, format version, layout kind, topology, technology, lattice orientation, clock zone size,
+ *   aspect ratio, and layout name,
+ * - the clocking scheme: name, number of clocks, and, if it is irregular, the clock numbers of all clock zones,
+ * - either the gate-level section: tiles, gate types, and fanin counts of all nodes in topological order, followed by
+ *   the incoming tiles, the truth tables of generic functions, and the names of primary inputs and outputs,
+ * - or the cell-level section: positions, types, and, for QCA, modes of all cells, followed by the cell names.
+ *
+ * Coordinates are stored in the 64-bit encoding of `offset::ucoord_t` and all arrays are stored contiguously such that
+ * memory-mapped files can be decoded without intermediate copies.
+ */
+namespace fbl
+{
+
+inline constexpr std::array<char, 4> MAGIC{'F', 'B', 'L', '\0'};
+inline constexpr uint16_t            VERSION = 1;
+
+enum class layout_kind : uint8_t
+{
+    GATE_LEVEL = 0,
+    CELL_LEVEL = 1
+};
+
+enum class topology : uint8_t
+{
+    CARTESIAN = 0,
+    ODD_ROW_CARTESIAN,
+    EVEN_ROW_CARTESIAN,
+    ODD_COLUMN_CARTESIAN,
+    EVEN_COLUMN_CARTESIAN,
+    ODD_ROW_HEX,
+    EVEN_ROW_HEX,
+    ODD_COLUMN_HEX,
+    EVEN_COLUMN_HEX
+};
+
+inline constexpr std::array<const char*, 9> TOPOLOGY_NAMES{
+    "cartesian",   "odd_row_cartesian", "even_row_cartesian", "odd_column_cartesian", "even_column_cartesian",
+    "odd_row_hex", "even_row_hex",      "odd_column_hex",     "even_column_hex"};
+
+enum class technology : uint8_t
+{
+    NONE = 0,
+    QCA,
+    INML,
+    SIDB
+};
+
+inline constexpr std::array<const char*, 4> TECHNOLOGY_NAMES{"", "QCA", "iNML", "SiDB"};
+
+enum class lattice_orientation : uint8_t
+{
+    NONE = 0,
+    SI_100,
+    SI_111
+};
+
+inline constexpr std::array<const char*, 3> LATTICE_ORIENTATION_NAMES{"", "100", "111"};
+
+enum class gate_type : uint8_t
+{
+    PI = 0,
+    PO,
+    BUF,
+    INV,
+    AND,
+    NAND,
+    OR,
+    NOR,
+    XOR,
+    XNOR,
+    LT,
+    GT,
+    LE,
+    GE,
+    MAJ,
+    FUNCTION
+};
+
+template <typename Lyt>
+[[nodiscard]] constexpr topology topology_of() noexcept
+{
+    if constexpr (is_shifted_cartesian_layout_v<Lyt>)
+    {
+        if constexpr (has_odd_row_cartesian_arrangement_v<Lyt>)
+        {
+            return topology::ODD_ROW_CARTESIAN;
+        }
+        else if constexpr (has_even_row_cartesian_arrangement_v<Lyt>)
+        {
+            return topology::EVEN_ROW_CARTESIAN;
+        }
+        else if constexpr (has_odd_column_cartesian_arrangement_v<Lyt>)
+        {
+            return topology::ODD_COLUMN_CARTESIAN;
+        }
+        else
+        {
+            return topology::EVEN_COLUMN_CARTESIAN;
+        }
+    }
+    else if constexpr (is_hexagonal_layout_v<Lyt>)
+    {
+        if constexpr (has_odd_row_hex_arrangement_v<Lyt>)
+        {
+            return topology::ODD_ROW_HEX;
+        }
+        else if constexpr (has_even_row_hex_arrangement_v<Lyt>)
+        {
+            return topology::EVEN_ROW_HEX;
+        }
+        else if constexpr (has_odd_column_hex_arrangement_v<Lyt>)
+        {
+            return topology::ODD_COLUMN_HEX;
+        }
+        else
+        {
+            return topology::EVEN_COLUMN_HEX;
+        }
+    }
+    else
+    {
+        return topology::CARTESIAN;
+    }
+}
+
+template <typename Lyt>
+[[nodiscard]] constexpr technology technology_of() noexcept
+{
+    if constexpr (is_cell_level_layout_v<Lyt>)
+    {
+        if constexpr (has_qca_technology_v<Lyt>)
+        {
+            return technology::QCA;
+        }
+        else if constexpr (has_inml_technology_v<Lyt>)
+        {
+            return technology::INML;
+        }
+        else if constexpr (has_sidb_technology_v<Lyt>)
+        {
+            return technology::SIDB;
+        }
+    }
+
+    return technology::NONE;
+}
+
+template <typename Lyt>
+[[nodiscard]] constexpr lattice_orientation lattice_orientation_of() noexcept
+{
+    if constexpr (is_sidb_lattice_100_v<Lyt>)
+    {
+        return lattice_orientation::SI_100;
+    }
+    else if constexpr (is_sidb_lattice_111_v<Lyt>)
+    {
+        return lattice_orientation::SI_111;
+    }
+    else
+    {
+        return lattice_orientation::NONE;
+    }
+}
+/**
+ * Returns the number of 64-bit words that make up a truth table over the given number of variables.
+ *
+ * @param num_vars Number of variables.
+ * @return Number of 64-bit words.
+ */
+[[nodiscard]] constexpr std::size_t num_truth_table_words(const uint32_t num_vars) noexcept
+{
+    return num_vars <= 6 ? 1u : std::size_t{1} << (num_vars - 6);
+}
+
+}  // namespace fbl
+
+}  // namespace detail
+
+}  // namespace fiction
+
+#endif  // FICTION_FBL_FORMAT_HPP
@@ -0,0 +1,199 @@
+//
+// Created by marcel on 19.10.26.
+//
+
+#ifndef FICTION_FGL_FORMAT_HPP
+#define FICTION_FGL_FORMAT_HPP
+
+#include "utils/version_info.hpp"
+
+#include <fmt/chrono.h>
+#include <fmt/format.h>
+#include <kitty/dynamic_truth_table.hpp>
+#include <kitty/print.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <ctime>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <utility>
+
+namespace fiction
+{
+
+namespace detail
+{
+
+namespace fcn
+{
+
+inline constexpr const char* FGL_HEADER       = "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n";
+inline constexpr const char* OPEN_FGL         = "<fgl>\n";
+inline constexpr const char* CLOSE_FGL        = "</fgl>\n";
+inline constexpr const char* FICTION_METADATA = "  <fiction>\n"
+                                                "    <fiction_version>{}</fiction_version>\n"
+                                                "    <available_at>{}</available_at>\n"
+                                                "    <date>{}</date>\n"
+                                                "  </fiction>\n";
+
+inline constexpr const char* OPEN_LAYOUT_METADATA  = "  <layout>\n";
+inline constexpr const char* CLOSE_LAYOUT_METADATA = "  </layout>\n";
+inline constexpr const char* LAYOUT_METADATA       = "    <name>{}</name>\n"
+                                                     "    <topology>{}</topology>\n"
+                                                     "    <size>\n"
+                                                     "      <x>{}</x>\n"
+                                                     "      <y>{}</y>\n"
+                                                     "      <z>{}</z>\n"
+                                                     "    </size>\n";
+inline constexpr const char* OPEN_CLOCKING         = "    <clocking>\n";
+inline constexpr const char* CLOSE_CLOCKING        = "    </clocking>\n";
+inline constexpr const char* CLOCKING_SCHEME_NAME  = "      <name>{}</name>\n";
+inline constexpr const char* OPEN_CLOCK_ZONES      = "      <zones>\n";
+inline constexpr const char* CLOSE_CLOCK_ZONES     = "      </zones>\n";
+inline constexpr const char* CLOCK_ZONE            = "        <zone>\n"
+                                                     "          <x>{}</x>\n"
+                                                     "          <y>{}</y>\n"
+                                                     "          <clock>{}</clock>\n"
+                                                     "        </zone>\n";
+
+inline constexpr const char* OPEN_GATES     = "  <gates>\n";
+inline constexpr const char* CLOSE_GATES    = "  </gates>\n";
+inline constexpr const char* OPEN_GATE      = "    <gate>\n";
+inline constexpr const char* CLOSE_GATE     = "    </gate>\n";
+inline constexpr const char* GATE           = "      <id>{}</id>\n"
+                                              "      <type>{}</type>\n"
+                                              "      <name>{}</name>\n"
+                                              "      <loc>\n"
+                                              "        <x>{}</x>\n"
+                                              "        <y>{}</y>\n"
+                                              "        <z>{}</z>\n"
+                                              "      </loc>\n";
+inline constexpr const char* OPEN_INCOMING  = "      <incoming>\n";
+inline constexpr const char* CLOSE_INCOMING = "      </incoming>\n";
+inline constexpr const char* SIGNAL         = "        <signal>\n"
+                                              "          <x>{}</x>\n"
+                                              "          <y>{}</y>\n"
+                                              "          <z>{}</z>\n"
+                                              "        </signal>\n";
+
+}  // namespace fcn
+
+/**
+ * Writes the XML declaration, opens the FGL root element, and writes the metadata of the fiction version that created
+ * the file, including the current date.
+ *
+ * @param os Output stream to write into.
+ */
+inline void write_fgl_preamble(std::ostream& os)
+{
+    os << fcn::FGL_HEADER << fcn::OPEN_FGL;
+
+    const auto time_str = fmt::format("{:%Y-%m-%d %H:%M:%S}", fmt::localtime(std::time(nullptr)));
+    os << fmt::format(fcn::FICTION_METADATA, FICTION_VERSION, FICTION_REPO, time_str);
+}
+/**
+ * Determines the FGL type of a gate that computes the given function. Buffers, inverters, the named 2-input gates, and
+ * majority gates are identified by their names. All other functions are stored as their hexadecimal truth tables.
+ *
+ * @param tt Function of the gate.
+ * @return FGL type of the gate.
+ */
+[[nodiscard]] inline std::string fgl_gate_type(const kitty::dynamic_truth_table& tt)
+{
+    static const std::array<std::pair<const char*, const char*>, 10> names{{{"8", "AND"},
+                                                                             {"7", "NAND"},
+                                                                             {"e", "OR"},
+                                                                             {"1", "NOR"},
+                                                                             {"2", "LT"},
+                                                                             {"d", "GE"},
+                                                                             {"b", "LE"},
+                                                                             {"4", "GT"},
+                                                                             {"6", "XOR"},
+                                                                             {"9", "XNOR"}}};
+
+    auto hex = kitty::to_hex(tt);
+
+    if (tt.num_vars() == 1)
+    {
+        if (hex == "2")
+        {
+            return "BUF";
+        }
+        if (hex == "1")
+        {
+            return "INV";
+        }
+    }
+    else if (tt.num_vars() == 2)
+    {
+        if (const auto it =
+                std::find_if(names.cbegin(), names.cend(), [&hex](const auto& p) { return hex == p.first; });
+            it != names.cend())
+        {
+            return it->second;
+        }
+    }
+    else if (tt.num_vars() == 3 && hex == "e8")
+    {
+        return "MAJ";
+    }
+
+    return hex;
+}
+/**
+ * Writes a single gate or wire element, including its incoming signals if there are any.
+ *
+ * @tparam Coordinate Coordinate type.
+ * @tparam Signals Container type of the incoming signals' coordinates.
+ * @param os Output stream to write into.
+ * @param id ID of the element.
+ * @param type FGL type of the element, e.g., as determined by `fgl_gate_type`.
+ * @param name Name of the element, which is empty for all elements except for primary inputs and outputs.
+ * @param t Location of the element.
+ * @param incoming Coordinates of the incoming signals.
+ */
+template <typename Coordinate, typename Signals>
+void write_fgl_element(std::ostream& os, const uint64_t id, const std::string_view type, const std::string_view name,
+                       const Coordinate& t, const Signals& incoming)
+{
+    os << fcn::OPEN_GATE << fmt::format(fcn::GATE, id, type, name, t.x, t.y, t.z);
+
+    if (incoming.size() != 0)
+    {
+        os << fcn::OPEN_INCOMING;
+
+        for (const auto& s : incoming)
+        {
+            os << fmt::format(fcn::SIGNAL, s.x, s.y, s.z);
+        }
+
+        os << fcn::CLOSE_INCOMING;
+    }
+
+    os << fcn::CLOSE_GATE;
+}
+/**
+ * Writes a single gate or wire element without incoming signals, e.g., a primary input.
+ *
+ * @tparam Coordinate Coordinate type.
+ * @param os Output stream to write into.
+ * @param id ID of the element.
+ * @param type FGL type of the element.
+ * @param name Name of the element.
+ * @param t Location of the element.
+ */
+template <typename Coordinate>
+void write_fgl_element(std::ostream& os, const uint64_t id, const std::string_view type, const std::string_view name,
+                       const Coordinate& t)
+{
+    write_fgl_element(os, id, type, name, t, std::array<Coordinate, 0>{});
+}
+
+}  // namespace detail
+
+}  // namespace fiction
+
+#endif  // FICTION_FGL_FORMAT_HPP
@@ -0,0 +1,785 @@
+//
+// Created by marcel on 19.10.26.
+//
+
+#ifndef FICTION_READ_FBL_LAYOUT_HPP
+#define FICTION_READ_FBL_LAYOUT_HPP
+
+#include "fiction/io/fbl_format.hpp"
+#include "fiction/layouts/clocking_scheme.hpp"
+#include "fiction/layouts/coordinates.hpp"
+#include "fiction/traits.hpp"
+#include "fiction/utils/memory_mapped_file.hpp"
+#include "fiction/utils/name_utils.hpp"
+
+#include <fmt/format.h>
+#include <kitty/dynamic_truth_table.hpp>
+#include <mockturtle/traits.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <istream>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+namespace fiction
+{
+
+/**
+ * Information stored in the header of an FBL file. It can be used to determine the layout type that a file has to be
+ * read into before the file is parsed completely.
+ */
+struct fbl_layout_info
+{
+    /**
+     * Version of the FBL format the file was written in.
+     */
+    uint16_t version{};
+    /**
+     * `true` iff the file contains a gate-level layout. Otherwise, it contains a cell-level layout.
+     */
+    bool is_gate_level{};
+    /**
+     * Topology of the layout, i.e., `cartesian` or of the form `<odd|even>_<row|column>_<cartesian|hex>`.
+     */
+    std::string topology{};
+    /**
+     * Technology of a cell-level layout, i.e., `QCA`, `iNML`, or `SiDB`. Empty for gate-level layouts.
+     */
+    std::string technology{};
+    /**
+     * Lattice orientation of an SiDB layout, i.e., `100` or `111`. Empty if the layout has no lattice orientation.
+     */
+    std::string lattice_orientation{};
+    /**
+     * Name of the layout.
+     */
+    std::string name{};
+};
+
+namespace detail
+{
+
+namespace fbl
+{
+
+/**
+ * Sequential little-endian decoder for the contents of an FBL file that checks all accesses against the file size.
+ */
+class byte_reader
+{
+  public:
+    explicit byte_reader(const std::string_view& d) noexcept : data{d} {}
+
+    template <typename T>
+    [[nodiscard]] T get()
+    {
+        return load<T>(get_bytes(sizeof(T)), 0);
+    }
+
+    template <typename E>
+    [[nodiscard]] E get_enum()
+    {
+        return static_cast<E>(get<std::underlying_type_t<E>>());
+    }
+
+    [[nodiscard]] std::string_view get_string()
+    {
+        return get_bytes(get<uint32_t>());
+    }
+    /**
+     * Returns a view of the next `count` elements of `element_size` bytes each.
+     */
+    [[nodiscard]] std::string_view get_array(const uint64_t count, const std::size_t element_size)
+    {
+        if (count > (data.size() - pos) / element_size)
+        {
+            throw fbl_parsing_error("Error parsing FBL file: unexpected end of file");
+        }
+
+        return get_bytes(static_cast<std::size_t>(count) * element_size);
+    }
+    /**
+     * Decodes the `index`-th element of type `T` from an array view obtained via `get_array`.
+     */
+    template <typename T>
+    [[nodiscard]] static T load(const std::string_view& array, const std::size_t index) noexcept
+    {
+        return load_little_endian<T>(array.data() + index * sizeof(T));
+    }
+
+  private:
+    std::string_view data;
+
+    std::size_t pos{0};
+
+    [[nodiscard]] std::string_view get_bytes(const std::size_t n)
+    {
+        if (n > data.size() - pos)
+        {
+            throw fbl_parsing_error("Error parsing FBL file: unexpected end of file");
+        }
+
+        const auto bytes = data.substr(pos, n);
+        pos += n;
+
+        return bytes;
+    }
+};
+/**
+ * Header of an FBL file with its enumerators not yet validated against a layout type.
+ */
+struct header
+{
+    uint16_t            version{};
+    layout_kind         kind{};
+    topology            topo{};
+    technology          tech{};
+    lattice_orientation orientation{};
+    uint16_t            tile_size_x{};
+    uint16_t            tile_size_y{};
+    offset::ucoord_t    aspect_ratio{};
+    std::string_view    name{};
+};
+
+[[nodiscard]] inline header read_header(byte_reader& reader)
+{
+    for (const auto c : MAGIC)
+    {
+        if (reader.get<uint8_t>() != static_cast<uint8_t>(c))
+        {
+            throw fbl_parsing_error("Error parsing FBL file: not an FBL file");
+        }
+    }
+
+    header hdr{};
+
+    hdr.version = reader.get<uint16_t>();
+
+    if (hdr.version == 0 || hdr.version > VERSION)
+    {
+        throw fbl_parsing_error(fmt::format("Error parsing FBL file: unsupported format version {}", hdr.version));
+    }
+
+    hdr.kind        = reader.get_enum<layout_kind>();
+    hdr.topo        = reader.get_enum<topology>();
+    hdr.tech        = reader.get_enum<technology>();
+    hdr.orientation = reader.get_enum<lattice_orientation>();
+
+    if (hdr.kind != layout_kind::GATE_LEVEL && hdr.kind != layout_kind::CELL_LEVEL)
+    {
+        throw fbl_parsing_error("Error parsing FBL file: unknown layout kind");
+    }
+    if (static_cast<std::size_t>(hdr.topo) >= TOPOLOGY_NAMES.size())
+    {
+        throw fbl_parsing_error("Error parsing FBL file: unknown topology");
+    }
+    if (static_cast<std::size_t>(hdr.tech) >= TECHNOLOGY_NAMES.size())
+    {
+        throw fbl_parsing_error("Error parsing FBL file: unknown technology");
+    }
+    if (static_cast<std::size_t>(hdr.orientation) >= LATTICE_ORIENTATION_NAMES.size())
+    {
+        throw fbl_parsing_error("Error parsing FBL file: unknown lattice orientation");
+    }
+
+    hdr.tile_size_x  = reader.get<uint16_t>();
+    hdr.tile_size_y  = reader.get<uint16_t>();
+    hdr.aspect_ratio = offset::ucoord_t{reader.get<uint64_t>()};
+    hdr.name         = reader.get_string();
+
+    if (hdr.tile_size_x == 0 || hdr.tile_size_y == 0)
+    {
+        throw fbl_parsing_error("Error parsing FBL file: clock zone sizes must be positive");
+    }
+    if (hdr.aspect_ratio.is_dead())
+    {
+        throw fbl_parsing_error("Error parsing FBL file: invalid aspect ratio");
+    }
+
+    return hdr;
+}
+
+}  // namespace fbl
+
+[[nodiscard]] inline fbl_layout_info read_fbl_layout_info_impl(const std::string_view& contents)
+{
+    fbl::byte_reader reader{contents};
+
+    const auto hdr = fbl::read_header(reader);
+
+    return {hdr.version,
+            hdr.kind == fbl::layout_kind::GATE_LEVEL,
+            fbl::TOPOLOGY_NAMES[static_cast<std::size_t>(hdr.topo)],
+            fbl::TECHNOLOGY_NAMES[static_cast<std::size_t>(hdr.tech)],
+            fbl::LATTICE_ORIENTATION_NAMES[static_cast<std::size_t>(hdr.orientation)],
+            std::string{hdr.name}};
+}
+
+template <typename Lyt>
+class read_fbl_layout_impl
+{
+  public:
+    read_fbl_layout_impl(const std::string_view& c, const std::string_view& name) : lyt{}, reader{c}
+    {
+        set_name(lyt, name);
+    }
+
+    read_fbl_layout_impl(Lyt& tgt, const std::string_view& c) : lyt{tgt}, reader{c} {}
+
+    Lyt run()
+    {
+        const auto hdr = fbl::read_header(reader);
+
+        check_type(hdr);
+
+        // set layout name; the view into the file is not null-terminated
+        if (!hdr.name.empty())
+        {
+            set_name(lyt, std::string{hdr.name});
+        }
+
+        lyt.resize(aspect_ratio<Lyt>{hdr.aspect_ratio.x, hdr.aspect_ratio.y, hdr.aspect_ratio.z});
+
+        if constexpr (is_cell_level_layout_v<Lyt>)
+        {
+            lyt.set_tile_size_x(hdr.tile_size_x);
+            lyt.set_tile_size_y(hdr.tile_size_y);
+        }
+
+        read_clocking(hdr);
+
+        if constexpr (is_gate_level_layout_v<Lyt>)
+        {
+            read_gates();
+        }
+        else
+        {
+            read_cells();
+        }
+
+        return lyt;
+    }
+
+  private:
+    /**
+     * The layout which will be altered based on the parsed information.
+     */
+    Lyt lyt;
+    /**
+     * Decoder for the contents of the FBL file.
+     */
+    fbl::byte_reader reader;
+
+    void check_type(const fbl::header& hdr) const
+    {
+        if (hdr.kind != (is_gate_level_layout_v<Lyt> ? fbl::layout_kind::GATE_LEVEL : fbl::layout_kind::CELL_LEVEL))
+        {
+            throw fbl_parsing_error(fmt::format("Error parsing FBL file: Lyt is not a {}-level layout",
+                                                hdr.kind == fbl::layout_kind::GATE_LEVEL ? "gate" : "cell"));
+        }
+        if (hdr.topo != fbl::topology_of<Lyt>())
+        {
+            throw fbl_parsing_error(fmt::format("Error parsing FBL file: Lyt is not a {} layout",
+                                                fbl::TOPOLOGY_NAMES[static_cast<std::size_t>(hdr.topo)]));
+        }
+        if (hdr.tech != fbl::technology_of<Lyt>())
+        {
+            throw fbl_parsing_error(fmt::format("Error parsing FBL file: Lyt does not implement the {} technology",
+                                                fbl::TECHNOLOGY_NAMES[static_cast<std::size_t>(hdr.tech)]));
+        }
+        // layouts without a lattice orientation can hold SiDBs of any orientation
+        if (constexpr auto orientation = fbl::lattice_orientation_of<Lyt>();
+            orientation != fbl::lattice_orientation::NONE && hdr.orientation != fbl::lattice_orientation::NONE &&
+            hdr.orientation != orientation)
+        {
+            throw fbl_parsing_error(
+                fmt::format("Error parsing FBL file: Lyt does not have the lattice orientation {}",
+                            fbl::LATTICE_ORIENTATION_NAMES[static_cast<std::size_t>(hdr.orientation)]));
+        }
+    }
+
+    void read_clocking(const fbl::header& hdr)
+    {
+        const auto clocking_scheme_name = std::string{reader.get_string()};
+        const auto num_clocks           = reader.get<uint8_t>();
+
+        // prefer the variant with the stored number of clocks, e.g., OPEN3, over the default one
+        const auto clocking_scheme_with_num_clocks =
+            get_clocking_scheme<Lyt>(fmt::format("{}{}", clocking_scheme_name, num_clocks));
+
+        const auto clocking_scheme =
+            clocking_scheme_with_num_clocks.has_value() &&
+                    clocking_scheme_with_num_clocks->name == clocking_scheme_name ?
+                clocking_scheme_with_num_clocks :
+                get_clocking_scheme<Lyt>(clocking_scheme_name);
+
+        if (!clocking_scheme.has_value())
+        {
+            throw fbl_parsing_error(
+                fmt::format("Error parsing FBL file: unknown clocking scheme: {}", clocking_scheme_name));
+        }
+
+        lyt.replace_clocking_scheme(*clocking_scheme);
+
+        const auto num_zones = reader.get<uint64_t>();
+
+        if (num_zones == 0)
+        {
+            return;
+        }
+
+        const uint64_t max_zone_x = hdr.aspect_ratio.x / hdr.tile_size_x;
+        const uint64_t max_zone_y = hdr.aspect_ratio.y / hdr.tile_size_y;
+
+        if (num_zones != (max_zone_x + 1) * (max_zone_y + 1))
+        {
+            throw fbl_parsing_error("Error parsing FBL file: number of clock zones does not match the layout size");
+        }
+
+        const auto clocks = reader.get_array(num_zones, sizeof(uint8_t));
+
+        std::size_t i = 0;
+
+        for (uint64_t x = 0; x <= max_zone_x; ++x)
+        {
+            for (uint64_t y = 0; y <= max_zone_y; ++y)
+            {
+                lyt.assign_clock_number({x, y}, fbl::byte_reader::load<uint8_t>(clocks, i++));
+            }
+        }
+    }
+
+    [[nodiscard]] static offset::ucoord_t to_coordinate(const uint64_t value)
+    {
+        const offset::ucoord_t c{value};
+
+        if (c.is_dead())
+        {
+            throw fbl_parsing_error("Error parsing FBL file: invalid coordinate");
+        }
+
+        return c;
+    }
+
+    void read_gates()
+    {
+        const auto num_nodes    = reader.get<uint64_t>();
+        const auto tiles        = reader.get_array(num_nodes, sizeof(uint64_t));
+        const auto types        = reader.get_array(num_nodes, sizeof(uint8_t));
+        const auto fanin_counts = reader.get_array(num_nodes, sizeof(uint8_t));
+
+        const auto num_fanins = reader.get<uint64_t>();
+        const auto fanins     = reader.get_array(num_fanins, sizeof(uint64_t));
+
+        const auto num_words         = reader.get<uint64_t>();
+        const auto truth_table_words = reader.get_array(num_words, sizeof(uint64_t));
+
+        std::size_t next_fanin = 0;
+        std::size_t next_word  = 0;
+
+        std::vector<mockturtle::signal<Lyt>> incoming_signals{};
+
+        for (std::size_t i = 0; i < num_nodes; ++i)
+        {
+            const auto location    = to_coordinate(fbl::byte_reader::load<uint64_t>(tiles, i));
+            const auto type        = static_cast<fbl::gate_type>(fbl::byte_reader::load<uint8_t>(types, i));
+            const auto fanin_count = fbl::byte_reader::load<uint8_t>(fanin_counts, i);
+
+            if (fanin_count > num_fanins - next_fanin)
+            {
+                throw fbl_parsing_error("Error parsing FBL file: unexpected end of incoming signals");
+            }
+
+            incoming_signals.clear();
+
+            for (std::size_t f = 0; f < fanin_count; ++f)
+            {
+                const auto incoming_tile = to_coordinate(fbl::byte_reader::load<uint64_t>(fanins, next_fanin++));
+
+                if (lyt.is_empty_tile(incoming_tile))
+                {
+                    throw fbl_parsing_error(fmt::format("Error parsing FBL file: incoming signal of the gate at {} "
+                                                        "originates from empty tile {}",
+                                                        location, incoming_tile));
+                }
+
+                incoming_signals.push_back(lyt.make_signal(lyt.get_node(incoming_tile)));
+            }
+
+            const auto require_fanin = [&fanin_count, &location](const uint8_t expected)
+            {
+                if (fanin_count != expected)
+                {
+                    throw fbl_parsing_error(fmt::format(
+                        "Error parsing FBL file: gate at {} has {} instead of {} input signals", location,
+                        fanin_count, expected));
+                }
+            };
+
+            switch (type)
+            {
+                case fbl::gate_type::PI:
+                {
+                    require_fanin(0);
+
+                    if constexpr (mockturtle::has_create_pi_v<Lyt>)
+                    {
+                        lyt.create_pi(std::string{reader.get_string()}, location);
+                    }
+                    break;
+                }
+                case fbl::gate_type::PO:
+                {
+                    require_fanin(1);
+
+                    if constexpr (mockturtle::has_create_po_v<Lyt>)
+                    {
+                        lyt.create_po(incoming_signals[0], std::string{reader.get_string()}, location);
+                    }
+                    break;
+                }
+                case fbl::gate_type::BUF:
+                {
+                    require_fanin(1);
+
+                    if constexpr (mockturtle::has_create_buf_v<Lyt>)
+                    {
+                        lyt.create_buf(incoming_signals[0], location);
+                    }
+                    break;
+                }
+                case fbl::gate_type::INV:
+                {
+                    require_fanin(1);
+
+                    if constexpr (mockturtle::has_create_not_v<Lyt>)
+                    {
+                        lyt.create_not(incoming_signals[0], location);
+                    }
+                    break;
+                }
+                case fbl::gate_type::AND:
+                {
+                    require_fanin(2);
+
+                    if constexpr (mockturtle::has_create_and_v<Lyt>)
+                    {
+                        lyt.create_and(incoming_signals[0], incoming_signals[1], location);
+                    }
+                    break;
+                }
+                case fbl::gate_type::NAND:
+                {
+                    require_fanin(2);
+
+                    if constexpr (mockturtle::has_create_nand_v<Lyt>)
+                    {
+                        lyt.create_nand(incoming_signals[0], incoming_signals[1], location);
+                    }
+                    break;
+                }
+                case fbl::gate_type::OR:
+                {
+                    require_fanin(2);
+
+                    if constexpr (mockturtle::has_create_or_v<Lyt>)
+                    {
+                        lyt.create_or(incoming_signals[0], incoming_signals[1], location);
+                    }
+                    break;
+                }
+                case fbl::gate_type::NOR:
+                {
+                    require_fanin(2);
+
+                    if constexpr (mockturtle::has_create_nor_v<Lyt>)
+                    {
+                        lyt.create_nor(incoming_signals[0], incoming_signals[1], location);
+                    }
+                    break;
+                }
+                case fbl::gate_type::XOR:
+                {
+                    require_fanin(2);
+
+                    if constexpr (mockturtle::has_create_xor_v<Lyt>)
+                    {
+                        lyt.create_xor(incoming_signals[0], incoming_signals[1], location);
+                    }
+                    break;
+                }
+                case fbl::gate_type::XNOR:
+                {
+                    require_fanin(2);
+
+                    if constexpr (mockturtle::has_create_xnor_v<Lyt>)
+                    {
+                        lyt.create_xnor(incoming_signals[0], incoming_signals[1], location);
+                    }
+                    break;
+                }
+                case fbl::gate_type::LT:
+                {
+                    require_fanin(2);
+
+                    if constexpr (mockturtle::has_create_lt_v<Lyt>)
+                    {
+                        lyt.create_lt(incoming_signals[0], incoming_signals[1], location);
+                    }
+                    break;
+                }
+                case fbl::gate_type::GT:
+                {
+                    require_fanin(2);
+
+                    if constexpr (mockturtle::has_create_gt_v<Lyt>)
+                    {
+                        lyt.create_gt(incoming_signals[0], incoming_signals[1], location);
+                    }
+                    break;
+                }
+                case fbl::gate_type::LE:
+                {
+                    require_fanin(2);
+
+                    if constexpr (mockturtle::has_create_le_v<Lyt>)
+                    {
+                        lyt.create_le(incoming_signals[0], incoming_signals[1], location);
+                    }
+                    break;
+                }
+                case fbl::gate_type::GE:
+                {
+                    require_fanin(2);
+
+                    if constexpr (mockturtle::has_create_ge_v<Lyt>)
+                    {
+                        lyt.create_ge(incoming_signals[0], incoming_signals[1], location);
+                    }
+                    break;
+                }
+                case fbl::gate_type::MAJ:
+                {
+                    require_fanin(3);
+
+                    if constexpr (mockturtle::has_create_maj_v<Lyt>)
+                    {
+                        lyt.create_maj(incoming_signals[0], incoming_signals[1], incoming_signals[2], location);
+                    }
+                    break;
+                }
+                case fbl::gate_type::FUNCTION:
+                {
+                    if (fanin_count == 0)
+                    {
+                        throw fbl_parsing_error(
+                            fmt::format("Error parsing FBL file: gate at {} has no input signals", location));
+                    }
+                    // a truth table cannot have more words than the file has bytes
+                    if (fanin_count >= 64 + 6 || fbl::num_truth_table_words(fanin_count) > num_words - next_word)
+                    {
+                        throw fbl_parsing_error("Error parsing FBL file: unexpected end of truth tables");
+                    }
+
+                    kitty::dynamic_truth_table tt{fanin_count};
+
+                    std::generate(tt.begin(), tt.end(),
+                                  [&truth_table_words, &next_word]
+                                  { return fbl::byte_reader::load<uint64_t>(truth_table_words, next_word++); });
+
+                    if constexpr (mockturtle::has_create_node_v<Lyt>)
+                    {
+                        lyt.create_node(incoming_signals, tt, location);
+                    }
+                    break;
+                }
+                default:
+                {
+                    throw fbl_parsing_error(fmt::format("Error parsing FBL file: unknown gate type {} at {}",
+                                                        static_cast<uint32_t>(type), location));
+                }
+            }
+        }
+    }
+
+    void read_cells()
+    {
+        const auto num_cells = reader.get<uint64_t>();
+        const auto cells     = reader.get_array(num_cells, sizeof(uint64_t));
+        const auto types     = reader.get_array(num_cells, sizeof(uint8_t));
+
+        for (std::size_t i = 0; i < num_cells; ++i)
+        {
+            lyt.assign_cell_type(to_coordinate(fbl::byte_reader::load<uint64_t>(cells, i)),
+                                 static_cast<typename technology<Lyt>::cell_type>(
+                                     fbl::byte_reader::load<uint8_t>(types, i)));
+        }
+
+        if constexpr (has_qca_technology_v<Lyt>)
+        {
+            const auto modes = reader.get_array(num_cells, sizeof(uint8_t));
+
+            for (std::size_t i = 0; i < num_cells; ++i)
+            {
+                lyt.assign_cell_mode(offset::ucoord_t{fbl::byte_reader::load<uint64_t>(cells, i)},
+                                     static_cast<typename technology<Lyt>::cell_mode>(
+                                         fbl::byte_reader::load<uint8_t>(modes, i)));
+            }
+        }
+
+        const auto num_named_cells = reader.get<uint64_t>();
+
+        for (uint64_t i = 0; i < num_named_cells; ++i)
+        {
+            const auto c = to_coordinate(reader.get<uint64_t>());
+
+            lyt.assign_cell_name(c, std::string{reader.get_string()});
+        }
+    }
+};
+
+}  // namespace detail
+
+/**
+ * Reads the header of an FBL file provided as an input stream. The returned information can be used to determine the
+ * layout type the file has to be read into.
+ *
+ * May throw an `fbl_parsing_error` if the header is malformed.
+ *
+ * @param is The input stream to read from.
+ * @return Information stored in the header of the FBL file.
+ */
+[[nodiscard]] inline fbl_layout_info read_fbl_layout_info(std::istream& is)
+{
+    const std::string contents{std::istreambuf_iterator<char>{is}, std::istreambuf_iterator<char>{}};
+
+    return detail::read_fbl_layout_info_impl(contents);
+}
+/**
+ * Reads the header of an FBL file provided as a file name. The returned information can be used to determine the
+ * layout type the file has to be read into.
+ *
+ * May throw an `fbl_parsing_error` if the header is malformed.
+ *
+ * @param filename The file name to open and read from.
+ * @return Information stored in the header of the FBL file.
+ */
+[[nodiscard]] inline fbl_layout_info read_fbl_layout_info(const std::string_view& filename)
+{
+    const memory_mapped_file file{filename};
+
+    return detail::read_fbl_layout_info_impl(file.view());
+}
+/**
+ * Reads a gate-level or cell-level layout from an FBL file provided as an input stream. The file has to contain a
+ * layout of the same kind, topology, and technology as `Lyt`.
+ *
+ * May throw an `fbl_parsing_error` if the FBL file is malformed or does not match `Lyt`.
+ *
+ * @tparam Lyt The layout type to be created from an input.
+ * @param is The input stream to read from. It should have been opened in binary mode.
+ * @param name The name to give to the generated layout.
+ */
+template <typename Lyt>
+[[nodiscard]] Lyt read_fbl_layout(std::istream& is, const std::string_view& name = "")
+{
+    static_assert(is_gate_level_layout_v<Lyt> || is_cell_level_layout_v<Lyt>,
+                  "Lyt is neither a gate-level nor a cell-level layout");
+    static_assert(std::is_same_v<coordinate<Lyt>, offset::ucoord_t>, "Lyt must be based on offset::ucoord_t");
+
+    const std::string contents{std::istreambuf_iterator<char>{is}, std::istreambuf_iterator<char>{}};
+
+    detail::read_fbl_layout_impl<Lyt> p{contents, name};
+
+    const auto lyt = p.run();
+
+    return lyt;
+}
+/**
+ * Reads a gate-level or cell-level layout from an FBL file provided as an input stream. The file has to contain a
+ * layout of the same kind, topology, and technology as `Lyt`.
+ *
+ * May throw an `fbl_parsing_error` if the FBL file is malformed or does not match `Lyt`.
+ *
+ * This is an in-place version of `read_fbl_layout` that utilizes the given layout as a target to write to.
+ *
+ * @tparam Lyt The layout type to be used as input.
+ * @param lyt The layout to write to.
+ * @param is The input stream to read from. It should have been opened in binary mode.
+ */
+template <typename Lyt>
+void read_fbl_layout(Lyt& lyt, std::istream& is)
+{
+    static_assert(is_gate_level_layout_v<Lyt> || is_cell_level_layout_v<Lyt>,
+                  "Lyt is neither a gate-level nor a cell-level layout");
+    static_assert(std::is_same_v<coordinate<Lyt>, offset::ucoord_t>, "Lyt must be based on offset::ucoord_t");
+
+    const std::string contents{std::istreambuf_iterator<char>{is}, std::istreambuf_iterator<char>{}};
+
+    detail::read_fbl_layout_impl<Lyt> p{lyt, contents};
+
+    lyt = p.run();
+}
+/**
+ * Reads a gate-level or cell-level layout from an FBL file provided as a file name. The file is memory-mapped such
+ * that its contents are decoded without being copied into a buffer first. The file has to contain a layout of the same
+ * kind, topology, and technology as `Lyt`.
+ *
+ * May throw an `fbl_parsing_error` if the FBL file is malformed or does not match `Lyt`.
+ *
+ * @tparam Lyt The layout type to be created from an input.
+ * @param filename The file name to open and read from.
+ * @param name The name to give to the generated layout.
+ */
+template <typename Lyt>
+[[nodiscard]] Lyt read_fbl_layout(const std::string_view& filename, const std::string_view& name = "")
+{
+    static_assert(is_gate_level_layout_v<Lyt> || is_cell_level_layout_v<Lyt>,
+                  "Lyt is neither a gate-level nor a cell-level layout");
+    static_assert(std::is_same_v<coordinate<Lyt>, offset::ucoord_t>, "Lyt must be based on offset::ucoord_t");
+
+    const memory_mapped_file file{filename};
+
+    detail::read_fbl_layout_impl<Lyt> p{file.view(), name};
+
+    const auto lyt = p.run();
+
+    return lyt;
+}
+/**
+ * Reads a gate-level or cell-level layout from an FBL file provided as a file name. The file is memory-mapped such
+ * that its contents are decoded without being copied into a buffer first. The file has to contain a layout of the same
+ * kind, topology, and technology as `Lyt`.
+ *
+ * May throw an `fbl_parsing_error` if the FBL file is malformed or does not match `Lyt`.
+ *
+ * This is an in-place version of `read_fbl_layout` that utilizes the given layout as a target to write to.
+ *
+ * @tparam Lyt The layout type to be used as input.
+ * @param lyt The layout to write to.
+ * @param filename The file name to open and read from.
+ */
+template <typename Lyt>
+void read_fbl_layout(Lyt& lyt, const std::string_view& filename)
+{
+    static_assert(is_gate_level_layout_v<Lyt> || is_cell_level_layout_v<Lyt>,
+                  "Lyt is neither a gate-level nor a cell-level layout");
+    static_assert(std::is_same_v<coordinate<Lyt>, offset::ucoord_t>, "Lyt must be based on offset::ucoord_t");
+
+    const memory_mapped_file file{filename};
+
+    detail::read_fbl_layout_impl<Lyt> p{lyt, file.view()};
+
+    lyt = p.run();
+}
+
+}  // namespace fiction
+
+#endif  // FICTION_READ_FBL_LAYOUT_HPP
@@ -8,18 +8,20 @@
 #include "fiction/technology/sidb_defect_surface.hpp"
 #include "fiction/technology/sidb_defects.hpp"
 #include "fiction/traits.hpp"
+#include "fiction/utils/memory_mapped_file.hpp"
 
+#include <algorithm>
 #include <array>
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
 #include <exception>
 #include <fstream>
 #include <istream>
-#include <regex>
-#include <stdexcept>
+#include <iterator>
+#include <limits>
 #include <string>
 #include <string_view>
-#include <vector>
 
 namespace fiction
 {
@@ -63,11 +65,6 @@ namespace detail
 namespace sidb_defects
 {
 
-/* Regex */
-
-static const std::regex RE_DEFECT_MATRIX{R"(\[(?:\s*\d+\s*)+\])"};  // each match is one row
-static const std::regex RE_ROW_INDICES{R"((\d+))"};                 // each match is one index
-
 /**
  * Maps indices in the data format to defect types.
  */
@@ -76,6 +73,26 @@ inline constexpr std::array<sidb_defect_type, 11> INDEX_TO_DEFECT{
      sidb_defect_type::SINGLE_DIHYDRIDE, sidb_defect_type::ONE_BY_ONE, sidb_defect_type::THREE_BY_ONE,
      sidb_defect_type::SILOXANE, sidb_defect_type::RAISED_SI, sidb_defect_type::ETCH_PIT,
      sidb_defect_type::MISSING_DIMER}};
+/**
+ * Checks whether the given character is a decimal digit.
+ *
+ * @param c Character to check.
+ * @return `true` iff `c` is in `[0-9]`.
+ */
+[[nodiscard]] constexpr bool is_digit(const char c) noexcept
+{
+    return static_cast<unsigned char>(c - '0') < 10u;
+}
+/**
+ * Checks whether the given character is a whitespace character, i.e., one of `[ \t\n\v\f\r]`.
+ *
+ * @param c Character to check.
+ * @return `true` iff `c` is a whitespace character.
+ */
+[[nodiscard]] constexpr bool is_space(const char c) noexcept
+{
+    return c == ' ' || static_cast<unsigned char>(c - '\t') < 5u;
+}
 
 }  // namespace sidb_defects
 
@@ -90,61 +107,61 @@ template <typename Lyt>
 class read_sidb_surface_defects_impl
 {
   public:
-    explicit read_sidb_surface_defects_impl(std::istream& s, const std::string_view& name) :
+    read_sidb_surface_defects_impl(const std::string_view& matrix, const std::string_view& name) :
             lyt{sidb_defect_surface{Lyt{{}, name.data()}}},
-            defect_matrix{std::istreambuf_iterator<char>(s), {}}  // read the stream into a string to perform regex
+            defect_matrix{matrix}
     {}
 
     sidb_defect_surface<Lyt> run()
     {
-        // each match is one row
-        const std::vector<std::smatch> matrix_matches{
-            std::sregex_iterator(std::cbegin(defect_matrix), std::cend(defect_matrix), sidb_defects::RE_DEFECT_MATRIX),
-            std::sregex_iterator()};
+        reserve_defects();
 
-        // iterate over the row matches
-        for (auto y = 0u; y < matrix_matches.size(); ++y)
-        {
-            // get the match as a string
-            const auto row_str = matrix_matches[y].str();
+        const auto* const end = defect_matrix.data() + defect_matrix.size();
+
+        uint32_t y = 0;
 
-            // each match is a defect index
-            const std::vector<std::smatch> row_matches{
-                std::sregex_iterator(std::cbegin(row_str), std::cend(row_str), sidb_defects::RE_ROW_INDICES),
-                std::sregex_iterator()};
+        // each row is a bracketed list of whitespace-separated defect indices
+        for (const auto* pos = defect_matrix.data(); pos != end;)
+        {
+            pos = static_cast<const char*>(std::memchr(pos, '[', static_cast<std::size_t>(end - pos)));
 
-            // track x-dimension of the surface
-            if (row_matches.size() - 1 > static_cast<std::size_t>(max_cell_pos.x))
+            if (pos == nullptr)
             {
-                max_cell_pos.x = static_cast<decltype(max_cell_pos.x)>(row_matches.size() - 1);
+                break;
             }
-            else if (static_cast<decltype(max_cell_pos.x)>(row_matches.size() - 1) < max_cell_pos.x)
+
+            ++pos;
+
+            const auto* const row_begin = pos;
+
+            uint64_t num_entries = 0;
+            bool     in_number   = false;
+
+            // count the entries of the row, which may only consist of whitespace-separated digits
+            while (pos != end && (sidb_defects::is_digit(*pos) || sidb_defects::is_space(*pos)))
             {
-                // row y has fewer SiDBs than previous rows
-                throw missing_sidb_position_exception(y);
+                const auto digit = sidb_defects::is_digit(*pos);
+
+                num_entries += static_cast<uint64_t>(digit && !in_number);
+                in_number = digit;
+
+                ++pos;
             }
 
-            // iterate over the index matches
-            for (auto x = 0u; x < row_matches.size(); ++x)
+            // rows must not be empty or contain any other characters; otherwise, they are ignored
+            if (pos == end || *pos != ']' || num_entries == 0)
             {
-                const auto defect_index = std::stoi(row_matches[x].str());
-
-                try
-                {
-                    // assign the defect
-                    lyt.assign_sidb_defect(
-                        {x, y}, sidb_defect{sidb_defects::INDEX_TO_DEFECT.at(static_cast<std::size_t>(defect_index))});
-                }
-                catch (const std::out_of_range&)
-                {
-                    // defect index does not match any supported defects
-                    throw unsupported_defect_index_exception(defect_index);
-                }
+                continue;
             }
+
+            parse_row(row_begin, pos, num_entries, y);
+
+            ++pos;
+            ++y;
         }
 
         // y-dimension of the surface
-        max_cell_pos.y = static_cast<decltype(max_cell_pos.y)>(matrix_matches.empty() ? 0 : matrix_matches.size() - 1);
+        max_cell_pos.y = static_cast<decltype(max_cell_pos.y)>(y == 0 ? 0 : y - 1);
 
         // resize the layout to fit all surface defects
         lyt.resize(max_cell_pos);
@@ -155,9 +172,77 @@ class read_sidb_surface_defects_impl
   private:
     sidb_defect_surface<Lyt> lyt;
 
-    const std::string defect_matrix;
+    const std::string_view defect_matrix;
 
     cell<Lyt> max_cell_pos{};
+    /**
+     * Reserves storage for the defects on the surface. Since every index of a defect other than `NONE` contains at
+     * least one non-zero digit, the number of non-zero digits is an upper bound for the number of defects. Counting
+     * them is a single branch-free pass over the data that compilers vectorize.
+     */
+    void reserve_defects()
+    {
+        if constexpr (has_reserve_sidb_defects_v<sidb_defect_surface<Lyt>>)
+        {
+            const auto num_non_zero_digits =
+                std::count_if(defect_matrix.cbegin(), defect_matrix.cend(),
+                              [](const char c) { return static_cast<unsigned char>(c - '1') < 9u; });
+
+            lyt.reserve_sidb_defects(static_cast<std::size_t>(num_non_zero_digits));
+        }
+    }
+    /**
+     * Assigns the defects of a single row. Entries of index 0, i.e., `NONE`, are skipped without touching the surface.
+     *
+     * @param begin Start of the row contents after the opening bracket.
+     * @param end End of the row contents at the closing bracket.
+     * @param num_entries Number of entries in the row.
+     * @param y Index of the row.
+     */
+    void parse_row(const char* begin, const char* const end, const uint64_t num_entries, const uint32_t y)
+    {
+        // track x-dimension of the surface
+        if (num_entries - 1 > static_cast<uint64_t>(max_cell_pos.x))
+        {
+            max_cell_pos.x = static_cast<decltype(max_cell_pos.x)>(num_entries - 1);
+        }
+        else if (num_entries - 1 < static_cast<uint64_t>(max_cell_pos.x))
+        {
+            // row y has fewer SiDBs than previous rows
+            throw missing_sidb_position_exception(y);
+        }
+
+        for (uint32_t x = 0; begin != end; ++x)
+        {
+            begin = std::find_if(begin, end, sidb_defects::is_digit);
+
+            if (begin == end)
+            {
+                break;
+            }
+
+            // indices larger than the number of defect types are only accumulated up to a saturation bound
+            uint64_t defect_index = 0;
+
+            for (; begin != end && sidb_defects::is_digit(*begin); ++begin)
+            {
+                defect_index = std::min(defect_index * 10 + static_cast<uint64_t>(*begin - '0'),
+                                        static_cast<uint64_t>(std::numeric_limits<int>::max()));
+            }
+
+            if (defect_index >= sidb_defects::INDEX_TO_DEFECT.size())
+            {
+                // defect index does not match any supported defects
+                throw unsupported_defect_index_exception(static_cast<int>(defect_index));
+            }
+
+            if (defect_index != 0)
+            {
+                // assign the defect
+                lyt.assign_sidb_defect({x, y}, sidb_defect{sidb_defects::INDEX_TO_DEFECT[defect_index]});
+            }
+        }
+    }
 };
 
 #pragma GCC diagnostic pop
@@ -183,7 +268,10 @@ sidb_defect_surface<Lyt> read_sidb_surface_defects(std::istream& is, const std::
     static_assert(is_cell_level_layout_v<Lyt>, "Lyt is not a cell-level layout");
     static_assert(has_sidb_technology_v<Lyt>, "Lyt must be an SiDB layout");
 
-    detail::read_sidb_surface_defects_impl<Lyt> p{is, name};
+    // read the stream into a string to parse it in one go
+    const std::string defect_matrix{std::istreambuf_iterator<char>(is), {}};
+
+    detail::read_sidb_surface_defects_impl<Lyt> p{defect_matrix, name};
 
     const auto lyt = p.run();
 
@@ -198,6 +286,9 @@ sidb_defect_surface<Lyt> read_sidb_surface_defects(std::istream& is, const std::
  * @note For testing purposes, a Python script that generates defective surfaces is provided in the
  * `experiments/defect_aware_physical_design` directory.
  *
+ * The file is memory-mapped and parsed in place such that even full-wafer scans of tens of millions of entries are not
+ * copied into memory before parsing.
+ *
  * @tparam Lyt The layout type underlying the SiDB surface. Must be a cell-level SiDB layout.
  * @param filename The file name to open and read from.
  * @param name The name to give to the generated layout.
@@ -205,15 +296,14 @@ sidb_defect_surface<Lyt> read_sidb_surface_defects(std::istream& is, const std::
 template <typename Lyt>
 sidb_defect_surface<Lyt> read_sidb_surface_defects(const std::string_view& filename, const std::string_view& name = "")
 {
-    std::ifstream is{filename.data(), std::ifstream::in};
+    static_assert(is_cell_level_layout_v<Lyt>, "Lyt is not a cell-level layout");
+    static_assert(has_sidb_technology_v<Lyt>, "Lyt must be an SiDB layout");
 
-    if (!is.is_open())
-    {
-        throw std::ifstream::failure("could not open file");
-    }
+    const memory_mapped_file file{filename};
+
+    detail::read_sidb_surface_defects_impl<Lyt> p{file.view(), name};
 
-    const auto lyt = read_sidb_surface_defects<Lyt>(is, name);
-    is.close();
+    const auto lyt = p.run();
 
     return lyt;
 }
@@ -11,19 +11,23 @@
 #include "fiction/traits.hpp"
 #include "fiction/utils/name_utils.hpp"
 
-#include <tinyxml2.h>
+#include <fmt/format.h>
 
 #include <algorithm>
 #include <cctype>
+#include <charconv>
+#include <cstddef>
 #include <cstdint>
-#include <exception>
 #include <fstream>
 #include <istream>
-#include <sstream>
+#include <optional>
 #include <stdexcept>
+#include <streambuf>
 #include <string>
 #include <string_view>
+#include <system_error>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 namespace fiction
@@ -41,128 +45,1015 @@ class sqd_parsing_error : public std::runtime_error
 namespace detail
 {
 
+/**
+ * A minimal XML pull parser that reads its input incrementally from a stream buffer. In contrast to a DOM parser, it
+ * only ever holds the currently parsed tag in memory such that documents with millions of elements can be processed
+ * with constant memory overhead.
+ *
+ * It supports the subset of XML that is used by SiQAD, i.e., elements, attributes, text, entity and character
+ * references, and CDATA sections. Comments, processing instructions, and document type declarations are skipped.
+ */
+class sqd_xml_pull_parser
+{
+  public:
+    /**
+     * Events reported by the parser.
+     */
+    enum class event : uint8_t
+    {
+        /**
+         * An opening tag or a self-closing tag was read.
+         */
+        START_ELEMENT,
+        /**
+         * A closing tag was read or a self-closing tag was completed.
+         */
+        END_ELEMENT,
+        /**
+         * Text content that does not consist of whitespace only was read.
+         */
+        TEXT,
+        /**
+         * The end of the document was reached.
+         */
+        END_OF_DOCUMENT
+    };
+    /**
+     * Standard constructor.
+     *
+     * @param is The input stream to read from.
+     */
+    explicit sqd_xml_pull_parser(std::istream& is) : sb{is.rdbuf()} {}
+    /**
+     * Advances to the next event in the document.
+     *
+     * @return The next event.
+     * @throws sqd_parsing_error if the document is not well-formed.
+     */
+    event next()
+    {
+        if (pending_end_element)
+        {
+            pending_end_element = false;
+            --depth;
+
+            return event::END_ELEMENT;
+        }
+
+        while (true)
+        {
+            auto c = peek();
+
+            if (is_eof(c))
+            {
+                if (depth > 0)
+                {
+                    throw sqd_parsing_error("Error parsing SQD file: unexpected end of file");
+                }
+
+                return event::END_OF_DOCUMENT;
+            }
+
+            if (c != '<')
+            {
+                // text outside the root element is ignored
+                if (read_text() && depth > 0)
+                {
+                    return event::TEXT;
+                }
+
+                continue;
+            }
+
+            get();
+
+            c = peek();
+
+            if (c == '?')
+            {
+                skip_until("?>");
+            }
+            else if (c == '!')
+            {
+                get();
+
+                if (consume("--"))
+                {
+                    skip_until("-->");
+                }
+                else if (consume("[CDATA["))
+                {
+                    read_cdata();
+
+                    if (depth > 0)
+                    {
+                        return event::TEXT;
+                    }
+                }
+                else
+                {
+                    skip_declaration();
+                }
+            }
+            else if (c == '/')
+            {
+                get();
+
+                read_end_tag();
+
+                return event::END_ELEMENT;
+            }
+            else
+            {
+                read_start_tag();
+
+                return event::START_ELEMENT;
+            }
+        }
+    }
+    /**
+     * Returns the name of the element of the last `START_ELEMENT` or `END_ELEMENT` event.
+     *
+     * @return Element name.
+     */
+    [[nodiscard]] const std::string& name() const noexcept
+    {
+        return element_name;
+    }
+    /**
+     * Returns the value of the given attribute of the element of the last `START_ELEMENT` event. The returned pointer
+     * is invalidated by the next call to `next`.
+     *
+     * @param key Attribute name.
+     * @return Pointer to the attribute value or `nullptr` if the element does not have the attribute.
+     */
+    [[nodiscard]] const std::string* attribute(const std::string_view& key) const noexcept
+    {
+        for (std::size_t i = 0; i < num_attributes; ++i)
+        {
+            if (attributes[i].first == key)
+            {
+                return &attributes[i].second;
+            }
+        }
+
+        return nullptr;
+    }
+    /**
+     * Returns the text of the last `TEXT` event with all entity and character references resolved.
+     *
+     * @return Text content.
+     */
+    [[nodiscard]] const std::string& text() const noexcept
+    {
+        return text_content;
+    }
+
+  private:
+    /**
+     * The stream buffer to read from.
+     */
+    std::streambuf* sb;
+    /**
+     * Names of all currently open elements. Entries beyond `depth` are kept to reuse their storage.
+     */
+    std::vector<std::string> open_elements{};
+    /**
+     * Number of currently open elements.
+     */
+    std::size_t depth{0};
+    /**
+     * Name of the current element.
+     */
+    std::string element_name{};
+    /**
+     * Attributes of the current element. Entries beyond `num_attributes` are kept to reuse their storage.
+     */
+    std::vector<std::pair<std::string, std::string>> attributes{};
+    /**
+     * Number of attributes of the current element.
+     */
+    std::size_t num_attributes{0};
+    /**
+     * Current text content.
+     */
+    std::string text_content{};
+    /**
+     * Flag to indicate that the last start tag was self-closing such that its end event is still to be reported.
+     */
+    bool pending_end_element{false};
+
+    using traits = std::char_traits<char>;
+
+    [[nodiscard]] static bool is_eof(const traits::int_type c) noexcept
+    {
+        return traits::eq_int_type(c, traits::eof());
+    }
+
+    [[nodiscard]] static bool is_space(const traits::int_type c) noexcept
+    {
+        return c == ' ' || c == '\n' || c == '\r' || c == '\t';
+    }
+
+    [[nodiscard]] traits::int_type peek() const
+    {
+        return sb == nullptr ? traits::eof() : sb->sgetc();
+    }
+
+    traits::int_type get()
+    {
+        return sb == nullptr ? traits::eof() : sb->sbumpc();
+    }
+    /**
+     * Reads the next character and throws if the end of the file was reached.
+     */
+    char get_char()
+    {
+        const auto c = get();
+
+        if (is_eof(c))
+        {
+            throw sqd_parsing_error("Error parsing SQD file: unexpected end of file");
+        }
+
+        return traits::to_char_type(c);
+    }
+
+    void skip_whitespace()
+    {
+        while (is_space(peek()))
+        {
+            get();
+        }
+    }
+    /**
+     * Consumes the given string if the input continues with it. Characters are only consumed if they match.
+     *
+     * @param str String to consume.
+     * @return `true` iff the entire string was consumed.
+     */
+    bool consume(const std::string_view& str)
+    {
+        for (const auto c : str)
+        {
+            if (peek() != c)
+            {
+                return false;
+            }
+
+            get();
+        }
+
+        return true;
+    }
+    /**
+     * Skips all characters up to and including the given terminator.
+     *
+     * @param terminator Terminating character sequence.
+     */
+    void skip_until(const std::string_view& terminator)
+    {
+        std::string window{};
+
+        while (window.size() < terminator.size() ||
+               std::string_view{window}.substr(window.size() - terminator.size()) != terminator)
+        {
+            window.push_back(get_char());
+
+            if (window.size() > terminator.size())
+            {
+                window.erase(window.begin());
+            }
+        }
+    }
+    /**
+     * Skips a document type declaration including a potential internal subset.
+     */
+    void skip_declaration()
+    {
+        std::size_t brackets = 0;
+
+        for (auto c = get_char(); c != '>' || brackets > 0; c = get_char())
+        {
+            if (c == '[')
+            {
+                ++brackets;
+            }
+            else if (c == ']' && brackets > 0)
+            {
+                --brackets;
+            }
+        }
+    }
+    /**
+     * Reads an element or attribute name.
+     *
+     * @param name String to store the name in.
+     */
+    void read_name(std::string& name)
+    {
+        name.clear();
+
+        for (auto c = peek(); !is_eof(c) && !is_space(c) && c != '/' && c != '>' && c != '=' && c != '<'; c = peek())
+        {
+            name.push_back(traits::to_char_type(get()));
+        }
+
+        if (name.empty())
+        {
+            throw sqd_parsing_error("Error parsing SQD file: expected a name");
+        }
+    }
+    /**
+     * Resolves an entity or character reference whose leading '&' was already consumed and appends the result to the
+     * given string. Unknown references are kept verbatim.
+     *
+     * @param str String to append to.
+     */
+    void read_reference(std::string& str)
+    {
+        // the longest reference that has to be resolved is a hexadecimal character reference of a 32-bit code point
+        static constexpr std::size_t max_reference_length = 10;
+
+        std::string reference{};
+
+        while (reference.size() < max_reference_length && !is_eof(peek()) && peek() != ';' && peek() != '<' &&
+               !is_space(peek()))
+        {
+            reference.push_back(traits::to_char_type(get()));
+        }
+
+        if (peek() != ';')
+        {
+            str.push_back('&');
+            str.append(reference);
+
+            return;
+        }
+
+        get();
+
+        if (reference == "lt")
+        {
+            str.push_back('<');
+        }
+        else if (reference == "gt")
+        {
+            str.push_back('>');
+        }
+        else if (reference == "amp")
+        {
+            str.push_back('&');
+        }
+        else if (reference == "quot")
+        {
+            str.push_back('"');
+        }
+        else if (reference == "apos")
+        {
+            str.push_back('\'');
+        }
+        else if (reference.size() > 1 && reference.front() == '#')
+        {
+            const auto hex = reference[1] == 'x' || reference[1] == 'X';
+
+            uint32_t code_point = 0;
+
+            const auto* const first = reference.data() + (hex ? 2 : 1);
+            const auto* const last  = reference.data() + reference.size();
+
+            if (const auto [ptr, ec] = std::from_chars(first, last, code_point, hex ? 16 : 10);
+                ec != std::errc{} || ptr != last || first == last)
+            {
+                throw sqd_parsing_error(fmt::format("Error parsing SQD file: invalid character reference '&{};'",
+                                                    reference));
+            }
+
+            append_utf8(str, code_point);
+        }
+        else
+        {
+            str.push_back('&');
+            str.append(reference);
+            str.push_back(';');
+        }
+    }
+    /**
+     * Appends the UTF-8 encoding of the given code point to the given string.
+     *
+     * @param str String to append to.
+     * @param code_point Unicode code point.
+     */
+    static void append_utf8(std::string& str, const uint32_t code_point)
+    {
+        if (code_point < 0x80u)
+        {
+            str.push_back(static_cast<char>(code_point));
+        }
+        else if (code_point < 0x800u)
+        {
+            str.push_back(static_cast<char>(0xC0u | (code_point >> 6u)));
+            str.push_back(static_cast<char>(0x80u | (code_point & 0x3Fu)));
+        }
+        else if (code_point < 0x10000u)
+        {
+            str.push_back(static_cast<char>(0xE0u | (code_point >> 12u)));
+            str.push_back(static_cast<char>(0x80u | ((code_point >> 6u) & 0x3Fu)));
+            str.push_back(static_cast<char>(0x80u | (code_point & 0x3Fu)));
+        }
+        else if (code_point < 0x110000u)
+        {
+            str.push_back(static_cast<char>(0xF0u | (code_point >> 18u)));
+            str.push_back(static_cast<char>(0x80u | ((code_point >> 12u) & 0x3Fu)));
+            str.push_back(static_cast<char>(0x80u | ((code_point >> 6u) & 0x3Fu)));
+            str.push_back(static_cast<char>(0x80u | (code_point & 0x3Fu)));
+        }
+        else
+        {
+            throw sqd_parsing_error("Error parsing SQD file: invalid character reference");
+        }
+    }
+    /**
+     * Reads text up to the next tag.
+     *
+     * @return `true` iff the text contains at least one non-whitespace character.
+     */
+    bool read_text()
+    {
+        text_content.clear();
+
+        auto non_whitespace = false;
+
+        for (auto c = peek(); !is_eof(c) && c != '<'; c = peek())
+        {
+            get();
+
+            if (c == '&')
+            {
+                read_reference(text_content);
+                non_whitespace = true;
+            }
+            else
+            {
+                text_content.push_back(traits::to_char_type(c));
+                non_whitespace = non_whitespace || !is_space(c);
+            }
+        }
+
+        return non_whitespace;
+    }
+    /**
+     * Reads the contents of a CDATA section whose opening sequence was already consumed.
+     */
+    void read_cdata()
+    {
+        static constexpr std::string_view terminator{"]]>"};
+
+        text_content.clear();
+
+        while (text_content.size() < terminator.size() ||
+               std::string_view{text_content}.substr(text_content.size() - terminator.size()) != terminator)
+        {
+            text_content.push_back(get_char());
+        }
+
+        text_content.resize(text_content.size() - terminator.size());
+    }
+    /**
+     * Reads a start tag whose leading '<' was already consumed.
+     */
+    void read_start_tag()
+    {
+        read_name(element_name);
+
+        num_attributes = 0;
+
+        while (true)
+        {
+            skip_whitespace();
+
+            const auto c = peek();
+
+            if (c == '>')
+            {
+                get();
+                break;
+            }
+            if (c == '/')
+            {
+                get();
+
+                if (get_char() != '>')
+                {
+                    throw sqd_parsing_error("Error parsing SQD file: malformed self-closing tag");
+                }
+
+                pending_end_element = true;
+                break;
+            }
+
+            read_attribute();
+        }
+
+        if (open_elements.size() <= depth)
+        {
+            open_elements.emplace_back();
+        }
+
+        open_elements[depth].assign(element_name);
+        ++depth;
+    }
+    /**
+     * Reads an attribute of the current start tag.
+     */
+    void read_attribute()
+    {
+        if (attributes.size() <= num_attributes)
+        {
+            attributes.emplace_back();
+        }
+
+        auto& [key, value] = attributes[num_attributes];
+
+        read_name(key);
+        skip_whitespace();
+
+        if (get_char() != '=')
+        {
+            throw sqd_parsing_error(fmt::format("Error parsing SQD file: attribute '{}' has no value", key));
+        }
+
+        skip_whitespace();
+
+        const auto quote = get_char();
+
+        if (quote != '"' && quote != '\'')
+        {
+            throw sqd_parsing_error(fmt::format("Error parsing SQD file: value of attribute '{}' is not quoted", key));
+        }
+
+        value.clear();
+
+        for (auto c = get_char(); c != quote; c = get_char())
+        {
+            if (c == '&')
+            {
+                read_reference(value);
+            }
+            else
+            {
+                value.push_back(c);
+            }
+        }
+
+        ++num_attributes;
+    }
+    /**
+     * Reads an end tag whose leading "</" was already consumed.
+     */
+    void read_end_tag()
+    {
+        read_name(element_name);
+        skip_whitespace();
+
+        if (get_char() != '>')
+        {
+            throw sqd_parsing_error("Error parsing SQD file: malformed closing tag");
+        }
+
+        if (depth == 0 || open_elements[depth - 1] != element_name)
+        {
+            throw sqd_parsing_error(fmt::format("Error parsing SQD file: mismatched closing tag '{}'", element_name));
+        }
+
+        --depth;
+    }
+};
+
 template <typename Lyt>
 class read_sqd_layout_impl
 {
   public:
-    read_sqd_layout_impl(std::istream& s, const std::string_view& name) : lyt{}, is{s}
+    read_sqd_layout_impl(std::istream& s, const std::string_view& name) : lyt{}, is{s}, xml{s}
+    {
+        set_name(lyt, name);
+    }
+
+    read_sqd_layout_impl(Lyt& tgt, std::istream& s) : lyt{tgt}, is{s}, xml{s} {}
+
+    Lyt run()
+    {
+        reserve_storage();
+
+        auto root_found = false;
+
+        // only top-level elements are encountered here as their children are consumed by the respective functions
+        for (auto ev = xml.next(); ev != sqd_xml_pull_parser::event::END_OF_DOCUMENT; ev = xml.next())
+        {
+            if (ev != sqd_xml_pull_parser::event::START_ELEMENT)
+            {
+                continue;
+            }
+
+            if (!root_found && xml.name() == "siqad")
+            {
+                root_found = true;
+                parse_siqad();
+            }
+            else
+            {
+                skip_element();
+            }
+        }
+
+        if (!root_found)
+        {
+            throw sqd_parsing_error("Error parsing SQD file: no root element 'siqad'");
+        }
+
+        // resize the layout to fit all cells
+        lyt.resize(max_cell_pos);
+
+        return lyt;
+    }
+
+  private:
+    /**
+     * The layout to which the parsed cells are added.
+     */
+    Lyt lyt;
+    /**
+     * The input stream from which the SQD file is read.
+     */
+    std::istream& is;
+    /**
+     * The parser that reads the SQD file element by element.
+     */
+    sqd_xml_pull_parser xml;
+    /**
+     * The maximum position of a cell in the layout.
+     */
+    cell<Lyt> max_cell_pos{};
+    /**
+     * Text content of the element that was read last by `read_text`.
+     */
+    std::string element_text{};
+    /**
+     * Cells covered by the defect that is currently being parsed.
+     */
+    std::vector<cell<Lyt>> incl_cells{};
+
+    /**
+     * Reserves storage in the layout for all <dbdot> and <defect> elements in the input such that the layout's hash
+     * maps do not have to rehash while the file is parsed. To this end, the elements are counted in a fast pass over
+     * the raw input before the stream is rewound. Streams that cannot be rewound, e.g., pipes, are parsed without
+     * reserving storage.
+     */
+    void reserve_storage()
     {
-        set_name(lyt, name);
-    }
+        if constexpr (has_reserve_cells_v<Lyt> || has_reserve_sidb_defects_v<Lyt>)
+        {
+            const auto start = is.tellg();
+
+            if (start == std::istream::pos_type(-1) || is.rdbuf() == nullptr)
+            {
+                return;
+            }
 
-    read_sqd_layout_impl(Lyt& tgt, std::istream& s) : lyt{tgt}, is{s} {}
+            static constexpr std::string_view dbdot_tag{"<dbdot"};
+            static constexpr std::string_view defect_tag{"<defect"};
 
-    Lyt run()
-    {
-        // tinyXML2 does not support std::istream, so we have to read the whole file into a string first
-        std::stringstream buffer{};
-        buffer << is.rdbuf();
-        const std::string sqd_content{buffer.str()};
+            std::size_t num_dbdots  = 0;
+            std::size_t num_defects = 0;
+
+            // chunk of the input that is prefixed by a potentially incomplete tag carried over from the previous one
+            std::string window(defect_tag.size() + (std::size_t{1} << 16u), '\0');
+
+            std::size_t carried = 0;
+
+            for (auto num_read = is.rdbuf()->sgetn(window.data(), static_cast<std::streamsize>(window.size()));
+                 num_read > 0; num_read = is.rdbuf()->sgetn(window.data() + carried,
+                                                            static_cast<std::streamsize>(window.size() - carried)))
+            {
+                const std::string_view chunk{window.data(), carried + static_cast<std::size_t>(num_read)};
+
+                carried = 0;
+
+                for (auto pos = chunk.find('<'); pos != std::string_view::npos; pos = chunk.find('<', pos + 1))
+                {
+                    const auto tag = chunk.substr(pos, defect_tag.size());
+
+                    // a tag might continue in the next chunk; since tags cannot contain '<', this is the last one
+                    if (tag.size() < defect_tag.size())
+                    {
+                        carried = tag.size();
+                        std::copy(tag.cbegin(), tag.cend(), window.begin());
+
+                        break;
+                    }
+
+                    if (tag == defect_tag)
+                    {
+                        ++num_defects;
+                    }
+                    else if (tag.substr(0, dbdot_tag.size()) == dbdot_tag)
+                    {
+                        ++num_dbdots;
+                    }
+                }
+            }
 
-        tinyxml2::XMLDocument xml_document{};
-        xml_document.Parse(sqd_content.c_str());
+            is.clear();
+            is.seekg(start);
 
-        if (xml_document.ErrorID() != 0)
+            if constexpr (has_reserve_cells_v<Lyt>)
+            {
+                lyt.reserve_cells(num_dbdots);
+            }
+            if constexpr (has_reserve_sidb_defects_v<Lyt> && has_assign_sidb_defect_v<Lyt>)
+            {
+                lyt.reserve_sidb_defects(num_defects);
+            }
+        }
+    }
+    /**
+     * Advances to the next child element of the current element.
+     *
+     * @return `true` if a child element was found and `false` if the current element was closed instead.
+     */
+    bool next_child()
+    {
+        while (true)
         {
-            throw sqd_parsing_error("Error parsing SQD file: " + std::string(xml_document.ErrorName()));
+            switch (xml.next())
+            {
+                case sqd_xml_pull_parser::event::START_ELEMENT:
+                {
+                    return true;
+                }
+                case sqd_xml_pull_parser::event::TEXT:
+                {
+                    break;
+                }
+                default:
+                {
+                    return false;
+                }
+            }
         }
+    }
+    /**
+     * Skips the remainder of the current element including all of its children.
+     */
+    void skip_element()
+    {
+        for (std::size_t open = 1; open > 0;)
+        {
+            switch (xml.next())
+            {
+                case sqd_xml_pull_parser::event::START_ELEMENT:
+                {
+                    ++open;
+                    break;
+                }
+                case sqd_xml_pull_parser::event::END_ELEMENT:
+                {
+                    --open;
+                    break;
+                }
+                case sqd_xml_pull_parser::event::TEXT:
+                {
+                    break;
+                }
+                // LCOV_EXCL_START
+                case sqd_xml_pull_parser::event::END_OF_DOCUMENT:
+                {
+                    // the parser throws on unclosed elements; this case exists to comfort the compilers
+                    return;
+                }
+                    // LCOV_EXCL_STOP
+            }
+        }
+    }
+    /**
+     * Reads the text content of the current element up to its closing tag. Child elements are skipped.
+     *
+     * @return The text content of the current element. Empty if it does not contain any non-whitespace text.
+     */
+    const std::string& read_text()
+    {
+        element_text.clear();
 
-        auto* const siqad_root = xml_document.FirstChildElement("siqad");
-
-        if (siqad_root == nullptr)
+        while (true)
         {
-            throw sqd_parsing_error("Error parsing SQD file: no root element 'siqad'");
+            switch (xml.next())
+            {
+                case sqd_xml_pull_parser::event::START_ELEMENT:
+                {
+                    skip_element();
+                    break;
+                }
+                case sqd_xml_pull_parser::event::TEXT:
+                {
+                    element_text.append(xml.text());
+                    break;
+                }
+                default:
+                {
+                    return element_text;
+                }
+            }
         }
+    }
+    /**
+     * Parses the <siqad> root element.
+     */
+    void parse_siqad()
+    {
+        auto layers_found = false;
+        auto design_found = false;
 
-        const auto* const layers_element = siqad_root->FirstChildElement("layers");
+        while (next_child())
+        {
+            if (!layers_found && xml.name() == "layers")
+            {
+                layers_found = true;
+                parse_layers();
+            }
+            else if (!design_found && xml.name() == "design")
+            {
+                design_found = true;
+                parse_design();
+            }
+            else
+            {
+                skip_element();
+            }
+        }
 
-        if (layers_element == nullptr)
+        if (!layers_found)
         {
             throw sqd_parsing_error("Error parsing SQD file: no element 'layers'");
         }
+        if (!design_found)
+        {
+            throw sqd_parsing_error("Error parsing SQD file: no element 'design'");
+        }
+    }
+    /**
+     * Parses the <layers> element and checks the lattice orientation specified in its first <layer_prop> element.
+     */
+    void parse_layers()
+    {
+        auto layer_prop_found = false;
 
-        const auto* const layer_prop_element = layers_element->FirstChildElement("layer_prop");
+        while (next_child())
+        {
+            if (!layer_prop_found && xml.name() == "layer_prop")
+            {
+                layer_prop_found = true;
+                parse_layer_prop();
+            }
+            else
+            {
+                skip_element();
+            }
+        }
 
-        if (layer_prop_element == nullptr)
+        if (!layer_prop_found)
         {
             throw sqd_parsing_error("Error parsing SQD file: no element 'layer_prop'");
         }
+    }
+    /**
+     * Parses a <layer_prop> element and checks the lattice orientation specified in its <lat_vec> element.
+     */
+    void parse_layer_prop()
+    {
+        auto lat_vec_found = false;
 
-        const auto* const lat_vec_element = layer_prop_element->FirstChildElement("lat_vec");
+        while (next_child())
+        {
+            if (!lat_vec_found && xml.name() == "lat_vec")
+            {
+                lat_vec_found = true;
+                parse_lat_vec();
+            }
+            else
+            {
+                skip_element();
+            }
+        }
 
-        if (lat_vec_element == nullptr)
+        if (!lat_vec_found)
         {
             throw sqd_parsing_error("Error parsing SQD file: no element 'lat_vec'");
         }
-
+    }
+    /**
+     * Parses a <lat_vec> element and checks the lattice orientation specified in its <name> element.
+     */
+    void parse_lat_vec()
+    {
         std::string lattice_orientation = "Si(100) 2x1";
 
-        if (const auto* const name = lat_vec_element->FirstChildElement("name"); name != nullptr)
+        auto name_found = false;
+
+        while (next_child())
         {
-            if (const auto* const text = name->GetText(); text != nullptr)
+            if (!name_found && xml.name() == "name")
+            {
+                name_found = true;
+
+                if (const auto& text = read_text(); !text.empty())
+                {
+                    lattice_orientation = text;
+                }
+            }
+            else
             {
-                lattice_orientation = text;
+                skip_element();
             }
         }
 
         parse_lat_type(lattice_orientation);
-
-        const auto* const design_element = siqad_root->FirstChildElement("design");
-
-        if (design_element == nullptr)
+    }
+    /**
+     * Parses the <design> element and all of its <layer> elements.
+     */
+    void parse_design()
+    {
+        while (next_child())
         {
-            throw sqd_parsing_error("Error parsing SQD file: no element 'design'");
-        }
+            if (xml.name() != "layer")
+            {
+                skip_element();
+                continue;
+            }
 
-        for (const auto* layer = design_element->FirstChildElement("layer"); layer != nullptr;
-             layer             = layer->NextSiblingElement("layer"))
-        {
-            const auto* const layer_type = layer->Attribute("type");
+            const auto* const layer_type = xml.attribute("type");
 
             if (layer_type == nullptr)
             {
                 throw sqd_parsing_error("Error parsing SQD file: no attribute 'type' in element 'layer'");
             }
 
-            if (std::string{layer_type} == "DB")
+            if (*layer_type == "DB")
             {
-                for (const auto* db_dot = layer->FirstChildElement("dbdot"); db_dot != nullptr;
-                     db_dot             = db_dot->NextSiblingElement("dbdot"))
-                {
-                    parse_db_dot(db_dot);
-                }
+                parse_db_layer();
             }
-
-            else if (std::string{layer_type} == "Defects")
+            else if (*layer_type == "Defects")
             {
-                for (const auto* defect = layer->FirstChildElement("defect"); defect != nullptr;
-                     defect             = defect->NextSiblingElement("defect"))
-                {
-                    parse_defect(defect);
-                }
+                parse_defects_layer();
+            }
+            else
+            {
+                skip_element();
             }
         }
-
-        // resize the layout to fit all cells
-        lyt.resize(max_cell_pos);
-
-        return lyt;
     }
-
-  private:
-    /**
-     * The layout to which the parsed cells are added.
-     */
-    Lyt lyt;
     /**
-     * The input stream from which the SQD file is read.
+     * Parses a <layer> element of type DB and adds all of its dots to the layout.
      */
-    std::istream& is;
+    void parse_db_layer()
+    {
+        while (next_child())
+        {
+            if (xml.name() == "dbdot")
+            {
+                parse_db_dot();
+            }
+            else
+            {
+                skip_element();
+            }
+        }
+    }
     /**
-     * The maximum position of a cell in the layout.
+     * Parses a <layer> element of type Defects and adds all of its defects to the layout if it implements the
+     * `assign_sidb_defect` function. Otherwise, the layer is skipped.
      */
-    cell<Lyt> max_cell_pos{};
-
+    void parse_defects_layer()
+    {
+        if constexpr (has_assign_sidb_defect_v<Lyt>)
+        {
+            while (next_child())
+            {
+                if (xml.name() == "defect")
+                {
+                    parse_defect();
+                }
+                else
+                {
+                    skip_element();
+                }
+            }
+        }
+        else
+        {
+            skip_element();
+        }
+    }
     /**
      * Updates the bounding box given by the maximum position of a cell in the layout
      *
@@ -209,10 +1100,9 @@ class read_sqd_layout_impl
         return cell;
     }
     /**
-     * Parses a <latcoord> element from the SQD file and returns its specified cell position.
+     * Checks whether the given lattice orientation name matches the lattice orientation of `Lyt`.
      *
-     * @param latcoord The <latcoord> element.
-     * @return The cell position specified by the <latcoord> element.
+     * @param name The name of the lattice orientation as specified in the SQD file.
      */
     void parse_lat_type(const std::string& name)
     {
@@ -236,14 +1126,13 @@ class read_sqd_layout_impl
         }
     }
     /**
-     * Parses a <latcoord> element from the SQD file and returns its specified cell position.
+     * Parses the attributes of the current <latcoord> element and returns its specified cell position.
      *
-     * @param latcoord The <latcoord> element.
      * @return The cell position specified by the <latcoord> element.
      */
-    cell<Lyt> parse_latcoord(const tinyxml2::XMLElement* latcoord)
+    cell<Lyt> parse_latcoord()
     {
-        const auto n = latcoord->Attribute("n"), m = latcoord->Attribute("m"), l = latcoord->Attribute("l");
+        const auto *n = xml.attribute("n"), *m = xml.attribute("m"), *l = xml.attribute("l");
 
         if (n == nullptr || m == nullptr || l == nullptr)
         {
@@ -253,49 +1142,40 @@ class read_sqd_layout_impl
         // special case for SiQAD coordinates
         if constexpr (has_siqad_coord_v<Lyt>)
         {
-            cell<Lyt> cell{std::stoll(n), std::stoll(m), std::stoll(l)};
+            cell<Lyt> cell{std::stoll(*n), std::stoll(*m), std::stoll(*l)};
             update_bounding_box(cell);
             return cell;
         }
 
         // Cartesian coordinates
-        return dimer_to_cell(std::stoll(n), std::stoll(m), std::stoll(l));
+        return dimer_to_cell(std::stoll(*n), std::stoll(*m), std::stoll(*l));
     }
     /**
-     * Parses the <type> attribute of a <dbdot> element from the SQD file and returns the corresponding cell type.
+     * Converts the text of a <type> element of a <dbdot> element from the SQD file to the corresponding cell type.
      *
-     * @param db_dot The <dbdot> element.
-     * @return The cell type specified by the <dbdot> element. If non is specified, the cell type is assumed to be
-     * normal.
+     * @param type The text of the <type> element.
+     * @return The cell type specified by the <type> element.
      */
-    sidb_technology::cell_type parse_dot_type(const tinyxml2::XMLElement* dot_type)
+    static sidb_technology::cell_type parse_dot_type(const std::string& type)
     {
-        // if no dot type is given, assume normal dot
-        if (dot_type == nullptr)
-        {
-            return sidb_technology::cell_type::NORMAL;
-        }
-
-        const auto* const type = dot_type->GetText();
-
-        if (type == nullptr)
+        if (type.empty())
         {
             throw sqd_parsing_error("Error parsing SQD file: no text in element 'type'");
         }
 
-        if (std::string{type} == "input")
+        if (type == "input")
         {
             return sidb_technology::cell_type::INPUT;
         }
-        if (std::string{type} == "output")
+        if (type == "output")
         {
             return sidb_technology::cell_type::OUTPUT;
         }
-        if (std::string{type} == "normal")
+        if (type == "normal")
         {
             return sidb_technology::cell_type::NORMAL;
         }
-        if (std::string{type} == "logic")
+        if (type == "logic")
         {
             return sidb_technology::cell_type::LOGIC;
         }
@@ -303,31 +1183,49 @@ class read_sqd_layout_impl
         throw sqd_parsing_error("Error parsing SQD file: invalid dot type");
     }
     /**
-     * Parses a <dbdot> element from the SQD file and adds the respective dot to the layout.
-     *
-     * @param db_dot The <dbdot> element.
+     * Parses a <dbdot> element from the SQD file and adds the respective dot to the layout. If the element has no
+     * <type> child, the dot is assumed to be normal.
      */
-    void parse_db_dot(const tinyxml2::XMLElement* db_dot)
+    void parse_db_dot()
     {
-        const auto* const latcoord = db_dot->FirstChildElement("latcoord");
+        std::optional<cell<Lyt>> latcoord{};
 
-        if (latcoord == nullptr)
+        auto dot_type   = sidb_technology::cell_type::NORMAL;
+        auto type_found = false;
+
+        while (next_child())
         {
-            throw sqd_parsing_error("Error parsing SQD file: no element 'latcoord' in element 'dbdot'");
+            if (!latcoord.has_value() && xml.name() == "latcoord")
+            {
+                latcoord = parse_latcoord();
+                skip_element();
+            }
+            else if (!type_found && xml.name() == "type")
+            {
+                type_found = true;
+                dot_type   = parse_dot_type(read_text());
+            }
+            else
+            {
+                skip_element();
+            }
         }
 
-        const auto* const dot_type = db_dot->FirstChildElement("type");
+        if (!latcoord.has_value())
+        {
+            throw sqd_parsing_error("Error parsing SQD file: no element 'latcoord' in element 'dbdot'");
+        }
 
-        lyt.assign_cell_type(parse_latcoord(latcoord), parse_dot_type(dot_type));
+        lyt.assign_cell_type(*latcoord, dot_type);
     }
     /**
-     * Parses a <val> attribute of a <type_label> element of a <property_map> element from the SQD file and converts it
-     * to the respective SiDB defect type.
+     * Converts the text of a <val> element of a <type_label> element of a <property_map> element from the SQD file to
+     * the respective SiDB defect type.
      *
-     * @param label The <type_label> element's <val> attribute.
+     * @param label The text of the <val> element.
      * @return The SiDB defect type corresponding to the given label.
      */
-    [[nodiscard]] static sidb_defect_type parse_defect_label(const char* label) noexcept
+    [[nodiscard]] static sidb_defect_type parse_defect_label(const std::string& label) noexcept
     {
         // maps defect names to their respective types
         static const std::unordered_map<std::string, sidb_defect_type> defect_name_to_type{
@@ -353,51 +1251,94 @@ class read_sqd_layout_impl
         return it == defect_name_to_type.cend() ? sidb_defect_type::UNKNOWN : it->second;
     }
     /**
-     * Parses a <defect> element from the SQD file and adds the respective defect to the layout if it implements the
-     * has_assign_sidb_defect function..
+     * Parses a <property_map> element of a <defect> element and returns the defect type given by its first
+     * <type_label> element.
      *
-     * @param label The <defect> element.
+     * @return The SiDB defect type specified by the <property_map> element.
      */
-    void parse_defect(const tinyxml2::XMLElement* defect)
+    sidb_defect_type parse_property_map()
     {
-        if constexpr (has_assign_sidb_defect_v<Lyt>)
-        {
-            std::vector<cell<Lyt>> incl_cells{};
-            sidb_defect_type       defect_type{sidb_defect_type::UNKNOWN};
-            int64_t                charge{0};
-            double                 eps_r{0.0};
-            double                 lambda_tf{0.0};
+        auto defect_type = sidb_defect_type::UNKNOWN;
 
-            if (const auto* const incl_coords = defect->FirstChildElement("incl_coords"); incl_coords != nullptr)
+        auto type_label_found = false;
+
+        while (next_child())
+        {
+            if (!type_label_found && xml.name() == "type_label")
             {
-                for (const auto* latcoord = incl_coords->FirstChildElement("latcoord"); latcoord != nullptr;
-                     latcoord             = latcoord->NextSiblingElement("latcoord"))
-                {
-                    incl_cells.push_back(parse_latcoord(latcoord));
-                }
-                if (incl_cells.empty())
+                type_label_found = true;
+
+                auto val_found = false;
+
+                while (next_child())
                 {
-                    throw sqd_parsing_error("Error parsing SQD file: no element 'latcoord' in element 'incl_coords'");
+                    if (!val_found && xml.name() == "val")
+                    {
+                        val_found   = true;
+                        defect_type = parse_defect_label(read_text());
+                    }
+                    else
+                    {
+                        skip_element();
+                    }
                 }
             }
-            if (const auto* const property_map = defect->FirstChildElement("property_map"); property_map != nullptr)
+            else
+            {
+                skip_element();
+            }
+        }
+
+        return defect_type;
+    }
+    /**
+     * Parses a <defect> element from the SQD file and adds the respective defect to the layout.
+     */
+    void parse_defect()
+    {
+        sidb_defect_type defect_type{sidb_defect_type::UNKNOWN};
+        int64_t          charge{0};
+        double           eps_r{0.0};
+        double           lambda_tf{0.0};
+
+        auto incl_coords_found  = false;
+        auto property_map_found = false;
+        auto coulomb_found      = false;
+
+        incl_cells.clear();
+
+        while (next_child())
+        {
+            if (!incl_coords_found && xml.name() == "incl_coords")
             {
-                if (const auto* const type_label = property_map->FirstChildElement("type_label"); type_label != nullptr)
+                incl_coords_found = true;
+
+                while (next_child())
                 {
-                    if (const auto* const val = type_label->FirstChildElement("val"); val != nullptr)
+                    if (xml.name() == "latcoord")
                     {
-                        defect_type = parse_defect_label(val->GetText());
+                        incl_cells.push_back(parse_latcoord());
                     }
+
+                    skip_element();
+                }
+
+                if (incl_cells.empty())
+                {
+                    throw sqd_parsing_error("Error parsing SQD file: no element 'latcoord' in element 'incl_coords'");
                 }
             }
-            if (const auto* const coulomb = defect->FirstChildElement("coulomb"); coulomb == nullptr)
+            else if (!property_map_found && xml.name() == "property_map")
             {
-                // no coulomb data available; use default values
+                property_map_found = true;
+                defect_type        = parse_property_map();
             }
-            else
+            else if (!coulomb_found && xml.name() == "coulomb")
             {
-                const auto charge_string = coulomb->Attribute("charge"), eps_r_string = coulomb->Attribute("eps_r"),
-                           lambda_tf_string = coulomb->Attribute("lambda_tf");
+                coulomb_found = true;
+
+                const auto *charge_string = xml.attribute("charge"), *eps_r_string = xml.attribute("eps_r"),
+                           *lambda_tf_string = xml.attribute("lambda_tf");
 
                 if (charge_string == nullptr || eps_r_string == nullptr || lambda_tf_string == nullptr)
                 {
@@ -405,15 +1346,22 @@ class read_sqd_layout_impl
                         "Error parsing SQD file: no attribute 'charge', 'eps_r', or 'lambda_tf' in element 'coulomb'");
                 }
 
-                charge    = std::stoll(charge_string);
-                eps_r     = std::stod(eps_r_string);
-                lambda_tf = std::stod(lambda_tf_string);
-            }
+                charge    = std::stoll(*charge_string);
+                eps_r     = std::stod(*eps_r_string);
+                lambda_tf = std::stod(*lambda_tf_string);
 
-            std::for_each(incl_cells.begin(), incl_cells.end(),
-                          [this, &defect_type, &charge, &eps_r, &lambda_tf](const auto& cell)
-                          { lyt.assign_sidb_defect(cell, sidb_defect{defect_type, charge, eps_r, lambda_tf}); });
+                skip_element();
+            }
+            else
+            {
+                skip_element();
+            }
         }
+
+        // if no coulomb data is available, default values are used
+        std::for_each(incl_cells.cbegin(), incl_cells.cend(),
+                      [this, &defect_type, &charge, &eps_r, &lambda_tf](const auto& cell)
+                      { lyt.assign_sidb_defect(cell, sidb_defect{defect_type, charge, eps_r, lambda_tf}); });
     }
 };
 
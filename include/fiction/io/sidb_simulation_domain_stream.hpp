@@ -0,0 +1,735 @@
+//
+// Created by marcel on 19.10.26.
+//
+
+#ifndef FICTION_SIDB_SIMULATION_DOMAIN_STREAM_HPP
+#define FICTION_SIDB_SIMULATION_DOMAIN_STREAM_HPP
+
+#include "fiction/io/fbl_format.hpp"
+
+#include <fmt/format.h>
+
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <mutex>
+#include <optional>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace fiction
+{
+
+/**
+ * Parameters for streaming the points of a simulation domain (e.g., an operational domain or a defect influence
+ * domain) to a file while it is being computed. Thereby, the points evaluated so far are not lost if a long-running
+ * computation is terminated prematurely, and a restarted computation can skip them.
+ */
+struct sidb_simulation_domain_stream_params
+{
+    /**
+     * File format of the stream.
+     */
+    enum class stream_format : uint8_t
+    {
+        /**
+         * One point per line in CSV format. The first line holds the column names. Enumerators are written by their
+         * underlying integer value.
+         */
+        CSV,
+        /**
+         * Compact binary format in little-endian byte order. After a header that describes the columns, the points
+         * are written in blocks of up to `flush_interval` points. Within each block, the values are stored column by
+         * column.
+         */
+        BINARY
+    };
+    /**
+     * Path of the file to stream the domain points to. If empty, no points are streamed.
+     */
+    std::string filename{};
+    /**
+     * File format of the stream.
+     */
+    stream_format format{stream_format::CSV};
+    /**
+     * Number of points that are buffered before they are written to the file and the file is flushed.
+     */
+    std::size_t flush_interval{100};
+    /**
+     * If `true` and the file already exists, the points stored in it are loaded into the domain before the computation
+     * starts such that they are not evaluated again, and new points are appended to the file. An incomplete trailing
+     * line or block, e.g., caused by a crash while writing, is discarded. Complete CSV lines that cannot be parsed are
+     * skipped but kept in the file. If `false`, an existing file is overwritten.
+     */
+    bool resume{false};
+};
+
+/**
+ * Appends key-value pairs of a simulation domain to a file as soon as they have been computed. The keys are either
+ * parameter points, i.e., `Key` can be constructed from a `std::vector<double>` and provides `get_parameters()`, or
+ * cells whose `x`, `y`, and `z` coordinates are written. The mapped values may be enumerations with an 8-bit underlying
+ * type or `double`s. All member functions are thread-safe.
+ *
+ * @tparam Domain Simulation domain type, e.g., `operational_domain`.
+ */
+template <typename Domain>
+class sidb_simulation_domain_stream
+{
+  public:
+    /**
+     * Key type of the domain.
+     */
+    using key_type = typename Domain::key_type;
+    /**
+     * Value type of the domain.
+     */
+    using mapped_type = typename Domain::mapped_type;
+    /**
+     * Standard constructor. Opens the file given in `ps` and writes the column header. If `ps.resume` is set and the
+     * file exists, its points are added to `domain` instead and further points are appended to it.
+     *
+     * @param ps Stream parameters.
+     * @param key_column_names Names of the key columns, i.e., one per dimension for parameter points and `x`, `y`, and
+     * `z` for cells.
+     * @param value_column_names Names of the value columns, i.e., one per element of `mapped_type`.
+     * @param domain Domain to load the points of an existing file into if `ps.resume` is set.
+     * @throws std::invalid_argument if an existing file to resume from does not match the given columns.
+     * @throws std::ofstream::failure if the file could not be opened.
+     */
+    sidb_simulation_domain_stream(const sidb_simulation_domain_stream_params& ps,
+                                  std::vector<std::string> key_column_names,
+                                  std::vector<std::string> value_column_names, Domain& domain) :
+            params{ps},
+            key_columns{std::move(key_column_names)},
+            value_columns{std::move(value_column_names)}
+    {
+        assert(value_columns.size() == std::tuple_size_v<mapped_type> && "one name per value column is required");
+        assert((has_parameter_key_v || key_columns.size() == 3) && "cells are written as x, y, and z");
+
+        std::optional<std::uintmax_t> resume_position{};
+
+        if (params.resume && std::filesystem::exists(params.filename))
+        {
+            resume_position = params.format == sidb_simulation_domain_stream_params::stream_format::CSV ?
+                                  resume_csv(domain) :
+                                  resume_binary(domain);
+        }
+
+        if (resume_position.has_value())
+        {
+            // discard an incomplete trailing line or block
+            std::filesystem::resize_file(params.filename, *resume_position);
+
+            file.open(params.filename, std::ios::out | std::ios::binary | std::ios::app);
+        }
+        else
+        {
+            file.open(params.filename, std::ios::out | std::ios::binary | std::ios::trunc);
+
+            file << header();
+        }
+
+        if (!file.is_open())
+        {
+            throw std::ofstream::failure("could not open file");
+        }
+
+        buffer.reserve(params.flush_interval);
+    }
+    /**
+     * Copy constructor is deleted.
+     */
+    sidb_simulation_domain_stream(const sidb_simulation_domain_stream&) = delete;
+    /**
+     * Move constructor is deleted.
+     */
+    sidb_simulation_domain_stream(sidb_simulation_domain_stream&&) = delete;
+    /**
+     * Copy assignment operator is deleted.
+     */
+    sidb_simulation_domain_stream& operator=(const sidb_simulation_domain_stream&) = delete;
+    /**
+     * Move assignment operator is deleted.
+     */
+    sidb_simulation_domain_stream& operator=(sidb_simulation_domain_stream&&) = delete;
+    /**
+     * Destructor. Writes all buffered points to the file.
+     */
+    ~sidb_simulation_domain_stream()
+    {
+        try
+        {
+            flush();
+        }
+        catch (...)
+        {
+            // destructors must not throw
+        }
+    }
+    /**
+     * Buffers the given key-value pair and writes the buffer to the file once it holds `flush_interval` points.
+     *
+     * @param key The key.
+     * @param value The value associated with `key`.
+     */
+    void append(const key_type& key, const mapped_type& value)
+    {
+        const std::lock_guard lock{mutex};
+
+        buffer.emplace_back(key, value);
+
+        if (buffer.size() >= params.flush_interval)
+        {
+            write_buffer();
+            file.flush();
+        }
+    }
+    /**
+     * Writes all buffered points to the file and flushes it.
+     */
+    void flush()
+    {
+        const std::lock_guard lock{mutex};
+
+        write_buffer();
+        file.flush();
+    }
+
+  private:
+    /**
+     * Whether the keys are parameter points rather than cells.
+     */
+    static constexpr bool has_parameter_key_v = std::is_constructible_v<key_type, std::vector<double>>;
+    /**
+     * Number of value columns.
+     */
+    static constexpr std::size_t num_value_columns = std::tuple_size_v<mapped_type>;
+    /**
+     * Identifies files in the binary format.
+     */
+    static constexpr std::array<char, 4> BINARY_MAGIC{'F', 'S', 'D', 'S'};
+    /**
+     * Version of the binary format.
+     */
+    static constexpr uint8_t BINARY_VERSION = 2;
+    /**
+     * The delimiter of the CSV format.
+     */
+    static constexpr char DELIMITER = ',';
+    /**
+     * Stream parameters.
+     */
+    const sidb_simulation_domain_stream_params params;
+    /**
+     * Names of the key columns.
+     */
+    const std::vector<std::string> key_columns;
+    /**
+     * Names of the value columns.
+     */
+    const std::vector<std::string> value_columns;
+    /**
+     * The file the points are written to.
+     */
+    std::ofstream file{};
+    /**
+     * Points that have not been written to the file yet.
+     */
+    std::vector<std::pair<key_type, mapped_type>> buffer{};
+    /**
+     * Mutex that guards `buffer` and `file`.
+     */
+    std::mutex mutex{};
+    /**
+     * Returns the size in bytes of the binary representation of a value of type `T`.
+     *
+     * @tparam T Value type.
+     * @return Size of a value of type `T` in bytes.
+     */
+    template <typename T>
+    [[nodiscard]] static constexpr std::size_t binary_size() noexcept
+    {
+        if constexpr (std::is_enum_v<T>)
+        {
+            static_assert(sizeof(std::underlying_type_t<T>) == 1, "enumerations must have an 8-bit underlying type");
+
+            return 1;
+        }
+        else
+        {
+            static_assert(std::is_same_v<T, double>, "only enumerations and doubles are supported as values");
+
+            return sizeof(double);
+        }
+    }
+    /**
+     * Appends the little-endian binary representation of the given value to the given buffer.
+     *
+     * @tparam T Value type, i.e., an enumeration with an 8-bit underlying type or `double`.
+     * @param buffer Buffer to append to.
+     * @param value Value to encode.
+     */
+    template <typename T>
+    static void append_binary(std::string& buffer, const T& value)
+    {
+        if constexpr (std::is_enum_v<T>)
+        {
+            detail::append_little_endian(buffer, static_cast<uint8_t>(value));
+        }
+        else
+        {
+            static_assert(sizeof(double) == sizeof(uint64_t), "doubles must be 64 bits wide");
+
+            uint64_t bits = 0;
+            std::memcpy(&bits, &value, sizeof(bits));
+
+            detail::append_little_endian(buffer, bits);
+        }
+    }
+    /**
+     * Decodes a value from its little-endian binary representation.
+     *
+     * @tparam T Value type, i.e., an enumeration with an 8-bit underlying type or `double`.
+     * @param bytes Pointer to the first of `binary_size<T>()` bytes.
+     * @return The decoded value.
+     */
+    template <typename T>
+    [[nodiscard]] static T load_binary(const char* bytes) noexcept
+    {
+        if constexpr (std::is_enum_v<T>)
+        {
+            return static_cast<T>(detail::load_little_endian<uint8_t>(bytes));
+        }
+        else
+        {
+            const auto bits = detail::load_little_endian<uint64_t>(bytes);
+
+            double value{};
+            std::memcpy(&value, &bits, sizeof(value));
+
+            return value;
+        }
+    }
+    /**
+     * Applies a callable to the index of each value column, given as an `std::integral_constant`.
+     *
+     * @tparam Fn Functor type.
+     * @tparam Is Value column indices.
+     * @param fn Functor to apply to each value column index.
+     */
+    template <typename Fn, std::size_t... Is>
+    static void for_each_value_column(Fn&& fn, std::index_sequence<Is...> /*unused*/)
+    {
+        (fn(std::integral_constant<std::size_t, Is>{}), ...);
+    }
+    /**
+     * Applies a callable to the index of each value column, given as an `std::integral_constant`.
+     *
+     * @tparam Fn Functor type.
+     * @param fn Functor to apply to each value column index.
+     */
+    template <typename Fn>
+    static void for_each_value_column(Fn&& fn)
+    {
+        for_each_value_column(std::forward<Fn>(fn), std::make_index_sequence<num_value_columns>{});
+    }
+    /**
+     * Returns the size in bytes of the binary representation of one point.
+     *
+     * @return Size of one point in bytes.
+     */
+    [[nodiscard]] std::size_t binary_point_size() const noexcept
+    {
+        std::size_t size = key_columns.size() * sizeof(double);
+
+        for_each_value_column(
+            [&size](const auto i)
+            { size += binary_size<std::tuple_element_t<decltype(i)::value, mapped_type>>(); });
+
+        return size;
+    }
+    /**
+     * Converts a key to its column values.
+     *
+     * @param key The key.
+     * @return One value per key column.
+     */
+    [[nodiscard]] static std::vector<double> to_columns(const key_type& key)
+    {
+        if constexpr (has_parameter_key_v)
+        {
+            return key.get_parameters();
+        }
+        else
+        {
+            return {static_cast<double>(key.x), static_cast<double>(key.y), static_cast<double>(key.z)};
+        }
+    }
+    /**
+     * Converts column values to a key.
+     *
+     * @param columns One value per key column.
+     * @return The key.
+     */
+    [[nodiscard]] static key_type to_key(const std::vector<double>& columns)
+    {
+        if constexpr (has_parameter_key_v)
+        {
+            return key_type{columns};
+        }
+        else
+        {
+            return key_type{static_cast<int64_t>(columns[0]), static_cast<int64_t>(columns[1]),
+                            static_cast<int64_t>(columns[2])};
+        }
+    }
+    /**
+     * Returns the header that is written at the beginning of a new file.
+     *
+     * @return Header in the selected format.
+     */
+    [[nodiscard]] std::string header() const
+    {
+        if (params.format == sidb_simulation_domain_stream_params::stream_format::CSV)
+        {
+            std::string line{};
+
+            for (const auto& name : key_columns)
+            {
+                line += name + DELIMITER;
+            }
+            for (const auto& name : value_columns)
+            {
+                line += name + DELIMITER;
+            }
+
+            line.back() = '\n';
+
+            return line;
+        }
+
+        std::string bytes{BINARY_MAGIC.cbegin(), BINARY_MAGIC.cend()};
+
+        bytes.push_back(static_cast<char>(BINARY_VERSION));
+        bytes.push_back(static_cast<char>(key_columns.size()));
+        bytes.push_back(static_cast<char>(num_value_columns));
+
+        // type of each value column, i.e., its size in bytes
+        for_each_value_column(
+            [&bytes](const auto i) {
+                bytes.push_back(
+                    static_cast<char>(binary_size<std::tuple_element_t<decltype(i)::value, mapped_type>>()));
+            });
+
+        for (const auto& name : key_columns)
+        {
+            bytes.push_back(static_cast<char>(name.size()));
+            bytes += name;
+        }
+        for (const auto& name : value_columns)
+        {
+            bytes.push_back(static_cast<char>(name.size()));
+            bytes += name;
+        }
+
+        return bytes;
+    }
+    /**
+     * Writes all buffered points to the file and clears the buffer. The mutex has to be held by the caller.
+     */
+    void write_buffer()
+    {
+        if (buffer.empty())
+        {
+            return;
+        }
+
+        if (params.format == sidb_simulation_domain_stream_params::stream_format::CSV)
+        {
+            std::string lines{};
+
+            for (const auto& [key, value] : buffer)
+            {
+                for (const auto c : to_columns(key))
+                {
+                    lines += fmt::format("{}{}", c, DELIMITER);
+                }
+
+                for_each_value_column(
+                    [&lines, &value = value](const auto i)
+                    {
+                        const auto& element = std::get<decltype(i)::value>(value);
+
+                        if constexpr (std::is_enum_v<std::decay_t<decltype(element)>>)
+                        {
+                            lines += fmt::format("{}{}", static_cast<int>(element), DELIMITER);
+                        }
+                        else
+                        {
+                            lines += fmt::format("{}{}", element, DELIMITER);
+                        }
+                    });
+
+                lines.back() = '\n';
+            }
+
+            file << lines;
+        }
+        else
+        {
+            std::string block{};
+            detail::append_little_endian(block, static_cast<uint32_t>(buffer.size()));
+
+            std::vector<std::vector<double>> keys{};
+            keys.reserve(buffer.size());
+
+            for (const auto& [key, value] : buffer)
+            {
+                keys.push_back(to_columns(key));
+            }
+
+            // column-wise: first all key columns, then all value columns
+            for (std::size_t d = 0; d < key_columns.size(); ++d)
+            {
+                for (const auto& key : keys)
+                {
+                    append_binary(block, key[d]);
+                }
+            }
+
+            for_each_value_column(
+                [this, &block](const auto i)
+                {
+                    for (const auto& [key, value] : buffer)
+                    {
+                        append_binary(block, std::get<decltype(i)::value>(value));
+                    }
+                });
+
+            file.write(block.data(), static_cast<std::streamsize>(block.size()));
+        }
+
+        buffer.clear();
+    }
+    /**
+     * Parses the value columns of a CSV line.
+     *
+     * @param fields The fields of the line that belong to the value columns.
+     * @return The parsed value or `std::nullopt` if a field is malformed.
+     */
+    [[nodiscard]] static std::optional<mapped_type> parse_csv_value(const std::vector<std::string>& fields)
+    {
+        mapped_type value{};
+        bool        valid = true;
+
+        for_each_value_column(
+            [&fields, &value, &valid](const auto i)
+            {
+                using T = std::tuple_element_t<decltype(i)::value, mapped_type>;
+
+                const auto* begin = fields[decltype(i)::value].c_str();
+                char*       end   = nullptr;
+
+                if constexpr (std::is_enum_v<T>)
+                {
+                    std::get<decltype(i)::value>(value) = static_cast<T>(std::strtol(begin, &end, 10));
+                }
+                else
+                {
+                    std::get<decltype(i)::value>(value) = std::strtod(begin, &end);
+                }
+
+                valid = valid && end != begin && *end == '\0';
+            });
+
+        if (!valid)
+        {
+            return std::nullopt;
+        }
+
+        return value;
+    }
+    /**
+     * Loads all complete lines of an existing CSV file into the given domain. Lines that cannot be parsed, e.g.,
+     * because they have been edited by hand, are skipped.
+     *
+     * @param domain The domain to add the points to.
+     * @return The size of the file without an incomplete trailing line or `std::nullopt` if the file does not even
+     * contain a complete header.
+     * @throws std::invalid_argument if the header of the file does not match the columns of this stream.
+     */
+    [[nodiscard]] std::optional<std::uintmax_t> resume_csv(Domain& domain) const
+    {
+        std::ifstream in{params.filename, std::ios::in | std::ios::binary};
+
+        if (!in.is_open())
+        {
+            throw std::ifstream::failure("could not open file");
+        }
+
+        std::string line{};
+
+        // a line is only complete if it is terminated by a newline
+        const auto read_line = [&in, &line]() { return std::getline(in, line) && !in.eof(); };
+
+        if (!read_line())
+        {
+            return std::nullopt;
+        }
+
+        const auto expected_header = header();
+
+        if (line != expected_header.substr(0, expected_header.size() - 1))
+        {
+            throw std::invalid_argument(
+                fmt::format("the header of '{}' does not match the domain to be computed", params.filename));
+        }
+
+        std::uintmax_t position = expected_header.size();
+
+        const auto num_fields = key_columns.size() + num_value_columns;
+
+        std::vector<std::string> fields{};
+        std::vector<double>      key_values(key_columns.size());
+
+        while (read_line())
+        {
+            fields.clear();
+
+            std::istringstream line_stream{line};
+
+            for (std::string field{}; std::getline(line_stream, field, DELIMITER);)
+            {
+                fields.push_back(field);
+            }
+
+            // complete lines remain in the file, regardless of whether they can be parsed
+            position += line.size() + 1;
+
+            if (fields.size() != num_fields)
+            {
+                continue;
+            }
+
+            bool valid_key = true;
+
+            for (std::size_t d = 0; d < key_columns.size(); ++d)
+            {
+                char* end     = nullptr;
+                key_values[d] = std::strtod(fields[d].c_str(), &end);
+                valid_key     = valid_key && end != fields[d].c_str() && *end == '\0';
+            }
+
+            const auto value = parse_csv_value({fields.cbegin() + static_cast<std::ptrdiff_t>(key_columns.size()),
+                                                fields.cend()});
+
+            if (!valid_key || !value.has_value())
+            {
+                continue;
+            }
+
+            domain.add_value(to_key(key_values), *value);
+        }
+
+        return position;
+    }
+    /**
+     * Loads all complete blocks of an existing binary file into the given domain.
+     *
+     * @param domain The domain to add the points to.
+     * @return The size of the file without an incomplete trailing block or `std::nullopt` if the file does not even
+     * contain a complete header.
+     * @throws std::invalid_argument if the header of the file does not match the columns of this stream.
+     */
+    [[nodiscard]] std::optional<std::uintmax_t> resume_binary(Domain& domain) const
+    {
+        std::ifstream in{params.filename, std::ios::in | std::ios::binary};
+
+        if (!in.is_open())
+        {
+            throw std::ifstream::failure("could not open file");
+        }
+
+        const auto expected_header = header();
+
+        std::string actual_header(expected_header.size(), '\0');
+
+        if (!in.read(actual_header.data(), static_cast<std::streamsize>(actual_header.size())))
+        {
+            return std::nullopt;
+        }
+
+        if (actual_header != expected_header)
+        {
+            throw std::invalid_argument(
+                fmt::format("the header of '{}' does not match the domain to be computed", params.filename));
+        }
+
+        std::uintmax_t position = expected_header.size();
+
+        const auto point_size = binary_point_size();
+
+        std::array<char, sizeof(uint32_t)> num_points_bytes{};
+        std::string                        block{};
+
+        while (in.read(num_points_bytes.data(), static_cast<std::streamsize>(num_points_bytes.size())))
+        {
+            const auto num_points = detail::load_little_endian<uint32_t>(num_points_bytes.data());
+
+            block.resize(static_cast<std::size_t>(num_points) * point_size);
+
+            if (!in.read(block.data(), static_cast<std::streamsize>(block.size())))
+            {
+                break;
+            }
+
+            std::vector<std::vector<double>> keys(num_points, std::vector<double>(key_columns.size()));
+            std::vector<mapped_type>         values(num_points);
+
+            std::size_t offset = 0;
+
+            for (std::size_t d = 0; d < key_columns.size(); ++d)
+            {
+                for (std::size_t p = 0; p < num_points; ++p, offset += sizeof(double))
+                {
+                    keys[p][d] = load_binary<double>(block.data() + offset);
+                }
+            }
+
+            for_each_value_column(
+                [&values, &block, &offset, num_points](const auto i)
+                {
+                    using T = std::tuple_element_t<decltype(i)::value, mapped_type>;
+
+                    for (std::size_t p = 0; p < num_points; ++p, offset += binary_size<T>())
+                    {
+                        std::get<decltype(i)::value>(values[p]) = load_binary<T>(block.data() + offset);
+                    }
+                });
+
+            for (std::size_t p = 0; p < num_points; ++p)
+            {
+                domain.add_value(to_key(keys[p]), values[p]);
+            }
+
+            position += num_points_bytes.size() + block.size();
+        }
+
+        return position;
+    }
+};
+
+}  // namespace fiction
+
+#endif  // FICTION_SIDB_SIMULATION_DOMAIN_STREAM_HPP
@@ -0,0 +1,391 @@
+//
+// Created by marcel on 19.10.26.
+//
+
+#ifndef FICTION_WRITE_FBL_LAYOUT_HPP
+#define FICTION_WRITE_FBL_LAYOUT_HPP
+
+#include "fiction/io/fbl_format.hpp"
+#include "fiction/layouts/coordinates.hpp"
+#include "fiction/technology/cell_technologies.hpp"
+#include "fiction/traits.hpp"
+#include "fiction/utils/name_utils.hpp"
+
+#include <kitty/dynamic_truth_table.hpp>
+#include <mockturtle/views/topo_view.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <limits>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace fiction
+{
+
+namespace detail
+{
+
+template <typename Lyt>
+class write_fbl_layout_impl
+{
+  public:
+    write_fbl_layout_impl(const Lyt& src, std::ostream& s) : lyt{src}, os{s} {}
+
+    void run()
+    {
+        write_header();
+        write_clocking();
+
+        if constexpr (is_gate_level_layout_v<Lyt>)
+        {
+            write_gates();
+        }
+        else
+        {
+            write_cells();
+        }
+
+        flush();
+    }
+
+  private:
+    /**
+     * The layout to be written.
+     */
+    const Lyt& lyt;
+    /**
+     * The output stream to which the layout is written.
+     */
+    std::ostream& os;
+    /**
+     * Buffer that collects encoded data before it is written to the stream in large chunks.
+     */
+    std::string buffer{};
+    /**
+     * Size in bytes from which on the buffer is written to the stream.
+     */
+    static constexpr std::size_t FLUSH_THRESHOLD = 1u << 20u;
+
+    void flush()
+    {
+        os.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+        buffer.clear();
+    }
+
+    template <typename T>
+    void put(const T value)
+    {
+        append_little_endian(buffer, value);
+
+        if (buffer.size() >= FLUSH_THRESHOLD)
+        {
+            flush();
+        }
+    }
+
+    template <typename E>
+    void put_enum(const E value)
+    {
+        put(static_cast<std::underlying_type_t<E>>(value));
+    }
+
+    void put_string(const std::string_view& str)
+    {
+        put(static_cast<uint32_t>(str.size()));
+        buffer.append(str);
+
+        if (buffer.size() >= FLUSH_THRESHOLD)
+        {
+            flush();
+        }
+    }
+
+    void put_coordinate(const offset::ucoord_t& c)
+    {
+        put(static_cast<uint64_t>(c));
+    }
+
+    void write_header()
+    {
+        buffer.append(fbl::MAGIC.data(), fbl::MAGIC.size());
+
+        put(fbl::VERSION);
+        put_enum(is_gate_level_layout_v<Lyt> ? fbl::layout_kind::GATE_LEVEL : fbl::layout_kind::CELL_LEVEL);
+        put_enum(fbl::topology_of<Lyt>());
+        put_enum(fbl::technology_of<Lyt>());
+        put_enum(fbl::lattice_orientation_of<Lyt>());
+
+        if constexpr (is_cell_level_layout_v<Lyt>)
+        {
+            put(static_cast<uint16_t>(lyt.get_tile_size_x()));
+            put(static_cast<uint16_t>(lyt.get_tile_size_y()));
+        }
+        else
+        {
+            put(uint16_t{1});
+            put(uint16_t{1});
+        }
+
+        put_coordinate({lyt.x(), lyt.y(), lyt.z()});
+        put_string(get_name(lyt));
+    }
+
+    void write_clocking()
+    {
+        const auto clocking_scheme = lyt.get_clocking_scheme();
+
+        put_string(clocking_scheme.name);
+        put(static_cast<uint8_t>(clocking_scheme.num_clocks));
+
+        // if the clocking scheme is irregular, store the clock numbers of all clock zones
+        if (clocking_scheme.is_regular())
+        {
+            put(uint64_t{0});
+
+            return;
+        }
+
+        uint64_t max_zone_x = lyt.x();
+        uint64_t max_zone_y = lyt.y();
+
+        if constexpr (is_cell_level_layout_v<Lyt>)
+        {
+            max_zone_x /= lyt.get_tile_size_x();
+            max_zone_y /= lyt.get_tile_size_y();
+        }
+
+        put(static_cast<uint64_t>((max_zone_x + 1) * (max_zone_y + 1)));
+
+        for (uint64_t x = 0; x <= max_zone_x; ++x)
+        {
+            for (uint64_t y = 0; y <= max_zone_y; ++y)
+            {
+                put(static_cast<uint8_t>(clocking_scheme({x, y})));
+            }
+        }
+    }
+
+    void write_gates()
+    {
+        std::vector<uint64_t>         tiles{};
+        std::vector<fbl::gate_type>   types{};
+        std::vector<uint8_t>          fanin_counts{};
+        std::vector<uint64_t>         fanins{};
+        std::vector<uint64_t>         truth_table_words{};
+        std::vector<std::string>      name_storage{};
+
+        const auto num_nodes = lyt.num_pis() + lyt.num_gates();
+        tiles.reserve(num_nodes);
+        types.reserve(num_nodes);
+        fanin_counts.reserve(num_nodes);
+
+        // create topological ordering
+        mockturtle::topo_view layout_topo{lyt};
+
+        layout_topo.foreach_pi(
+            [this, &tiles, &types, &fanin_counts, &name_storage](const auto& gate)
+            {
+                tiles.push_back(static_cast<uint64_t>(lyt.get_tile(gate)));
+                types.push_back(fbl::gate_type::PI);
+                fanin_counts.push_back(0);
+                name_storage.push_back(lyt.get_name(gate));
+            });
+
+        layout_topo.foreach_gate(
+            [this, &tiles, &types, &fanin_counts, &fanins, &truth_table_words, &name_storage](const auto& gate)
+            {
+                const auto coord   = lyt.get_tile(gate);
+                const auto signals = lyt.incoming_data_flow(coord);
+
+                if (signals.size() > std::numeric_limits<uint8_t>::max())
+                {
+                    throw fbl_write_error("gates with more than 255 incoming signals cannot be stored");
+                }
+
+                auto type = fbl::gate_type::FUNCTION;
+
+                if (signals.size() == 1)
+                {
+                    if (lyt.is_po(gate))
+                    {
+                        type = fbl::gate_type::PO;
+                        name_storage.push_back(lyt.get_name(gate));
+                    }
+                    else if (lyt.is_wire(gate))
+                    {
+                        type = fbl::gate_type::BUF;
+                    }
+                    else if (lyt.is_inv(gate))
+                    {
+                        type = fbl::gate_type::INV;
+                    }
+                }
+                else if (signals.size() == 2)
+                {
+                    type = lyt.is_and(gate)  ? fbl::gate_type::AND :
+                           lyt.is_nand(gate) ? fbl::gate_type::NAND :
+                           lyt.is_or(gate)   ? fbl::gate_type::OR :
+                           lyt.is_nor(gate)  ? fbl::gate_type::NOR :
+                           lyt.is_xor(gate)  ? fbl::gate_type::XOR :
+                           lyt.is_xnor(gate) ? fbl::gate_type::XNOR :
+                           lyt.is_lt(gate)   ? fbl::gate_type::LT :
+                           lyt.is_gt(gate)   ? fbl::gate_type::GT :
+                           lyt.is_le(gate)   ? fbl::gate_type::LE :
+                           lyt.is_ge(gate)   ? fbl::gate_type::GE :
+                                               fbl::gate_type::FUNCTION;
+                }
+                else if (signals.size() == 3 && lyt.is_maj(gate))
+                {
+                    type = fbl::gate_type::MAJ;
+                }
+
+                if (type == fbl::gate_type::FUNCTION)
+                {
+                    // the reader rejects generic functions without incoming signals, e.g., constants
+                    if (signals.empty())
+                    {
+                        throw fbl_write_error("gates without incoming signals other than PIs cannot be stored");
+                    }
+
+                    const auto node_fun = lyt.node_function(gate);
+
+                    if (node_fun.num_vars() != signals.size())
+                    {
+                        throw fbl_write_error(
+                            "the function of a gate does not match its number of incoming signals");
+                    }
+
+                    truth_table_words.insert(truth_table_words.cend(), node_fun.cbegin(), node_fun.cend());
+                }
+
+                tiles.push_back(static_cast<uint64_t>(coord));
+                types.push_back(type);
+                fanin_counts.push_back(static_cast<uint8_t>(signals.size()));
+
+                for (const auto& s : signals)
+                {
+                    fanins.push_back(static_cast<uint64_t>(s));
+                }
+            });
+
+        put(static_cast<uint64_t>(tiles.size()));
+        std::for_each(tiles.cbegin(), tiles.cend(), [this](const auto t) { put(t); });
+        std::for_each(types.cbegin(), types.cend(), [this](const auto t) { put_enum(t); });
+        std::for_each(fanin_counts.cbegin(), fanin_counts.cend(), [this](const auto c) { put(c); });
+
+        put(static_cast<uint64_t>(fanins.size()));
+        std::for_each(fanins.cbegin(), fanins.cend(), [this](const auto f) { put(f); });
+
+        put(static_cast<uint64_t>(truth_table_words.size()));
+        std::for_each(truth_table_words.cbegin(), truth_table_words.cend(), [this](const auto w) { put(w); });
+
+        std::for_each(name_storage.cbegin(), name_storage.cend(), [this](const auto& n) { put_string(n); });
+    }
+
+    void write_cells()
+    {
+        std::vector<uint64_t> cells{};
+        cells.reserve(lyt.num_cells());
+
+        lyt.foreach_cell([&cells](const auto& c) { cells.push_back(static_cast<uint64_t>(c)); });
+
+        // sort the cells to obtain reproducible files regardless of the hash map's iteration order
+        std::sort(cells.begin(), cells.end());
+
+        put(static_cast<uint64_t>(cells.size()));
+        std::for_each(cells.cbegin(), cells.cend(), [this](const auto c) { put(c); });
+        std::for_each(cells.cbegin(), cells.cend(),
+                      [this](const auto c)
+                      { put(static_cast<uint8_t>(lyt.get_cell_type(offset::ucoord_t{c}))); });
+
+        if constexpr (has_qca_technology_v<Lyt>)
+        {
+            std::for_each(cells.cbegin(), cells.cend(),
+                          [this](const auto c) { put_enum(lyt.get_cell_mode(offset::ucoord_t{c})); });
+        }
+
+        std::vector<std::pair<uint64_t, std::string>> named_cells{};
+
+        for (const auto c : cells)
+        {
+            if (auto name = lyt.get_cell_name(offset::ucoord_t{c}); !name.empty())
+            {
+                named_cells.emplace_back(c, std::move(name));
+            }
+        }
+
+        put(static_cast<uint64_t>(named_cells.size()));
+
+        for (const auto& [c, name] : named_cells)
+        {
+            put(c);
+            put_string(name);
+        }
+    }
+};
+
+}  // namespace detail
+
+/**
+ * Writes a gate-level or cell-level layout to a file in the fiction binary layout (FBL) format. In contrast to the
+ * XML-based formats, FBL stores all tiles, gates, and cells in packed arrays and can therefore be written and read
+ * significantly faster for large layouts. The layout's coordinates must be of type `offset::ucoord_t`.
+ *
+ * This overload uses an output stream to write into. The stream should have been opened in binary mode.
+ *
+ * May throw an `fbl_write_error` if the layout cannot be stored, e.g., because it contains gates without incoming
+ * signals that could not be parsed again.
+ *
+ * @tparam Lyt Gate-level or cell-level layout type.
+ * @param lyt The layout to be written.
+ * @param os The output stream to write into.
+ */
+template <typename Lyt>
+void write_fbl_layout(const Lyt& lyt, std::ostream& os)
+{
+    static_assert(is_gate_level_layout_v<Lyt> || is_cell_level_layout_v<Lyt>,
+                  "Lyt is neither a gate-level nor a cell-level layout");
+    static_assert(std::is_same_v<coordinate<Lyt>, offset::ucoord_t>, "Lyt must be based on offset::ucoord_t");
+
+    detail::write_fbl_layout_impl p{lyt, os};
+
+    p.run();
+}
+/**
+ * Writes a gate-level or cell-level layout to a file in the fiction binary layout (FBL) format. In contrast to the
+ * XML-based formats, FBL stores all tiles, gates, and cells in packed arrays and can therefore be written and read
+ * significantly faster for large layouts. The layout's coordinates must be of type `offset::ucoord_t`.
+ *
+ * This overload uses a file name to create and write into.
+ *
+ * May throw an `fbl_write_error` if the layout cannot be stored, e.g., because it contains gates without incoming
+ * signals that could not be parsed again.
+ *
+ * @tparam Lyt Gate-level or cell-level layout type.
+ * @param lyt The layout to be written.
+ * @param filename The file name to create and write into. Should preferably use the .fbl extension.
+ */
+template <typename Lyt>
+void write_fbl_layout(const Lyt& lyt, const std::string_view& filename)
+{
+    std::ofstream os{filename.data(), std::ofstream::out | std::ofstream::binary};
+
+    if (!os.is_open())
+    {
+        throw std::ofstream::failure("could not open file");
+    }
+
+    write_fbl_layout(lyt, os);
+    os.close();
+}
+
+}  // namespace fiction
+
+#endif  // FICTION_WRITE_FBL_LAYOUT_HPP
@@ -5,19 +5,16 @@
 #ifndef FICTION_WRITE_FGL_LAYOUT_HPP
 #define FICTION_WRITE_FGL_LAYOUT_HPP
 
+#include "fiction/io/fgl_format.hpp"
 #include "fiction/layouts/clocked_layout.hpp"
 #include "fiction/layouts/clocking_scheme.hpp"
 #include "fiction/traits.hpp"
-#include "utils/version_info.hpp"
 
-#include <fmt/chrono.h>
 #include <fmt/format.h>
 #include <kitty/print.hpp>
 #include <mockturtle/views/topo_view.hpp>
 
-#include <chrono>
 #include <cstdlib>
-#include <ctime>
 #include <fstream>
 #include <ostream>
 #include <sstream>
@@ -30,60 +27,6 @@ namespace fiction
 namespace detail
 {
 
-namespace fcn
-{
-
-inline constexpr const char* FGL_HEADER       = "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n";
-inline constexpr const char* OPEN_FGL         = "<fgl>\n";
-inline constexpr const char* CLOSE_FGL        = "</fgl>\n";
-inline constexpr const char* FICTION_METADATA = "  <fiction>\n"
-                                                "    <fiction_version>{}</fiction_version>\n"
-                                                "    <available_at>{}</available_at>\n"
-                                                "    <date>{}</date>\n"
-                                                "  </fiction>\n";
-
-inline constexpr const char* OPEN_LAYOUT_METADATA  = "  <layout>\n";
-inline constexpr const char* CLOSE_LAYOUT_METADATA = "  </layout>\n";
-inline constexpr const char* LAYOUT_METADATA       = "    <name>{}</name>\n"
-                                                     "    <topology>{}</topology>\n"
-                                                     "    <size>\n"
-                                                     "      <x>{}</x>\n"
-                                                     "      <y>{}</y>\n"
-                                                     "      <z>{}</z>\n"
-                                                     "    </size>\n";
-inline constexpr const char* OPEN_CLOCKING         = "    <clocking>\n";
-inline constexpr const char* CLOSE_CLOCKING        = "    </clocking>\n";
-inline constexpr const char* CLOCKING_SCHEME_NAME  = "      <name>{}</name>\n";
-inline constexpr const char* OPEN_CLOCK_ZONES      = "      <zones>\n";
-inline constexpr const char* CLOSE_CLOCK_ZONES     = "      </zones>\n";
-inline constexpr const char* CLOCK_ZONE            = "        <zone>\n"
-                                                     "          <x>{}</x>\n"
-                                                     "          <y>{}</y>\n"
-                                                     "          <clock>{}</clock>\n"
-                                                     "        </zone>\n";
-
-inline constexpr const char* OPEN_GATES     = "  <gates>\n";
-inline constexpr const char* CLOSE_GATES    = "  </gates>\n";
-inline constexpr const char* OPEN_GATE      = "    <gate>\n";
-inline constexpr const char* CLOSE_GATE     = "    </gate>\n";
-inline constexpr const char* GATE           = "      <id>{}</id>\n"
-                                              "      <type>{}</type>\n"
-                                              "      <name>{}</name>\n"
-                                              "      <loc>\n"
-                                              "        <x>{}</x>\n"
-                                              "        <y>{}</y>\n"
-                                              "        <z>{}</z>\n"
-                                              "      </loc>\n";
-inline constexpr const char* OPEN_INCOMING  = "      <incoming>\n";
-inline constexpr const char* CLOSE_INCOMING = "      </incoming>\n";
-inline constexpr const char* SIGNAL         = "        <signal>\n"
-                                              "          <x>{}</x>\n"
-                                              "          <y>{}</y>\n"
-                                              "          <z>{}</z>\n"
-                                              "        </signal>\n";
-
-}  // namespace fcn
-
 template <typename Lyt>
 class write_fgl_layout_impl
 {
@@ -93,9 +36,7 @@ class write_fgl_layout_impl
     void run()
     {
         // metadata
-        os << fcn::FGL_HEADER << fcn::OPEN_FGL;
-        const auto time_str = fmt::format("{:%Y-%m-%d %H:%M:%S}", fmt::localtime(std::time(nullptr)));
-        os << fmt::format(fcn::FICTION_METADATA, FICTION_VERSION, FICTION_REPO, time_str);
+        write_fgl_preamble(os);
 
         os << fcn::OPEN_LAYOUT_METADATA;
         std::string layout_name = get_name(lyt);
@@ -178,10 +119,7 @@ class write_fgl_layout_impl
         layout_topo.foreach_pi(
             [&gate_id, this](const auto& gate)
             {
-                const auto coord = lyt.get_tile(gate);
-                os << fcn::OPEN_GATE;
-                os << fmt::format(fcn::GATE, gate_id, "PI", lyt.get_name(gate), coord.x, coord.y, coord.z);
-                os << fcn::CLOSE_GATE;
+                write_fgl_element(os, gate_id, "PI", lyt.get_name(gate), lyt.get_tile(gate));
                 gate_id++;
             });
 
@@ -189,127 +127,24 @@ class write_fgl_layout_impl
         layout_topo.foreach_gate(
             [&gate_id, this](const auto& gate)
             {
-                os << fcn::OPEN_GATE;
-                const auto coord = lyt.get_tile(gate);
-                if (const auto signals = lyt.incoming_data_flow(coord); signals.size() == 1)
-                {
-                    const auto incoming_signal = signals[0];
-
-                    if (lyt.is_po(gate))
-                    {
-                        os << fmt::format(fcn::GATE, gate_id, "PO", lyt.get_name(gate), coord.x, coord.y, coord.z);
-                    }
-                    else if (lyt.is_wire(gate))
-                    {
-                        os << fmt::format(fcn::GATE, gate_id, "BUF", "", coord.x, coord.y, coord.z);
-                    }
-                    else if (lyt.is_inv(gate))
-                    {
-                        os << fmt::format(fcn::GATE, gate_id, "INV", "", coord.x, coord.y, coord.z);
-                    }
-                    else if (lyt.is_function(gate))
-                    {
-                        const auto node_fun = lyt.node_function(gate);
-
-                        os << fmt::format(fcn::GATE, gate_id, kitty::to_hex(node_fun), "", coord.x, coord.y, coord.z);
-                    }
+                const auto coord   = lyt.get_tile(gate);
+                const auto signals = lyt.incoming_data_flow(coord);
 
-                    os << fcn::OPEN_INCOMING;
-                    os << fmt::format(fcn::SIGNAL, incoming_signal.x, incoming_signal.y, incoming_signal.z);
-                    os << fcn::CLOSE_INCOMING;
-                }
-                else if (signals.size() == 2)
-                {
-                    const auto incoming_signal_a = signals[0];
-                    const auto incoming_signal_b = signals[1];
-
-                    if (lyt.is_and(gate))
-                    {
-                        os << fmt::format(fcn::GATE, gate_id, "AND", "", coord.x, coord.y, coord.z);
-                    }
-                    else if (lyt.is_nand(gate))
-                    {
-                        os << fmt::format(fcn::GATE, gate_id, "NAND", "", coord.x, coord.y, coord.z);
-                    }
-                    else if (lyt.is_or(gate))
-                    {
-                        os << fmt::format(fcn::GATE, gate_id, "OR", "", coord.x, coord.y, coord.z);
-                    }
-                    else if (lyt.is_nor(gate))
-                    {
-                        os << fmt::format(fcn::GATE, gate_id, "NOR", "", coord.x, coord.y, coord.z);
-                    }
-                    else if (lyt.is_xor(gate))
-                    {
-                        os << fmt::format(fcn::GATE, gate_id, "XOR", "", coord.x, coord.y, coord.z);
-                    }
-                    else if (lyt.is_xnor(gate))
-                    {
-                        os << fmt::format(fcn::GATE, gate_id, "XNOR", "", coord.x, coord.y, coord.z);
-                    }
-                    else if (lyt.is_lt(gate))
-                    {
-                        os << fmt::format(fcn::GATE, gate_id, "LT", "", coord.x, coord.y, coord.z);
-                    }
-                    else if (lyt.is_gt(gate))
-                    {
-                        os << fmt::format(fcn::GATE, gate_id, "GT", "", coord.x, coord.y, coord.z);
-                    }
-                    else if (lyt.is_le(gate))
-                    {
-                        os << fmt::format(fcn::GATE, gate_id, "LE", "", coord.x, coord.y, coord.z);
-                    }
-                    else if (lyt.is_ge(gate))
-                    {
-                        os << fmt::format(fcn::GATE, gate_id, "GE", "", coord.x, coord.y, coord.z);
-                    }
-                    else if (lyt.is_function(gate))
-                    {
-                        const auto node_fun = lyt.node_function(gate);
-
-                        os << fmt::format(fcn::GATE, gate_id, kitty::to_hex(node_fun), "", coord.x, coord.y, coord.z);
-                    }
-                    os << fcn::OPEN_INCOMING;
-                    os << fmt::format(fcn::SIGNAL, incoming_signal_a.x, incoming_signal_a.y, incoming_signal_a.z);
-                    os << fmt::format(fcn::SIGNAL, incoming_signal_b.x, incoming_signal_b.y, incoming_signal_b.z);
-                    os << fcn::CLOSE_INCOMING;
-                }
-                else if (signals.size() == 3)
+                if (lyt.is_po(gate))
                 {
-                    const auto incoming_signal_a = signals[0];
-                    const auto incoming_signal_b = signals[1];
-                    const auto incoming_signal_c = signals[2];
-
-                    if (lyt.is_maj(gate))
-                    {
-                        os << fmt::format(fcn::GATE, gate_id, "MAJ", "", coord.x, coord.y, coord.z);
-                    }
-                    else if (lyt.is_function(gate))
-                    {
-                        const auto node_fun = lyt.node_function(gate);
-
-                        os << fmt::format(fcn::GATE, gate_id, kitty::to_hex(node_fun), "", coord.x, coord.y, coord.z);
-                    }
-                    os << fcn::OPEN_INCOMING;
-                    os << fmt::format(fcn::SIGNAL, incoming_signal_a.x, incoming_signal_a.y, incoming_signal_a.z);
-                    os << fmt::format(fcn::SIGNAL, incoming_signal_b.x, incoming_signal_b.y, incoming_signal_b.z);
-                    os << fmt::format(fcn::SIGNAL, incoming_signal_c.x, incoming_signal_c.y, incoming_signal_c.z);
-                    os << fcn::CLOSE_INCOMING;
+                    write_fgl_element(os, gate_id, "PO", lyt.get_name(gate), coord, signals);
                 }
-                else if (lyt.is_function(gate))
+                else
                 {
                     const auto node_fun = lyt.node_function(gate);
 
-                    os << fmt::format(fcn::GATE, gate_id, kitty::to_hex(node_fun), "", coord.x, coord.y, coord.z);
+                    // gates are only named if their function matches the number of incoming signals
+                    const auto type = node_fun.num_vars() == signals.size() ? fgl_gate_type(node_fun) :
+                                                                              kitty::to_hex(node_fun);
 
-                    os << fcn::OPEN_INCOMING;
-                    for (std::size_t i = 0; i < signals.size(); i++)
-                    {
-                        os << fmt::format(fcn::SIGNAL, signals[i].x, signals[i].y, signals[i].z);
-                    }
-                    os << fcn::CLOSE_INCOMING;
+                    write_fgl_element(os, gate_id, type, "", coord, signals);
                 }
-                os << fcn::CLOSE_GATE;
+
                 gate_id++;
             });
 
@@ -54,38 +54,6 @@ struct write_operational_domain_params
     sample_writing_mode writing_mode = sample_writing_mode::ALL_SAMPLES;
 };
 
-namespace detail
-{
-
-/**
- * Converts a sweep parameter to a string representation. This is used to write the parameter name to the CSV file.
- *
- * @param param The sweep parameter to be converted.
- * @return The string representation of the sweep parameter.
- */
-[[nodiscard]] static inline std::string sweep_parameter_to_string(const sweep_parameter& param) noexcept
-{
-    switch (param)
-    {
-        case sweep_parameter::EPSILON_R:
-        {
-            return "epsilon_r";
-        }
-        case sweep_parameter::LAMBDA_TF:
-        {
-            return "lambda_tf";
-        }
-        case sweep_parameter::MU_MINUS:
-        {
-            return "mu_minus";
-        }
-    }
-
-    return "";
-}
-
-}  // namespace detail
-
 /**
  * Writes a CSV representation of an operational domain to the specified output stream. The data are written
  * as rows, each corresponding to one set of simulation parameters and their corresponding operational status.
@@ -19,7 +19,6 @@
 #include <ctime>
 #include <fstream>
 #include <ostream>
-#include <sstream>
 #include <string>
 #include <string_view>
 #include <unordered_map>
@@ -189,13 +188,13 @@ class write_sqd_layout_impl
 
     void run()
     {
-        std::stringstream header{}, gui{}, design{};
-
-        header << siqad::SQD_HEADER << siqad::OPEN_SIQAD;
+        // all blocks are written to the stream as soon as they are generated such that the memory overhead does not
+        // depend on the size of the layout
+        os << siqad::SQD_HEADER << siqad::OPEN_SIQAD;
 
         const auto time_str = fmt::format("{:%Y-%m-%d %H:%M:%S}", fmt::localtime(std::time(nullptr)));
 
-        header << fmt::format(siqad::PROGRAM_BLOCK, "layout simulation", FICTION_VERSION, FICTION_REPO, time_str);
+        os << fmt::format(siqad::PROGRAM_BLOCK, "layout simulation", FICTION_VERSION, FICTION_REPO, time_str);
 
         std::vector<const char*> active_layers{};
 
@@ -216,40 +215,36 @@ class write_sqd_layout_impl
             active_layers.push_back(siqad::DEFECT_LAYER_DEFINITION);
         }
 
-        design << fmt::format(siqad::LAYERS_BLOCK, fmt::join(active_layers, "")) << siqad::OPEN_DESIGN
-               << siqad::LATTICE_LAYER << siqad::MISC_LAYER;
+        os << fmt::format(siqad::LAYERS_BLOCK, fmt::join(active_layers, "")) << siqad::OPEN_DESIGN
+           << siqad::LATTICE_LAYER << siqad::MISC_LAYER;
 
-        design << siqad::OPEN_DB_LAYER;
-        generate_db_blocks(design);
-        design << siqad::CLOSE_DB_LAYER;
+        os << siqad::OPEN_DB_LAYER;
+        generate_db_blocks();
+        os << siqad::CLOSE_DB_LAYER;
 
         if constexpr (has_get_sidb_defect_v<Lyt>)
         {
-            design << siqad::OPEN_DEFECTS_LAYER;
-            generate_defect_blocks(design);
-            design << siqad::CLOSE_DEFECTS_LAYER;
+            os << siqad::OPEN_DEFECTS_LAYER;
+            generate_defect_blocks();
+            os << siqad::CLOSE_DEFECTS_LAYER;
         }
 
-        design << siqad::ELECTRODE_LAYER;
-
-        design << siqad::CLOSE_DESIGN;
+        os << siqad::ELECTRODE_LAYER;
 
-        os << header.str();
-        os << gui.str();
-        os << design.str();
+        os << siqad::CLOSE_DESIGN;
 
         os << siqad::CLOSE_SIQAD;
     }
 
   private:
-    Lyt lyt;
+    const Lyt& lyt;
 
     std::ostream& os;
 
-    void generate_db_blocks(std::stringstream& design) noexcept
+    void generate_db_blocks()
     {
         lyt.foreach_cell(
-            [this, &design](const auto& c)
+            [this](const auto& c)
             {
                 // generate SiDB cells
                 if constexpr (has_sidb_technology_v<Lyt>)
@@ -291,14 +286,14 @@ class write_sqd_layout_impl
 
                     if constexpr (has_siqad_coord_v<Lyt>)
                     {
-                        design << fmt::format(siqad::DBDOT_BLOCK, fmt::format(siqad::LATTICE_COORDINATE, c.x, c.y, c.z),
-                                              type_str, siqad::NORMAL_COLOR);
+                        os << fmt::format(siqad::DBDOT_BLOCK, fmt::format(siqad::LATTICE_COORDINATE, c.x, c.y, c.z),
+                                          type_str, siqad::NORMAL_COLOR);
                     }
                     else
                     {
                         const auto siqad_coord = fiction::siqad::to_siqad_coord(c);
 
-                        design << fmt::format(
+                        os << fmt::format(
                             siqad::DBDOT_BLOCK,
                             fmt::format(siqad::LATTICE_COORDINATE, siqad_coord.x, siqad_coord.y, siqad_coord.z),
                             type_str, siqad::NORMAL_COLOR);
@@ -334,23 +329,23 @@ class write_sqd_layout_impl
                     if (!qca_technology::is_const_1_cell(type))
                     {
                         // top left
-                        design << fmt::format(siqad::DBDOT_BLOCK,
-                                              fmt::format(siqad::LATTICE_COORDINATE, c.x * 14, c.y * 7, 0), "", color);
+                        os << fmt::format(siqad::DBDOT_BLOCK,
+                                          fmt::format(siqad::LATTICE_COORDINATE, c.x * 14, c.y * 7, 0), "", color);
                         // bottom right
-                        design << fmt::format(siqad::DBDOT_BLOCK,
-                                              fmt::format(siqad::LATTICE_COORDINATE, (c.x * 14) + 6, (c.y * 7) + 3, 0),
-                                              "", color);
+                        os << fmt::format(siqad::DBDOT_BLOCK,
+                                          fmt::format(siqad::LATTICE_COORDINATE, (c.x * 14) + 6, (c.y * 7) + 3, 0), "",
+                                          color);
                     }
                     if (!qca_technology::is_const_0_cell(type))
                     {
                         // top right
-                        design << fmt::format(siqad::DBDOT_BLOCK,
-                                              fmt::format(siqad::LATTICE_COORDINATE, (c.x * 14) + 6, c.y * 7, 0), "",
-                                              color);
+                        os << fmt::format(siqad::DBDOT_BLOCK,
+                                          fmt::format(siqad::LATTICE_COORDINATE, (c.x * 14) + 6, c.y * 7, 0), "",
+                                          color);
                         // bottom left
-                        design << fmt::format(siqad::DBDOT_BLOCK,
-                                              fmt::format(siqad::LATTICE_COORDINATE, c.x * 14, (c.y * 7) + 3, 0), "",
-                                              color);
+                        os << fmt::format(siqad::DBDOT_BLOCK,
+                                          fmt::format(siqad::LATTICE_COORDINATE, c.x * 14, (c.y * 7) + 3, 0), "",
+                                          color);
                     }
                 }
             });
@@ -362,12 +357,12 @@ class write_sqd_layout_impl
         return it == siqad::defect_type_to_name.cend() ? "Unknown" : it->second;
     }
 
-    void generate_defect_blocks(std::stringstream& design) noexcept
+    void generate_defect_blocks()
     {
         if constexpr (has_foreach_sidb_defect_v<Lyt>)
         {
             lyt.foreach_sidb_defect(
-                [&design](const auto& cd)
+                [this](const auto& cd)
                 {
                     const auto& defect = cd.second;
 
@@ -376,7 +371,7 @@ class write_sqd_layout_impl
                     {
                         const auto& cell = cd.first;
 
-                        design << fmt::format(
+                        os << fmt::format(
                             siqad::DEFECT_BLOCK, fmt::format(siqad::LATTICE_COORDINATE, cell.x, cell.y, cell.z),
                             is_charged_defect_type(defect) ?
                                 fmt::format(siqad::COULOMB, defect.charge, defect.epsilon_r, defect.lambda_tf) :
@@ -387,7 +382,7 @@ class write_sqd_layout_impl
                     {
                         const auto cell = fiction::siqad::to_siqad_coord(cd.first);
 
-                        design << fmt::format(
+                        os << fmt::format(
                             siqad::DEFECT_BLOCK, fmt::format(siqad::LATTICE_COORDINATE, cell.x, cell.y, cell.z),
                             is_charged_defect_type(defect) ?
                                 fmt::format(siqad::COULOMB, defect.charge, defect.epsilon_r, defect.lambda_tf) :
@@ -218,10 +218,13 @@ class write_sqd_sim_result_impl
     {
         os << siqad::OPEN_PHYSLOC;
 
+        // only the lattice type is relevant for the position calculation; hence, a single empty layout is sufficient
+        const Lyt lattice{};
+
         std::for_each(ordered_cells.cbegin(), ordered_cells.cend(),
-                      [this](const auto& c)
+                      [this, &lattice](const auto& c)
                       {
-                          const auto [nm_x, nm_y] = sidb_nm_position<Lyt>(Lyt{}, c);
+                          const auto [nm_x, nm_y] = sidb_nm_position<Lyt>(lattice, c);
                           os << fmt::format(siqad::DBDOT, nm_x * 10,
                                             nm_y * 10);  // convert nm to Angstrom
                       });
@@ -249,14 +252,17 @@ class write_sqd_sim_result_impl
         std::sort(ordered_surface_pointers.begin(), ordered_surface_pointers.end(), [](const auto& a, const auto& b)
                   { return a->get_electrostatic_potential_energy() < b->get_electrostatic_potential_energy(); });
 
+        // buffer that is reused for the charges of all surfaces to avoid an allocation per distribution
+        std::vector<sidb_charge_state> ordered_charges{};
+        ordered_charges.reserve(ordered_cells.size());
+
         // write the distributions to the output stream
         std::for_each(
             ordered_surface_pointers.cbegin(), ordered_surface_pointers.cend(),
-            [this](const auto& surface)
+            [this, &ordered_charges](const auto& surface)
             {
                 // obtain the charges in the same order as the cells
-                std::vector<sidb_charge_state> ordered_charges{};
-                ordered_charges.reserve(ordered_cells.size());
+                ordered_charges.clear();
 
                 std::for_each(ordered_cells.cbegin(), ordered_cells.cend(), [&ordered_charges, &surface](const auto& c)
                               { ordered_charges.push_back(surface->get_charge_state(c)); });
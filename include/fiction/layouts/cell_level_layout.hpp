@@ -11,6 +11,7 @@
 #include <mockturtle/networks/detail/foreach.hpp>
 #include <phmap.h>
 
+#include <cstddef>
 #include <cstdint>
 #include <memory>
 #include <string>
@@ -338,6 +339,16 @@ class cell_level_layout : public ClockedLayout
     {
         return static_cast<uint64_t>(strg->cell_type_map.size());
     }
+    /**
+     * Reserves storage for at least `n` cells such that assigning cell types to up to `n` cells does not trigger any
+     * rehashing. This is useful when large layouts are read from files.
+     *
+     * @param n Number of cells to reserve storage for.
+     */
+    void reserve_cells(const std::size_t n)
+    {
+        strg->cell_type_map.reserve(n);
+    }
     /**
      * Checks whether there are no cells assigned to the layout's coordinates.
      *
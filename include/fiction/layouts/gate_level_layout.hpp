@@ -7,6 +7,7 @@
 
 #include "fiction/algorithms/verification/design_rule_violations.hpp"
 #include "fiction/layouts/clocking_scheme.hpp"
+#include "fiction/layouts/coordinates.hpp"
 #include "fiction/traits.hpp"
 #include "fiction/utils/mockturtle_utils.hpp"
 #include "fiction/utils/range.hpp"
@@ -22,16 +23,335 @@
 #include <phmap.h>
 
 #include <algorithm>
+#include <cassert>
+#include <cstddef>
 #include <cstdint>
 #include <functional>
 #include <initializer_list>
+#include <limits>
 #include <memory>
+#include <optional>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
 namespace fiction
 {
 
+/**
+ * Storage policy for `gate_level_layout` that maps tiles to nodes and vice versa via hash maps. Memory consumption is
+ * proportional to the number of placed nodes, which makes this policy suitable for sparse or unbounded layouts. This is
+ * the default policy.
+ */
+struct sparse_tile_storage
+{
+    /**
+     * Bidirectional tile <-> node map.
+     *
+     * @tparam Node Node type.
+     * @tparam Signal Signal type, i.e., the 64-bit representation of a tile.
+     */
+    template <typename Node, typename Signal>
+    class map
+    {
+      public:
+        /**
+         * Standard constructor. Registers the two constant nodes.
+         *
+         * @param const0 Signal representation of the tile reserved for the `const0` node.
+         * @param const1 Signal representation of the tile reserved for the `const1` node.
+         */
+        map(const Signal const0, const Signal const1) :
+                tile_node_map{{const0, static_cast<Node>(0ull)}, {const1, static_cast<Node>(1ull)}},
+                node_tile_map{{static_cast<Node>(0ull), const0}, {static_cast<Node>(1ull), const1}}
+        {}
+        /**
+         * Fetches the node that is assigned to the given tile.
+         *
+         * @param s Tile in its signal representation.
+         * @return The node assigned to `s` or `std::nullopt` if there is none.
+         */
+        [[nodiscard]] std::optional<Node> find_node(const Signal s) const noexcept
+        {
+            if (const auto it = tile_node_map.find(s); it != tile_node_map.cend())
+            {
+                return it->second;
+            }
+
+            return std::nullopt;
+        }
+        /**
+         * Fetches the tile that the given node is assigned to.
+         *
+         * @param n Node.
+         * @return The tile `n` is assigned to in its signal representation or `std::nullopt` if there is none.
+         */
+        [[nodiscard]] std::optional<Signal> find_tile(const Node n) const noexcept
+        {
+            if (const auto it = node_tile_map.find(n); it != node_tile_map.cend())
+            {
+                return it->second;
+            }
+
+            return std::nullopt;
+        }
+        /**
+         * Assigns node `n` to tile `s`.
+         *
+         * @param s Tile in its signal representation.
+         * @param n Node.
+         */
+        void insert(const Signal s, const Node n)
+        {
+            tile_node_map[s] = n;
+            node_tile_map[n] = s;
+        }
+        /**
+         * Removes the assignment of node `n` to tile `s`.
+         *
+         * @param s Tile in its signal representation.
+         * @param n Node.
+         */
+        void erase(const Signal s, const Node n) noexcept
+        {
+            node_tile_map.erase(n);
+            tile_node_map.erase(s);
+        }
+        /**
+         * Hash maps do not depend on the layout dimensions. Therefore, this function does nothing.
+         */
+        template <typename AspectRatio>
+        void reserve([[maybe_unused]] const AspectRatio& ar) noexcept
+        {}
+        /**
+         * Reserves buckets for the given number of nodes in both maps such that they do not need to rehash while
+         * being filled.
+         *
+         * @param num_nodes Expected number of nodes.
+         */
+        void reserve_nodes(const std::size_t num_nodes)
+        {
+            tile_node_map.reserve(num_nodes);
+            node_tile_map.reserve(num_nodes);
+        }
+
+      private:
+        // these maps grow large! use parallel_flat_hashmap for better performance
+        phmap::parallel_flat_hash_map<Signal, Node> tile_node_map;
+        phmap::parallel_flat_hash_map<Node, Signal> node_tile_map;
+    };
+};
+/**
+ * Storage policy for `gate_level_layout` that maps tiles to nodes via a dense array that is indexed by the tiles'
+ * \f$(x, y, z)\f$-coordinates and nodes to tiles via a dense array that is indexed by the nodes. Lookups do not need to
+ * compute any hashes, which considerably speeds up algorithms that query tiles extensively, e.g., routing. Memory
+ * consumption is proportional to the layout area. Therefore, this policy is suitable for bounded layouts that are
+ * densely populated. The tile array is sized on `resize` and additionally grows geometrically whenever a node gets
+ * assigned to a tile outside its current bounds.
+ *
+ * This policy requires the tiles to be represented by `offset::ucoord_t`.
+ */
+struct dense_tile_storage
+{
+    /**
+     * Bidirectional tile <-> node map.
+     *
+     * @tparam Node Node type.
+     * @tparam Signal Signal type, i.e., the 64-bit representation of a tile.
+     */
+    template <typename Node, typename Signal>
+    class map
+    {
+      public:
+        /**
+         * Standard constructor. Registers the two constant nodes.
+         *
+         * @param c0 Signal representation of the tile reserved for the `const0` node.
+         * @param c1 Signal representation of the tile reserved for the `const1` node.
+         */
+        map(const Signal c0, const Signal c1) : const0{c0}, const1{c1}, node_tiles{c0, c1} {}
+        /**
+         * Fetches the node that is assigned to the given tile.
+         *
+         * @param s Tile in its signal representation.
+         * @return The node assigned to `s` or `std::nullopt` if there is none.
+         */
+        [[nodiscard]] std::optional<Node> find_node(const Signal s) const noexcept
+        {
+            if (s == const0)
+            {
+                return static_cast<Node>(0ull);
+            }
+            if (s == const1)
+            {
+                return static_cast<Node>(1ull);
+            }
+
+            const offset::ucoord_t t{static_cast<uint64_t>(s)};
+
+            if (t.is_dead() || !is_within_bounds(t))
+            {
+                return std::nullopt;
+            }
+
+            // node 0 is const0, which is never assigned to a grid tile; it is therefore used to mark empty tiles
+            if (const auto n = tile_nodes[index(t)]; n != static_cast<Node>(0ull))
+            {
+                return n;
+            }
+
+            return std::nullopt;
+        }
+        /**
+         * Fetches the tile that the given node is assigned to.
+         *
+         * @param n Node.
+         * @return The tile `n` is assigned to in its signal representation or `std::nullopt` if there is none.
+         */
+        [[nodiscard]] std::optional<Signal> find_tile(const Node n) const noexcept
+        {
+            if (static_cast<std::size_t>(n) < node_tiles.size() && node_tiles[n] != no_tile)
+            {
+                return node_tiles[n];
+            }
+
+            return std::nullopt;
+        }
+        /**
+         * Assigns node `n` to tile `s`. Grows the tile array if `s` lies outside its current bounds.
+         *
+         * @param s Tile in its signal representation. Must not be dead.
+         * @param n Node.
+         */
+        void insert(const Signal s, const Node n)
+        {
+            const offset::ucoord_t t{static_cast<uint64_t>(s)};
+
+            assert(!t.is_dead() && "dead tiles cannot be stored in the dense tile array");
+
+            if (!is_within_bounds(t))
+            {
+                // grow only the exceeded dimensions, geometrically to amortize the cost of repeated growth
+                grow(t.x < width ? width : std::max(static_cast<uint64_t>(t.x) + 1, 2 * width),
+                     t.y < height ? height : std::max(static_cast<uint64_t>(t.y) + 1, 2 * height),
+                     t.z < depth ? depth : static_cast<uint64_t>(t.z) + 1);
+            }
+
+            tile_nodes[index(t)] = n;
+
+            if (static_cast<std::size_t>(n) >= node_tiles.size())
+            {
+                node_tiles.resize(std::max(static_cast<std::size_t>(n) + 1, 2 * node_tiles.size()), no_tile);
+            }
+
+            node_tiles[n] = s;
+        }
+        /**
+         * Removes the assignment of node `n` to tile `s`.
+         *
+         * @param s Tile in its signal representation.
+         * @param n Node.
+         */
+        void erase(const Signal s, const Node n) noexcept
+        {
+            if (const offset::ucoord_t t{static_cast<uint64_t>(s)}; !t.is_dead() && is_within_bounds(t))
+            {
+                tile_nodes[index(t)] = static_cast<Node>(0ull);
+            }
+
+            if (static_cast<std::size_t>(n) < node_tiles.size())
+            {
+                node_tiles[n] = no_tile;
+            }
+        }
+        /**
+         * Grows the tile array such that it covers the given aspect ratio. Never shrinks the array because nodes might
+         * still be assigned to tiles outside the given aspect ratio.
+         *
+         * @tparam AspectRatio Aspect ratio type.
+         * @param ar Highest possible position in the layout.
+         */
+        template <typename AspectRatio>
+        void reserve(const AspectRatio& ar)
+        {
+            if (static_cast<uint64_t>(ar.x) >= width || static_cast<uint64_t>(ar.y) >= height ||
+                static_cast<uint64_t>(ar.z) >= depth)
+            {
+                grow(static_cast<uint64_t>(ar.x) + 1, static_cast<uint64_t>(ar.y) + 1, static_cast<uint64_t>(ar.z) + 1);
+            }
+        }
+        /**
+         * Pre-allocates the node array for the given number of nodes such that it does not need to grow while being
+         * filled.
+         *
+         * @param num_nodes Expected number of nodes.
+         */
+        void reserve_nodes(const std::size_t num_nodes)
+        {
+            if (num_nodes > node_tiles.size())
+            {
+                node_tiles.resize(num_nodes, no_tile);
+            }
+        }
+
+      private:
+        /**
+         * Signal representations of the constant tiles.
+         */
+        Signal const0, const1;
+        /**
+         * Dimensions of the tile array.
+         */
+        uint64_t width{0ull}, height{0ull}, depth{0ull};
+        /**
+         * Tile array indexed by \f$(z \cdot height + y) \cdot width + x\f$ holding the node that is assigned to each
+         * tile or 0 if the tile is empty.
+         */
+        std::vector<Node> tile_nodes{};
+        /**
+         * Node array holding the tile that each node is assigned to or `no_tile` if it is not assigned.
+         */
+        std::vector<Signal> node_tiles;
+        /**
+         * Marks nodes that are not assigned to any tile.
+         */
+        static constexpr Signal no_tile = std::numeric_limits<Signal>::max();
+
+        [[nodiscard]] bool is_within_bounds(const offset::ucoord_t& t) const noexcept
+        {
+            return t.x < width && t.y < height && t.z < depth;
+        }
+
+        [[nodiscard]] std::size_t index(const offset::ucoord_t& t) const noexcept
+        {
+            return static_cast<std::size_t>((t.z * height + t.y) * width + t.x);
+        }
+        /**
+         * Re-allocates the tile array with at least the given dimensions and transfers all stored assignments.
+         */
+        void grow(const uint64_t new_width, const uint64_t new_height, const uint64_t new_depth)
+        {
+            const auto w = std::max(width, new_width), h = std::max(height, new_height), d = std::max(depth, new_depth);
+
+            std::vector<Node> grown(static_cast<std::size_t>(w * h * d), static_cast<Node>(0ull));
+
+            for (uint64_t z = 0; z < depth; ++z)
+            {
+                for (uint64_t y = 0; y < height; ++y)
+                {
+                    std::copy_n(tile_nodes.cbegin() + static_cast<std::ptrdiff_t>((z * height + y) * width), width,
+                                grown.begin() + static_cast<std::ptrdiff_t>((z * h + y) * w));
+                }
+            }
+
+            tile_nodes = std::move(grown);
+            width      = w;
+            height     = h;
+            depth      = d;
+        }
+    };
+};
+
 /**
  * A layout type to layer on top of a clocked layout that allows the assignment of gates to clock zones (aka tiles in
  * this context). This class represents a gate-level FCN layout and, thus, adds a notion of Boolean logic. The
@@ -71,13 +391,18 @@ namespace fiction
  * - nodes can be moved via the `move_node` function. This function can also be used to update their children, i.e.,
  * incoming signals.
  *
+ * - the mapping between tiles and nodes is realized by the `TileStorage` policy. By default, hash maps are used
+ * (`sparse_tile_storage`). For bounded, densely populated layouts, `dense_tile_storage` avoids hashing by using arrays
+ * indexed by coordinates and nodes, respectively.
+ *
  * Most implementation details regarding `mockturtle`-specific functions are borrowed from
  * `mockturtle/networks/klut.hpp`. Therefore, `mockturtle` API functions are only sporadically documented where their
  * behavior might differ. Information on their functionality can be found in `mockturtle`'s docs.
  *
  * @tparam ClockedLayout The clocked layout that is to be extended by gate functions.
+ * @tparam TileStorage Storage policy for the mapping between tiles and nodes.
  */
-template <typename ClockedLayout>
+template <typename ClockedLayout, typename TileStorage = sparse_tile_storage>
 class gate_level_layout : public ClockedLayout
 {
   public:
@@ -85,6 +410,9 @@ class gate_level_layout : public ClockedLayout
 
     using tile = typename ClockedLayout::clock_zone;
 
+    static_assert(!std::is_same_v<TileStorage, dense_tile_storage> || std::is_same_v<tile, offset::ucoord_t>,
+                  "dense_tile_storage requires tiles to be of type offset::ucoord_t");
+
     template <typename Node, typename Tile>
     struct gate_level_layout_storage_data
     {
@@ -93,11 +421,7 @@ class gate_level_layout : public ClockedLayout
         const Tile const0{0x8000000000000000ull};
         const Tile const1{0xc000000000000000ull};
 
-        // these maps grow large! use parallel_flat_hashmap for better performance
-        phmap::parallel_flat_hash_map<Tile, Node> tile_node_map{
-            {{const0, static_cast<Node>(0ull)}, {const1, static_cast<Node>(1ull)}}};
-        phmap::parallel_flat_hash_map<Node, Tile> node_tile_map{
-            {{static_cast<Node>(0ull), const0}, {static_cast<Node>(1ull), const1}}};
+        typename TileStorage::template map<Node, Tile> tile_node_map{const0, const1};
 
         uint32_t num_gates     = 0ull;
         uint32_t num_wires     = 0ull;
@@ -157,6 +481,7 @@ class gate_level_layout : public ClockedLayout
 
         initialize_truth_table_cache();
         strg->data.layout_name = name;
+        strg->data.tile_node_map.reserve(ar);
     }
     /**
      * Standard constructor. Creates a gate-level layout of the given aspect ratio and clocks it via the given clocking
@@ -176,6 +501,7 @@ class gate_level_layout : public ClockedLayout
 
         initialize_truth_table_cache();
         strg->data.layout_name = name;
+        strg->data.tile_node_map.reserve(ar);
     }
     /**
      * Copy constructor from another layout's storage.
@@ -210,6 +536,56 @@ class gate_level_layout : public ClockedLayout
     {
         static_assert(is_clocked_layout_v<ClockedLayout>, "ClockedLayout is not a clocked layout type");
     }
+    /**
+     * Converting constructor from a gate-level layout that realizes its tile <-> node mapping via a different storage
+     * policy. Creates a deep copy of `other` whose nodes keep their indices, functions, children, names, and tiles.
+     * Events are not copied.
+     *
+     * @tparam OtherTileStorage Tile storage policy of `other`.
+     * @param other Gate-level layout to convert.
+     */
+    template <typename OtherTileStorage, typename = std::enable_if_t<!std::is_same_v<OtherTileStorage, TileStorage>>>
+    explicit gate_level_layout(const gate_level_layout<ClockedLayout, OtherTileStorage>& other) :
+            ClockedLayout(static_cast<const ClockedLayout&>(other).clone()),
+            strg{std::make_shared<gate_level_layout_storage>()},
+            evnts{std::make_shared<typename event_storage::element_type>()}
+    {
+        static_assert(is_clocked_layout_v<ClockedLayout>, "ClockedLayout is not a clocked layout type");
+
+        const auto& other_strg = *other.strg;
+
+        strg->nodes.clear();
+        strg->nodes.reserve(other_strg.nodes.size());
+        for (const auto& n : other_strg.nodes)
+        {
+            // both node types only differ in their enclosing layout type
+            static_cast<mockturtle::mixed_fanin_node<2>&>(strg->nodes.emplace_back()) = n;
+        }
+
+        strg->inputs  = other_strg.inputs;
+        strg->outputs = other_strg.outputs;
+
+        strg->data.fn_cache      = other_strg.data.fn_cache;
+        strg->data.num_gates     = other_strg.data.num_gates;
+        strg->data.num_wires     = other_strg.data.num_wires;
+        strg->data.num_crossings = other_strg.data.num_crossings;
+        strg->data.trav_id       = other_strg.data.trav_id;
+        strg->data.layout_name   = other_strg.data.layout_name;
+        strg->data.node_names    = other_strg.data.node_names;
+
+        strg->data.tile_node_map.reserve(
+            typename ClockedLayout::aspect_ratio{ClockedLayout::x(), ClockedLayout::y(), ClockedLayout::z()});
+        strg->data.tile_node_map.reserve_nodes(strg->nodes.size());
+
+        // the constants are registered by the tile storage itself
+        for (auto n = static_cast<node>(2ul); n < static_cast<node>(strg->nodes.size()); ++n)
+        {
+            if (const auto t = other_strg.data.tile_node_map.find_tile(n); t.has_value())
+            {
+                strg->data.tile_node_map.insert(*t, n);
+            }
+        }
+    }
     /**
      * Clones the layout returning a deep copy.
      *
@@ -223,6 +599,30 @@ class gate_level_layout : public ClockedLayout
 
         return copy;
     }
+    /**
+     * Updates the layout's dimensions. To this end, it calls `ClockedLayout`'s resize function. Additionally, the tile
+     * storage is informed about the new dimensions such that a dense storage policy can pre-allocate its arrays.
+     *
+     * @param ar New highest possible position in the layout.
+     */
+    void resize(const typename ClockedLayout::aspect_ratio& ar)
+    {
+        ClockedLayout::resize(ar);
+        strg->data.tile_node_map.reserve(ar);
+    }
+    /**
+     * Reserves storage for the given number of nodes including the two constants. As long as the layout does not
+     * exceed this number of nodes, creating new ones neither re-allocates the node storage nor rehashes the tile
+     * storage. This avoids peaks in memory consumption when large layouts are constructed whose number of nodes is
+     * known in advance.
+     *
+     * @param num_nodes Expected number of nodes.
+     */
+    void reserve_nodes(const std::size_t num_nodes)
+    {
+        strg->nodes.reserve(num_nodes);
+        strg->data.tile_node_map.reserve_nodes(num_nodes);
+    }
 
 #pragma endregion
 
@@ -642,12 +1042,7 @@ class gate_level_layout : public ClockedLayout
      */
     [[nodiscard]] node get_node(const signal& s) const noexcept
     {
-        if (const auto it = strg->data.tile_node_map.find(s); it != strg->data.tile_node_map.cend())
-        {
-            return it->second;
-        }
-
-        return 0;
+        return strg->data.tile_node_map.find_node(s).value_or(0);
     }
     /**
      * Fetches the node that is placed onto the provided tile If no node is placed there, the `const0` node is returned.
@@ -668,9 +1063,9 @@ class gate_level_layout : public ClockedLayout
      */
     [[nodiscard]] tile get_tile(const node n) const noexcept
     {
-        if (auto it = strg->data.node_tile_map.find(n); it != strg->data.node_tile_map.cend())
+        if (const auto s = strg->data.tile_node_map.find_tile(n); s.has_value())
         {
-            return static_cast<tile>(it->second);
+            return static_cast<tile>(*s);
         }
 
         return {};
@@ -774,9 +1169,9 @@ class gate_level_layout : public ClockedLayout
      */
     void clear_tile(const tile& t) noexcept
     {
-        if (const auto it = strg->data.tile_node_map.find(static_cast<signal>(t)); it != strg->data.tile_node_map.end())
+        if (const auto found = strg->data.tile_node_map.find_node(static_cast<signal>(t)); found.has_value())
         {
-            const auto n = it->second;
+            const auto n = *found;
 
             if (!t.is_dead())
             {
@@ -815,10 +1210,8 @@ class gate_level_layout : public ClockedLayout
             // mark node as dead
             kill_node(n);
 
-            // remove node-tile
-            strg->data.node_tile_map.erase(n);
-            // remove tile-node
-            strg->data.tile_node_map.erase(it);
+            // remove node-tile and tile-node
+            strg->data.tile_node_map.erase(static_cast<signal>(t), n);
         }
     }
     /**
@@ -1665,6 +2058,9 @@ class gate_level_layout : public ClockedLayout
     template <typename>
     friend class detail::gate_level_drvs_impl;
 
+    template <typename, typename>
+    friend class gate_level_layout;
+
     inline void initialize_truth_table_cache()
     {
         /* reserve the second node for constant 1 */
@@ -1702,9 +2098,7 @@ class gate_level_layout : public ClockedLayout
         {
             clear_tile(t);
 
-            strg->data.tile_node_map[static_cast<signal>(t)] = n;
-
-            strg->data.node_tile_map[n] = static_cast<signal>(t);
+            strg->data.tile_node_map.insert(static_cast<signal>(t), n);
 
             // keep track of number of gates and wire segments
             if (is_wire(n))
@@ -1778,6 +2172,34 @@ class gate_level_layout : public ClockedLayout
         return std::find(node_data.children.cbegin(), node_data.children.cend(), s) != node_data.children.cend();
     }
 };
+/**
+ * Determines the `gate_level_layout` type that is equal to `Lyt` except for its tile storage policy, which is replaced
+ * by `TileStorage`. If `Lyt` is not a `gate_level_layout` or its tiles do not support `TileStorage`, i.e.,
+ * `TileStorage` is `dense_tile_storage` but the tiles are not of type `offset::ucoord_t`, `Lyt` is kept as is.
+ *
+ * Layouts of the original and the resulting type can be converted into each other via `gate_level_layout`'s converting
+ * constructor.
+ *
+ * @tparam Lyt Gate-level layout type.
+ * @tparam TileStorage Desired tile storage policy.
+ */
+template <typename Lyt, typename TileStorage>
+struct with_tile_storage
+{
+    using type = Lyt;
+};
+
+template <typename ClockedLayout, typename OldTileStorage, typename TileStorage>
+struct with_tile_storage<gate_level_layout<ClockedLayout, OldTileStorage>, TileStorage>
+{
+    using type = std::conditional_t<!std::is_same_v<TileStorage, dense_tile_storage> ||
+                                        std::is_same_v<typename ClockedLayout::clock_zone, offset::ucoord_t>,
+                                    gate_level_layout<ClockedLayout, TileStorage>,
+                                    gate_level_layout<ClockedLayout, OldTileStorage>>;
+};
+
+template <typename Lyt, typename TileStorage>
+using with_tile_storage_t = typename with_tile_storage<Lyt, TileStorage>::type;
 
 }  // namespace fiction
 
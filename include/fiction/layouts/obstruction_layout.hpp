@@ -69,6 +69,18 @@ class obstruction_layout<Lyt, false> : public Lyt
     {
         static_assert(is_coordinate_layout_v<Lyt>, "Lyt is not a coordinate layout");
     }
+    /**
+     * Clones the layout returning a deep copy. Both the underlying layout and the obstructions are copied.
+     *
+     * @return Deep copy of the layout.
+     */
+    [[nodiscard]] obstruction_layout clone() const noexcept
+    {
+        obstruction_layout copy{Lyt::clone()};
+        copy.obstr_strg = std::make_shared<obstruction_layout_storage>(*obstr_strg);
+
+        return copy;
+    }
     /**
      * Marks the given coordinate as obstructed.
      *
@@ -656,11 +656,13 @@ class charge_distribution_surface<Lyt, false> : public Lyt
         return sidb_charge_state::NONE;
     }
     /**
-     * This function returns all SiDB charges of the placed SiDBs as a vector.
+     * This function returns all SiDB charges of the placed SiDBs as a vector. The charge states are ordered in the same
+     * way as the SiDBs are indexed, i.e., the charge state at position `i` belongs to the SiDB returned by
+     * `index_to_cell(i)`.
      *
      * @return Vector of SiDB charge states.
      */
-    [[maybe_unused]] [[nodiscard]] std::vector<sidb_charge_state> get_all_sidb_charges() const noexcept
+    [[maybe_unused]] [[nodiscard]] const std::vector<sidb_charge_state>& get_all_sidb_charges() const noexcept
     {
         return strg->cell_charge;
     }
@@ -911,6 +913,17 @@ class charge_distribution_surface<Lyt, false> : public Lyt
         }
         return std::nullopt;
     }
+    /**
+     * This function returns the local electrostatic potentials at all SiDB positions in Volt (unit: V). The potentials
+     * are ordered in the same way as the SiDBs are indexed. The vector is empty if the local potentials have not been
+     * computed yet.
+     *
+     * @return Vector of local electrostatic potentials (unit: V).
+     */
+    [[nodiscard]] const std::vector<double>& get_all_local_potentials() const noexcept
+    {
+        return strg->local_pot;
+    }
     /**
      * This function allows the local electrostatic potential for some given index position to be set externally.
      *
@@ -184,6 +184,16 @@ class sidb_defect_surface<Lyt, false> : public Lyt
     {
         return strg->defective_coordinates.size();
     }
+    /**
+     * Reserves storage for at least `n` defective coordinates such that assigning up to `n` defects does not trigger
+     * any rehashing. This is useful when large surfaces are read from files.
+     *
+     * @param n Number of defective coordinates to reserve storage for.
+     */
+    void reserve_sidb_defects(const std::size_t n)
+    {
+        strg->defective_coordinates.reserve(n);
+    }
     /**
      * Number of positively charged defects on the surface.
      *
@@ -16,6 +16,7 @@
 
 #include <mockturtle/traits.hpp>
 
+#include <cstddef>
 #include <cstdint>
 #include <string>
 #include <type_traits>
@@ -655,6 +656,19 @@ template <class Lyt>
 inline constexpr bool has_foreach_cell_v = has_foreach_cell<Lyt>::value;
 #pragma endregion
 
+#pragma region has_reserve_cells
+template <class Lyt, class = void>
+struct has_reserve_cells : std::false_type
+{};
+
+template <class Lyt>
+struct has_reserve_cells<Lyt, std::void_t<decltype(std::declval<Lyt>().reserve_cells(std::size_t()))>> : std::true_type
+{};
+
+template <class Lyt>
+inline constexpr bool has_reserve_cells_v = has_reserve_cells<Lyt>::value;
+#pragma endregion
+
 #pragma region has_set_layout_name
 template <class Ntk, class = void>
 struct has_set_layout_name : std::false_type
@@ -804,6 +818,20 @@ template <class Lyt>
 inline constexpr bool has_foreach_sidb_defect_v = has_foreach_sidb_defect<Lyt>::value;
 #pragma endregion
 
+#pragma region has_reserve_sidb_defects
+template <class Lyt, class = void>
+struct has_reserve_sidb_defects : std::false_type
+{};
+
+template <class Lyt>
+struct has_reserve_sidb_defects<Lyt, std::void_t<decltype(std::declval<Lyt>().reserve_sidb_defects(std::size_t()))>>
+        : std::true_type
+{};
+
+template <class Lyt>
+inline constexpr bool has_reserve_sidb_defects_v = has_reserve_sidb_defects<Lyt>::value;
+#pragma endregion
+
 /**
  * SiDB simulation domain
  */
@@ -0,0 +1,148 @@
+//
+// Created by marcel on 19.10.26.
+//
+
+#ifndef FICTION_MEMORY_MAPPED_FILE_HPP
+#define FICTION_MEMORY_MAPPED_FILE_HPP
+
+#include <cstddef>
+#include <fstream>
+#include <ios>
+#include <iterator>
+#include <string>
+#include <string_view>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace fiction
+{
+
+/**
+ * A read-only view of the contents of a file. On POSIX systems, regular files are memory-mapped such that their
+ * contents do not have to be copied into a buffer before they are parsed. This avoids reading files of several
+ * gigabytes into memory at once. On other platforms and for non-regular files, e.g., pipes, the contents are read into
+ * an internal buffer instead.
+ */
+class memory_mapped_file
+{
+  public:
+    /**
+     * Opens the given file and maps its contents into memory.
+     *
+     * @param filename The name of the file to open.
+     * @throws std::ifstream::failure if the file could not be opened or mapped.
+     */
+    explicit memory_mapped_file(const std::string_view& filename)
+    {
+        const std::string name{filename};
+
+#if defined(__unix__) || defined(__APPLE__)
+        const int fd = ::open(name.c_str(), O_RDONLY);
+
+        if (fd == -1)
+        {
+            throw std::ifstream::failure("could not open file");
+        }
+
+        struct stat file_status{};
+
+        if (::fstat(fd, &file_status) == -1)
+        {
+            ::close(fd);
+            throw std::ifstream::failure("could not determine the file size");
+        }
+
+        if (S_ISREG(file_status.st_mode))
+        {
+            mapping_size = static_cast<std::size_t>(file_status.st_size);
+
+            // mapping an empty file is not allowed
+            if (mapping_size > 0)
+            {
+                void* address = ::mmap(nullptr, mapping_size, PROT_READ, MAP_PRIVATE, fd, 0);
+
+                if (address == MAP_FAILED)
+                {
+                    ::close(fd);
+                    throw std::ifstream::failure("could not map file into memory");
+                }
+
+                // the file is usually parsed front to back
+                ::madvise(address, mapping_size, MADV_SEQUENTIAL);
+
+                mapping = static_cast<const char*>(address);
+            }
+
+            // the mapping remains valid after the file descriptor has been closed
+            ::close(fd);
+
+            return;
+        }
+
+        ::close(fd);
+#endif
+
+        std::ifstream is{name, std::ios::in | std::ios::binary};
+
+        if (!is.is_open())
+        {
+            throw std::ifstream::failure("could not open file");
+        }
+
+        buffer.assign(std::istreambuf_iterator<char>{is}, std::istreambuf_iterator<char>{});
+    }
+    /**
+     * Destructor. Unmaps the file.
+     */
+    ~memory_mapped_file()
+    {
+#if defined(__unix__) || defined(__APPLE__)
+        if (mapping != nullptr)
+        {
+            ::munmap(const_cast<char*>(mapping), mapping_size);  // NOLINT(cppcoreguidelines-pro-type-const-cast)
+        }
+#endif
+    }
+
+    memory_mapped_file(const memory_mapped_file&)            = delete;
+    memory_mapped_file& operator=(const memory_mapped_file&) = delete;
+    memory_mapped_file(memory_mapped_file&&)                 = delete;
+    memory_mapped_file& operator=(memory_mapped_file&&)      = delete;
+    /**
+     * Returns a view of the contents of the file. The view is valid as long as this object exists.
+     *
+     * @return A view of the contents of the file.
+     */
+    [[nodiscard]] std::string_view view() const noexcept
+    {
+        if (mapping != nullptr)
+        {
+            return {mapping, mapping_size};
+        }
+
+        return buffer;
+    }
+
+  private:
+    /**
+     * Start of the memory-mapped file contents or `nullptr` if the file is not mapped.
+     */
+    const char* mapping{nullptr};
+    /**
+     * Size of the memory-mapped region in bytes.
+     */
+    std::size_t mapping_size{0};
+    /**
+     * File contents if the file could not be mapped.
+     */
+    std::string buffer{};
+};
+
+}  // namespace fiction
+
+#endif  // FICTION_MEMORY_MAPPED_FILE_HPP
@@ -0,0 +1,701 @@
+//
+// Created by marcel on 19.10.26.
+//
+
+#ifndef FICTION_PERFORMANCE_PROFILE_HPP
+#define FICTION_PERFORMANCE_PROFILE_HPP
+
+#include <fmt/format.h>
+#include <mockturtle/utils/stopwatch.hpp>
+#include <nlohmann/json.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <functional>
+#include <iostream>
+#include <limits>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <optional>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <utility>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/resource.h>
+#endif
+
+namespace fiction
+{
+
+/**
+ * Process-wide allocation counters. They are only updated by `tracking_allocator` and, if enabled via
+ * `FICTION_TRACK_GLOBAL_ALLOCATIONS`, by the global `operator new` and `operator delete`.
+ */
+struct allocation_counters
+{
+    /**
+     * Number of allocations.
+     */
+    std::atomic<uint64_t> num_allocations{0};
+    /**
+     * Number of deallocations.
+     */
+    std::atomic<uint64_t> num_deallocations{0};
+    /**
+     * Total number of allocated bytes.
+     */
+    std::atomic<uint64_t> bytes_allocated{0};
+};
+/**
+ * Returns the process-wide allocation counters.
+ *
+ * @return Reference to the allocation counters.
+ */
+[[nodiscard]] inline allocation_counters& global_allocation_counters() noexcept
+{
+    static allocation_counters counters{};
+
+    return counters;
+}
+/**
+ * Records an allocation of the given size in the process-wide allocation counters.
+ *
+ * @param size Number of allocated bytes.
+ */
+inline void record_allocation(const std::size_t size) noexcept
+{
+    auto& counters = global_allocation_counters();
+
+    counters.num_allocations.fetch_add(1, std::memory_order_relaxed);
+    counters.bytes_allocated.fetch_add(size, std::memory_order_relaxed);
+}
+/**
+ * Records a deallocation in the process-wide allocation counters.
+ */
+inline void record_deallocation() noexcept
+{
+    global_allocation_counters().num_deallocations.fetch_add(1, std::memory_order_relaxed);
+}
+/**
+ * An allocator that forwards to `std::allocator` and records all allocations in the process-wide allocation counters.
+ * It can be used to track the allocations of individual containers without replacing the global `operator new`.
+ *
+ * @tparam T Type of the allocated objects.
+ */
+template <typename T>
+class tracking_allocator
+{
+  public:
+    using value_type = T;
+
+    tracking_allocator() noexcept = default;
+
+    template <typename U>
+    explicit tracking_allocator(const tracking_allocator<U>& /* other */) noexcept
+    {}
+    /**
+     * Allocates storage for `n` objects of type `T`.
+     *
+     * @param n Number of objects.
+     * @return Pointer to the allocated storage.
+     */
+    [[nodiscard]] T* allocate(const std::size_t n)
+    {
+        T* ptr = std::allocator<T>{}.allocate(n);
+
+        record_allocation(n * sizeof(T));
+
+        return ptr;
+    }
+    /**
+     * Deallocates storage that was obtained from `allocate`.
+     *
+     * @param ptr Pointer to the storage.
+     * @param n Number of objects that was passed to `allocate`.
+     */
+    void deallocate(T* ptr, const std::size_t n) noexcept
+    {
+        record_deallocation();
+
+        std::allocator<T>{}.deallocate(ptr, n);
+    }
+
+    template <typename U>
+    bool operator==(const tracking_allocator<U>& /* other */) const noexcept
+    {
+        return true;
+    }
+
+    template <typename U>
+    bool operator!=(const tracking_allocator<U>& /* other */) const noexcept
+    {
+        return false;
+    }
+};
+/**
+ * Returns the peak resident set size of the current process, i.e., the maximum amount of physical memory it has
+ * occupied so far.
+ *
+ * @return Peak resident set size in bytes, or `std::nullopt` if it cannot be determined on this platform.
+ */
+[[nodiscard]] inline std::optional<uint64_t> peak_resident_set_size() noexcept
+{
+#if defined(__unix__) || defined(__APPLE__)
+    rusage usage{};
+
+    if (::getrusage(RUSAGE_SELF, &usage) == 0)
+    {
+#if defined(__APPLE__)
+        // macOS reports bytes
+        return static_cast<uint64_t>(usage.ru_maxrss);
+#else
+        // Linux and BSD report kibibytes
+        return static_cast<uint64_t>(usage.ru_maxrss) * 1024u;
+#endif
+    }
+#endif
+
+    return std::nullopt;
+}
+/**
+ * A lightweight profile of an algorithm's execution that can be attached to its statistics. It records the time spent
+ * in named phases, named event counters, and the memory usage of the process.
+ *
+ * All member functions are thread-safe such that worker threads of parallel algorithms can report to the same profile.
+ * Since the profile is locked on every update, phase timers and counters are meant to be used at the granularity of
+ * algorithm phases and not inside of tight loops.
+ *
+ * Phases and counters are reported in lexicographical order of their names.
+ */
+class performance_profile
+{
+  public:
+    /**
+     * Duration type used for phase times.
+     */
+    using duration = mockturtle::stopwatch<>::duration;
+    /**
+     * Accumulated time and number of executions of a phase.
+     */
+    struct phase
+    {
+        /**
+         * Total time spent in the phase.
+         */
+        duration time{0};
+        /**
+         * Number of times the phase was executed.
+         */
+        uint64_t num_calls{0};
+    };
+    /**
+     * Memory usage during a tracked scope.
+     */
+    struct memory_usage
+    {
+        /**
+         * Peak resident set size of the process in bytes at the end of the scope. Since the operating system only
+         * reports the peak of the whole process, this includes everything that happened before the scope.
+         */
+        std::optional<uint64_t> peak_resident_set_size{};
+        /**
+         * Number of allocations during the scope. Only counted if allocation tracking is enabled.
+         */
+        uint64_t num_allocations{0};
+        /**
+         * Number of deallocations during the scope. Only counted if allocation tracking is enabled.
+         */
+        uint64_t num_deallocations{0};
+        /**
+         * Number of bytes allocated during the scope. Only counted if allocation tracking is enabled.
+         */
+        uint64_t bytes_allocated{0};
+    };
+    /**
+     * Measures the time between its construction and its destruction and adds it to a phase of a profile.
+     */
+    class phase_timer
+    {
+      public:
+        /**
+         * Starts measuring the given phase.
+         *
+         * @param p Profile to report to.
+         * @param n Name of the phase.
+         */
+        phase_timer(performance_profile& p, std::string n) :
+                profile{p},
+                name{std::move(n)},
+                start{std::chrono::steady_clock::now()}
+        {}
+        /**
+         * Stops measuring and adds the elapsed time to the phase.
+         */
+        ~phase_timer()
+        {
+            profile.add_phase_time(name, std::chrono::steady_clock::now() - start);
+        }
+
+        phase_timer(const phase_timer&)            = delete;
+        phase_timer(phase_timer&&)                 = delete;
+        phase_timer& operator=(const phase_timer&) = delete;
+        phase_timer& operator=(phase_timer&&)      = delete;
+
+      private:
+        /**
+         * Profile to report to.
+         */
+        performance_profile& profile;
+        /**
+         * Name of the phase.
+         */
+        const std::string name;
+        /**
+         * Point in time at which the measurement started.
+         */
+        const std::chrono::steady_clock::time_point start;
+    };
+    /**
+     * Records the memory usage between its construction and its destruction in a profile.
+     */
+    class memory_tracker
+    {
+      public:
+        /**
+         * Takes a snapshot of the allocation counters.
+         *
+         * @param p Profile to report to.
+         */
+        explicit memory_tracker(performance_profile& p) noexcept :
+                profile{p},
+                num_allocations{global_allocation_counters().num_allocations.load(std::memory_order_relaxed)},
+                num_deallocations{global_allocation_counters().num_deallocations.load(std::memory_order_relaxed)},
+                bytes_allocated{global_allocation_counters().bytes_allocated.load(std::memory_order_relaxed)}
+        {}
+        /**
+         * Stores the peak resident set size and the allocations since construction in the profile.
+         */
+        ~memory_tracker()
+        {
+            const auto& counters = global_allocation_counters();
+
+            memory_usage usage{};
+            usage.peak_resident_set_size = peak_resident_set_size();
+            usage.num_allocations   = counters.num_allocations.load(std::memory_order_relaxed) - num_allocations;
+            usage.num_deallocations = counters.num_deallocations.load(std::memory_order_relaxed) - num_deallocations;
+            usage.bytes_allocated   = counters.bytes_allocated.load(std::memory_order_relaxed) - bytes_allocated;
+
+            profile.set_memory_usage(usage);
+        }
+
+        memory_tracker(const memory_tracker&)            = delete;
+        memory_tracker(memory_tracker&&)                 = delete;
+        memory_tracker& operator=(const memory_tracker&) = delete;
+        memory_tracker& operator=(memory_tracker&&)      = delete;
+
+      private:
+        /**
+         * Profile to report to.
+         */
+        performance_profile& profile;
+        /**
+         * Allocation counters at construction.
+         */
+        const uint64_t num_allocations, num_deallocations, bytes_allocated;
+    };
+    /**
+     * Standard constructor. Creates an empty profile.
+     */
+    performance_profile() = default;
+    /**
+     * Copy constructor.
+     *
+     * @param other Profile to copy.
+     */
+    performance_profile(const performance_profile& other)
+    {
+        const std::lock_guard lock{other.mutex};
+
+        phases   = other.phases;
+        counters = other.counters;
+        memory   = other.memory;
+    }
+    /**
+     * Copy assignment operator.
+     *
+     * @param other Profile to copy.
+     * @return Reference to this profile.
+     */
+    performance_profile& operator=(const performance_profile& other)
+    {
+        if (this != &other)
+        {
+            std::scoped_lock lock{mutex, other.mutex};
+
+            phases   = other.phases;
+            counters = other.counters;
+            memory   = other.memory;
+        }
+
+        return *this;
+    }
+
+    ~performance_profile() = default;
+    /**
+     * Starts measuring the given phase. The measurement ends when the returned timer is destroyed.
+     *
+     * @param name Name of the phase.
+     * @return Timer that measures the phase.
+     */
+    [[nodiscard]] phase_timer time_phase(std::string name)
+    {
+        return phase_timer{*this, std::move(name)};
+    }
+    /**
+     * Calls the given function and adds the time it takes to a phase, similar to `mockturtle::call_with_stopwatch`.
+     *
+     * @tparam Fn Functor type.
+     * @param name Name of the phase.
+     * @param fn Function to call.
+     * @return The return value of `fn`.
+     */
+    template <typename Fn>
+    decltype(auto) call_with_phase_timer(std::string name, Fn&& fn)
+    {
+        const phase_timer timer{*this, std::move(name)};
+
+        return std::forward<Fn>(fn)();
+    }
+    /**
+     * Starts tracking the memory usage. The tracking ends when the returned tracker is destroyed.
+     *
+     * @return Tracker that records the memory usage.
+     */
+    [[nodiscard]] memory_tracker track_memory() noexcept
+    {
+        return memory_tracker{*this};
+    }
+    /**
+     * Adds the given time to a phase.
+     *
+     * @param name Name of the phase.
+     * @param time Time to add.
+     * @param num_calls Number of executions of the phase that took `time` in total.
+     */
+    void add_phase_time(const std::string_view& name, const duration& time, const uint64_t num_calls = 1)
+    {
+        const std::lock_guard lock{mutex};
+
+        auto& p = find_or_insert(phases, name);
+        p.time += time;
+        p.num_calls += num_calls;
+    }
+    /**
+     * Increments a counter.
+     *
+     * @param name Name of the counter.
+     * @param value Value to add.
+     */
+    void increment(const std::string_view& name, const uint64_t value = 1)
+    {
+        const std::lock_guard lock{mutex};
+
+        find_or_insert(counters, name) += value;
+    }
+    /**
+     * Stores the given memory usage.
+     *
+     * @param usage Memory usage to store.
+     */
+    void set_memory_usage(const memory_usage& usage)
+    {
+        const std::lock_guard lock{mutex};
+
+        memory = usage;
+    }
+    /**
+     * Returns the accumulated time and number of executions of a phase.
+     *
+     * @param name Name of the phase.
+     * @return The phase, or `std::nullopt` if it was never executed.
+     */
+    [[nodiscard]] std::optional<phase> get_phase(const std::string_view& name) const
+    {
+        const std::lock_guard lock{mutex};
+
+        if (const auto it = phases.find(name); it != phases.cend())
+        {
+            return it->second;
+        }
+
+        return std::nullopt;
+    }
+    /**
+     * Returns the value of a counter.
+     *
+     * @param name Name of the counter.
+     * @return Value of the counter, which is `0` if it was never incremented.
+     */
+    [[nodiscard]] uint64_t get_counter(const std::string_view& name) const
+    {
+        const std::lock_guard lock{mutex};
+
+        if (const auto it = counters.find(name); it != counters.cend())
+        {
+            return it->second;
+        }
+
+        return 0;
+    }
+    /**
+     * Returns the recorded memory usage.
+     *
+     * @return The memory usage, or `std::nullopt` if it was not tracked.
+     */
+    [[nodiscard]] std::optional<memory_usage> get_memory_usage() const
+    {
+        const std::lock_guard lock{mutex};
+
+        return memory;
+    }
+    /**
+     * Checks whether anything was recorded.
+     *
+     * @return `true` iff no phase, counter, or memory usage was recorded.
+     */
+    [[nodiscard]] bool empty() const
+    {
+        const std::lock_guard lock{mutex};
+
+        return phases.empty() && counters.empty() && !memory.has_value();
+    }
+    /**
+     * Adds all phases and counters of another profile to this one. If the other profile recorded a memory usage, it
+     * replaces the one of this profile. This is useful to combine the profiles of independent runs or threads.
+     *
+     * @param other Profile to merge into this one.
+     */
+    void merge(const performance_profile& other)
+    {
+        if (this == &other)
+        {
+            return;
+        }
+
+        std::scoped_lock lock{mutex, other.mutex};
+
+        for (const auto& [name, p] : other.phases)
+        {
+            auto& own = phases[name];
+            own.time += p.time;
+            own.num_calls += p.num_calls;
+        }
+        for (const auto& [name, value] : other.counters)
+        {
+            counters[name] += value;
+        }
+        if (other.memory.has_value())
+        {
+            memory = other.memory;
+        }
+    }
+    /**
+     * Prints the profile.
+     *
+     * @param out Output stream to write to.
+     */
+    void report(std::ostream& out = std::cout) const
+    {
+        const std::lock_guard lock{mutex};
+
+        for (const auto& [name, p] : phases)
+        {
+            out << fmt::format("[i] phase '{}': {:.4f} secs in {} call(s)\n", name, mockturtle::to_seconds(p.time),
+                               p.num_calls);
+        }
+        for (const auto& [name, value] : counters)
+        {
+            out << fmt::format("[i] counter '{}': {}\n", name, value);
+        }
+        if (memory.has_value())
+        {
+            if (memory->peak_resident_set_size.has_value())
+            {
+                out << fmt::format("[i] peak resident set size: {:.2f} MiB\n",
+                                   static_cast<double>(*memory->peak_resident_set_size) / (1024.0 * 1024.0));
+            }
+            if (memory->num_allocations > 0)
+            {
+                out << fmt::format("[i] allocations: {} ({} bytes), deallocations: {}\n", memory->num_allocations,
+                                   memory->bytes_allocated, memory->num_deallocations);
+            }
+        }
+    }
+    /**
+     * Converts a profile into JSON. Phases are mapped to objects containing their time in seconds and their number of
+     * calls, counters to integers, and the memory usage to an object. Empty sections are omitted.
+     *
+     * @param j JSON value to write to.
+     * @param profile Profile to convert.
+     */
+    friend void to_json(nlohmann::json& j, const performance_profile& profile)
+    {
+        const std::lock_guard lock{profile.mutex};
+
+        j = nlohmann::json::object();
+
+        if (!profile.phases.empty())
+        {
+            auto& phases_json = j["phases"];
+
+            for (const auto& [name, p] : profile.phases)
+            {
+                phases_json[name] = {{"time in seconds", mockturtle::to_seconds(p.time)}, {"calls", p.num_calls}};
+            }
+        }
+        if (!profile.counters.empty())
+        {
+            j["counters"] = profile.counters;
+        }
+        if (profile.memory.has_value())
+        {
+            auto& memory_json = j["memory"];
+
+            if (profile.memory->peak_resident_set_size.has_value())
+            {
+                memory_json["peak resident set size in bytes"] = *profile.memory->peak_resident_set_size;
+            }
+            if (profile.memory->num_allocations > 0)
+            {
+                memory_json["allocations"]     = profile.memory->num_allocations;
+                memory_json["deallocations"]   = profile.memory->num_deallocations;
+                memory_json["bytes allocated"] = profile.memory->bytes_allocated;
+            }
+        }
+    }
+
+  private:
+    /**
+     * Mutex that protects all members.
+     */
+    mutable std::mutex mutex{};
+    /**
+     * Phases by name.
+     */
+    std::map<std::string, phase, std::less<>> phases{};
+    /**
+     * Counters by name.
+     */
+    std::map<std::string, uint64_t, std::less<>> counters{};
+    /**
+     * Memory usage.
+     */
+    std::optional<memory_usage> memory{};
+    /**
+     * Returns the value with the given key and inserts a default-constructed one if it does not exist yet. Avoids
+     * constructing a `std::string` for keys that already exist.
+     *
+     * @tparam Map Map type with a transparent comparator.
+     * @param map Map to search.
+     * @param key Key to look up.
+     * @return Reference to the value.
+     */
+    template <typename Map>
+    static typename Map::mapped_type& find_or_insert(Map& map, const std::string_view& key)
+    {
+        if (const auto it = map.find(key); it != map.end())
+        {
+            return it->second;
+        }
+
+        return map.emplace(std::string{key}, typename Map::mapped_type{}).first->second;
+    }
+};
+
+namespace detail
+{
+
+/**
+ * Allocates memory for the global `operator new` and records the allocation.
+ *
+ * @param size Number of bytes to allocate.
+ * @return Pointer to the allocated memory.
+ * @throws std::bad_alloc if the allocation fails.
+ */
+inline void* tracked_malloc(std::size_t size)
+{
+    // operator new must return a unique pointer even for zero-sized allocations
+    if (size == 0)
+    {
+        size = 1;
+    }
+
+    if (void* ptr = std::malloc(size); ptr != nullptr)
+    {
+        record_allocation(size);
+
+        return ptr;
+    }
+
+    throw std::bad_alloc{};
+}
+/**
+ * Frees memory for the global `operator delete` and records the deallocation.
+ *
+ * @param ptr Pointer to the memory to free.
+ */
+inline void tracked_free(void* ptr) noexcept
+{
+    if (ptr != nullptr)
+    {
+        record_deallocation();
+
+        std::free(ptr);
+    }
+}
+
+}  // namespace detail
+
+}  // namespace fiction
+
+/**
+ * Replaces the global `operator new` and `operator delete` such that all allocations of the program are recorded in
+ * `fiction::global_allocation_counters()` and, thereby, in the memory usage of every `fiction::performance_profile`.
+ * Over-aligned allocations are not tracked.
+ *
+ * This macro must be used at namespace scope in exactly one translation unit of an executable, e.g., next to `main`.
+ */
+#define FICTION_TRACK_GLOBAL_ALLOCATIONS()                                                                             \
+    void* operator new(std::size_t size)                                                                               \
+    {                                                                                                                  \
+        return fiction::detail::tracked_malloc(size);                                                                  \
+    }                                                                                                                  \
+    void* operator new[](std::size_t size)                                                                             \
+    {                                                                                                                  \
+        return fiction::detail::tracked_malloc(size);                                                                  \
+    }                                                                                                                  \
+    void operator delete(void* ptr) noexcept                                                                           \
+    {                                                                                                                  \
+        fiction::detail::tracked_free(ptr);                                                                            \
+    }                                                                                                                  \
+    void operator delete[](void* ptr) noexcept                                                                         \
+    {                                                                                                                  \
+        fiction::detail::tracked_free(ptr);                                                                            \
+    }                                                                                                                  \
+    void operator delete(void* ptr, std::size_t) noexcept                                                              \
+    {                                                                                                                  \
+        fiction::detail::tracked_free(ptr);                                                                            \
+    }                                                                                                                  \
+    void operator delete[](void* ptr, std::size_t) noexcept                                                            \
+    {                                                                                                                  \
+        fiction::detail::tracked_free(ptr);                                                                            \
+    }
+
+#endif  // FICTION_PERFORMANCE_PROFILE_HPP
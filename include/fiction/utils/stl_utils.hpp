@@ -5,10 +5,15 @@
 #ifndef FICTION_STL_UTILS_HPP
 #define FICTION_STL_UTILS_HPP
 
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
 #include <functional>
 #include <iterator>
+#include <limits>
 #include <queue>
 #include <type_traits>
+#include <utility>
 #include <vector>
 
 namespace fiction
@@ -154,6 +159,303 @@ class searchable_priority_queue : public std::priority_queue<T, Container, Compa
     }
 };
 
+/**
+ * An addressable d-ary heap over integral handles. Every element is identified by a handle in the range `[0, n)` that
+ * is chosen by the caller, e.g., the index of a coordinate in a dense array. The heap keeps track of each handle's
+ * position, which allows for \f$\mathcal{O}(1)\f$ membership queries and \f$\mathcal{O}(\log_d n)\f$ priority
+ * updates (decrease-key) in addition to the usual push and pop operations. Contrary to `std::priority_queue`, the
+ * element on top is the one that compares *first* according to `Compare`, i.e., the default `std::less` results in a
+ * min-heap.
+ *
+ * Compared to a binary heap, a higher arity \f$d\f$ leads to shallower trees and thus cheaper decrease-key and push
+ * operations at the expense of slightly more comparisons per pop. Since path finding algorithms usually perform many
+ * more pushes and updates than pops, \f$d = 4\f$ is a sensible default.
+ *
+ * @tparam Priority The type of the priorities associated with the handles.
+ * @tparam Arity The number of children of each heap node.
+ * @tparam Compare A Compare type providing a strict weak ordering on `Priority`.
+ */
+template <class Priority, std::size_t Arity = 4, class Compare = std::less<Priority>>
+class indexed_d_ary_heap
+{
+    static_assert(Arity >= 2, "A heap requires an arity of at least 2");
+
+  public:
+    /**
+     * Handle type that identifies the stored elements.
+     */
+    using handle_type = std::size_t;
+    /**
+     * Position value of handles that are not contained in the heap.
+     */
+    static constexpr std::size_t npos = std::numeric_limits<std::size_t>::max();
+    /**
+     * Standard constructor.
+     *
+     * @param num_handles Number of handles for which position storage is to be allocated up front.
+     * @param comp Comparator instance.
+     */
+    explicit indexed_d_ary_heap(const std::size_t num_handles = 0ul, const Compare& comp = Compare{}) :
+            positions(num_handles, npos),
+            compare{comp}
+    {}
+    /**
+     * Checks whether the heap is empty.
+     *
+     * @return `true` iff the heap does not contain any elements.
+     */
+    [[nodiscard]] bool empty() const noexcept
+    {
+        return elements.empty();
+    }
+    /**
+     * Returns the number of elements in the heap.
+     *
+     * @return Number of stored elements.
+     */
+    [[nodiscard]] std::size_t size() const noexcept
+    {
+        return elements.size();
+    }
+    /**
+     * Allocates position storage for all handles in the range `[0, num_handles)`. Handles beyond this range are
+     * supported as well but may lead to reallocations when pushed.
+     *
+     * @param num_handles Number of handles to allocate position storage for.
+     */
+    void reserve(const std::size_t num_handles)
+    {
+        if (num_handles > positions.size())
+        {
+            positions.resize(num_handles, npos);
+        }
+
+        elements.reserve(num_handles);
+    }
+    /**
+     * Checks whether the given handle is currently stored in the heap.
+     *
+     * @param h Handle to check.
+     * @return `true` iff `h` is contained in the heap.
+     */
+    [[nodiscard]] bool contains(const handle_type h) const noexcept
+    {
+        return h < positions.size() && positions[h] != npos;
+    }
+    /**
+     * Returns the handle on top of the heap. The heap must not be empty.
+     *
+     * @return Handle with the highest priority according to `Compare`.
+     */
+    [[nodiscard]] handle_type top() const noexcept
+    {
+        assert(!empty() && "top() called on an empty heap");
+
+        return elements.front().first;
+    }
+    /**
+     * Returns the priority of the handle on top of the heap. The heap must not be empty.
+     *
+     * @return Priority of the top handle.
+     */
+    [[nodiscard]] const Priority& top_priority() const noexcept
+    {
+        assert(!empty() && "top_priority() called on an empty heap");
+
+        return elements.front().second;
+    }
+    /**
+     * Returns the priority that is currently associated with the given handle. The handle must be contained.
+     *
+     * @param h Handle whose priority is desired.
+     * @return Priority of `h`.
+     */
+    [[nodiscard]] const Priority& priority(const handle_type h) const noexcept
+    {
+        assert(contains(h) && "handle is not contained in the heap");
+
+        return elements[positions[h]].second;
+    }
+    /**
+     * Inserts a handle with the given priority. The handle must not already be contained.
+     *
+     * @param h Handle to insert.
+     * @param p Priority of `h`.
+     */
+    void push(const handle_type h, const Priority& p)
+    {
+        assert(!contains(h) && "handle is already contained in the heap");
+
+        if (h >= positions.size())
+        {
+            positions.resize(h + 1, npos);
+        }
+
+        elements.emplace_back(h, p);
+        sift_up(elements.size() - 1);
+    }
+    /**
+     * Removes the handle on top of the heap and returns it. The heap must not be empty.
+     *
+     * @return The removed handle.
+     */
+    handle_type pop() noexcept
+    {
+        assert(!empty() && "pop() called on an empty heap");
+
+        const auto h = elements.front().first;
+        positions[h] = npos;
+
+        if (elements.size() > 1)
+        {
+            elements.front() = std::move(elements.back());
+            elements.pop_back();
+            sift_down(0);
+        }
+        else
+        {
+            elements.pop_back();
+        }
+
+        return h;
+    }
+    /**
+     * Assigns a new priority to a contained handle that does not compare after its current one, i.e., for a min-heap,
+     * the new priority must be less than or equal to the old one.
+     *
+     * @param h Contained handle whose priority is to be improved.
+     * @param p New priority of `h`.
+     */
+    void decrease_key(const handle_type h, const Priority& p) noexcept
+    {
+        assert(contains(h) && "handle is not contained in the heap");
+        assert(!compare(elements[positions[h]].second, p) && "new priority must not compare after the old one");
+
+        elements[positions[h]].second = p;
+        sift_up(positions[h]);
+    }
+    /**
+     * Assigns a new priority to a contained handle regardless of whether it improves or worsens its position.
+     *
+     * @param h Contained handle whose priority is to be changed.
+     * @param p New priority of `h`.
+     */
+    void update(const handle_type h, const Priority& p) noexcept
+    {
+        assert(contains(h) && "handle is not contained in the heap");
+
+        const auto pos = positions[h];
+        const auto up  = compare(p, elements[pos].second);
+
+        elements[pos].second = p;
+
+        if (up)
+        {
+            sift_up(pos);
+        }
+        else
+        {
+            sift_down(pos);
+        }
+    }
+    /**
+     * Removes all elements from the heap. The allocated storage is kept for later reuse.
+     */
+    void clear() noexcept
+    {
+        for (const auto& e : elements)
+        {
+            positions[e.first] = npos;
+        }
+
+        elements.clear();
+    }
+
+  private:
+    /**
+     * Heap-ordered handle-priority pairs.
+     */
+    std::vector<std::pair<handle_type, Priority>> elements{};
+    /**
+     * Maps each handle to its index in `elements` or to `npos` if the handle is not contained.
+     */
+    std::vector<std::size_t> positions;
+    /**
+     * Comparator instance.
+     */
+    Compare compare;
+    /**
+     * Moves the element at index `i` towards the root until the heap property is restored.
+     *
+     * @param i Index of the element to move.
+     */
+    void sift_up(std::size_t i) noexcept
+    {
+        auto e = std::move(elements[i]);
+
+        while (i > 0)
+        {
+            const auto parent = (i - 1) / Arity;
+
+            if (!compare(e.second, elements[parent].second))
+            {
+                break;
+            }
+
+            elements[i]                  = std::move(elements[parent]);
+            positions[elements[i].first] = i;
+            i                            = parent;
+        }
+
+        positions[e.first] = i;
+        elements[i]        = std::move(e);
+    }
+    /**
+     * Moves the element at index `i` towards the leaves until the heap property is restored.
+     *
+     * @param i Index of the element to move.
+     */
+    void sift_down(std::size_t i) noexcept
+    {
+        const auto n = elements.size();
+        auto       e = std::move(elements[i]);
+
+        while (true)
+        {
+            const auto first_child = i * Arity + 1;
+
+            if (first_child >= n)
+            {
+                break;
+            }
+
+            // determine the child that compares first
+            auto       best_child = first_child;
+            const auto last_child = std::min(first_child + Arity, n);
+
+            for (auto c = first_child + 1; c < last_child; ++c)
+            {
+                if (compare(elements[c].second, elements[best_child].second))
+                {
+                    best_child = c;
+                }
+            }
+
+            if (!compare(elements[best_child].second, e.second))
+            {
+                break;
+            }
+
+            elements[i]                  = std::move(elements[best_child]);
+            positions[elements[i].first] = i;
+            i                            = best_child;
+        }
+
+        positions[e.first] = i;
+        elements[i]        = std::move(e);
+    }
+};
+
 }  // namespace fiction
 
 #endif  // FICTION_STL_UTILS_HPP
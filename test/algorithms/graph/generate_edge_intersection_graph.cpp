@@ -11,6 +11,7 @@
 #include <fiction/layouts/coordinates.hpp>
 #include <fiction/layouts/gate_level_layout.hpp>
 
+#include <cstddef>
 #include <vector>
 
 using namespace fiction;
@@ -253,3 +254,73 @@ TEST_CASE("EPG on 4x4 layouts with obstruction", "[generate-edge-intersection-gr
         }
     }
 }
+
+TEST_CASE("EPG on 5x5 layouts with multiple objectives", "[generate-edge-intersection-graph]")
+{
+    using gate_lyt = gate_level_layout<clocked_layout<cartesian_layout<offset::ucoord_t>>>;
+
+    const gate_lyt layout{{4, 4}, twoddwave_clocking<gate_lyt>()};
+
+    const std::vector<routing_objective<gate_lyt>> objectives{
+        {{0, 0}, {4, 4}}, {{0, 2}, {4, 2}}, {{2, 0}, {2, 4}}, {{1, 0}, {3, 4}}};
+
+    const auto check_graph = [&layout, &objectives](generate_edge_intersection_graph_params ps,
+                                                    const std::size_t num_vertices, const std::size_t num_edges)
+    {
+        generate_edge_intersection_graph_stats st{};
+
+        const auto graph = generate_edge_intersection_graph(layout, objectives, ps, &st);
+
+        CHECK(st.number_of_unroutable_objectives == 0);
+        CHECK(st.cliques.size() == 4);
+
+        CHECK(graph.size_vertices() == num_vertices);
+        CHECK(graph.size_edges() == num_edges);
+
+        // the graph must not depend on the number of threads
+        for (const auto num_threads : {0ull, 4ull})
+        {
+            ps.num_threads = num_threads;
+
+            generate_edge_intersection_graph_stats parallel_st{};
+
+            const auto parallel_graph = generate_edge_intersection_graph(layout, objectives, ps, &parallel_st);
+
+            CHECK(parallel_st.cliques == st.cliques);
+
+            REQUIRE(parallel_graph.size_vertices() == graph.size_vertices());
+            CHECK(parallel_graph.size_edges() == graph.size_edges());
+
+            for (std::size_t v = 0; v < graph.size_vertices(); ++v)
+            {
+                CHECK(parallel_graph.at_vertex(v) == graph.at_vertex(v));
+            }
+        }
+    };
+
+    generate_edge_intersection_graph_params ps{};
+
+    SECTION("without crossings")
+    {
+        check_graph(ps, 87, 3739);
+    }
+    SECTION("with crossings")
+    {
+        ps.crossings = true;
+        check_graph(ps, 87, 3310);
+    }
+    SECTION("with path limit")
+    {
+        ps.path_limit = 5;
+
+        SECTION("without crossings")
+        {
+            check_graph(ps, 12, 65);
+        }
+        SECTION("with crossings")
+        {
+            ps.crossings = true;
+            check_graph(ps, 12, 47);
+        }
+    }
+}
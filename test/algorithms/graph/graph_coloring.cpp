@@ -68,6 +68,32 @@ void check_sat_search_tactics(const Graph& graph, const std::size_t expected_chr
 
         check_statistics_with_exact_chromatic_number(pst, expected_chromatic_number);
     }
+    SECTION("upper bound binary search")
+    {
+        sat_params.sat_search_tactic = graph_coloring_sat_search_tactic::UPPER_BOUND_BINARY_SEARCH;
+
+        const auto coloring =
+            determine_vertex_coloring(graph, {graph_coloring_engine::SAT, sat_params, {}, true}, &pst);
+
+        check_statistics_with_exact_chromatic_number(pst, expected_chromatic_number);
+    }
+    SECTION("incremental")
+    {
+        sat_params.incremental = true;
+
+        for (const auto tactic : {graph_coloring_sat_search_tactic::LINEARLY_ASCENDING,
+                                  graph_coloring_sat_search_tactic::LINEARLY_DESCENDING,
+                                  graph_coloring_sat_search_tactic::BINARY_SEARCH,
+                                  graph_coloring_sat_search_tactic::UPPER_BOUND_BINARY_SEARCH})
+        {
+            sat_params.sat_search_tactic = tactic;
+
+            const auto coloring =
+                determine_vertex_coloring(graph, {graph_coloring_engine::SAT, sat_params, {}, true}, &pst);
+
+            check_statistics_with_exact_chromatic_number(pst, expected_chromatic_number);
+        }
+    }
 }
 
 template <typename Graph>
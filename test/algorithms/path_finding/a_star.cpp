@@ -663,3 +663,80 @@ TEST_CASE("A* path finding with the A* distance functor (don't do this!)", "[A*]
         }
     }
 }
+
+TEST_CASE("A* with dense and hashed coordinate indices", "[A*]")
+{
+    // offset coordinates are indexed densely, cube coordinates are indexed via a hash map
+    using offset_lyt = obstruction_layout<clocked_layout<cartesian_layout<offset::ucoord_t>>>;
+    using cube_lyt   = obstruction_layout<clocked_layout<cartesian_layout<cube::coord_t>>>;
+
+    offset_lyt offset_layout{clocked_layout<cartesian_layout<offset::ucoord_t>>{{7, 7}, use_clocking<offset_lyt>()}};
+    cube_lyt   cube_layout{clocked_layout<cartesian_layout<cube::coord_t>>{{7, 7}, use_clocking<cube_lyt>()}};
+
+    // obstruct a diagonal band of coordinates
+    for (auto i = 1; i < 7; ++i)
+    {
+        offset_layout.obstruct_coordinate({i, 7 - i});
+        cube_layout.obstruct_coordinate({i, 7 - i});
+    }
+
+    offset_layout.foreach_coordinate(
+        [&](const auto& source)
+        {
+            offset_layout.foreach_coordinate(
+                [&](const auto& target)
+                {
+                    if (offset_layout.is_obstructed_coordinate(source) ||
+                        offset_layout.is_obstructed_coordinate(target))
+                    {
+                        return;
+                    }
+
+                    const auto offset_path =
+                        a_star<layout_coordinate_path<offset_lyt>>(offset_layout, {source, target});
+                    const auto cube_path = a_star<layout_coordinate_path<cube_lyt>>(
+                        cube_layout, {{source.x, source.y}, {target.x, target.y}});
+
+                    CHECK(offset_path.size() == cube_path.size());
+
+                    if (!offset_path.empty())
+                    {
+                        CHECK(offset_path.source() == source);
+                        CHECK(offset_path.target() == target);
+                    }
+                });
+        });
+}
+
+TEST_CASE("A* with a reusable search context", "[A*]")
+{
+    using clk_lyt  = clocked_layout<cartesian_layout<offset::ucoord_t>>;
+    using obst_lyt = obstruction_layout<clk_lyt>;
+    using path     = layout_coordinate_path<obst_lyt>;
+
+    a_star_context<clk_lyt> context{};
+
+    obst_lyt layout{clk_lyt{{4, 4}, use_clocking<clk_lyt>()}};
+
+    // the context has to produce the same results as a fresh search, even if the layout changes in between
+    for (auto i = 0u; i < 4u; ++i)
+    {
+        const auto with_context    = a_star<path>(layout, {{0, 0}, {4, 4}}, context);
+        const auto without_context = a_star<path>(layout, {{0, 0}, {4, 4}});
+
+        CHECK(with_context.size() == without_context.size());
+
+        layout.obstruct_coordinate({i + 1, i});
+    }
+
+    // a larger layout grows the context's buffers
+    const obst_lyt larger_layout{clk_lyt{{9, 9}, use_clocking<clk_lyt>()}};
+
+    CHECK(a_star<path>(larger_layout, {{0, 0}, {9, 9}}, context).size() == 19);
+
+    // a smaller layout reuses them
+    const obst_lyt smaller_layout{clk_lyt{{1, 1}, use_clocking<clk_lyt>()}};
+
+    CHECK(a_star<path>(smaller_layout, {{0, 0}, {0, 1}}, context).size() == 4);
+    CHECK(a_star<path>(smaller_layout, {{1, 1}, {1, 1}}, context).size() == 1);
+}
@@ -11,6 +11,13 @@
 #include <fiction/layouts/clocked_layout.hpp>
 #include <fiction/layouts/clocking_scheme.hpp>
 #include <fiction/layouts/coordinates.hpp>
+#include <fiction/layouts/obstruction_layout.hpp>
+
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <thread>
+#include <vector>
 
 using namespace fiction;
 
@@ -262,3 +269,171 @@ TEST_CASE("Smart distance cache functor", "[distance-map]")
             });
     }
 }
+
+template <typename Lyt>
+void check_distance_oracle(const Lyt& layout)
+{
+    using dist = uint64_t;
+
+    const auto oracle      = std::make_shared<distance_oracle<Lyt, dist>>(distance_oracle_params{5});
+    const auto oracle_func = distance_oracle_functor<Lyt, dist>{oracle};
+
+    layout.foreach_coordinate(
+        [&layout, &oracle, &oracle_func](const auto& c1)
+        {
+            layout.foreach_coordinate(
+                [&layout, &oracle, &oracle_func, &c1](const auto& c2)
+                {
+                    if (const auto d = a_star_distance(layout, c1, c2); d != std::numeric_limits<dist>::max())
+                    {
+                        CHECK(oracle_func(layout, c1, c2) == d);
+                    }
+                    else
+                    {
+                        CHECK(oracle_func(layout, c1, c2) == std::numeric_limits<uint32_t>::max());
+                    }
+
+                    CHECK(oracle->num_cached_targets() <= 5);
+                });
+        });
+
+    oracle->clear();
+    CHECK(oracle->num_cached_targets() == 0);
+}
+
+TEST_CASE("Distance oracle", "[distance-map]")
+{
+    using clk_lyt = clocked_layout<cartesian_layout<offset::ucoord_t>>;
+
+    SECTION("2DDWave clocking")
+    {
+        check_distance_oracle(clk_lyt{aspect_ratio<clk_lyt>{4, 4}, twoddwave_clocking<clk_lyt>()});
+    }
+    SECTION("USE clocking")
+    {
+        check_distance_oracle(clk_lyt{aspect_ratio<clk_lyt>{4, 4}, use_clocking<clk_lyt>()});
+    }
+    SECTION("RES clocking")
+    {
+        check_distance_oracle(clk_lyt{aspect_ratio<clk_lyt>{4, 4}, res_clocking<clk_lyt>()});
+    }
+    SECTION("CFE clocking")
+    {
+        check_distance_oracle(clk_lyt{aspect_ratio<clk_lyt>{4, 4}, cfe_clocking<clk_lyt>()});
+    }
+    SECTION("Concurrent queries")
+    {
+        const clk_lyt layout{aspect_ratio<clk_lyt>{4, 4}, use_clocking<clk_lyt>()};
+
+        // a small cache forces concurrent evictions
+        const auto oracle_func = distance_oracle_functor<clk_lyt, uint64_t>{distance_oracle_params{3}};
+
+        std::vector<std::vector<uint64_t>> results(4);
+        std::vector<std::thread>           threads{};
+
+        for (auto& r : results)
+        {
+            threads.emplace_back(
+                [&layout, &oracle_func, &r]
+                {
+                    layout.foreach_coordinate(
+                        [&layout, &oracle_func, &r](const auto& c1)
+                        {
+                            layout.foreach_coordinate([&layout, &oracle_func, &r, &c1](const auto& c2)
+                                                      { r.push_back(oracle_func(layout, c1, c2)); });
+                        });
+                });
+        }
+
+        for (auto& t : threads)
+        {
+            t.join();
+        }
+
+        std::size_t i = 0;
+
+        layout.foreach_coordinate(
+            [&layout, &results, &i](const auto& c1)
+            {
+                layout.foreach_coordinate(
+                    [&layout, &results, &i, &c1](const auto& c2)
+                    {
+                        if (const auto d = a_star_distance(layout, c1, c2); d != std::numeric_limits<uint64_t>::max())
+                        {
+                            for (const auto& r : results)
+                            {
+                                CHECK(r[i] == d);
+                            }
+                        }
+
+                        ++i;
+                    });
+            });
+    }
+}
+
+template <typename Lyt>
+void check_landmark_distance(const Lyt& layout)
+{
+    using dist = uint64_t;
+
+    const auto landmark_func = landmark_distance_functor<Lyt, dist>{layout, 4};
+
+    CHECK(landmark_func.get_landmarks().size() == 4);
+
+    layout.foreach_coordinate(
+        [&layout, &landmark_func](const auto& c1)
+        {
+            layout.foreach_coordinate(
+                [&layout, &landmark_func, &c1](const auto& c2)
+                {
+                    // the landmark bound must be admissible
+                    if (const auto d = a_star_distance(layout, c1, c2); d != std::numeric_limits<dist>::max())
+                    {
+                        CHECK(landmark_func(layout, c1, c2) <= d);
+                    }
+                });
+        });
+
+    // using the landmark bound as A* heuristic must not change the path lengths
+    obstruction_layout<Lyt> obstr_layout{layout};
+    obstr_layout.obstruct_coordinate({1, 1});
+    obstr_layout.obstruct_coordinate({2, 3});
+
+    const auto obstr_landmark_func = landmark_distance_functor<decltype(obstr_layout), dist>{obstr_layout};
+
+    obstr_layout.foreach_coordinate(
+        [&obstr_layout, &obstr_landmark_func](const auto& c1)
+        {
+            obstr_layout.foreach_coordinate(
+                [&obstr_layout, &obstr_landmark_func, &c1](const auto& c2)
+                {
+                    using path = layout_coordinate_path<decltype(obstr_layout)>;
+
+                    CHECK(a_star<path>(obstr_layout, {c1, c2}).size() ==
+                          a_star<path>(obstr_layout, {c1, c2}, obstr_landmark_func).size());
+                });
+        });
+}
+
+TEST_CASE("Landmark distance", "[distance-map]")
+{
+    using clk_lyt = clocked_layout<cartesian_layout<offset::ucoord_t>>;
+
+    SECTION("2DDWave clocking")
+    {
+        check_landmark_distance(clk_lyt{aspect_ratio<clk_lyt>{4, 4}, twoddwave_clocking<clk_lyt>()});
+    }
+    SECTION("USE clocking")
+    {
+        check_landmark_distance(clk_lyt{aspect_ratio<clk_lyt>{4, 4}, use_clocking<clk_lyt>()});
+    }
+    SECTION("RES clocking")
+    {
+        check_landmark_distance(clk_lyt{aspect_ratio<clk_lyt>{4, 4}, res_clocking<clk_lyt>()});
+    }
+    SECTION("CFE clocking")
+    {
+        check_landmark_distance(clk_lyt{aspect_ratio<clk_lyt>{4, 4}, cfe_clocking<clk_lyt>()});
+    }
+}
@@ -384,3 +384,19 @@ TEST_CASE("Enumerate all paths on 4x4 gate-level layouts with connection obstruc
         }
     }
 }
+
+TEST_CASE("Enumerate all paths with a reusable search context", "[enumerate-all-paths]")
+{
+    using clk_lyt = clocked_layout<cartesian_layout<offset::ucoord_t>>;
+    using path    = layout_coordinate_path<clk_lyt>;
+
+    const clk_lyt layout{{3, 3}, twoddwave_clocking<clk_lyt>()};
+
+    a_star_context<clk_lyt> context{};
+
+    // all monotone paths through a 4x4 grid
+    CHECK(enumerate_all_paths<path>(layout, {{0, 0}, {3, 3}}, context).size() == 20);
+    // the context is reset between enumerations
+    CHECK(enumerate_all_paths<path>(layout, {{0, 0}, {3, 3}}, context).size() == 20);
+    CHECK(enumerate_all_paths<path>(layout, {{1, 1}, {3, 2}}, context).size() == 3);
+}
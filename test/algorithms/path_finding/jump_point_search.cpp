@@ -410,3 +410,24 @@ TEST_CASE("JPS on 10x10 layouts with varying distance functions", "[JPS]")
         }
     }
 }
+
+TEST_CASE("JPS with a reusable search context", "[JPS]")
+{
+    using clk_lyt = clocked_layout<cartesian_layout<offset::ucoord_t>>;
+    using path    = layout_coordinate_path<clk_lyt>;
+
+    const clk_lyt layout{{5, 5}, use_clocking<clk_lyt>()};
+
+    a_star_context<clk_lyt> context{};
+
+    layout.foreach_coordinate(
+        [&](const auto& source)
+        {
+            layout.foreach_coordinate(
+                [&](const auto& target)
+                {
+                    CHECK(jump_point_search<path>(layout, {source, target}, context).size() ==
+                          jump_point_search<path>(layout, {source, target}).size());
+                });
+        });
+}
@@ -12,6 +12,8 @@
 #include <fiction/layouts/gate_level_layout.hpp>
 #include <fiction/layouts/obstruction_layout.hpp>
 
+#include <algorithm>
+
 using namespace fiction;
 
 TEST_CASE("Yen's algorithm on 2x2 layouts", "[k-shortest-paths]")
@@ -784,3 +786,22 @@ TEST_CASE("Yen's algorithm on 4x4 gate-level layouts with connection obstruction
         }
     }
 }
+
+TEST_CASE("Yen's algorithm with a reusable search context", "[k-shortest-paths]")
+{
+    using clk_lyt = clocked_layout<cartesian_layout<offset::ucoord_t>>;
+    using path    = layout_coordinate_path<clk_lyt>;
+
+    const clk_lyt layout{{3, 3}, twoddwave_clocking<clk_lyt>()};
+
+    a_star_context<clk_lyt> context{};
+
+    for (const auto k : {1u, 5u, 20u, 25u})
+    {
+        const auto with_context    = yen_k_shortest_paths<path>(layout, {{0, 0}, {3, 3}}, k, context);
+        const auto without_context = yen_k_shortest_paths<path>(layout, {{0, 0}, {3, 3}}, k);
+
+        CHECK(with_context.size() == without_context.size());
+        CHECK(with_context.size() == std::min(k, 20u));
+    }
+}
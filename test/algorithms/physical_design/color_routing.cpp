@@ -70,6 +70,12 @@ TEST_CASE("Two paths wire connections", "[color-routing]")
         ps.engine = graph_coloring_engine::SAT;
         check_color_routing(spec_layout, impl_layout, objectives, ps);
     }
+    SECTION("Incremental SAT")
+    {
+        ps.engine          = graph_coloring_engine::SAT;
+        ps.incremental_sat = true;
+        check_color_routing(spec_layout, impl_layout, objectives, ps);
+    }
 }
 
 TEST_CASE("Three paths wire connections", "[color-routing]")
@@ -171,6 +177,12 @@ TEST_CASE("Routing with crossings", "[color-routing]")
             ps.engine = graph_coloring_engine::SAT;
             check_color_routing(spec_layout, impl_layout, objectives, ps);
         }
+        SECTION("Incremental SAT")
+        {
+            ps.engine          = graph_coloring_engine::SAT;
+            ps.incremental_sat = true;
+            check_color_routing(spec_layout, impl_layout, objectives, ps);
+        }
     }
     SECTION("With path limit")
     {
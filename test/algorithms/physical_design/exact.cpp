@@ -184,6 +184,20 @@ exact_physical_design_params&& async(const std::size_t t, exact_physical_design_
     return std::move(ps);
 }
 
+exact_physical_design_params&& portfolio(exact_physical_design_params&& ps) noexcept
+{
+    ps.portfolio = true;
+
+    return std::move(ps);
+}
+
+exact_physical_design_params&& break_symmetry(exact_physical_design_params&& ps) noexcept
+{
+    ps.break_translation_symmetry = true;
+
+    return std::move(ps);
+}
+
 exact_physical_design_params&& minimize_wires(exact_physical_design_params&& ps) noexcept
 {
     ps.minimize_wires = true;
@@ -685,13 +699,18 @@ TEST_CASE("Exact physical design with upper bounds", "[exact]")
     {
         upper_bound_config.upper_bound_y = 3u;  // allow only 3 tiles in y direction; this will work
 
-        const auto mux    = blueprints::mux21_network<technology_network>();
-        auto       layout = exact<cart_gate_clk_lyt>(mux, upper_bound_config);
+        const auto mux = blueprints::mux21_network<technology_network>();
+
+        exact_physical_design_stats stats{};
+        auto                        layout = exact<cart_gate_clk_lyt>(mux, upper_bound_config, &stats);
 
         REQUIRE(layout.has_value());
 
         CHECK(layout->y() <= 3);
 
+        // aspect ratios that are too tall are counted separately from those that are filtered as infeasible
+        CHECK(stats.num_aspect_ratios_beyond_bounds > 0);
+
         upper_bound_config.upper_bound_x = 2u;  // additionally, allow only 2 tiles in x direction; this will now fail
 
         layout = exact<cart_gate_clk_lyt>(mux, upper_bound_config);
@@ -712,6 +731,73 @@ TEST_CASE("Exact physical design timeout", "[exact]")
     CHECK(!layout.has_value());
 }
 
+TEST_CASE("Exact physical design with pre-solve filtering and symmetry breaking", "[exact]")
+{
+    const auto check_minimal = [](const auto& ntk, exact_physical_design_params&& ps)
+    {
+        exact_physical_design_stats reference_stats{};
+        const auto reference_layout = exact<cart_gate_clk_lyt>(ntk, ps, &reference_stats);
+
+        REQUIRE(reference_layout.has_value());
+
+        // aspect ratios that are too shallow for the network's depth are never handed to the solver
+        CHECK(reference_stats.num_skipped_aspect_ratios > 0);
+        CHECK(reference_stats.num_aspect_ratios_beyond_bounds == 0);
+
+        exact_physical_design_stats symmetry_stats{};
+        const auto symmetry_layout = exact<cart_gate_clk_lyt>(ntk, break_symmetry(std::move(ps)), &symmetry_stats);
+
+        REQUIRE(symmetry_layout.has_value());
+
+        check_drvs(*symmetry_layout);
+        check_eq(ntk, *symmetry_layout);
+
+        // symmetry breaking must not compromise optimality
+        CHECK(symmetry_stats.x_size * symmetry_stats.y_size == reference_stats.x_size * reference_stats.y_size);
+    };
+
+    SECTION("2DDWave")
+    {
+        check_minimal(blueprints::mux21_network<technology_network>(),
+                      twoddwave(crossings(desynchronize(configuration()))));
+    }
+    SECTION("2DDWave with border I/Os")
+    {
+        check_minimal(blueprints::and_or_network<technology_network>(),
+                      twoddwave(crossings(border_io(configuration()))));
+    }
+}
+
+TEST_CASE("Exact physical design with a solver portfolio", "[exact]")
+{
+    const auto mux = blueprints::mux21_network<technology_network>();
+
+    exact_physical_design_stats sequential_stats{};
+    const auto                  sequential_layout =
+        exact<cart_gate_clk_lyt>(mux, twoddwave(crossings(configuration())), &sequential_stats);
+
+    REQUIRE(sequential_layout.has_value());
+
+    exact_physical_design_stats portfolio_stats{};
+    const auto                  portfolio_layout =
+        exact<cart_gate_clk_lyt>(mux, twoddwave(crossings(portfolio(async(2, configuration())))), &portfolio_stats);
+
+    REQUIRE(portfolio_layout.has_value());
+
+    check_drvs(*portfolio_layout);
+    check_eq(mux, *portfolio_layout);
+
+    // the portfolio has to find a layout of minimal area as well
+    CHECK(portfolio_stats.x_size * portfolio_stats.y_size == sequential_stats.x_size * sequential_stats.y_size);
+
+    REQUIRE(portfolio_stats.thread_stats.size() == 2);
+    CHECK(portfolio_stats.thread_stats[0].random_seed == 0);
+    CHECK(portfolio_stats.thread_stats[1].random_seed == 1);
+    CHECK(portfolio_stats.thread_stats[0].num_solved_aspect_ratios +
+              portfolio_stats.thread_stats[1].num_solved_aspect_ratios >
+          0);
+}
+
 TEST_CASE("Name conservation after exact physical design", "[exact]")
 {
     auto maj = blueprints::maj1_network<mockturtle::names_view<mockturtle::mig_network>>();
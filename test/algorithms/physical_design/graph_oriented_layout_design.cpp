@@ -20,6 +20,7 @@
 
 #include <mockturtle/networks/aig.hpp>
 #include <mockturtle/networks/mig.hpp>
+#include <mockturtle/views/fanout_view.hpp>
 #include <mockturtle/views/names_view.hpp>
 
 #include <array>
@@ -315,3 +316,86 @@ TEST_CASE("No custom cost objective provided exception", "[graph-oriented-layout
 
     CHECK_THROWS_AS(graph_oriented_layout_design<gate_layout>(ntk, params, &stats), std::invalid_argument);
 }
+
+TEST_CASE("Parallel vertex expansions", "[graph-oriented-layout-design]")
+{
+    using gate_layout = gate_level_layout<clocked_layout<tile_based_layout<cartesian_layout<offset::ucoord_t>>>>;
+    const auto ntk    = blueprints::mux21_network<technology_network>();
+
+    graph_oriented_layout_design_stats stats{};
+
+    graph_oriented_layout_design_params params{};
+
+    // High efficiency mode, which only uses two search space graphs
+    params.mode                    = graph_oriented_layout_design_params::effort_mode::HIGH_EFFICIENCY;
+    params.num_parallel_expansions = 4;
+    const auto layout1             = graph_oriented_layout_design<gate_layout>(ntk, params, &stats);
+
+    REQUIRE(layout1.has_value());
+    check_eq(ntk, *layout1);
+
+    // Speculative expansions do not change the search, so the same layout is found as with one expansion per step
+    params.mode = graph_oriented_layout_design_params::effort_mode::HIGH_EFFORT;
+
+    params.num_parallel_expansions = 1;
+    const auto sequential_layout   = graph_oriented_layout_design<gate_layout>(ntk, params, &stats);
+
+    params.num_parallel_expansions = 4;
+    const auto parallel_layout     = graph_oriented_layout_design<gate_layout>(ntk, params, &stats);
+
+    REQUIRE(sequential_layout.has_value());
+    REQUIRE(parallel_layout.has_value());
+
+    CHECK(parallel_layout->x() == sequential_layout->x());
+    CHECK(parallel_layout->y() == sequential_layout->y());
+    CHECK(parallel_layout->num_gates() == sequential_layout->num_gates());
+    CHECK(parallel_layout->num_wires() == sequential_layout->num_wires());
+    CHECK(parallel_layout->num_crossings() == sequential_layout->num_crossings());
+
+    sequential_layout->foreach_coordinate(
+        [&sequential_layout, &parallel_layout](const auto& c)
+        { CHECK(parallel_layout->get_node(c) == sequential_layout->get_node(c)); });
+
+    // Combined with multithreading across search space graphs
+    params.mode                  = graph_oriented_layout_design_params::effort_mode::HIGH_EFFORT;
+    params.enable_multithreading = true;
+    params.return_first          = true;
+    const auto layout2           = graph_oriented_layout_design<gate_layout>(ntk, params, &stats);
+
+    REQUIRE(layout2.has_value());
+    check_eq(ntk, *layout2);
+}
+
+template <typename TopoView>
+void check_topological_node_indices(const TopoView& topo)
+{
+    uint32_t expected_index = 0u;
+
+    topo.foreach_node(
+        [&topo, &expected_index](const auto& n)
+        {
+            CHECK(topo.node_to_index(n) == expected_index);
+            CHECK(topo.index_to_node(expected_index) == n);
+
+            topo.foreach_fanin(n, [&topo, &n](const auto& f)
+                               { CHECK(topo.node_to_index(topo.get_node(f)) < topo.node_to_index(n)); });
+
+            ++expected_index;
+        });
+
+    CHECK(expected_index == topo.size());
+}
+
+TEST_CASE("Node indices of topological views", "[graph-oriented-layout-design]")
+{
+    const auto ntk = mockturtle::fanout_view{blueprints::mux21_network<technology_network>()};
+
+    SECTION("CO to CI")
+    {
+        check_topological_node_indices(detail::topo_view_co_to_ci{ntk});
+    }
+    SECTION("CI to CO")
+    {
+        check_topological_node_indices(detail::topo_view_ci_to_co{ntk});
+    }
+}
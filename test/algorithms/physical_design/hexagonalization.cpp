@@ -211,6 +211,87 @@ TEST_CASE("Layout equivalence", "[hexagonalization]")
     }
 }
 
+template <typename Lyt, typename Ntk>
+static void check_parallel_mapping_and_negotiated_routing(const Ntk& ntk)
+{
+    const auto layout = orthogonal<Lyt>(ntk, {});
+
+    hexagonalization_params params{};
+    params.input_pin_extension  = hexagonalization_params::io_pin_extension_mode::EXTEND;
+    params.output_pin_extension = hexagonalization_params::io_pin_extension_mode::EXTEND;
+
+    hexagonalization_stats stats{};
+
+    const auto sequential = hexagonalization<hex_even_row_gate_clk_lyt, Lyt>(layout, params, &stats);
+
+    CHECK(stats.num_negotiation_iterations == 0);
+    CHECK(!stats.negotiation_converged);
+
+    // the result must not depend on the number of threads
+    for (const auto num_threads : {0ull, 4ull})
+    {
+        params.num_threads = num_threads;
+        const auto parallel = hexagonalization<hex_even_row_gate_clk_lyt, Lyt>(layout, params);
+
+        check_eq(layout, parallel);
+
+        CHECK(parallel.x() == sequential.x());
+        CHECK(parallel.y() == sequential.y());
+        CHECK(parallel.num_gates() == sequential.num_gates());
+        CHECK(parallel.num_wires() == sequential.num_wires());
+
+        sequential.foreach_gate([&sequential, &parallel](const auto& g)
+                                { CHECK(!parallel.is_empty_tile(sequential.get_tile(g))); });
+    }
+
+    params.num_threads                   = 1ull;
+    params.negotiated_congestion_routing = true;
+
+    for (const auto mode : {hexagonalization_params::io_pin_extension_mode::EXTEND,
+                            hexagonalization_params::io_pin_extension_mode::EXTEND_PLANAR})
+    {
+        params.input_pin_extension  = mode;
+        params.output_pin_extension = mode;
+
+        params.max_negotiation_iterations = 32ull;
+
+        const auto negotiated = hexagonalization<hex_even_row_gate_clk_lyt, Lyt>(layout, params, &stats);
+
+        // one negotiation each for the primary inputs and outputs
+        CHECK(stats.num_negotiation_iterations >= 2);
+        CHECK(stats.num_negotiation_iterations <= 2 * params.max_negotiation_iterations);
+
+        check_eq(ntk, negotiated);
+        check_eq(layout, negotiated);
+
+        negotiated.foreach_pi([&negotiated](const auto& gate) { CHECK(negotiated.get_tile(gate).y == 0); });
+        negotiated.foreach_po([&negotiated](const auto& gate)
+                              { CHECK(negotiated.get_tile(negotiated.get_node(gate)).y == negotiated.y()); });
+
+        // without any iteration, the negotiation cannot converge and all objectives are routed one after another
+        params.max_negotiation_iterations = 0ull;
+
+        const auto fallback = hexagonalization<hex_even_row_gate_clk_lyt, Lyt>(layout, params, &stats);
+
+        CHECK(stats.num_negotiation_iterations == 0);
+        CHECK(!stats.negotiation_converged);
+
+        check_eq(ntk, fallback);
+        check_eq(layout, fallback);
+    }
+}
+
+TEST_CASE("Parallel mapping and negotiated routing", "[hexagonalization]")
+{
+    using gate_layout = gate_level_layout<clocked_layout<tile_based_layout<cartesian_layout<offset::ucoord_t>>>>;
+
+    check_parallel_mapping_and_negotiated_routing<gate_layout>(blueprints::maj4_network<mockturtle::aig_network>());
+    check_parallel_mapping_and_negotiated_routing<gate_layout>(blueprints::full_adder_network<technology_network>());
+    check_parallel_mapping_and_negotiated_routing<gate_layout>(blueprints::mux21_network<technology_network>());
+    check_parallel_mapping_and_negotiated_routing<gate_layout>(blueprints::nand_xnor_network<technology_network>());
+    check_parallel_mapping_and_negotiated_routing<gate_layout>(blueprints::clpl<technology_network>());
+}
+
 TEST_CASE("Cartesian to hexagonal")
 {
     using gate_layout = gate_level_layout<clocked_layout<tile_based_layout<cartesian_layout<offset::ucoord_t>>>>;
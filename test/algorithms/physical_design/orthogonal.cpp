@@ -9,6 +9,7 @@
 
 #include <fiction/algorithms/physical_design/apply_gate_library.hpp>
 #include <fiction/algorithms/physical_design/orthogonal.hpp>
+#include <fiction/io/read_fgl_layout.hpp>
 #include <fiction/layouts/cartesian_layout.hpp>
 #include <fiction/layouts/cell_level_layout.hpp>
 #include <fiction/layouts/clocked_layout.hpp>
@@ -22,6 +23,7 @@
 #include <mockturtle/views/fanout_view.hpp>
 #include <mockturtle/views/names_view.hpp>
 
+#include <sstream>
 #include <type_traits>
 
 using namespace fiction;
@@ -177,3 +179,75 @@ TEST_CASE("Name conservation after orthogonal physical design", "[orthogonal]")
     // PO names
     CHECK(layout.get_output_name(0) == "f");
 }
+
+TEST_CASE("Two-pass and streaming orthogonal physical design", "[orthogonal]")
+{
+    using gate_layout = gate_level_layout<clocked_layout<tile_based_layout<cartesian_layout<offset::ucoord_t>>>>;
+
+    const auto check = [](const auto& ntk)
+    {
+        orthogonal_physical_design_stats stats{};
+        const auto                       layout = orthogonal<gate_layout>(ntk, {}, &stats);
+
+        // two-pass
+        {
+            orthogonal_physical_design_params two_pass_ps{};
+            two_pass_ps.two_pass = true;
+
+            orthogonal_physical_design_stats two_pass_stats{};
+            const auto two_pass_layout = orthogonal<gate_layout>(ntk, two_pass_ps, &two_pass_stats);
+
+            CHECK(two_pass_stats.x_size == stats.x_size);
+            CHECK(two_pass_stats.y_size == stats.y_size);
+            CHECK(two_pass_stats.num_gates == stats.num_gates);
+            CHECK(two_pass_stats.num_wires == stats.num_wires);
+            CHECK(two_pass_stats.num_crossings == stats.num_crossings);
+
+            check_eq(ntk, two_pass_layout);
+        }
+        // streaming
+        {
+            std::stringstream layout_stream{};
+
+            orthogonal_physical_design_stats stream_stats{};
+            write_orthogonal_fgl_layout<gate_layout>(ntk, layout_stream, {}, &stream_stats);
+
+            CHECK(stream_stats.x_size == stats.x_size);
+            CHECK(stream_stats.y_size == stats.y_size);
+            CHECK(stream_stats.num_gates == stats.num_gates);
+            CHECK(stream_stats.num_wires == stats.num_wires);
+            CHECK(stream_stats.num_crossings == stats.num_crossings);
+
+            const auto read_layout = read_fgl_layout<gate_layout>(layout_stream);
+
+            CHECK(read_layout.x() == layout.x());
+            CHECK(read_layout.y() == layout.y());
+            CHECK(read_layout.num_gates() == layout.num_gates());
+            CHECK(read_layout.num_wires() == layout.num_wires());
+            CHECK(read_layout.num_crossings() == layout.num_crossings());
+
+            layout.foreach_tile(
+                [&layout, &read_layout](const auto& t)
+                {
+                    CHECK(layout.is_empty_tile(t) == read_layout.is_empty_tile(t));
+                    CHECK(layout.incoming_data_flow(t) == read_layout.incoming_data_flow(t));
+                });
+
+            check_eq(ntk, read_layout);
+        }
+    };
+
+    check(blueprints::unbalanced_and_inv_network<mockturtle::aig_network>());
+    check(blueprints::maj4_network<mockturtle::aig_network>());
+    check(blueprints::se_coloring_corner_case_network<technology_network>());
+    check(blueprints::fanout_substitution_corner_case_network<technology_network>());
+    check(blueprints::nary_operation_network<technology_network>());
+    check(blueprints::clpl<technology_network>());
+    check(blueprints::full_adder_network<mockturtle::mig_network>());
+
+    // constant input network
+    check(blueprints::unbalanced_and_inv_network<mockturtle::mig_network>());
+
+    // multi-output network
+    check(blueprints::multi_output_network<technology_network>());
+}
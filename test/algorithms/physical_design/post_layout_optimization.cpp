@@ -21,7 +21,9 @@
 #include <mockturtle/networks/aig.hpp>
 #include <mockturtle/views/names_view.hpp>
 
+#include <algorithm>
 #include <cstdint>
+#include <vector>
 
 using namespace fiction;
 
@@ -227,6 +229,138 @@ TEST_CASE("Layout equivalence", "[post_layout_optimization]")
     }
 }
 
+template <typename Lyt, typename Ntk>
+void check_parallel_relocation(const Ntk& ntk)
+{
+    std::vector<std::vector<tile<Lyt>>> occupied_tiles{};
+
+    for (const auto num_threads : {1ull, 2ull, 4ull})
+    {
+        const auto layout = orthogonal<Lyt>(ntk, {});
+
+        post_layout_optimization_params params{};
+        params.parallel_relocation = true;
+        params.num_threads         = num_threads;
+
+        post_layout_optimization_stats stats{};
+        post_layout_optimization<Lyt>(layout, params, &stats);
+
+        check_eq(ntk, layout);
+
+        std::vector<tile<Lyt>> tiles{};
+        layout.foreach_node([&layout, &tiles](const auto& n) { tiles.push_back(layout.get_tile(n)); });
+        std::sort(tiles.begin(), tiles.end());
+
+        occupied_tiles.push_back(tiles);
+    }
+
+    // the result does not depend on the number of threads
+    CHECK(occupied_tiles[0] == occupied_tiles[1]);
+    CHECK(occupied_tiles[0] == occupied_tiles[2]);
+}
+
+TEST_CASE("Parallel relocation", "[post_layout_optimization]")
+{
+    using gate_layout = gate_level_layout<clocked_layout<tile_based_layout<cartesian_layout<offset::ucoord_t>>>>;
+
+    SECTION("mux21_network")
+    {
+        check_parallel_relocation<gate_layout>(blueprints::mux21_network<technology_network>());
+    }
+    SECTION("full_adder_network")
+    {
+        check_parallel_relocation<gate_layout>(blueprints::full_adder_network<technology_network>());
+    }
+    SECTION("nand_xnor_network")
+    {
+        check_parallel_relocation<gate_layout>(blueprints::nand_xnor_network<technology_network>());
+    }
+}
+
+template <typename Lyt, typename Ntk>
+void check_gain_driven_relocation(const Ntk& ntk)
+{
+    const auto layout = orthogonal<Lyt>(ntk, {});
+
+    post_layout_optimization_params params{};
+    params.gain_driven_relocation = true;
+
+    post_layout_optimization_stats stats{};
+    post_layout_optimization<Lyt>(layout, params, &stats);
+
+    check_eq(ntk, layout);
+
+    CHECK(stats.num_relocation_attempts > 0);
+    CHECK(stats.x_size_after * stats.y_size_after <= stats.x_size_before * stats.y_size_before);
+}
+
+TEST_CASE("Gain-driven relocation", "[post_layout_optimization]")
+{
+    using gate_layout = gate_level_layout<clocked_layout<tile_based_layout<cartesian_layout<offset::ucoord_t>>>>;
+
+    SECTION("mux21_network")
+    {
+        check_gain_driven_relocation<gate_layout>(blueprints::mux21_network<technology_network>());
+    }
+    SECTION("full_adder_network")
+    {
+        check_gain_driven_relocation<gate_layout>(blueprints::full_adder_network<technology_network>());
+    }
+    SECTION("nand_xnor_network")
+    {
+        check_gain_driven_relocation<gate_layout>(blueprints::nand_xnor_network<technology_network>());
+    }
+    SECTION("fanout_substitution_corner_case_network")
+    {
+        check_gain_driven_relocation<gate_layout>(
+            blueprints::fanout_substitution_corner_case_network<technology_network>());
+    }
+    SECTION("Corner cases")
+    {
+        using corner_case_layout = gate_level_layout<clocked_layout<tile_based_layout<cartesian_layout<>>>>;
+
+        post_layout_optimization_params params{};
+        params.gain_driven_relocation = true;
+
+        const auto layout_outputs_1 = blueprints::optimization_layout_corner_case_outputs_1<corner_case_layout>();
+        post_layout_optimization<corner_case_layout>(layout_outputs_1, params);
+        check_eq(blueprints::optimization_layout_corner_case_outputs_1<corner_case_layout>(), layout_outputs_1);
+
+        const auto layout_outputs_2 = blueprints::optimization_layout_corner_case_outputs_2<corner_case_layout>();
+        post_layout_optimization<corner_case_layout>(layout_outputs_2, params);
+        check_eq(blueprints::optimization_layout_corner_case_outputs_2<corner_case_layout>(), layout_outputs_2);
+
+        const auto layout_inputs = blueprints::optimization_layout_corner_case_inputs<corner_case_layout>();
+        post_layout_optimization<corner_case_layout>(layout_inputs, params);
+        check_eq(blueprints::optimization_layout_corner_case_inputs<corner_case_layout>(), layout_inputs);
+    }
+    SECTION("Maximum gate relocations")
+    {
+        for (uint64_t max_gate_relocations = 0; max_gate_relocations < 5; ++max_gate_relocations)
+        {
+            const auto layout = orthogonal<gate_layout>(blueprints::mux21_network<technology_network>(), {});
+
+            post_layout_optimization_params params{};
+            params.gain_driven_relocation = true;
+            params.max_gate_relocations   = max_gate_relocations;
+            post_layout_optimization<gate_layout>(layout, params);
+
+            check_eq(blueprints::mux21_network<technology_network>(), layout);
+        }
+    }
+    SECTION("Optimize POs only")
+    {
+        const auto layout = orthogonal<gate_layout>(blueprints::full_adder_network<technology_network>(), {});
+
+        post_layout_optimization_params params{};
+        params.gain_driven_relocation = true;
+        params.optimize_pos_only      = true;
+        post_layout_optimization<gate_layout>(layout, params);
+
+        check_eq(blueprints::full_adder_network<technology_network>(), layout);
+    }
+}
+
 TEST_CASE("Wrong clocking scheme", "[post_layout_optimization]")
 {
     using gate_layout = gate_level_layout<clocked_layout<tile_based_layout<cartesian_layout<>>>>;
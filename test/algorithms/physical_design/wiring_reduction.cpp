@@ -150,6 +150,89 @@ TEST_CASE("Layout equivalence", "[wiring_reduction]")
     }
 }
 
+template <typename Lyt, typename Ntk>
+void check_search_modes(const Ntk& ntk)
+{
+    const auto             reference_layout = orthogonal<Lyt>(ntk, {});
+    wiring_reduction_stats reference_stats{};
+    wiring_reduction<Lyt>(reference_layout, {}, &reference_stats);
+
+    SECTION("Incremental search")
+    {
+        const auto layout = orthogonal<Lyt>(ntk, {});
+
+        wiring_reduction_params params{};
+        params.incremental_search = true;
+
+        wiring_reduction_stats stats{};
+        wiring_reduction<Lyt>(layout, params, &stats);
+
+        check_eq(ntk, layout);
+
+        // the maintained search layouts are identical to freshly created ones
+        CHECK(stats.x_size_after == reference_stats.x_size_after);
+        CHECK(stats.y_size_after == reference_stats.y_size_after);
+        CHECK(stats.num_wires_after == reference_stats.num_wires_after);
+        CHECK(stats.num_search_passes == reference_stats.num_search_passes);
+    }
+    SECTION("Disjoint paths")
+    {
+        const auto layout = orthogonal<Lyt>(ntk, {});
+
+        wiring_reduction_params params{};
+        params.disjoint_paths = true;
+
+        wiring_reduction_stats stats{};
+        wiring_reduction<Lyt>(layout, params, &stats);
+
+        check_eq(ntk, layout);
+
+        CHECK(stats.num_search_passes > 0);
+        CHECK(stats.x_size_after * stats.y_size_after <= stats.x_size_before * stats.y_size_before);
+    }
+    SECTION("Incremental search with disjoint paths")
+    {
+        const auto layout = orthogonal<Lyt>(ntk, {});
+
+        wiring_reduction_params params{};
+        params.incremental_search = true;
+        params.disjoint_paths     = true;
+
+        wiring_reduction_stats stats{};
+        wiring_reduction<Lyt>(layout, params, &stats);
+
+        check_eq(ntk, layout);
+
+        CHECK(stats.num_wires_after <= stats.num_wires_before);
+    }
+}
+
+TEST_CASE("Search modes", "[wiring_reduction]")
+{
+    using gate_layout = gate_level_layout<clocked_layout<tile_based_layout<cartesian_layout<offset::ucoord_t>>>>;
+
+    SECTION("mux21_network")
+    {
+        check_search_modes<gate_layout>(blueprints::mux21_network<technology_network>());
+    }
+    SECTION("full_adder_network")
+    {
+        check_search_modes<gate_layout>(blueprints::full_adder_network<technology_network>());
+    }
+    SECTION("se_coloring_corner_case_network")
+    {
+        check_search_modes<gate_layout>(blueprints::se_coloring_corner_case_network<technology_network>());
+    }
+    SECTION("clpl")
+    {
+        check_search_modes<gate_layout>(blueprints::clpl<technology_network>());
+    }
+    SECTION("nand_xnor_network")
+    {
+        check_search_modes<gate_layout>(blueprints::nand_xnor_network<technology_network>());
+    }
+}
+
 TEST_CASE("Wrong clocking scheme", "[wiring_reduction]")
 {
     using gate_layout = gate_level_layout<clocked_layout<tile_based_layout<cartesian_layout<>>>>;
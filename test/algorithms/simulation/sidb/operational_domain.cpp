@@ -18,8 +18,12 @@
 
 #include <mockturtle/utils/stopwatch.hpp>
 
+#include <cstddef>
+#include <filesystem>
+#include <limits>
 #include <optional>
 #include <stdexcept>
+#include <tuple>
 #include <vector>
 
 using namespace fiction;
@@ -142,6 +146,68 @@ TEST_CASE("operational_domain class member functions", "[operational-domain]")
     CHECK(opdom.get_number_of_dimensions() == 2);
     CHECK(opdom.get_dimension(0) == sweep_parameter::LAMBDA_TF);
     CHECK(opdom.get_dimension(1) == sweep_parameter::MU_MINUS);
+
+    SECTION("dense grid storage")
+    {
+        opdom.add_value(parameter_point{{1.0, 2.0}}, {operational_status::OPERATIONAL});
+        opdom.add_value(parameter_point{{1.05, 2.0}}, {operational_status::NON_OPERATIONAL});
+
+        CHECK(!opdom.has_grid_storage());
+
+        // 1.0, 1.1, ..., 2.0 in both dimensions
+        opdom.use_grid_storage({{1.0, 0.1, 11}, {2.0, 0.1, 11}});
+
+        CHECK(opdom.has_grid_storage());
+        CHECK(opdom.get_number_of_dimensions() == 2);
+        CHECK(opdom.size() == 2);
+
+        // values that have been added before are retained, regardless of whether they lie on the grid
+        REQUIRE(opdom.contains(parameter_point{{1.0, 2.0}}).has_value());
+        CHECK(std::get<0>(opdom.contains(parameter_point{{1.0, 2.0}}).value()) == operational_status::OPERATIONAL);
+        REQUIRE(opdom.contains(parameter_point{{1.05, 2.0}}).has_value());
+        CHECK(std::get<0>(opdom.contains(parameter_point{{1.05, 2.0}}).value()) ==
+              operational_status::NON_OPERATIONAL);
+
+        CHECK(!opdom.contains(parameter_point{{1.1, 2.0}}).has_value());
+        CHECK(!opdom.contains(parameter_point{{2.1, 2.0}}).has_value());
+
+        // points outside of the grid's range or with non-finite parameters are never mapped to a grid slot
+        CHECK(!opdom.contains(parameter_point{{0.9, 2.0}}).has_value());
+        CHECK(!opdom.contains(parameter_point{{std::numeric_limits<double>::quiet_NaN(), 2.0}}).has_value());
+        CHECK(!opdom.contains(parameter_point{{1.0, std::numeric_limits<double>::infinity()}}).has_value());
+
+        // values on the grid are written only once
+        opdom.add_value(parameter_point{{1.1, 2.0}}, {operational_status::OPERATIONAL});
+        opdom.add_value(parameter_point{{1.1, 2.0}}, {operational_status::NON_OPERATIONAL});
+        opdom.add_value(parameter_point{{2.1, 2.0}}, {operational_status::OPERATIONAL});
+
+        CHECK(opdom.size() == 4);
+        CHECK(std::get<0>(opdom.contains(parameter_point{{1.1, 2.0}}).value()) == operational_status::OPERATIONAL);
+        CHECK(opdom.contains(parameter_point{{2.1, 2.0}}).has_value());
+
+        std::size_t num_visited = 0;
+        opdom.for_each(
+            [&opdom, &num_visited](const auto& pp, const auto& value)
+            {
+                REQUIRE(opdom.contains(pp).has_value());
+                CHECK(opdom.contains(pp).value() == value);
+                ++num_visited;
+            });
+
+        CHECK(num_visited == 4);
+
+        const auto opdom_copy = opdom;
+
+        CHECK(opdom_copy.has_grid_storage());
+        CHECK(opdom_copy.size() == 4);
+        CHECK(opdom_copy.contains(parameter_point{{1.1, 2.0}}).has_value());
+
+        // axes must have a positive step size
+        CHECK_THROWS_AS(opdom.use_grid_storage({{1.0, 0.0, 11}, {2.0, 0.1, 11}}), std::invalid_argument);
+        CHECK_THROWS_AS(opdom.use_grid_storage({{1.0, -0.1, 11}, {2.0, 0.1, 11}}), std::invalid_argument);
+        CHECK(opdom.has_grid_storage());
+        CHECK(opdom.size() == 4);
+    }
 }
 
 TEST_CASE("Error handling of operational domain algorithms", "[operational-domain]")
@@ -546,6 +612,46 @@ TEST_CASE("BDL wire operational domain computation", "[operational-domain]")
             CHECK(op_domain_stats.num_evaluated_parameter_combinations == 100);
             CHECK(op_domain_stats.num_operational_parameter_combinations == 100);
             CHECK(op_domain_stats.num_non_operational_parameter_combinations == 0);
+
+            SECTION("hash map storage")
+            {
+                op_domain_params.storage = operational_domain_params::domain_storage::HASH_MAP;
+
+                const auto op_domain_hash_map =
+                    operational_domain_grid_search(lat, std::vector<tt>{create_id_tt()}, op_domain_params);
+
+                CHECK(op_domain.has_grid_storage());
+                CHECK(!op_domain_hash_map.has_grid_storage());
+                REQUIRE(op_domain_hash_map.size() == op_domain.size());
+
+                op_domain_hash_map.for_each(
+                    [&op_domain](const auto& pp, const auto& value)
+                    {
+                        REQUIRE(op_domain.contains(pp).has_value());
+                        CHECK(op_domain.contains(pp).value() == value);
+                    });
+            }
+            SECTION("stream and resume")
+            {
+                op_domain_params.stream.filename =
+                    (std::filesystem::temp_directory_path() / "fiction_operational_domain_grid_search.csv").string();
+
+                operational_domain_grid_search(lat, std::vector<tt>{create_id_tt()}, op_domain_params);
+
+                op_domain_params.stream.resume = true;
+
+                operational_domain_stats resumed_stats{};
+
+                const auto op_domain_resumed = operational_domain_grid_search(lat, std::vector<tt>{create_id_tt()},
+                                                                              op_domain_params, &resumed_stats);
+
+                CHECK(op_domain_resumed.size() == 100);
+                CHECK(resumed_stats.num_simulator_invocations == 0);
+                CHECK(resumed_stats.num_evaluated_parameter_combinations == 0);
+                CHECK(resumed_stats.num_operational_parameter_combinations == 100);
+
+                std::filesystem::remove(op_domain_params.stream.filename);
+            }
         }
         SECTION("random_sampling")
         {
@@ -581,6 +687,21 @@ TEST_CASE("BDL wire operational domain computation", "[operational-domain]")
             CHECK(op_domain_stats.num_evaluated_parameter_combinations == 100);
             CHECK(op_domain_stats.num_operational_parameter_combinations == 100);
             CHECK(op_domain_stats.num_non_operational_parameter_combinations == 0);
+
+            SECTION("dense grid storage")
+            {
+                op_domain_params.storage = operational_domain_params::domain_storage::DENSE_GRID;
+
+                const auto op_domain_dense_grid =
+                    operational_domain_flood_fill(lat, std::vector<tt>{create_id_tt()}, 1, op_domain_params);
+
+                CHECK(!op_domain.has_grid_storage());
+                CHECK(op_domain_dense_grid.has_grid_storage());
+                CHECK(op_domain_dense_grid.size() == 100);
+
+                check_op_domain_params_and_operational_status(op_domain_dense_grid, op_domain_params,
+                                                              operational_status::OPERATIONAL);
+            }
         }
         SECTION("contour_tracing")
         {
@@ -0,0 +1,191 @@
+//
+// Created by marcel on 19.10.26.
+//
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <fiction/algorithms/path_finding/a_star.hpp>
+#include <fiction/algorithms/path_finding/jump_point_search.hpp>
+#include <fiction/layouts/cartesian_layout.hpp>
+#include <fiction/layouts/clocked_layout.hpp>
+#include <fiction/layouts/clocking_scheme.hpp>
+#include <fiction/layouts/coordinates.hpp>
+#include <fiction/layouts/obstruction_layout.hpp>
+#include <fiction/utils/routing_utils.hpp>
+
+#include <cstdint>
+#include <random>
+
+using namespace fiction;
+
+/**
+ * Obstructs every fourth column of the given layout except for a single gap whose position alternates between the
+ * top and the bottom row. This creates a serpentine maze that forces paths to traverse most of the layout.
+ */
+template <typename Lyt>
+void obstruct_serpentine(Lyt& layout) noexcept
+{
+    for (uint64_t x = 2; x < layout.x(); x += 4)
+    {
+        const auto gap = ((x / 4) % 2 == 0) ? layout.y() : uint64_t{0};
+
+        for (uint64_t y = 0; y <= layout.y(); ++y)
+        {
+            if (y != gap)
+            {
+                layout.obstruct_coordinate({x, y});
+            }
+        }
+    }
+}
+/**
+ * Obstructs roughly the given percentage of all coordinates of the given layout except for the source and target
+ * corners.
+ */
+template <typename Lyt>
+void obstruct_randomly(Lyt& layout, const uint32_t percentage, const uint32_t seed) noexcept
+{
+    std::mt19937                            generator{seed};
+    std::uniform_int_distribution<uint32_t> distribution{0u, 99u};
+
+    layout.foreach_coordinate(
+        [&](const auto& c)
+        {
+            if (c != coordinate<Lyt>{0, 0} && c != coordinate<Lyt>{layout.x(), layout.y()} &&
+                distribution(generator) < percentage)
+            {
+                layout.obstruct_coordinate(c);
+            }
+        });
+}
+
+TEST_CASE("Benchmark A* on obstructed grids", "[benchmark]")
+{
+    using lyt      = cartesian_layout<offset::ucoord_t>;
+    using cube_lyt = cartesian_layout<cube::coord_t>;
+
+    SECTION("100 x 100 serpentine")
+    {
+        obstruction_layout<lyt> layout{lyt{{99, 99}}};
+        obstruct_serpentine(layout);
+
+        obstruction_layout<cube_lyt> cube_layout{cube_lyt{{99, 99}}};
+        obstruct_serpentine(cube_layout);
+
+        a_star_context<decltype(layout)> context{};
+
+        BENCHMARK("A*: dense coordinate index")
+        {
+            return a_star<layout_coordinate_path<decltype(layout)>>(layout, {{0, 0}, {99, 99}}, context);
+        };
+
+        BENCHMARK("A*: without context")
+        {
+            return a_star<layout_coordinate_path<decltype(layout)>>(layout, {{0, 0}, {99, 99}});
+        };
+
+        BENCHMARK("A*: hashed coordinate index")
+        {
+            return a_star<layout_coordinate_path<decltype(cube_layout)>>(cube_layout, {{0, 0}, {99, 99}});
+        };
+    }
+    SECTION("250 x 250 serpentine")
+    {
+        obstruction_layout<lyt> layout{lyt{{249, 249}}};
+        obstruct_serpentine(layout);
+
+        a_star_context<decltype(layout)> context{};
+
+        BENCHMARK("A*: dense coordinate index")
+        {
+            return a_star<layout_coordinate_path<decltype(layout)>>(layout, {{0, 0}, {249, 249}}, context);
+        };
+    }
+    SECTION("200 x 200 with 25 % random obstructions")
+    {
+        obstruction_layout<lyt> layout{lyt{{199, 199}}};
+        obstruct_randomly(layout, 25, 42);
+
+        a_star_context<decltype(layout)> context{};
+
+        BENCHMARK("A*: dense coordinate index")
+        {
+            return a_star<layout_coordinate_path<decltype(layout)>>(layout, {{0, 0}, {199, 199}}, context);
+        };
+    }
+}
+
+TEST_CASE("Benchmark A* and JPS on obstructed clocked grids", "[benchmark]")
+{
+    using clk_lyt = clocked_layout<cartesian_layout<offset::ucoord_t>>;
+
+    SECTION("USE 100 x 100 with 10 % random obstructions")
+    {
+        obstruction_layout<clk_lyt> layout{clk_lyt{{99, 99}, use_clocking<clk_lyt>()}};
+        obstruct_randomly(layout, 10, 42);
+
+        a_star_context<decltype(layout)> context{};
+
+        BENCHMARK("A*: dense coordinate index")
+        {
+            return a_star<layout_coordinate_path<decltype(layout)>>(layout, {{0, 0}, {99, 99}}, context);
+        };
+
+        BENCHMARK("JPS")
+        {
+            return jump_point_search<layout_coordinate_path<decltype(layout)>>(layout, {{0, 0}, {99, 99}});
+        };
+    }
+    SECTION("2DDWave 200 x 200 with 20 % random obstructions")
+    {
+        obstruction_layout<clk_lyt> layout{clk_lyt{{199, 199}, twoddwave_clocking<clk_lyt>()}};
+        obstruct_randomly(layout, 20, 42);
+
+        a_star_context<decltype(layout)> context{};
+
+        BENCHMARK("A*: dense coordinate index")
+        {
+            return a_star<layout_coordinate_path<decltype(layout)>>(layout, {{0, 0}, {199, 199}}, context);
+        };
+
+        BENCHMARK("JPS")
+        {
+            return jump_point_search<layout_coordinate_path<decltype(layout)>>(layout, {{0, 0}, {199, 199}});
+        };
+    }
+}
+
+TEST_CASE("Benchmark many short A* searches on a large layout", "[benchmark]")
+{
+    using lyt = cartesian_layout<offset::ucoord_t>;
+
+    const lyt layout{{999, 999}};
+
+    const auto route_short_paths = [&layout](auto&&... context)
+    {
+        uint64_t total_length = 0;
+
+        for (uint64_t i = 0; i < 100; ++i)
+        {
+            const coordinate<lyt> source{(i * 37) % 990, (i * 53) % 990};
+            const coordinate<lyt> target{source.x + 5, source.y + 5};
+
+            total_length += a_star<layout_coordinate_path<lyt>>(layout, {source, target}, context...).size();
+        }
+
+        return total_length;
+    };
+
+    BENCHMARK("A*: 100 searches without context")
+    {
+        return route_short_paths();
+    };
+
+    a_star_context<lyt> context{};
+
+    BENCHMARK("A*: 100 searches with reused context")
+    {
+        return route_short_paths(context);
+    };
+}
@@ -0,0 +1,43 @@
+//
+// Created by marcel on 19.10.26.
+//
+
+#ifndef FICTION_BENCHMARK_UTILS_HPP
+#define FICTION_BENCHMARK_UTILS_HPP
+
+#include <fiction/io/network_reader.hpp>
+#include <fiction/types.hpp>
+
+#include <fmt/format.h>
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+/**
+ * Reads a logic network from the `benchmarks` folder of the repository such that the benchmarks do not depend on the
+ * working directory they are executed in.
+ *
+ * @param path Path to the network file relative to the `benchmarks` folder, e.g., `"ISCAS85/c432.v"`.
+ * @return The network as a named AIG.
+ */
+inline fiction::aig_nt read_benchmark_network(const std::string_view& path)
+{
+    const auto filename = fmt::format("{}/../benchmarks/{}", TEST_PATH, path);
+
+    std::ostringstream errors{};
+
+    fiction::network_reader<fiction::aig_ptr> reader{filename, errors};
+
+    const auto networks = reader.get_networks();
+
+    if (networks.size() != 1)
+    {
+        throw std::runtime_error(fmt::format("could not read benchmark network '{}': {}", filename, errors.str()));
+    }
+
+    return *networks.front();
+}
+
+#endif  // FICTION_BENCHMARK_UTILS_HPP
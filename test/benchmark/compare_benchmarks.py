@@ -0,0 +1,211 @@
+#!/usr/bin/env python3
+"""Collects the results of fiction's Catch2 benchmarks and compares them against a stored baseline.
+
+The benchmark executables write their results via Catch2's XML reporter, e.g.,
+
+    ./bench_a_star --reporter console --reporter XML::out=bench_a_star.xml
+
+This script reads such XML files (or directories containing them), merges them into a single JSON document that can be
+stored as a baseline, and compares them against a previously stored baseline. A benchmark is reported as a regression if
+its mean runtime increased by more than the given threshold AND the confidence intervals of the two measurements do not
+overlap, which filters out most of the noise of shared machines. The exit code is 1 if any regression was found.
+
+Catch2's JSON reporter does not include benchmark statistics, which is why the XML reporter is used as input.
+"""
+
+from __future__ import annotations
+
+import argparse
+import json
+import sys
+import xml.etree.ElementTree as ET
+from pathlib import Path
+from typing import TYPE_CHECKING
+
+if TYPE_CHECKING:
+    from collections.abc import Iterable
+
+# separates the executable, test case, section, and benchmark names in the identifier of a benchmark
+SEPARATOR = " / "
+
+
+def parse_catch2_xml(path: Path) -> dict[str, dict[str, float]]:
+    """Extracts all benchmark results from a file written by Catch2's XML reporter.
+
+    Args:
+        path: Path to the XML file.
+
+    Returns:
+        A dictionary that maps the identifier of each benchmark to its statistics in nanoseconds.
+    """
+    root = ET.parse(path).getroot()
+    results: dict[str, dict[str, float]] = {}
+
+    def visit(element: ET.Element, scope: list[str]) -> None:
+        for child in element:
+            if child.tag in {"TestCase", "Section"}:
+                visit(child, [*scope, child.get("name", "")])
+            elif child.tag == "BenchmarkResults":
+                mean = child.find("mean")
+                std_dev = child.find("standardDeviation")
+                if mean is None or std_dev is None:
+                    continue
+
+                results[SEPARATOR.join([*scope, child.get("name", "")])] = {
+                    "mean": float(mean.get("value", "nan")),
+                    "lower bound": float(mean.get("lowerBound", "nan")),
+                    "upper bound": float(mean.get("upperBound", "nan")),
+                    "standard deviation": float(std_dev.get("value", "nan")),
+                    "samples": float(child.get("samples", "0")),
+                }
+            else:
+                visit(child, scope)
+
+    visit(root, [root.get("name") or path.stem])
+
+    return results
+
+
+def collect(paths: Iterable[Path]) -> dict[str, dict[str, float]]:
+    """Collects the benchmark results from the given files.
+
+    Args:
+        paths: Catch2 XML files, directories containing such files, or JSON files written by this script.
+
+    Returns:
+        A dictionary that maps the identifier of each benchmark to its statistics in nanoseconds.
+    """
+    results: dict[str, dict[str, float]] = {}
+
+    for path in paths:
+        if path.is_dir():
+            results.update(collect(sorted(path.glob("*.xml"))))
+        elif path.suffix == ".json":
+            results.update(json.loads(path.read_text(encoding="utf-8"))["benchmarks"])
+        else:
+            results.update(parse_catch2_xml(path))
+
+    return results
+
+
+def format_time(nanoseconds: float) -> str:
+    """Formats a duration with a suitable unit.
+
+    Args:
+        nanoseconds: Duration in nanoseconds.
+
+    Returns:
+        The formatted duration.
+    """
+    for unit, factor in (("s", 1e9), ("ms", 1e6), ("us", 1e3)):
+        if abs(nanoseconds) >= factor:
+            return f"{nanoseconds / factor:.3f} {unit}"
+
+    return f"{nanoseconds:.3f} ns"
+
+
+def compare(
+    baseline: dict[str, dict[str, float]], current: dict[str, dict[str, float]], threshold: float
+) -> tuple[list[str], list[str]]:
+    """Compares the current benchmark results against the baseline and prints a report.
+
+    Args:
+        baseline: Results of the baseline.
+        current: Results to compare.
+        threshold: Relative change of the mean runtime above which a benchmark counts as changed, e.g., 0.1 for 10 %.
+
+    Returns:
+        The identifiers of all regressed and all improved benchmarks.
+    """
+    regressions: list[str] = []
+    improvements: list[str] = []
+
+    width = max((len(name) for name in current.keys() | baseline.keys()), default=0)
+
+    print(f"{'benchmark':<{width}}  {'baseline':>12}  {'current':>12}  {'change':>9}")
+
+    for name, result in sorted(current.items()):
+        if name not in baseline:
+            print(f"{name:<{width}}  {'':>12}  {format_time(result['mean']):>12}  {'':>9}  new")
+            continue
+
+        base = baseline[name]
+        change = result["mean"] / base["mean"] - 1.0 if base["mean"] > 0 else 0.0
+        status = ""
+
+        if change > threshold and result["lower bound"] > base["upper bound"]:
+            status = "REGRESSION"
+            regressions.append(name)
+        elif change < -threshold and result["upper bound"] < base["lower bound"]:
+            status = "improvement"
+            improvements.append(name)
+
+        print(
+            f"{name:<{width}}  {format_time(base['mean']):>12}  {format_time(result['mean']):>12}  "
+            f"{change:>+9.1%}  {status}".rstrip()
+        )
+
+    for name in sorted(baseline.keys() - current.keys()):
+        print(f"{name:<{width}}  {format_time(baseline[name]['mean']):>12}  {'':>12}  {'':>9}  missing")
+
+    return regressions, improvements
+
+
+def main() -> int:
+    """Runs the script.
+
+    Returns:
+        The exit code.
+    """
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument(
+        "results", nargs="+", type=Path, help="Catch2 XML files, directories containing them, or JSON result files"
+    )
+    parser.add_argument("--baseline", type=Path, help="JSON file with the baseline results to compare against")
+    parser.add_argument(
+        "--threshold",
+        type=float,
+        default=0.1,
+        help="relative change of the mean runtime above which a benchmark counts as changed (default: 0.1)",
+    )
+    parser.add_argument("--output", type=Path, help="JSON file to write the collected results to")
+    parser.add_argument(
+        "--update-baseline", action="store_true", help="overwrite the baseline with the collected results"
+    )
+    args = parser.parse_args()
+
+    current = collect(args.results)
+
+    if not current:
+        print("[e] no benchmark results found", file=sys.stderr)
+        return 1
+
+    document = json.dumps({"benchmarks": current}, indent=2, sort_keys=True) + "\n"
+
+    if args.output:
+        args.output.write_text(document, encoding="utf-8")
+
+    if args.baseline is None:
+        return 0
+
+    if args.update_baseline:
+        args.baseline.write_text(document, encoding="utf-8")
+        print(f"[i] stored {len(current)} benchmark results as baseline in '{args.baseline}'")
+        return 0
+
+    if not args.baseline.exists():
+        print(f"[w] baseline '{args.baseline}' does not exist; nothing to compare against", file=sys.stderr)
+        return 0
+
+    regressions, improvements = compare(collect([args.baseline]), current, args.threshold)
+
+    print(
+        f"\n[i] compared {len(current)} benchmarks against '{args.baseline}': "
+        f"{len(regressions)} regression(s), {len(improvements)} improvement(s)"
+    )
+
+    return 1 if regressions else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
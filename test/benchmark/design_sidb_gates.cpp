@@ -0,0 +1,65 @@
+//
+// Created by marcel on 19.10.26.
+//
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include "../utils/blueprints/layout_blueprints.hpp"
+
+#include <fiction/algorithms/iter/bdl_input_iterator.hpp>
+#include <fiction/algorithms/physical_design/design_sidb_gates.hpp>
+#include <fiction/algorithms/simulation/sidb/is_operational.hpp>
+#include <fiction/algorithms/simulation/sidb/sidb_simulation_engine.hpp>
+#include <fiction/algorithms/simulation/sidb/sidb_simulation_parameters.hpp>
+#include <fiction/layouts/coordinates.hpp>
+#include <fiction/types.hpp>
+#include <fiction/utils/truth_table_utils.hpp>
+
+#include <vector>
+
+using namespace fiction;
+
+TEST_CASE("Benchmark SiDB gate design", "[benchmark]")
+{
+    using lattice = sidb_100_cell_clk_lyt_siqad;
+    using params  = design_sidb_gates_params<cell<lattice>>;
+
+    const auto skeleton = blueprints::two_input_one_output_skeleton_west_west<lattice>();
+
+    const std::vector<tt> spec{create_and_tt()};
+
+    params ps{is_operational_params{sidb_simulation_parameters{2, -0.31}, sidb_simulation_engine::QUICKEXACT,
+                                    bdl_input_iterator_params{},
+                                    is_operational_params::operational_condition::REJECT_KINKS},
+              params::design_sidb_gates_mode::QUICKCELL,
+              {{27, 6, 0}, {30, 8, 0}},
+              3,
+              params::termination_condition::ALL_COMBINATIONS_ENUMERATED};
+
+    BENCHMARK("QuickCell: all gates")
+    {
+        return design_sidb_gates(skeleton, spec, ps);
+    };
+
+    ps.design_mode = params::design_sidb_gates_mode::AUTOMATIC_EXHAUSTIVE_GATE_DESIGNER;
+
+    BENCHMARK("exhaustive: all gates")
+    {
+        return design_sidb_gates(skeleton, spec, ps);
+    };
+
+    ps.termination_cond = params::termination_condition::AFTER_FIRST_SOLUTION;
+
+    BENCHMARK("exhaustive: first gate")
+    {
+        return design_sidb_gates(skeleton, spec, ps);
+    };
+
+    ps.design_mode = params::design_sidb_gates_mode::RANDOM;
+
+    BENCHMARK("random: first gate")
+    {
+        return design_sidb_gates(skeleton, spec, ps);
+    };
+}
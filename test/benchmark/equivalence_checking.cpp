@@ -0,0 +1,43 @@
+//
+// Created by marcel on 19.10.26.
+//
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include "benchmark_utils.hpp"
+
+#include <fiction/algorithms/physical_design/orthogonal.hpp>
+#include <fiction/algorithms/verification/equivalence_checking.hpp>
+#include <fiction/types.hpp>
+
+#include <array>
+
+using namespace fiction;
+
+TEST_CASE("Benchmark equivalence checking of layouts against their specifications", "[benchmark]")
+{
+    static constexpr const std::array networks{"trindade16/FA.v", "fontes18/parity.v", "ISCAS85/c432.v",
+                                               "ISCAS85/c880.v", "ISCAS85/c1908.v"};
+
+    for (const auto* const name : networks)
+    {
+        DYNAMIC_SECTION(name)
+        {
+            const auto ntk    = read_benchmark_network(name);
+            const auto layout = orthogonal<cart_gate_clk_lyt>(ntk);
+
+            REQUIRE(equivalence_checking(ntk, layout) != eq_type::NO);
+
+            BENCHMARK("network vs. layout")
+            {
+                return equivalence_checking(ntk, layout);
+            };
+
+            BENCHMARK("layout vs. layout")
+            {
+                return equivalence_checking(layout, layout);
+            };
+        }
+    }
+}
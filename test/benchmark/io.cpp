@@ -0,0 +1,148 @@
+//
+// Created by marcel on 19.10.26.
+//
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include "benchmark_utils.hpp"
+
+#include <fiction/algorithms/physical_design/apply_gate_library.hpp>
+#include <fiction/algorithms/physical_design/orthogonal.hpp>
+#include <fiction/io/read_fbl_layout.hpp>
+#include <fiction/io/read_fgl_layout.hpp>
+#include <fiction/io/read_sqd_layout.hpp>
+#include <fiction/io/write_fbl_layout.hpp>
+#include <fiction/io/write_fgl_layout.hpp>
+#include <fiction/io/write_sqd_layout.hpp>
+#include <fiction/technology/cell_technologies.hpp>
+#include <fiction/technology/qca_one_library.hpp>
+#include <fiction/types.hpp>
+
+#include <cstdint>
+#include <sstream>
+
+using namespace fiction;
+
+TEST_CASE("Benchmark reading Verilog networks", "[benchmark]")
+{
+    BENCHMARK("Verilog: c432")
+    {
+        return read_benchmark_network("ISCAS85/c432.v");
+    };
+
+    BENCHMARK("Verilog: c7552")
+    {
+        return read_benchmark_network("ISCAS85/c7552.v");
+    };
+}
+
+TEST_CASE("Benchmark gate-level layout IO", "[benchmark]")
+{
+    const auto layout = orthogonal<cart_gate_clk_lyt>(read_benchmark_network("ISCAS85/c5315.v"));
+
+    std::ostringstream fgl_stream{};
+    write_fgl_layout(layout, fgl_stream);
+    const auto fgl = fgl_stream.str();
+
+    std::ostringstream fbl_stream{};
+    write_fbl_layout(layout, fbl_stream);
+    const auto fbl = fbl_stream.str();
+
+    BENCHMARK("FGL: write")
+    {
+        std::ostringstream os{};
+        write_fgl_layout(layout, os);
+        return os.str().size();
+    };
+
+    BENCHMARK("FGL: read")
+    {
+        std::istringstream is{fgl};
+        return read_fgl_layout<cart_gate_clk_lyt>(is);
+    };
+
+    BENCHMARK("FBL: write")
+    {
+        std::ostringstream os{};
+        write_fbl_layout(layout, os);
+        return os.str().size();
+    };
+
+    BENCHMARK("FBL: read")
+    {
+        std::istringstream is{fbl};
+        return read_fbl_layout<cart_gate_clk_lyt>(is);
+    };
+}
+
+TEST_CASE("Benchmark QCA cell-level layout IO", "[benchmark]")
+{
+    const auto layout = apply_gate_library<qca_cell_clk_lyt, qca_one_library>(
+        orthogonal<cart_gate_clk_lyt>(read_benchmark_network("ISCAS85/c432.v")));
+
+    std::ostringstream fbl_stream{};
+    write_fbl_layout(layout, fbl_stream);
+    const auto fbl = fbl_stream.str();
+
+    BENCHMARK("FBL: write")
+    {
+        std::ostringstream os{};
+        write_fbl_layout(layout, os);
+        return os.str().size();
+    };
+
+    BENCHMARK("FBL: read")
+    {
+        std::istringstream is{fbl};
+        return read_fbl_layout<qca_cell_clk_lyt>(is);
+    };
+}
+
+TEST_CASE("Benchmark SiDB cell-level layout IO", "[benchmark]")
+{
+    // a dense block of 20,000 SiDBs
+    sidb_100_cell_clk_lyt layout{{199, 99}, "SiDB block"};
+
+    for (uint64_t y = 0; y < 100; ++y)
+    {
+        for (uint64_t x = 0; x < 200; ++x)
+        {
+            layout.assign_cell_type({x, y}, sidb_technology::cell_type::NORMAL);
+        }
+    }
+
+    std::ostringstream sqd_stream{};
+    write_sqd_layout(layout, sqd_stream);
+    const auto sqd = sqd_stream.str();
+
+    std::ostringstream fbl_stream{};
+    write_fbl_layout(layout, fbl_stream);
+    const auto fbl = fbl_stream.str();
+
+    BENCHMARK("SQD: write")
+    {
+        std::ostringstream os{};
+        write_sqd_layout(layout, os);
+        return os.str().size();
+    };
+
+    BENCHMARK("SQD: read")
+    {
+        std::istringstream is{sqd};
+        return read_sqd_layout<sidb_100_cell_clk_lyt>(is);
+    };
+
+    BENCHMARK("FBL: write")
+    {
+        std::ostringstream os{};
+        write_fbl_layout(layout, os);
+        return os.str().size();
+    };
+
+    BENCHMARK("FBL: read")
+    {
+        std::istringstream is{fbl};
+        return read_fbl_layout<sidb_100_cell_clk_lyt>(is);
+    };
+}
@@ -0,0 +1,70 @@
+//
+// Created by marcel on 19.10.26.
+//
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <fiction/algorithms/simulation/sidb/operational_domain.hpp>
+#include <fiction/algorithms/simulation/sidb/sidb_simulation_parameters.hpp>
+#include <fiction/technology/cell_technologies.hpp>
+#include <fiction/types.hpp>
+#include <fiction/utils/truth_table_utils.hpp>
+
+#include <vector>
+
+using namespace fiction;
+
+TEST_CASE("Benchmark operational domain computation", "[benchmark]")
+{
+    // SiQAD's AND gate
+    sidb_100_cell_clk_lyt_siqad lyt{};
+
+    lyt.assign_cell_type({0, 0, 1}, sidb_technology::cell_type::INPUT);
+    lyt.assign_cell_type({2, 1, 1}, sidb_technology::cell_type::INPUT);
+
+    lyt.assign_cell_type({20, 0, 1}, sidb_technology::cell_type::INPUT);
+    lyt.assign_cell_type({18, 1, 1}, sidb_technology::cell_type::INPUT);
+
+    lyt.assign_cell_type({4, 2, 1}, sidb_technology::cell_type::NORMAL);
+    lyt.assign_cell_type({6, 3, 1}, sidb_technology::cell_type::NORMAL);
+
+    lyt.assign_cell_type({14, 3, 1}, sidb_technology::cell_type::NORMAL);
+    lyt.assign_cell_type({16, 2, 1}, sidb_technology::cell_type::NORMAL);
+
+    lyt.assign_cell_type({10, 6, 0}, sidb_technology::cell_type::OUTPUT);
+    lyt.assign_cell_type({10, 7, 0}, sidb_technology::cell_type::OUTPUT);
+
+    lyt.assign_cell_type({10, 9, 1}, sidb_technology::cell_type::NORMAL);
+
+    const std::vector<tt> spec{create_and_tt()};
+
+    sidb_simulation_parameters sim_params{};
+    sim_params.base     = 2;
+    sim_params.mu_minus = -0.28;
+
+    operational_domain_params params{};
+    params.operational_params.simulation_parameters = sim_params;
+    params.sweep_dimensions                         = {{sweep_parameter::EPSILON_R, 5.1, 6.0, 0.1},
+                                                       {sweep_parameter::LAMBDA_TF, 4.5, 5.4, 0.1}};
+
+    BENCHMARK("grid search")
+    {
+        return operational_domain_grid_search(lyt, spec, params);
+    };
+
+    BENCHMARK("random sampling")
+    {
+        return operational_domain_random_sampling(lyt, spec, 100, params);
+    };
+
+    BENCHMARK("flood fill")
+    {
+        return operational_domain_flood_fill(lyt, spec, 1, params);
+    };
+
+    BENCHMARK("contour tracing")
+    {
+        return operational_domain_contour_tracing(lyt, spec, 1, params);
+    };
+}
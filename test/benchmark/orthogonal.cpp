@@ -0,0 +1,120 @@
+//
+// Created by marcel on 19.10.26.
+//
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <fiction/algorithms/physical_design/orthogonal.hpp>
+#include <fiction/layouts/cartesian_layout.hpp>
+#include <fiction/layouts/clocked_layout.hpp>
+#include <fiction/layouts/coordinates.hpp>
+#include <fiction/layouts/gate_level_layout.hpp>
+#include <fiction/layouts/tile_based_layout.hpp>
+
+#include <fmt/format.h>
+#include <mockturtle/generators/random_network.hpp>
+#include <mockturtle/networks/aig.hpp>
+#include <mockturtle/utils/stopwatch.hpp>
+
+#include <cstdint>
+#include <iostream>
+#include <ostream>
+#include <streambuf>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/resource.h>
+#endif
+
+using namespace fiction;
+
+/**
+ * Returns the peak resident set size of this process in KiB or 0 if it cannot be determined on this platform. Since
+ * the peak never decreases, sections that are supposed to use less memory have to run first.
+ */
+uint64_t peak_rss_kib() noexcept
+{
+#if defined(__unix__) || defined(__APPLE__)
+    rusage usage{};
+    if (getrusage(RUSAGE_SELF, &usage) == 0)
+    {
+#if defined(__APPLE__)
+        return static_cast<uint64_t>(usage.ru_maxrss) / 1024;  // bytes on macOS
+#else
+        return static_cast<uint64_t>(usage.ru_maxrss);  // KiB on Linux
+#endif
+    }
+#endif
+    return 0;
+}
+/**
+ * Stream buffer that discards all output such that only the generation of the FGL data is measured.
+ */
+class null_buffer : public std::streambuf
+{
+  protected:
+    int overflow(int c) override
+    {
+        return c;
+    }
+};
+
+TEST_CASE("Benchmark orthogonal on large random networks", "[benchmark]")
+{
+    using gate_layout = gate_level_layout<clocked_layout<tile_based_layout<cartesian_layout<offset::ucoord_t>>>>;
+
+    mockturtle::random_network_generator_params_size gen_ps{};
+    gen_ps.seed      = 42;
+    gen_ps.num_pis   = 64;
+    gen_ps.num_gates = 2000;
+
+    const auto ntk = mockturtle::random_aig_generator(gen_ps).generate();
+
+    const auto report = [&ntk](const char* mode, const orthogonal_physical_design_stats& st)
+    {
+        const auto secs = mockturtle::to_seconds(st.time_total);
+
+        std::cout << fmt::format("[i] {:<10} | {} × {} tiles | {} gates, {} wires | {:.0f} nodes/s | "
+                                 "peak RSS {} KiB\n",
+                                 mode, st.x_size, st.y_size, st.num_gates, st.num_wires,
+                                 secs > 0.0 ? static_cast<double>(ntk.size()) / secs : 0.0, peak_rss_kib());
+    };
+
+    // streaming has to come first as the peak RSS is monotone
+    SECTION("streaming to FGL")
+    {
+        null_buffer  buffer{};
+        std::ostream null_stream{&buffer};
+
+        orthogonal_physical_design_stats st{};
+        write_orthogonal_fgl_layout<gate_layout>(ntk, null_stream, {}, &st);
+        report("streaming", st);
+
+        BENCHMARK("orthogonal: streaming to FGL")
+        {
+            write_orthogonal_fgl_layout<gate_layout>(ntk, null_stream);
+        };
+    }
+    SECTION("in-memory layout")
+    {
+        orthogonal_physical_design_stats st{};
+        orthogonal<gate_layout>(ntk, {}, &st);
+        report("default", st);
+
+        BENCHMARK("orthogonal: default")
+        {
+            return orthogonal<gate_layout>(ntk);
+        };
+
+        orthogonal_physical_design_params two_pass_ps{};
+        two_pass_ps.two_pass = true;
+
+        orthogonal<gate_layout>(ntk, two_pass_ps, &st);
+        report("two-pass", st);
+
+        BENCHMARK("orthogonal: two-pass")
+        {
+            return orthogonal<gate_layout>(ntk, two_pass_ps);
+        };
+    }
+}
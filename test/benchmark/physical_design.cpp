@@ -0,0 +1,86 @@
+//
+// Created by marcel on 19.10.26.
+//
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include "benchmark_utils.hpp"
+
+#include <fiction/algorithms/physical_design/exact.hpp>
+#include <fiction/algorithms/physical_design/graph_oriented_layout_design.hpp>
+#include <fiction/algorithms/physical_design/orthogonal.hpp>
+#include <fiction/types.hpp>
+
+#include <array>
+
+using namespace fiction;
+
+// each network is benchmarked in a section of its own such that results can be compared network by network
+
+TEST_CASE("Benchmark orthogonal on benchmark networks", "[benchmark]")
+{
+    static constexpr const std::array networks{"trindade16/mux21.v", "trindade16/FA.v", "fontes18/parity.v",
+                                               "fontes18/cm82a_5.v", "ISCAS85/c432.v",  "ISCAS85/c880.v",
+                                               "ISCAS85/c1908.v",    "ISCAS85/c5315.v", "ISCAS85/c7552.v"};
+
+    for (const auto* const name : networks)
+    {
+        DYNAMIC_SECTION(name)
+        {
+            const auto ntk = read_benchmark_network(name);
+
+            BENCHMARK("orthogonal")
+            {
+                return orthogonal<cart_gate_clk_lyt>(ntk);
+            };
+        }
+    }
+}
+
+TEST_CASE("Benchmark gold on benchmark networks", "[benchmark]")
+{
+    static constexpr const std::array networks{"trindade16/mux21.v", "trindade16/xor2.v", "trindade16/HA.v",
+                                               "trindade16/par_gen.v", "fontes18/1bitAdderAOIG.v"};
+
+    graph_oriented_layout_design_params params{};
+    params.mode = graph_oriented_layout_design_params::effort_mode::HIGH_EFFICIENCY;
+
+    for (const auto* const name : networks)
+    {
+        DYNAMIC_SECTION(name)
+        {
+            auto ntk = read_benchmark_network(name);
+
+            BENCHMARK("gold: high efficiency")
+            {
+                return graph_oriented_layout_design<cart_gate_clk_lyt>(ntk, params);
+            };
+        }
+    }
+}
+
+#if (FICTION_Z3_SOLVER)
+TEST_CASE("Benchmark exact on benchmark networks", "[benchmark]")
+{
+    static constexpr const std::array networks{"trindade16/mux21.v", "trindade16/xor2.v", "trindade16/xnor2.v",
+                                               "trindade16/HA.v", "fontes18/xor.v"};
+
+    exact_physical_design_params params{};
+    params.crossings = true;
+    params.border_io = true;
+
+    for (const auto* const name : networks)
+    {
+        DYNAMIC_SECTION(name)
+        {
+            const auto ntk = read_benchmark_network(name);
+
+            BENCHMARK("exact: 2DDWave")
+            {
+                return exact<cart_gate_clk_lyt>(ntk, params);
+            };
+        }
+    }
+}
+#endif  // FICTION_Z3_SOLVER
@@ -0,0 +1,133 @@
+//
+// Created by marcel on 19.10.26.
+//
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include <fiction/io/read_sidb_surface_defects.hpp>
+#include <fiction/technology/sidb_defect_surface.hpp>
+#include <fiction/technology/sidb_defects.hpp>
+#include <fiction/types.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <regex>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace fiction;
+
+using lattice = sidb_cell_clk_lyt;
+
+/**
+ * Generates a defect matrix in the format printed by Python of the given size in which roughly the given percentage of
+ * positions are defective.
+ */
+std::string generate_defect_matrix(const uint32_t width, const uint32_t height, const uint32_t percentage,
+                                   const uint32_t seed)
+{
+    std::mt19937                            generator{seed};
+    std::uniform_int_distribution<uint32_t> defect_distribution{0u, 99u};
+    std::uniform_int_distribution<uint32_t> index_distribution{1u, 10u};
+
+    std::ostringstream matrix{};
+
+    matrix << '[';
+
+    for (uint32_t y = 0; y < height; ++y)
+    {
+        matrix << (y == 0 ? "[" : " [");
+
+        for (uint32_t x = 0; x < width; ++x)
+        {
+            matrix << (defect_distribution(generator) < percentage ? index_distribution(generator) : 0u)
+                   << (x + 1 < width ? " " : "");
+        }
+
+        matrix << (y + 1 < height ? "]\n" : "]");
+    }
+
+    matrix << ']';
+
+    return matrix.str();
+}
+/**
+ * The previous `std::regex`-based parser, which serves as the baseline.
+ */
+sidb_defect_surface<lattice> read_sidb_surface_defects_regex(const std::string& defect_matrix)
+{
+    static const std::regex re_defect_matrix{R"(\[(?:\s*\d+\s*)+\])"};
+    static const std::regex re_row_indices{R"((\d+))"};
+
+    sidb_defect_surface<lattice> lyt{lattice{}};
+
+    const std::vector<std::smatch> matrix_matches{
+        std::sregex_iterator(std::cbegin(defect_matrix), std::cend(defect_matrix), re_defect_matrix),
+        std::sregex_iterator()};
+
+    uint64_t max_x = 0;
+
+    for (auto y = 0u; y < matrix_matches.size(); ++y)
+    {
+        const auto row_str = matrix_matches[y].str();
+
+        const std::vector<std::smatch> row_matches{
+            std::sregex_iterator(std::cbegin(row_str), std::cend(row_str), re_row_indices), std::sregex_iterator()};
+
+        max_x = std::max(max_x, static_cast<uint64_t>(row_matches.size() - 1));
+
+        for (auto x = 0u; x < row_matches.size(); ++x)
+        {
+            const auto defect_index = static_cast<std::size_t>(std::stoi(row_matches[x].str()));
+
+            lyt.assign_sidb_defect({x, y}, sidb_defect{detail::sidb_defects::INDEX_TO_DEFECT.at(defect_index)});
+        }
+    }
+
+    lyt.resize({max_x, matrix_matches.empty() ? 0 : matrix_matches.size() - 1});
+
+    return lyt;
+}
+
+TEST_CASE("Benchmark reading SiDB surface defects", "[benchmark]")
+{
+    // std::regex recurses per character of a match, which limits the length of the rows the baseline can handle
+    const auto defect_matrix = generate_defect_matrix(250, 2000, 5, 42);
+
+    const auto filename = (std::filesystem::temp_directory_path() / "fiction_benchmark_surface_defects.txt").string();
+
+    {
+        std::ofstream file{filename};
+        file << defect_matrix;
+    }
+
+    const auto surface = read_sidb_surface_defects<lattice>(filename);
+
+    REQUIRE(surface.x() == 249);
+    REQUIRE(surface.y() == 1999);
+    REQUIRE(surface.num_defects() == read_sidb_surface_defects_regex(defect_matrix).num_defects());
+
+    BENCHMARK("regex parser")
+    {
+        return read_sidb_surface_defects_regex(defect_matrix);
+    };
+
+    BENCHMARK("hand-written parser: stream")
+    {
+        std::istringstream is{defect_matrix};
+        return read_sidb_surface_defects<lattice>(is);
+    };
+
+    BENCHMARK("hand-written parser: memory-mapped file")
+    {
+        return read_sidb_surface_defects<lattice>(filename);
+    };
+
+    std::filesystem::remove(filename);
+}
@@ -311,3 +311,50 @@ TEST_CASE("Benchmark ClusterComplete", "[benchmark]")
 //      (single-threaded)                   100                 1                       18.5153 s
 //                                          187.65 ms           187.029 ms              188.333 ms
 //                                          3.31611 ms          2.83437 ms              4.32337 ms
+
+TEST_CASE("Benchmark simulator scaling over the number of SiDBs", "[benchmark]")
+{
+    // BDL wire with the given number of BDL pairs that is driven by an input perturber
+    const auto create_bdl_wire = [](const uint64_t num_pairs)
+    {
+        lattice_siqad lyt{};
+
+        lyt.assign_cell_type({0, 0, 0}, sidb_technology::cell_type::NORMAL);
+
+        for (uint64_t i = 1; i <= num_pairs; ++i)
+        {
+            lyt.assign_cell_type({6 * i, 0, 0}, sidb_technology::cell_type::NORMAL);
+            lyt.assign_cell_type({6 * i + 2, 0, 0}, sidb_technology::cell_type::NORMAL);
+        }
+
+        return lyt;
+    };
+
+    for (const auto num_pairs : {uint64_t{3}, uint64_t{6}, uint64_t{9}})
+    {
+        const auto lyt = create_bdl_wire(num_pairs);
+
+        DYNAMIC_SECTION(lyt.num_cells() << " SiDBs")
+        {
+            BENCHMARK("QuickExact")
+            {
+                const quickexact_params<cell<lattice_siqad>> sim_params{sidb_simulation_parameters{2, -0.32}};
+                return quickexact<lattice_siqad>(lyt, sim_params);
+            };
+
+            BENCHMARK("QuickSim")
+            {
+                const quicksim_params quicksim_params{sidb_simulation_parameters{2, -0.32}};
+                return quicksim<lattice_siqad>(lyt, quicksim_params);
+            };
+
+#if (FICTION_ALGLIB_ENABLED)
+            BENCHMARK("ClusterComplete")
+            {
+                const clustercomplete_params<cell<lattice_siqad>> sim_params{sidb_simulation_parameters{3, -0.32}};
+                return clustercomplete<lattice_siqad>(lyt, sim_params);
+            };
+#endif  // FICTION_ALGLIB_ENABLED
+        }
+    }
+}
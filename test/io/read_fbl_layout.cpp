@@ -0,0 +1,176 @@
+//
+// Created by marcel on 19.10.26.
+//
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "utils/blueprints/layout_blueprints.hpp"
+
+#include <fiction/io/read_fbl_layout.hpp>
+#include <fiction/io/write_fbl_layout.hpp>
+#include <fiction/technology/cell_technologies.hpp>
+#include <fiction/types.hpp>
+
+#include <cstddef>
+#include <sstream>
+#include <string>
+
+using namespace fiction;
+
+namespace
+{
+
+template <typename Lyt>
+[[nodiscard]] std::string write_to_string(const Lyt& lyt)
+{
+    std::ostringstream os{};
+    write_fbl_layout(lyt, os);
+
+    return os.str();
+}
+
+[[nodiscard]] sidb_100_cell_clk_lyt sidb_layout()
+{
+    sidb_100_cell_clk_lyt layout{{4, 2}, "SiDB"};
+
+    layout.assign_cell_type({0, 0}, sidb_technology::cell_type::INPUT);
+    layout.assign_cell_type({2, 1}, sidb_technology::cell_type::NORMAL);
+    layout.assign_cell_type({4, 2}, sidb_technology::cell_type::OUTPUT);
+
+    return layout;
+}
+
+}  // namespace
+
+TEST_CASE("Read FBL layout info", "[read-fbl-layout]")
+{
+    SECTION("gate-level layout")
+    {
+        std::istringstream is{write_to_string(blueprints::and_or_gate_layout<hex_odd_row_gate_clk_lyt>())};
+
+        const auto info = read_fbl_layout_info(is);
+
+        CHECK(info.version == 1);
+        CHECK(info.is_gate_level);
+        CHECK(info.topology == "odd_row_hex");
+        CHECK(info.technology.empty());
+        CHECK(info.lattice_orientation.empty());
+    }
+    SECTION("cell-level layout")
+    {
+        std::istringstream is{write_to_string(sidb_layout())};
+
+        const auto info = read_fbl_layout_info(is);
+
+        CHECK(!info.is_gate_level);
+        CHECK(info.topology == "cartesian");
+        CHECK(info.technology == "SiDB");
+        CHECK(info.lattice_orientation == "100");
+        CHECK(info.name == "SiDB");
+    }
+}
+
+TEST_CASE("Read SiDB layout without lattice orientation", "[read-fbl-layout]")
+{
+    std::istringstream is{write_to_string(sidb_layout())};
+
+    const auto layout = read_fbl_layout<sidb_cell_clk_lyt>(is);
+
+    CHECK(layout.num_cells() == 3);
+    CHECK(layout.get_cell_type({2, 1}) == sidb_technology::cell_type::NORMAL);
+}
+
+TEST_CASE("Parsing error: not an FBL file", "[read-fbl-layout]")
+{
+    std::istringstream is{"<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n<fgl>\n</fgl>\n"};
+
+    CHECK_THROWS_AS(read_fbl_layout<cart_gate_clk_lyt>(is), fbl_parsing_error);
+}
+
+TEST_CASE("Parsing error: unsupported format version", "[read-fbl-layout]")
+{
+    auto contents = write_to_string(sidb_layout());
+
+    // the version is stored right after the 4-byte magic number
+    contents[4] = 2;
+
+    std::istringstream is{contents};
+
+    CHECK_THROWS_AS(read_fbl_layout<sidb_100_cell_clk_lyt>(is), fbl_parsing_error);
+}
+
+TEST_CASE("Parsing error: unknown clocking scheme", "[read-fbl-layout]")
+{
+    auto contents = write_to_string(sidb_layout());
+
+    // header of 22 bytes, followed by the length-prefixed layout name and clocking scheme name
+    contents[22 + 4 + 4 + 4] = '?';
+
+    std::istringstream is{contents};
+
+    CHECK_THROWS_AS(read_fbl_layout<sidb_100_cell_clk_lyt>(is), fbl_parsing_error);
+}
+
+TEST_CASE("Parsing error: unexpected end of file", "[read-fbl-layout]")
+{
+    const auto gate_contents = write_to_string(blueprints::xor_maj_gate_layout<cart_gate_clk_lyt>());
+
+    for (std::size_t i = 0; i < gate_contents.size(); ++i)
+    {
+        std::istringstream is{gate_contents.substr(0, i)};
+
+        CHECK_THROWS_AS(read_fbl_layout<cart_gate_clk_lyt>(is), fbl_parsing_error);
+    }
+
+    const auto cell_contents = write_to_string(sidb_layout());
+
+    for (std::size_t i = 0; i < cell_contents.size(); ++i)
+    {
+        std::istringstream is{cell_contents.substr(0, i)};
+
+        CHECK_THROWS_AS(read_fbl_layout<sidb_100_cell_clk_lyt>(is), fbl_parsing_error);
+    }
+}
+
+TEST_CASE("Parsing error: layout type mismatch", "[read-fbl-layout]")
+{
+    const auto gate_contents = write_to_string(blueprints::and_or_gate_layout<cart_gate_clk_lyt>());
+    const auto cell_contents = write_to_string(sidb_layout());
+
+    SECTION("Lyt is not a gate-level layout")
+    {
+        std::istringstream is{gate_contents};
+
+        CHECK_THROWS_AS(read_fbl_layout<sidb_100_cell_clk_lyt>(is), fbl_parsing_error);
+    }
+    SECTION("Lyt is not a cell-level layout")
+    {
+        std::istringstream is{cell_contents};
+
+        CHECK_THROWS_AS(read_fbl_layout<cart_gate_clk_lyt>(is), fbl_parsing_error);
+    }
+    SECTION("Lyt is not a cartesian layout")
+    {
+        std::istringstream is{gate_contents};
+
+        CHECK_THROWS_AS(read_fbl_layout<hex_even_row_gate_clk_lyt>(is), fbl_parsing_error);
+    }
+    SECTION("Lyt is not an odd_row_cartesian layout")
+    {
+        std::istringstream is{write_to_string(blueprints::and_or_gate_layout<cart_odd_row_gate_clk_lyt>())};
+
+        CHECK_THROWS_AS(read_fbl_layout<cart_even_row_gate_clk_lyt>(is), fbl_parsing_error);
+    }
+    SECTION("Lyt does not implement the SiDB technology")
+    {
+        std::istringstream is{cell_contents};
+
+        CHECK_THROWS_AS(read_fbl_layout<qca_cell_clk_lyt>(is), fbl_parsing_error);
+    }
+    SECTION("Lyt does not have the lattice orientation 100")
+    {
+        std::istringstream is{cell_contents};
+
+        CHECK_THROWS_AS(read_fbl_layout<sidb_111_cell_clk_lyt>(is), fbl_parsing_error);
+    }
+}
@@ -11,8 +11,11 @@
 #include <fiction/layouts/hexagonal_layout.hpp>
 #include <fiction/technology/cell_technologies.hpp>
 
+#include <filesystem>
+#include <fstream>
 #include <sstream>
 #include <string>
+#include <string_view>
 #include <type_traits>
 
 using namespace fiction;
@@ -173,3 +176,40 @@ TEMPLATE_TEST_CASE(
         }
     }
 }
+
+TEMPLATE_TEST_CASE(
+    "Read defective surface from file", "[read-sidb-surface-defects]",
+    (cell_level_layout<sidb_technology, clocked_layout<cartesian_layout<offset::ucoord_t>>>),
+    (cell_level_layout<sidb_technology, clocked_layout<hexagonal_layout<offset::ucoord_t, odd_row_hex>>>),
+    (cell_level_layout<sidb_technology, clocked_layout<hexagonal_layout<offset::ucoord_t, even_row_hex>>>),
+    (cell_level_layout<sidb_technology, clocked_layout<hexagonal_layout<offset::ucoord_t, odd_column_hex>>>),
+    (cell_level_layout<sidb_technology, clocked_layout<hexagonal_layout<offset::ucoord_t, even_column_hex>>>))
+{
+    // line breaks and tabs as printed by numpy for wide matrices
+    static constexpr const char* sidb_surface = "[[ 0  1  0\t0]\n"
+                                                " [ 0  0  0 10]\n"
+                                                " [ 3  0  0  0]]\n";
+
+    const auto filename = (std::filesystem::temp_directory_path() / "fiction_read_sidb_surface_defects.txt").string();
+
+    {
+        std::ofstream file{filename};
+        file << sidb_surface;
+    }
+
+    const auto lyt = read_sidb_surface_defects<TestType>(filename, "surface");
+
+    std::filesystem::remove(filename);
+
+    CHECK(lyt.get_layout_name() == "surface");
+    CHECK(lyt.x() == 3);
+    CHECK(lyt.y() == 2);
+    CHECK(lyt.num_defects() == 3);
+
+    CHECK(lyt.get_sidb_defect({1, 0}).type == sidb_defect_type::DB);
+    CHECK(lyt.get_sidb_defect({3, 1}).type == sidb_defect_type::MISSING_DIMER);
+    CHECK(lyt.get_sidb_defect({0, 2}).type == sidb_defect_type::DIHYDRIDE_PAIR);
+
+    CHECK_THROWS_AS(read_sidb_surface_defects<TestType>(std::string_view{"this_file_does_not_exist.txt"}),
+                    std::ifstream::failure);
+}
@@ -17,7 +17,10 @@
 #include <fiction/traits.hpp>
 #include <fiction/types.hpp>
 
+#include <ios>
+#include <istream>
 #include <sstream>
+#include <string>
 #include <unordered_set>
 
 using namespace fiction;
@@ -1151,3 +1154,124 @@ TEST_CASE("SQD parsing error: missing 'lambda_tf' attribute in <coulomb> element
         sidb_defect_surface<cell_level_layout<sidb_technology, clocked_layout<cartesian_layout<offset::ucoord_t>>>>>;
     CHECK_THROWS_AS(read_sqd_layout<sidb_layout>(layout_stream), sqd_parsing_error);
 }
+
+TEST_CASE("Read SQD layout with comments, CDATA sections, and character references", "[sqd]")
+{
+    static constexpr const char* sqd_layout = "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+                                              "<!DOCTYPE siqad>\n"
+                                              "<!-- created by hand -->\n"
+                                              "<siqad>\n"
+                                              "    <layers>\n"
+                                              "        <layer_prop>\n"
+                                              "            <lat_vec>\n"
+                                              "                <name>Si(100) 2x1</name>\n"
+                                              "            </lat_vec>\n"
+                                              "        </layer_prop>\n"
+                                              "    </layers>\n"
+                                              "  <design>\n"
+                                              "    <layer type='DB'>\n"
+                                              "      <!-- <dbdot> in a comment is ignored -->\n"
+                                              "      <dbdot>\n"
+                                              "          <latcoord n='0' m='0' l='0'/>\n"
+                                              "          <type><![CDATA[input]]></type>\n"
+                                              "      </dbdot>\n"
+                                              "      <dbdot>\n"
+                                              "          <latcoord n=\"&#50;\" m=\"0\" l=\"1\"/>\n"
+                                              "          <type>&#x6f;utput</type>\n"
+                                              "      </dbdot>\n"
+                                              "    </layer>\n"
+                                              "  </design>\n"
+                                              "</siqad>\n";
+
+    std::istringstream layout_stream{sqd_layout};
+
+    using sidb_layout = cell_level_layout<sidb_technology, clocked_layout<cartesian_layout<offset::ucoord_t>>>;
+    const auto layout = read_sqd_layout<sidb_lattice<sidb_100_lattice, sidb_layout>>(layout_stream);
+
+    CHECK(layout.num_cells() == 2);
+    CHECK(layout.get_cell_type({0, 0}) == sidb_technology::cell_type::INPUT);
+    CHECK(layout.get_cell_type({2, 1}) == sidb_technology::cell_type::OUTPUT);
+}
+
+TEST_CASE("Read SQD layout from a non-seekable stream", "[sqd]")
+{
+    static constexpr const char* sqd_layout = "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+                                              "<siqad>\n"
+                                              "    <layers>\n"
+                                              "        <layer_prop>\n"
+                                              "            <lat_vec>\n"
+                                              "                <name>Si(100) 2x1</name>\n"
+                                              "            </lat_vec>\n"
+                                              "        </layer_prop>\n"
+                                              "    </layers>\n"
+                                              "  <design>\n"
+                                              "    <layer type=\"DB\">\n"
+                                              "      <dbdot>\n"
+                                              "          <latcoord n=\"1\" m=\"2\" l=\"0\"/>\n"
+                                              "      </dbdot>\n"
+                                              "    </layer>\n"
+                                              "  </design>\n"
+                                              "</siqad>\n";
+
+    // a stream buffer that does not support repositioning, e.g., as used for pipes
+    class forward_only_buffer : public std::stringbuf
+    {
+      public:
+        explicit forward_only_buffer(const std::string& s) : std::stringbuf{s, std::ios_base::in} {}
+
+      protected:
+        pos_type seekoff(off_type /*off*/, std::ios_base::seekdir /*dir*/,
+                         std::ios_base::openmode /*which*/ = std::ios_base::in) override
+        {
+            return pos_type(off_type(-1));
+        }
+
+        pos_type seekpos(pos_type /*pos*/, std::ios_base::openmode /*which*/ = std::ios_base::in) override
+        {
+            return pos_type(off_type(-1));
+        }
+    };
+
+    forward_only_buffer buffer{sqd_layout};
+    std::istream        layout_stream{&buffer};
+
+    using sidb_layout = cell_level_layout<sidb_technology, clocked_layout<cartesian_layout<offset::ucoord_t>>>;
+    const auto layout = read_sqd_layout<sidb_lattice<sidb_100_lattice, sidb_layout>>(layout_stream);
+
+    CHECK(layout.num_cells() == 1);
+    CHECK(layout.get_cell_type({1, 4}) == sidb_technology::cell_type::NORMAL);
+}
+
+TEST_CASE("SQD parsing error: mismatched closing tag", "[sqd]")
+{
+    static constexpr const char* sqd_layout = "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+                                              "<siqad>\n"
+                                              "  <design>\n"
+                                              "    <layer type=\"DB\">\n"
+                                              "  </design>\n"
+                                              "</siqad>\n";
+
+    std::istringstream layout_stream{sqd_layout};
+
+    using sidb_layout = sidb_lattice<
+        sidb_100_lattice,
+        sidb_defect_surface<cell_level_layout<sidb_technology, clocked_layout<cartesian_layout<offset::ucoord_t>>>>>;
+    CHECK_THROWS_AS(read_sqd_layout<sidb_layout>(layout_stream), sqd_parsing_error);
+}
+
+TEST_CASE("SQD parsing error: unexpected end of file", "[sqd]")
+{
+    static constexpr const char* sqd_layout = "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+                                              "<siqad>\n"
+                                              "  <design>\n"
+                                              "    <layer type=\"DB\">\n"
+                                              "      <dbdot>\n"
+                                              "          <latcoord n=\"0\" m=\"0\" l=";
+
+    std::istringstream layout_stream{sqd_layout};
+
+    using sidb_layout = sidb_lattice<
+        sidb_100_lattice,
+        sidb_defect_surface<cell_level_layout<sidb_technology, clocked_layout<cartesian_layout<offset::ucoord_t>>>>>;
+    CHECK_THROWS_AS(read_sqd_layout<sidb_layout>(layout_stream), sqd_parsing_error);
+}
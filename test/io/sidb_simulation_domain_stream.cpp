@@ -0,0 +1,296 @@
+//
+// Created by marcel on 19.10.26.
+//
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <fiction/algorithms/simulation/sidb/defect_influence.hpp>
+#include <fiction/algorithms/simulation/sidb/is_operational.hpp>
+#include <fiction/algorithms/simulation/sidb/operational_domain.hpp>
+#include <fiction/io/sidb_simulation_domain_stream.hpp>
+#include <fiction/types.hpp>
+
+#include <cstddef>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <vector>
+
+using namespace fiction;
+
+namespace
+{
+
+[[nodiscard]] std::string read_file(const std::string& filename)
+{
+    std::ifstream in{filename, std::ios::in | std::ios::binary};
+
+    return {std::istreambuf_iterator<char>{in}, std::istreambuf_iterator<char>{}};
+}
+
+}  // namespace
+
+TEST_CASE("Stream operational domain points", "[sidb-simulation-domain-stream]")
+{
+    const auto filename = (std::filesystem::temp_directory_path() / "fiction_operational_domain_stream").string();
+
+    sidb_simulation_domain_stream_params params{};
+    params.filename       = filename;
+    params.flush_interval = 2;
+
+    const std::vector<std::string> key_columns{"epsilon_r", "lambda_tf"};
+    const std::vector<std::string> value_columns{"operational status"};
+
+    const auto write_points = [&params, &key_columns, &value_columns]()
+    {
+        operational_domain                                opdom{};
+        sidb_simulation_domain_stream<operational_domain> stream{params, key_columns, value_columns, opdom};
+
+        stream.append(parameter_point{{5.5, 5.0}}, {operational_status::OPERATIONAL});
+        stream.append(parameter_point{{5.6, 5.0}}, {operational_status::NON_OPERATIONAL});
+        stream.append(parameter_point{{5.7, 5.1}}, {operational_status::OPERATIONAL});
+
+        CHECK(opdom.empty());
+    };
+
+    SECTION("CSV")
+    {
+        params.format = sidb_simulation_domain_stream_params::stream_format::CSV;
+
+        write_points();
+
+        CHECK(read_file(filename) == "epsilon_r,lambda_tf,operational status\n5.5,5,0\n5.6,5,1\n5.7,5.1,0\n");
+
+        SECTION("resume")
+        {
+            params.resume = true;
+
+            operational_domain opdom{};
+
+            {
+                sidb_simulation_domain_stream<operational_domain> stream{params, key_columns, value_columns, opdom};
+
+                REQUIRE(opdom.size() == 3);
+                CHECK(std::get<0>(opdom.contains(parameter_point{{5.6, 5.0}}).value()) ==
+                      operational_status::NON_OPERATIONAL);
+
+                stream.append(parameter_point{{5.8, 5.1}}, {operational_status::NON_OPERATIONAL});
+            }
+
+            CHECK(read_file(filename) ==
+                  "epsilon_r,lambda_tf,operational status\n5.5,5,0\n5.6,5,1\n5.7,5.1,0\n5.8,5.1,1\n");
+        }
+        SECTION("resume from an incomplete file")
+        {
+            // simulate a crash while the last line was written
+            std::filesystem::resize_file(filename, std::filesystem::file_size(filename) - 2);
+
+            params.resume = true;
+
+            operational_domain opdom{};
+
+            {
+                const sidb_simulation_domain_stream<operational_domain> stream{params, key_columns, value_columns,
+                                                                               opdom};
+
+                CHECK(opdom.size() == 2);
+                CHECK(!opdom.contains(parameter_point{{5.7, 5.1}}).has_value());
+            }
+
+            CHECK(read_file(filename) == "epsilon_r,lambda_tf,operational status\n5.5,5,0\n5.6,5,1\n");
+        }
+        SECTION("resume from a file with a malformed line")
+        {
+            {
+                std::ofstream out{filename, std::ios::out | std::ios::binary | std::ios::trunc};
+                out << "epsilon_r,lambda_tf,operational status\n5.5,5,0\n5.6,five,1\n5.7,5.1\n5.8,5.1,1\n";
+            }
+
+            params.resume = true;
+
+            operational_domain opdom{};
+
+            {
+                sidb_simulation_domain_stream<operational_domain> stream{params, key_columns, value_columns, opdom};
+
+                // only the malformed lines are skipped, whereas the points after them are still loaded
+                CHECK(opdom.size() == 2);
+                CHECK(opdom.contains(parameter_point{{5.5, 5.0}}).has_value());
+                CHECK(opdom.contains(parameter_point{{5.8, 5.1}}).has_value());
+
+                stream.append(parameter_point{{5.9, 5.1}}, {operational_status::OPERATIONAL});
+            }
+
+            CHECK(read_file(filename) ==
+                  "epsilon_r,lambda_tf,operational status\n5.5,5,0\n5.6,five,1\n5.7,5.1\n5.8,5.1,1\n5.9,5.1,0\n");
+        }
+        SECTION("resume with different dimensions")
+        {
+            params.resume = true;
+
+            operational_domain opdom{};
+
+            CHECK_THROWS_AS(sidb_simulation_domain_stream<operational_domain>(
+                                params, std::vector<std::string>{"epsilon_r", "mu_minus"}, value_columns, opdom),
+                            std::invalid_argument);
+        }
+        SECTION("overwrite")
+        {
+            operational_domain opdom{};
+
+            {
+                const sidb_simulation_domain_stream<operational_domain> stream{params, key_columns, value_columns,
+                                                                               opdom};
+            }
+
+            CHECK(opdom.empty());
+            CHECK(read_file(filename) == "epsilon_r,lambda_tf,operational status\n");
+        }
+    }
+    SECTION("binary")
+    {
+        params.format = sidb_simulation_domain_stream_params::stream_format::BINARY;
+
+        write_points();
+
+        const auto file_size = std::filesystem::file_size(filename);
+
+        SECTION("little-endian encoding")
+        {
+            const auto contents = read_file(filename);
+
+            // magic, version, number of key and value columns, value size, and length-prefixed column names
+            const std::size_t header_size = 4 + 1 + 1 + 1 + 1 + (1 + 9) + (1 + 9) + (1 + 18);
+
+            REQUIRE(contents.size() > header_size + 4 + 8);
+            CHECK(contents[4] == 2);
+            // the first block holds two points
+            CHECK(contents.substr(header_size, 4) == std::string{"\x02\x00\x00\x00", 4});
+            // 5.5 is 0x4016000000000000
+            CHECK(contents.substr(header_size + 4, 8) == std::string{"\x00\x00\x00\x00\x00\x00\x16\x40", 8});
+        }
+
+        SECTION("resume")
+        {
+            params.resume = true;
+
+            operational_domain opdom{};
+
+            {
+                const sidb_simulation_domain_stream<operational_domain> stream{params, key_columns, value_columns,
+                                                                               opdom};
+
+                REQUIRE(opdom.size() == 3);
+                CHECK(std::get<0>(opdom.contains(parameter_point{{5.5, 5.0}}).value()) ==
+                      operational_status::OPERATIONAL);
+                CHECK(std::get<0>(opdom.contains(parameter_point{{5.6, 5.0}}).value()) ==
+                      operational_status::NON_OPERATIONAL);
+                CHECK(std::get<0>(opdom.contains(parameter_point{{5.7, 5.1}}).value()) ==
+                      operational_status::OPERATIONAL);
+            }
+
+            CHECK(std::filesystem::file_size(filename) == file_size);
+        }
+        SECTION("resume from an incomplete file")
+        {
+            // the last block holds a single point of two 8-byte keys and one 1-byte value
+            std::filesystem::resize_file(filename, file_size - 1);
+
+            params.resume = true;
+
+            operational_domain opdom{};
+
+            {
+                const sidb_simulation_domain_stream<operational_domain> stream{params, key_columns, value_columns,
+                                                                               opdom};
+
+                CHECK(opdom.size() == 2);
+            }
+
+            CHECK(std::filesystem::file_size(filename) == file_size - 4 - 17);
+        }
+    }
+
+    std::filesystem::remove(filename);
+}
+
+TEST_CASE("Stream critical temperature domain points", "[sidb-simulation-domain-stream]")
+{
+    const auto filename = (std::filesystem::temp_directory_path() / "fiction_ct_domain_stream").string();
+
+    sidb_simulation_domain_stream_params params{};
+    params.filename = filename;
+
+    const std::vector<std::string> key_columns{"epsilon_r"};
+    const std::vector<std::string> value_columns{"operational status", "critical temperature"};
+
+    for (const auto format : {sidb_simulation_domain_stream_params::stream_format::CSV,
+                              sidb_simulation_domain_stream_params::stream_format::BINARY})
+    {
+        params.format = format;
+        params.resume = false;
+
+        {
+            critical_temperature_domain                                ctdom{};
+            sidb_simulation_domain_stream<critical_temperature_domain> stream{params, key_columns, value_columns,
+                                                                              ctdom};
+
+            stream.append(parameter_point{{5.6}}, {operational_status::OPERATIONAL, 123.456789});
+            stream.append(parameter_point{{5.7}}, {operational_status::NON_OPERATIONAL, 0.0});
+        }
+
+        params.resume = true;
+
+        critical_temperature_domain ctdom{};
+
+        const sidb_simulation_domain_stream<critical_temperature_domain> stream{params, key_columns, value_columns,
+                                                                                ctdom};
+
+        REQUIRE(ctdom.size() == 2);
+        CHECK(ctdom.contains(parameter_point{{5.6}}).value() ==
+              std::tuple{operational_status::OPERATIONAL, 123.456789});
+        CHECK(ctdom.contains(parameter_point{{5.7}}).value() == std::tuple{operational_status::NON_OPERATIONAL, 0.0});
+    }
+
+    std::filesystem::remove(filename);
+}
+
+TEST_CASE("Stream defect influence domain points", "[sidb-simulation-domain-stream]")
+{
+    using lattice = sidb_cell_clk_lyt_siqad;
+
+    const auto filename = (std::filesystem::temp_directory_path() / "fiction_defect_influence_stream").string();
+
+    sidb_simulation_domain_stream_params params{};
+    params.filename = filename;
+
+    const std::vector<std::string> key_columns{"x", "y", "z"};
+    const std::vector<std::string> value_columns{"influence status"};
+
+    {
+        defect_influence_domain<lattice>                                defect_infdom{};
+        sidb_simulation_domain_stream<defect_influence_domain<lattice>> stream{params, key_columns, value_columns,
+                                                                               defect_infdom};
+
+        stream.append({-3, 5, 1}, {defect_influence_status::INFLUENTIAL});
+        stream.append({4, 2, 0}, {defect_influence_status::NON_INFLUENTIAL});
+    }
+
+    CHECK(read_file(filename) == "x,y,z,influence status\n-3,5,1,0\n4,2,0,1\n");
+
+    params.resume = true;
+
+    defect_influence_domain<lattice> defect_infdom{};
+
+    const sidb_simulation_domain_stream<defect_influence_domain<lattice>> stream{params, key_columns, value_columns,
+                                                                                 defect_infdom};
+
+    REQUIRE(defect_infdom.size() == 2);
+    CHECK(std::get<0>(defect_infdom.contains({-3, 5, 1}).value()) == defect_influence_status::INFLUENTIAL);
+    CHECK(std::get<0>(defect_infdom.contains({4, 2, 0}).value()) == defect_influence_status::NON_INFLUENTIAL);
+
+    std::filesystem::remove(filename);
+}
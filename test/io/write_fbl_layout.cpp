@@ -0,0 +1,259 @@
+//
+// Created by marcel on 19.10.26.
+//
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "utils/blueprints/layout_blueprints.hpp"
+#include "utils/blueprints/network_blueprints.hpp"
+#include "utils/equivalence_checking_utils.hpp"
+
+#include <fiction/algorithms/physical_design/orthogonal.hpp>
+#include <fiction/io/read_fbl_layout.hpp>
+#include <fiction/io/write_fbl_layout.hpp>
+#include <fiction/layouts/cartesian_layout.hpp>
+#include <fiction/layouts/cell_level_layout.hpp>
+#include <fiction/layouts/clocked_layout.hpp>
+#include <fiction/layouts/clocking_scheme.hpp>
+#include <fiction/layouts/gate_level_layout.hpp>
+#include <fiction/layouts/tile_based_layout.hpp>
+#include <fiction/networks/technology_network.hpp>
+#include <fiction/technology/cell_technologies.hpp>
+#include <fiction/traits.hpp>
+#include <fiction/types.hpp>
+
+#include <mockturtle/networks/aig.hpp>
+
+#include <filesystem>
+#include <sstream>
+
+using namespace fiction;
+
+template <typename Lyt>
+void compare_written_and_read_gate_layout(const Lyt& wlyt, const Lyt& rlyt) noexcept
+{
+    CHECK(wlyt.get_layout_name() == rlyt.get_layout_name());
+
+    CHECK(wlyt.x() == rlyt.x());
+    CHECK(wlyt.y() == rlyt.y());
+    CHECK(wlyt.z() == rlyt.z());
+
+    CHECK(wlyt.num_pis() == rlyt.num_pis());
+    CHECK(wlyt.num_pos() == rlyt.num_pos());
+    CHECK(wlyt.num_gates() == rlyt.num_gates());
+    CHECK(wlyt.num_wires() == rlyt.num_wires());
+
+    CHECK(wlyt.get_clocking_scheme().name == rlyt.get_clocking_scheme().name);
+    CHECK(wlyt.num_clocks() == rlyt.num_clocks());
+
+    wlyt.foreach_tile([&wlyt, &rlyt](const auto& t)
+                      { CHECK(wlyt.get_clock_number(t) == rlyt.get_clock_number(t)); });
+}
+
+template <typename Lyt>
+void compare_written_and_read_cell_layout(const Lyt& wlyt, const Lyt& rlyt) noexcept
+{
+    CHECK(wlyt.get_layout_name() == rlyt.get_layout_name());
+
+    CHECK(wlyt.x() == rlyt.x());
+    CHECK(wlyt.y() == rlyt.y());
+    CHECK(wlyt.z() == rlyt.z());
+
+    CHECK(wlyt.get_tile_size_x() == rlyt.get_tile_size_x());
+    CHECK(wlyt.get_tile_size_y() == rlyt.get_tile_size_y());
+
+    CHECK(wlyt.get_clocking_scheme().name == rlyt.get_clocking_scheme().name);
+    CHECK(wlyt.num_clocks() == rlyt.num_clocks());
+    CHECK(wlyt.is_regularly_clocked() == rlyt.is_regularly_clocked());
+
+    CHECK(wlyt.num_cells() == rlyt.num_cells());
+
+    wlyt.foreach_cell(
+        [&wlyt, &rlyt](const auto& c)
+        {
+            CHECK(wlyt.get_cell_type(c) == rlyt.get_cell_type(c));
+            CHECK(wlyt.get_cell_mode(c) == rlyt.get_cell_mode(c));
+            CHECK(wlyt.get_cell_name(c) == rlyt.get_cell_name(c));
+            CHECK(wlyt.get_clock_number(c) == rlyt.get_clock_number(c));
+        });
+}
+
+template <typename Lyt, typename Ntk>
+void check_parsing_equiv(const Ntk& ntk)
+{
+    const auto layout = orthogonal<Lyt>(ntk, {});
+
+    std::stringstream layout_stream{};
+    write_fbl_layout(layout, layout_stream);
+
+    const auto read_layout = read_fbl_layout<Lyt>(layout_stream);
+
+    compare_written_and_read_gate_layout(layout, read_layout);
+
+    check_eq(ntk, read_layout);
+    check_eq(layout, read_layout);
+}
+
+template <typename Lyt>
+void check_parsing_equiv_layout(const Lyt& lyt)
+{
+    std::stringstream layout_stream{};
+    write_fbl_layout(lyt, layout_stream);
+
+    const auto read_layout = read_fbl_layout<Lyt>(layout_stream);
+
+    compare_written_and_read_gate_layout(lyt, read_layout);
+
+    check_eq(lyt, read_layout);
+}
+
+template <typename Lyt>
+void check_parsing_equiv_cell_layout(const Lyt& lyt)
+{
+    std::stringstream layout_stream{};
+    write_fbl_layout(lyt, layout_stream);
+
+    const auto read_layout = read_fbl_layout<Lyt>(layout_stream);
+
+    compare_written_and_read_cell_layout(lyt, read_layout);
+}
+
+TEST_CASE("Write and read empty gate-level layout", "[write-fbl-layout]")
+{
+    const cart_gate_clk_lyt layout{{}, "empty"};
+
+    std::stringstream layout_stream{};
+    write_fbl_layout(layout, layout_stream);
+
+    const auto read_layout = read_fbl_layout<cart_gate_clk_lyt>(layout_stream);
+
+    compare_written_and_read_gate_layout(layout, read_layout);
+}
+
+TEST_CASE("Write and read gate-level layouts", "[write-fbl-layout]")
+{
+    SECTION("Physical design results")
+    {
+        check_parsing_equiv<cart_gate_clk_lyt>(blueprints::maj4_network<mockturtle::aig_network>());
+        check_parsing_equiv<cart_gate_clk_lyt>(blueprints::unbalanced_and_inv_network<mockturtle::aig_network>());
+        check_parsing_equiv<cart_gate_clk_lyt>(blueprints::nary_operation_network<technology_network>());
+        check_parsing_equiv<cart_gate_clk_lyt>(blueprints::full_adder_network<technology_network>());
+        check_parsing_equiv<cart_gate_clk_lyt>(blueprints::mux21_network<technology_network>());
+        check_parsing_equiv<cart_gate_clk_lyt>(blueprints::nand_xnor_network<technology_network>());
+    }
+    SECTION("Blueprints")
+    {
+        check_parsing_equiv_layout(blueprints::xor_maj_gate_layout<cart_gate_clk_lyt>());
+        check_parsing_equiv_layout(blueprints::tautology_gate_layout<cart_gate_clk_lyt>());
+        check_parsing_equiv_layout(blueprints::crossing_layout<cart_gate_clk_lyt>());
+        check_parsing_equiv_layout(blueprints::fanout_layout<cart_gate_clk_lyt>());
+        check_parsing_equiv_layout(blueprints::use_and_gate_layout<cart_gate_clk_lyt>());
+        check_parsing_equiv_layout(blueprints::res_maj_gate_layout<cart_gate_clk_lyt>());
+        check_parsing_equiv_layout(blueprints::and_or_gate_layout<cart_odd_row_gate_clk_lyt>());
+        check_parsing_equiv_layout(blueprints::and_or_gate_layout<cart_even_col_gate_clk_lyt>());
+        check_parsing_equiv_layout(blueprints::and_or_gate_layout<hex_odd_col_gate_clk_lyt>());
+        check_parsing_equiv_layout(blueprints::and_or_gate_layout<hex_even_row_gate_clk_lyt>());
+        check_parsing_equiv_layout(blueprints::shifted_cart_and_or_inv_gate_layout<cart_odd_col_gate_clk_lyt>());
+        check_parsing_equiv_layout(blueprints::row_clocked_and_xor_gate_layout<cart_even_row_gate_clk_lyt>());
+    }
+    SECTION("Irregular clocking")
+    {
+        check_parsing_equiv_layout(blueprints::open_tautology_gate_layout<hex_even_row_gate_clk_lyt>());
+    }
+}
+
+TEST_CASE("Write gate-level layout with gates without incoming signals", "[write-fbl-layout]")
+{
+    // such gates cannot be read again and, hence, have to be rejected when writing
+    cart_gate_clk_lyt layout{{2, 2}, twoddwave_clocking<cart_gate_clk_lyt>(), "unconnected"};
+
+    SECTION("Constant fanin")
+    {
+        layout.create_po(layout.get_constant(true), "f", {1, 0});
+
+        std::stringstream layout_stream{};
+        CHECK_THROWS_AS(write_fbl_layout(layout, layout_stream), fbl_write_error);
+    }
+    SECTION("Fanin on a non-adjacent tile")
+    {
+        const auto a = layout.create_pi("a", {0, 0});
+        const auto w = layout.create_buf(a, {1, 0});
+        layout.create_po(w, "f", {2, 0});
+
+        check_parsing_equiv_layout(layout);
+
+        layout.create_not(a, {2, 2});
+
+        std::stringstream layout_stream{};
+        CHECK_THROWS_AS(write_fbl_layout(layout, layout_stream), fbl_write_error);
+    }
+}
+
+TEST_CASE("Write and read SiDB cell-level layout", "[write-fbl-layout]")
+{
+    sidb_100_cell_clk_lyt layout{{20, 10}, "SiDB layout"};
+
+    layout.assign_cell_type({0, 0}, sidb_technology::cell_type::INPUT);
+    layout.assign_cell_type({2, 1, 1}, sidb_technology::cell_type::NORMAL);
+    layout.assign_cell_type({10, 4}, sidb_technology::cell_type::LOGIC);
+    layout.assign_cell_type({20, 10}, sidb_technology::cell_type::OUTPUT);
+    layout.assign_cell_name({0, 0}, "a");
+    layout.assign_cell_name({20, 10}, "f");
+
+    check_parsing_equiv_cell_layout(layout);
+
+    SECTION("Memory-mapped file")
+    {
+        const auto filename = (std::filesystem::temp_directory_path() / "fiction_write_fbl_layout.fbl").string();
+
+        write_fbl_layout(layout, filename);
+
+        const auto read_layout = read_fbl_layout<sidb_100_cell_clk_lyt>(filename);
+
+        compare_written_and_read_cell_layout(layout, read_layout);
+
+        std::filesystem::remove(filename);
+    }
+    SECTION("Files are reproducible")
+    {
+        std::stringstream first_stream{};
+        std::stringstream second_stream{};
+
+        write_fbl_layout(layout, first_stream);
+        write_fbl_layout(read_fbl_layout<sidb_100_cell_clk_lyt>(first_stream), second_stream);
+
+        CHECK(first_stream.str() == second_stream.str());
+    }
+}
+
+TEST_CASE("Write and read QCA cell-level layout", "[write-fbl-layout]")
+{
+    qca_cell_clk_lyt layout{{9, 9, 1}, open_clocking<qca_cell_clk_lyt>(num_clks::THREE), "QCA layout", 5, 5};
+
+    layout.assign_cell_type({1, 1}, qca_technology::cell_type::INPUT);
+    layout.assign_cell_type({2, 1}, qca_technology::cell_type::NORMAL);
+    layout.assign_cell_mode({2, 1}, qca_technology::cell_mode::VERTICAL);
+    layout.assign_cell_type({2, 1, 1}, qca_technology::cell_type::NORMAL);
+    layout.assign_cell_mode({2, 1, 1}, qca_technology::cell_mode::CROSSOVER);
+    layout.assign_cell_type({6, 6}, qca_technology::cell_type::CONST_1);
+    layout.assign_cell_type({9, 9}, qca_technology::cell_type::OUTPUT);
+    layout.assign_cell_name({1, 1}, "a");
+    layout.assign_cell_name({9, 9}, "f");
+
+    layout.assign_clock_number({0, 0}, 2);
+    layout.assign_clock_number({1, 1}, 1);
+
+    check_parsing_equiv_cell_layout(layout);
+}
+
+TEST_CASE("Write and read iNML cell-level layout", "[write-fbl-layout]")
+{
+    inml_cell_clk_lyt layout{{4, 2}, twoddwave_clocking<inml_cell_clk_lyt>(), "iNML layout"};
+
+    layout.assign_cell_type({0, 0}, inml_technology::cell_type::INPUT);
+    layout.assign_cell_type({1, 0}, inml_technology::cell_type::NORMAL);
+    layout.assign_cell_type({2, 0}, inml_technology::cell_type::INVERTER_MAGNET);
+    layout.assign_cell_type({3, 0}, inml_technology::cell_type::OUTPUT);
+
+    check_parsing_equiv_cell_layout(layout);
+}
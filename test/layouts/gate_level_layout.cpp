@@ -16,6 +16,7 @@
 #include <kitty/dynamic_truth_table.hpp>
 #include <mockturtle/traits.hpp>
 
+#include <algorithm>
 #include <type_traits>
 
 using namespace fiction;
@@ -1359,3 +1360,155 @@ TEST_CASE("Gate-level cardinal operations", "[gate-level-layout]")
     CHECK(layout.has_western_incoming_signal({3, 1}));
     CHECK(layout.has_western_incoming_signal({3, 2}));
 }
+
+TEST_CASE("Dense tile storage", "[gate-level-layout]")
+{
+    using sparse_layout = gate_level_layout<clocked_layout<tile_based_layout<cartesian_layout<offset::ucoord_t>>>>;
+    using dense_layout =
+        gate_level_layout<clocked_layout<tile_based_layout<cartesian_layout<offset::ucoord_t>>>, dense_tile_storage>;
+
+    CHECK(fiction::is_gate_level_layout_v<dense_layout>);
+
+    const auto check_equivalent_mapping = [](const sparse_layout& sparse, const dense_layout& dense)
+    {
+        CHECK(sparse.num_gates() == dense.num_gates());
+        CHECK(sparse.num_wires() == dense.num_wires());
+        CHECK(sparse.num_crossings() == dense.num_crossings());
+
+        for (auto z = 0u; z <= 1u; ++z)
+        {
+            for (auto y = 0u; y <= std::max(sparse.y(), dense.y()) + 1; ++y)
+            {
+                for (auto x = 0u; x <= std::max(sparse.x(), dense.x()) + 1; ++x)
+                {
+                    const tile<dense_layout> t{x, y, z};
+
+                    CHECK(sparse.get_node(t) == dense.get_node(t));
+                    CHECK(sparse.is_empty_tile(t) == dense.is_empty_tile(t));
+                }
+            }
+        }
+
+        for (auto n = 0u; n < sparse.size(); ++n)
+        {
+            CHECK(sparse.get_tile(n) == dense.get_tile(n));
+        }
+
+        CHECK(dense.get_node(dense.get_constant(false)) == 0);
+        CHECK(dense.get_node(dense.get_constant(true)) == 1);
+    };
+
+    const auto build = [](auto& layout)
+    {
+        const auto x1 = layout.create_pi("x1", {0, 0});
+        const auto x2 = layout.create_pi("x2", {1, 1});
+        const auto a  = layout.create_and(x1, x2, {1, 0});
+        const auto w1 = layout.create_buf(a, {2, 0});
+        const auto w2 = layout.create_buf(x2, {2, 1});
+        const auto w3 = layout.create_buf(w1, {2, 1, 1});  // crossing
+        const auto o  = layout.create_or(w2, w3, {3, 1});
+        layout.create_po(o, "f", {3, 2});
+    };
+
+    sparse_layout sparse{{3, 2, 1}, twoddwave_clocking<sparse_layout>()};
+    dense_layout  dense{{3, 2, 1}, twoddwave_clocking<dense_layout>()};
+
+    build(sparse);
+    build(dense);
+
+    check_equivalent_mapping(sparse, dense);
+
+    SECTION("Clearing and moving nodes")
+    {
+        sparse.clear_tile({3, 2});
+        dense.clear_tile({3, 2});
+
+        sparse.move_node(sparse.get_node({3, 1}), {3, 2}, {sparse.make_signal(sparse.get_node({2, 1}))});
+        dense.move_node(dense.get_node({3, 1}), {3, 2}, {dense.make_signal(dense.get_node({2, 1}))});
+
+        check_equivalent_mapping(sparse, dense);
+    }
+    SECTION("Growing beyond the initial bounds")
+    {
+        // assign nodes outside the layout's dimensions without resizing first
+        sparse.create_pi("x3", {10, 7});
+        dense.create_pi("x3", {10, 7});
+
+        // exceed a single dimension only
+        sparse.create_pi("x4", {1, 40});
+        dense.create_pi("x4", {1, 40});
+        sparse.create_pi("x5", {30, 0});
+        dense.create_pi("x5", {30, 0});
+
+        sparse.resize({10, 7, 1});
+        dense.resize({10, 7, 1});
+
+        sparse.move_node(sparse.get_node({0, 0}), {9, 6});
+        dense.move_node(dense.get_node({0, 0}), {9, 6});
+
+        check_equivalent_mapping(sparse, dense);
+
+        CHECK(dense.is_pi_tile({10, 7}));
+        CHECK(dense.is_pi_tile({1, 40}));
+        CHECK(dense.is_pi_tile({30, 0}));
+        CHECK(dense.is_pi_tile({9, 6}));
+        CHECK(dense.is_empty_tile({0, 0}));
+    }
+    SECTION("Reserved node storage")
+    {
+        sparse_layout reserved_sparse{{3, 2, 1}, twoddwave_clocking<sparse_layout>()};
+        dense_layout  reserved_dense{{3, 2, 1}, twoddwave_clocking<dense_layout>()};
+
+        // reserving fewer nodes than are created is fine as well
+        reserved_sparse.reserve_nodes(4);
+        reserved_dense.reserve_nodes(20);
+
+        CHECK(reserved_dense.size() == 2);
+        CHECK(reserved_dense.is_empty());
+
+        build(reserved_sparse);
+        build(reserved_dense);
+
+        check_equivalent_mapping(reserved_sparse, reserved_dense);
+        check_equivalent_mapping(sparse, reserved_dense);
+    }
+    SECTION("Deep copy")
+    {
+        auto copy = dense.clone();
+        copy.clear_tile({0, 0});
+
+        CHECK(!dense.is_empty_tile({0, 0}));
+        CHECK(copy.is_empty_tile({0, 0}));
+    }
+    SECTION("Conversion between storage policies")
+    {
+        static_assert(std::is_same_v<with_tile_storage_t<sparse_layout, dense_tile_storage>, dense_layout>);
+        static_assert(std::is_same_v<with_tile_storage_t<dense_layout, sparse_tile_storage>, sparse_layout>);
+
+        // dense tile storage requires offset coordinates; other layouts are kept as they are
+        using cube_layout = gate_level_layout<clocked_layout<tile_based_layout<cartesian_layout<cube::coord_t>>>>;
+        static_assert(std::is_same_v<with_tile_storage_t<cube_layout, dense_tile_storage>, cube_layout>);
+
+        sparse.set_layout_name("converted");
+
+        const dense_layout  converted_dense{sparse};
+        const sparse_layout converted_sparse{dense};
+
+        check_equivalent_mapping(sparse, converted_dense);
+        check_equivalent_mapping(converted_sparse, dense);
+
+        CHECK(converted_dense.get_layout_name() == "converted");
+        CHECK(converted_dense.get_name(converted_dense.get_node({3, 2})) == "f");
+        CHECK(converted_dense.is_clocking_scheme(clock_name::TWODDWAVE));
+        CHECK(converted_dense.is_and(converted_dense.get_node({1, 0})));
+        CHECK(converted_dense.is_or(converted_dense.get_node({3, 1})));
+        CHECK(converted_dense.num_pis() == 2);
+        CHECK(converted_dense.num_pos() == 1);
+
+        // the converted layout is a deep copy
+        sparse.clear_tile({0, 0});
+
+        CHECK(sparse.is_empty_tile({0, 0}));
+        CHECK(!converted_dense.is_empty_tile({0, 0}));
+    }
+}
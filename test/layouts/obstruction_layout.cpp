@@ -486,3 +486,37 @@ TEST_CASE("Connection obstruction", "[obstruction-layout]")
         CHECK(!obstr_lyt.is_obstructed_connection({3, 3}, {2, 3}));
     }
 }
+
+TEST_CASE("Deep copy obstruction layout", "[obstruction-layout]")
+{
+    using layout = gate_level_layout<clocked_layout<cartesian_layout<offset::ucoord_t>>>;
+
+    const auto lyt = blueprints::xor_maj_gate_layout<layout>();
+
+    obstruction_layout obstr_lyt{lyt};
+    obstr_lyt.obstruct_coordinate({0, 1});
+    obstr_lyt.obstruct_connection({0, 2}, {1, 2});
+
+    auto copy = obstr_lyt.clone();
+
+    CHECK(copy.is_obstructed_coordinate({0, 1}));
+    CHECK(copy.is_obstructed_connection({0, 2}, {1, 2}));
+
+    // modifications of the copy must not affect the original
+    copy.clear_obstructed_coordinate({0, 1});
+    copy.obstruct_coordinate({3, 2});
+    copy.clear_tile({1, 1});
+
+    CHECK(!copy.is_obstructed_coordinate({0, 1}));
+    CHECK(copy.is_obstructed_coordinate({3, 2}));
+    CHECK(!copy.is_obstructed_coordinate({1, 1}));
+
+    CHECK(obstr_lyt.is_obstructed_coordinate({0, 1}));
+    CHECK(!obstr_lyt.is_obstructed_coordinate({3, 2}));
+    CHECK(obstr_lyt.is_obstructed_coordinate({1, 1}));
+
+    // and vice versa
+    obstr_lyt.clear_obstructed_connection({0, 2}, {1, 2});
+
+    CHECK(copy.is_obstructed_connection({0, 2}, {1, 2}));
+}
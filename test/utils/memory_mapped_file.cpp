@@ -0,0 +1,51 @@
+//
+// Created by marcel on 19.10.26.
+//
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <fiction/utils/memory_mapped_file.hpp>
+
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <string_view>
+
+using namespace fiction;
+
+TEST_CASE("Memory-mapped file", "[memory-mapped-file]")
+{
+    const auto filename = (std::filesystem::temp_directory_path() / "fiction_memory_mapped_file.txt").string();
+
+    SECTION("non-empty file")
+    {
+        const std::string contents{"[[0 1]\n [2 0]]\n"};
+
+        {
+            std::ofstream file{filename, std::ios::binary};
+            file << contents;
+        }
+
+        const memory_mapped_file file{filename};
+
+        CHECK(file.view() == contents);
+    }
+    SECTION("empty file")
+    {
+        {
+            const std::ofstream file{filename};
+        }
+
+        const memory_mapped_file file{filename};
+
+        CHECK(file.view().empty());
+    }
+    SECTION("missing file")
+    {
+        std::filesystem::remove(filename);
+
+        CHECK_THROWS_AS(memory_mapped_file{filename}, std::ifstream::failure);
+    }
+
+    std::filesystem::remove(filename);
+}
@@ -0,0 +1,231 @@
+//
+// Created by marcel on 19.10.26.
+//
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <fiction/utils/performance_profile.hpp>
+
+#include <nlohmann/json.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+FICTION_TRACK_GLOBAL_ALLOCATIONS()
+
+using namespace fiction;
+
+namespace
+{
+
+// prevents the compiler from eliding allocations whose results are never used
+void* volatile sink = nullptr;
+
+}  // namespace
+
+TEST_CASE("Empty performance profile", "[performance-profile]")
+{
+    const performance_profile profile{};
+
+    CHECK(profile.empty());
+    CHECK(!profile.get_phase("phase").has_value());
+    CHECK(profile.get_counter("counter") == 0);
+    CHECK(!profile.get_memory_usage().has_value());
+
+    std::ostringstream out{};
+    profile.report(out);
+
+    CHECK(out.str().empty());
+    CHECK(nlohmann::json(profile) == nlohmann::json::object());
+}
+
+TEST_CASE("Phases and counters", "[performance-profile]")
+{
+    performance_profile profile{};
+
+    SECTION("phase timers")
+    {
+        for (auto i = 0u; i < 3; ++i)
+        {
+            const auto timer = profile.time_phase("phase");
+
+            std::this_thread::sleep_for(std::chrono::milliseconds{1});
+        }
+
+        const auto phase = profile.get_phase("phase");
+
+        REQUIRE(phase.has_value());
+        CHECK(phase->num_calls == 3);
+        CHECK(phase->time >= std::chrono::milliseconds{3});
+        CHECK(!profile.empty());
+    }
+    SECTION("call with phase timer")
+    {
+        const auto result = profile.call_with_phase_timer("phase", [] { return 42; });
+
+        CHECK(result == 42);
+        REQUIRE(profile.get_phase("phase").has_value());
+        CHECK(profile.get_phase("phase")->num_calls == 1);
+    }
+    SECTION("manually added phase times")
+    {
+        profile.add_phase_time("phase", std::chrono::seconds{1}, 2);
+        profile.add_phase_time("phase", std::chrono::seconds{2});
+
+        const auto phase = profile.get_phase("phase");
+
+        REQUIRE(phase.has_value());
+        CHECK(phase->num_calls == 3);
+        CHECK(phase->time == std::chrono::seconds{3});
+    }
+    SECTION("counters")
+    {
+        profile.increment("counter");
+        profile.increment("counter", 41);
+
+        CHECK(profile.get_counter("counter") == 42);
+        CHECK(profile.get_counter("other counter") == 0);
+    }
+}
+
+TEST_CASE("Memory tracking", "[performance-profile]")
+{
+    performance_profile profile{};
+
+    SECTION("global allocations")
+    {
+        {
+            const auto memory = profile.track_memory();
+
+            const auto ptr = std::make_unique<std::vector<uint64_t>>(1024);
+            sink           = ptr->data();
+        }
+
+        const auto usage = profile.get_memory_usage();
+
+        REQUIRE(usage.has_value());
+        CHECK(usage->num_allocations >= 2);
+        CHECK(usage->num_deallocations >= 2);
+        CHECK(usage->bytes_allocated >= 1024 * sizeof(uint64_t));
+
+#if defined(__unix__) || defined(__APPLE__)
+        REQUIRE(usage->peak_resident_set_size.has_value());
+        CHECK(*usage->peak_resident_set_size > 0);
+#endif
+    }
+    SECTION("tracking allocator")
+    {
+        const auto& counters    = global_allocation_counters();
+        const auto  allocations = counters.num_allocations.load();
+        const auto  bytes       = counters.bytes_allocated.load();
+
+        {
+            std::vector<uint32_t, tracking_allocator<uint32_t>> v{};
+            v.reserve(100);
+            sink = v.data();
+        }
+
+        // the tracking allocator and the global operator new both record the allocation
+        CHECK(counters.num_allocations.load() - allocations >= 2);
+        CHECK(counters.bytes_allocated.load() - bytes >= 2 * 100 * sizeof(uint32_t));
+    }
+}
+
+TEST_CASE("Merging and copying performance profiles", "[performance-profile]")
+{
+    performance_profile p1{};
+    p1.add_phase_time("a", std::chrono::seconds{1});
+    p1.increment("x", 2);
+
+    performance_profile p2{};
+    p2.add_phase_time("a", std::chrono::seconds{2});
+    p2.add_phase_time("b", std::chrono::seconds{3});
+    p2.increment("x", 3);
+    p2.increment("y");
+
+    p1.merge(p2);
+
+    CHECK(p1.get_phase("a")->time == std::chrono::seconds{3});
+    CHECK(p1.get_phase("a")->num_calls == 2);
+    CHECK(p1.get_phase("b")->time == std::chrono::seconds{3});
+    CHECK(p1.get_counter("x") == 5);
+    CHECK(p1.get_counter("y") == 1);
+
+    // merging a profile into itself does not change it
+    p1.merge(p1);
+    CHECK(p1.get_counter("x") == 5);
+
+    const performance_profile copy{p1};
+    CHECK(copy.get_counter("x") == 5);
+    CHECK(copy.get_phase("b")->time == std::chrono::seconds{3});
+
+    performance_profile assigned{};
+    assigned = p2;
+    CHECK(assigned.get_counter("x") == 3);
+    CHECK(!assigned.get_phase("c").has_value());
+}
+
+TEST_CASE("Concurrent reporting to a performance profile", "[performance-profile]")
+{
+    performance_profile profile{};
+
+    const auto num_threads = 4u;
+    const auto num_updates = 1000u;
+
+    std::vector<std::thread> threads{};
+    threads.reserve(num_threads);
+
+    for (auto t = 0u; t < num_threads; ++t)
+    {
+        threads.emplace_back(
+            [&profile]
+            {
+                for (auto i = 0u; i < num_updates; ++i)
+                {
+                    const auto timer = profile.time_phase("phase");
+
+                    profile.increment("counter");
+                }
+            });
+    }
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    CHECK(profile.get_counter("counter") == num_threads * num_updates);
+    CHECK(profile.get_phase("phase")->num_calls == num_threads * num_updates);
+}
+
+TEST_CASE("Performance profile to JSON", "[performance-profile]")
+{
+    performance_profile profile{};
+    profile.add_phase_time("phase", std::chrono::milliseconds{1500}, 3);
+    profile.increment("counter", 7);
+    profile.set_memory_usage({1024, 5, 4, 256});
+
+    const nlohmann::json j = profile;
+
+    CHECK(j["phases"]["phase"]["time in seconds"].get<double>() == 1.5);
+    CHECK(j["phases"]["phase"]["calls"].get<uint64_t>() == 3);
+    CHECK(j["counters"]["counter"].get<uint64_t>() == 7);
+    CHECK(j["memory"]["peak resident set size in bytes"].get<uint64_t>() == 1024);
+    CHECK(j["memory"]["allocations"].get<uint64_t>() == 5);
+    CHECK(j["memory"]["deallocations"].get<uint64_t>() == 4);
+    CHECK(j["memory"]["bytes allocated"].get<uint64_t>() == 256);
+
+    std::ostringstream out{};
+    profile.report(out);
+
+    CHECK(out.str() == "[i] phase 'phase': 1.5000 secs in 3 call(s)\n"
+                       "[i] counter 'counter': 7\n"
+                       "[i] peak resident set size: 0.00 MiB\n"
+                       "[i] allocations: 5 (256 bytes), deallocations: 4\n");
+}
@@ -10,6 +10,8 @@
 #include <fiction/utils/stl_utils.hpp>
 
 #include <array>
+#include <cstddef>
+#include <functional>
 #include <iterator>
 #include <vector>
 
@@ -76,3 +78,79 @@ TEST_CASE("Test find_first_two_of with layout_coordinate_paths", "[first_first_t
     CHECK(it3 == p1.begin());
     CHECK(it4 == std::next(p2.begin(), 1));
 }
+
+TEST_CASE("Indexed d-ary heap", "[indexed_d_ary_heap]")
+{
+    SECTION("push and pop")
+    {
+        indexed_d_ary_heap<int> heap{};
+
+        CHECK(heap.empty());
+
+        heap.push(3, 30);
+        heap.push(0, 5);
+        heap.push(7, 12);
+        heap.push(1, 20);
+        heap.push(5, 1);
+
+        CHECK(heap.size() == 5);
+        CHECK(heap.contains(7));
+        CHECK(!heap.contains(2));
+        CHECK(!heap.contains(100));
+
+        CHECK(heap.top() == 5);
+        CHECK(heap.top_priority() == 1);
+        CHECK(heap.priority(1) == 20);
+
+        std::vector<std::size_t> order{};
+        while (!heap.empty())
+        {
+            order.push_back(heap.pop());
+        }
+
+        CHECK(order == std::vector<std::size_t>{5, 0, 7, 1, 3});
+        CHECK(!heap.contains(5));
+    }
+    SECTION("decrease-key and update")
+    {
+        indexed_d_ary_heap<int, 2> heap{10};
+
+        for (std::size_t h = 0; h < 10; ++h)
+        {
+            heap.push(h, static_cast<int>(10 * h));
+        }
+
+        heap.decrease_key(9, -1);
+        CHECK(heap.top() == 9);
+
+        heap.update(9, 55);
+        heap.update(0, 100);
+        CHECK(heap.priority(9) == 55);
+
+        std::vector<std::size_t> order{};
+        while (!heap.empty())
+        {
+            order.push_back(heap.pop());
+        }
+
+        CHECK(order == std::vector<std::size_t>{1, 2, 3, 4, 5, 9, 6, 7, 8, 0});
+    }
+    SECTION("max-heap and clear")
+    {
+        indexed_d_ary_heap<double, 3, std::greater<double>> heap{};
+
+        heap.push(0, 1.5);
+        heap.push(1, 4.5);
+        heap.push(2, 2.5);
+
+        CHECK(heap.top() == 1);
+
+        heap.clear();
+
+        CHECK(heap.empty());
+        CHECK(!heap.contains(1));
+
+        heap.push(1, 0.5);
+        CHECK(heap.top() == 1);
+    }
+}